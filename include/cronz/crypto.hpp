@@ -16,8 +16,13 @@
  * @ingroup cronz
  */
 
+#include "cronz/crypto/base32.hpp"
 #include "cronz/crypto/base64.hpp"
+#include "cronz/crypto/base64/stream.hpp"
+#include "cronz/crypto/hash.hpp"
 #include "cronz/crypto/hex.hpp"
+#include "cronz/crypto/hmac.hpp"
+#include "cronz/crypto/sha.hpp"
 #include "cronz/crypto/types.hpp"
 
 #endif // CRONZ_CRYPTO_HPP
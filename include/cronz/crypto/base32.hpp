@@ -0,0 +1,270 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_BASE32_HPP
+#define CRONZ_CRYPTO_BASE32_HPP 1
+
+/**
+ * @defgroup cronz_crypto_base32 Base32
+ * @ingroup cronz_crypto
+ * @remark Follows the instructions from [RC4648](https://datatracker.ietf.org/doc/html/rfc4648).
+ */
+
+#include "cronz/crypto/base64.hpp"
+#include "cronz/crypto/types.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    /**
+     * @name Generic.
+     */
+    /** @{ */
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Base32 alphabet type.
+     * @typedef std::array<char, static_cast<std::size_t>(32)> Base32AlphabetType
+     */
+    typedef std::array<char, static_cast<std::size_t>(32)> Base32AlphabetType;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Base32 indices map type.
+     * @typedef std::array<char, static_cast<std::size_t>(256)> Base32IndicesMapType
+     */
+    typedef std::array<char, static_cast<std::size_t>(256)> Base32IndicesMapType;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Value of the characters that are not in the alphabet within a `Base32IndicesMapType`.
+     * @remark Every index fits in 5 bits, so the high bit alone tells the invalid characters apart.
+     */
+    inline static constexpr char Base32InvalidIndex = static_cast<char>(0xFF);
+
+    /**
+     * @brief Generates a `Base32IndicesMapType` from a `Base32AlphabetType`.
+     * @param[in] alphabet Instance of `Base32AlphabetType`.
+     * @param[in] caseInsensitive Whether the letters of the alphabet are also mapped in the other case, unless that
+     * character is in the alphabet itself.
+     * @return Instance of `Base32IndicesMapType`, in which the characters that are not in the alphabet are
+     * `Base32InvalidIndex`.
+     */
+    inline constexpr Base32IndicesMapType GenerateBase32IndicesMap(const Base32AlphabetType &alphabet,
+                                                                   const bool &caseInsensitive = false) noexcept {
+        Base32IndicesMapType b32map;
+
+        b32map.fill(Base32InvalidIndex);
+
+        if (caseInsensitive) {
+            char index = 0;
+            for (const char &character : alphabet) {
+                if ('A' <= character && 'Z' >= character)
+                    b32map[static_cast<unsigned char>(character - 'A' + 'a')] = index;
+                else if ('a' <= character && 'z' >= character)
+                    b32map[static_cast<unsigned char>(character - 'a' + 'A')] = index;
+
+                ++index;
+            }
+        }
+
+        char index = 0;
+        for (const char &character : alphabet)
+            b32map[static_cast<unsigned char>(character)] = index++;
+
+        return b32map;
+    }
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Default Base32 alphabet.
+     * @see [Base 32 Encoding](https://datatracker.ietf.org/doc/html/rfc4648#section-6).
+     */
+    inline static constexpr Base32AlphabetType Base32Alphabet = {
+            'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U',
+            'V', 'W', 'X', 'Y', 'Z', '2', '3', '4', '5', '6', '7'
+    };
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Default Base32 indices map.
+     * @remark Lowercase letters are accepted as well, as Base32 is meant for case-insensitive contexts.
+     */
+    inline static constexpr Base32IndicesMapType Base32AlphabetIndicesMap = GenerateBase32IndicesMap(Base32Alphabet,
+                                                                                                     true);
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Base32 alphabet with extended hex digits, which keeps the sort order of the encoded data.
+     * @see [Base 32 Encoding with Extended Hex Alphabet](https://datatracker.ietf.org/doc/html/rfc4648#section-7).
+     */
+    inline static constexpr Base32AlphabetType Base32HexAlphabet = {
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K',
+            'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V'
+    };
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Base32 indices map with extended hex digits.
+     * @remark Lowercase letters are accepted as well, as Base32 is meant for case-insensitive contexts.
+     */
+    inline static constexpr Base32IndicesMapType Base32HexAlphabetIndicesMap = GenerateBase32IndicesMap(
+            Base32HexAlphabet, true);
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Character to be used for padding Base32 encoded strings.
+     */
+    inline static constexpr char Base32PaddingCharacter = '=';
+
+    /** @} */
+
+    /**
+     * @name Encoding.
+     */
+    /** @{ */
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Tells the required length for an encoded Base32 string.
+     * @tparam Padded Should the length calculated for a padded version.
+     * @param[in] length Length of the data to be encoded.
+     * @return Required length for an encoded Base32 string.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase32EncodedLength(const std::size_t &length) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Tells the required length for an encoded Base32 string.
+     * @param[in] length Length of the data to be encoded.
+     * @param[in] padded Should the length calculated for a padded version.
+     * @return Required length for an encoded Base32 string.
+     */
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase32EncodedLength(const std::size_t &length,
+                                                                          const bool &padded) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Encodes data into a caller-provided buffer.
+     * @tparam Padded Whether the encoded data should be padded.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold `CalculateBase32EncodedLength<Padded>` of the
+     * data length.
+     * @param[out] written Number of characters written.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     * @remark No memory is allocated, and no terminating null character is written.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L2 bool Base32Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                         std::size_t &written,
+                                         const Base32AlphabetType &alphabet = Base32Alphabet) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Encodes data into a caller-provided buffer.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold `CalculateBase32EncodedLength` of the data
+     * length.
+     * @param[out] written Number of characters written.
+     * @param[in] padded Whether the encoded data should be padded.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     */
+    CRONZ_NODISCARD_L2 bool Base32Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                         std::size_t &written, const bool &padded,
+                                         const Base32AlphabetType &alphabet = Base32Alphabet) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Encodes a string.
+     * @tparam Padded Whether the encoded string should be padded.
+     * @param[in] str String to be encoded.
+     * @param[in] alphabet Alphabet to be used, e.g. `Base32Alphabet` or `Base32HexAlphabet`.
+     * @return Encoded Base32 string. Upon failure, the returned string will be empty.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L1 std::string Base32Encode(const std::string &str,
+                                                const Base32AlphabetType &alphabet = Base32Alphabet) noexcept;
+
+    /** @} */
+
+    /**
+     * @name Decoding.
+     */
+    /** @{ */
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Requirements for the Base32 decoding return type.
+     * @tparam ReturnType Return type.
+     */
+    template <typename ReturnType>
+    concept Base32DecodeReturnTypeRequirement = std::is_same_v<std::string, ReturnType> ||
+                                                std::is_same_v<std::vector<char>, ReturnType> ||
+                                                std::is_same_v<std::vector<unsigned char>, ReturnType>;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Tells the maximum decoded length of a Base32 encoded string.
+     * @param[in] length Length of the Base32 encoded string, without its padding.
+     * @return Decoded length.
+     */
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase32DecodedLength(const std::size_t &length) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Tells the decoded length of a Base32 encoded string.
+     * @param[in] encoded Base32 encoded string.
+     * @param[in] length Length of the Base32 encoded string.
+     * @return Decoded length, which is exact for valid strings.
+     */
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase32DecodedLength(const char *encoded,
+                                                                          const std::size_t &length) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Decodes a Base32 encoded string into a caller-provided buffer.
+     * @param[in] encoded Base32 encoded string. The last group may be padded or not.
+     * @param[out] decoded Buffer of the decoded bytes. Must hold `CalculateBase32DecodedLength` of `encoded`.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     * @remark No memory is allocated.
+     */
+    CRONZ_NODISCARD_L2 bool Base32Decode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                                         std::size_t &written,
+                                         const Base32IndicesMapType &alphabet = Base32AlphabetIndicesMap) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base32
+     * @brief Decodes a Base32 encoded string.
+     * @tparam ReturnType Output data type.
+     * @param[in] encoded Base32 encoded string. The last group may be padded or not.
+     * @param[out] decoded Decoded data.
+     * @param[in] alphabet Alphabet to be used, e.g. `Base32AlphabetIndicesMap` or `Base32HexAlphabetIndicesMap`.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     */
+    template <typename ReturnType = std::string>
+        requires Base32DecodeReturnTypeRequirement<ReturnType>
+    CRONZ_NODISCARD_L2 bool Base32Decode(const std::string &encoded, ReturnType &decoded,
+                                         const Base32IndicesMapType &alphabet = Base32AlphabetIndicesMap) noexcept;
+
+    /** @} */
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/crypto/impl/base32.ipp"
+
+#endif // CRONZ_CRYPTO_BASE32_HPP
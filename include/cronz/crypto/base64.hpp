@@ -21,7 +21,10 @@
 
 #include <array>
 #include <concepts>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
@@ -43,15 +46,23 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      */
     typedef std::array<char, static_cast<std::size_t>(256)> Base64IndicesMapType;
 
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Value of the characters that are not in the alphabet within a `Base64IndicesMapType`.
+     * @remark Every index fits in 6 bits, so the high bit alone tells the invalid characters apart.
+     */
+    inline static constexpr char Base64InvalidIndex = static_cast<char>(0xFF);
+
     /**
      * @brief Generates a `Base64IndicesMapType` from a `Base64AlphabetType`.
      * @param[in] alphabet Instance of `Base64AlphabetType`.
-     * @return Instance of `Base64IndicesMapType`.
+     * @return Instance of `Base64IndicesMapType`, in which the characters that are not in the alphabet are
+     * `Base64InvalidIndex`.
      */
     inline constexpr Base64IndicesMapType GenerateBase64IndicesMap(const Base64AlphabetType &alphabet) noexcept {
         Base64IndicesMapType b64map;
 
-        b64map.fill('\0');
+        b64map.fill(Base64InvalidIndex);
 
         char index = 0;
         for (const char &character : alphabet)
@@ -106,6 +117,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      * @param[in] character Character to be found.
      * @param[in] alphabet Alphabet to be searched.
      * @return `true` if the character exists in the alphabet, otherwise, `false`.
+     * @remark The alphabet is searched, so `IsInBase64AlphabetIndicesMap` should be preferred for many characters.
      */
     CRONZ_NODISCARD_L1 bool IsInBase64Alphabet(const char &character, const Base64AlphabetType &alphabet) noexcept;
 
@@ -132,7 +144,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      * @return Required length for an encoded Base64 string.
      */
     template <bool Padded = true>
-    CRONZ_NODISCARD_L2 std::size_t CalculateBase64EncodedLength(const std::size_t &length) noexcept;
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase64EncodedLength(const std::size_t &length) noexcept;
 
     /**
      * @ingroup cronz_crypto_base64
@@ -141,7 +153,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      * @param[in] padded Should the length calculated for a padded version.
      * @return Required length for an encoded Base64 string.
      */
-    CRONZ_NODISCARD_L2 std::size_t CalculateBase64EncodedLength(const std::size_t &length, const bool &padded) noexcept;
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase64EncodedLength(const std::size_t &length,
+                                                                          const bool &padded) noexcept;
 
     /**
      * @ingroup cronz_crypto_base64
@@ -252,6 +265,39 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     CRONZ_NODISCARD_L2 bool Base64Encode(const std::string &str, std::string &encoded, const bool &padded,
                                          const Base64AlphabetType &alphabet = Base64Alphabet) noexcept;
 
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Encodes data into a caller-provided buffer.
+     * @tparam Padded Whether the encoded data should be padded.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold `CalculateBase64EncodedLength<Padded>` of the
+     * data length, and no terminating null character is written.
+     * @param[out] written Number of characters written.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     * @remark No memory is allocated.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L2 bool Base64Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                         std::size_t &written,
+                                         const Base64AlphabetType &alphabet = Base64Alphabet) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Encodes data into a caller-provided buffer.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold `CalculateBase64EncodedLength` of the data
+     * length, and no terminating null character is written.
+     * @param[out] written Number of characters written.
+     * @param[in] padded Whether the encoded data should be padded.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     * @remark No memory is allocated.
+     */
+    CRONZ_NODISCARD_L2 bool Base64Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                         std::size_t &written, const bool &padded,
+                                         const Base64AlphabetType &alphabet = Base64Alphabet) noexcept;
+
     /** @} */
 
     /**
@@ -267,10 +313,27 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      *  - `std::vector<unsigned char>`
      */
     template <typename ReturnType>
-    concept Base64DecodeReturnTypeRequirement = requires {
-        std::is_same_v<std::string, ReturnType> || std::is_same_v<std::vector<char>, ReturnType> || std::is_same_v<
-            std::vector<unsigned char>, ReturnType>;
-    };
+    concept Base64DecodeReturnTypeRequirement = std::is_same_v<std::string, ReturnType> ||
+                                                std::is_same_v<std::vector<char>, ReturnType> ||
+                                                std::is_same_v<std::vector<unsigned char>, ReturnType>;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Tells the maximum decoded length of a Base64 encoded string.
+     * @param[in] length Length of the encoded string, without padding.
+     * @return Maximum decoded length, which is exact for a valid string without padding.
+     */
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase64DecodedLength(const std::size_t &length) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Tells the decoded length of a Base64 encoded string.
+     * @param[in] encoded Base64 encoded string.
+     * @param[in] length Length of `encoded`.
+     * @return Decoded length, which is exact for a valid string, padded or not.
+     */
+    CRONZ_NODISCARD_L2 constexpr std::size_t CalculateBase64DecodedLength(const char *encoded,
+                                                                          const std::size_t &length) noexcept;
 
     /**
      * @ingroup cronz_crypto_base64
@@ -358,6 +421,170 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     CRONZ_NODISCARD_L2 bool Base64Decode(const std::string &encoded, ReturnType &decoded,
                                          const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap) noexcept;
 
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a Base64 encoded string into a caller-provided buffer.
+     * @param[in] encoded Base64 encoded string, padded or not.
+     * @param[out] decoded Buffer of the decoded bytes. Must hold `CalculateBase64DecodedLength` of `encoded`.
+     * @param[out] written Number of bytes written.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully decoded, otherwise, `false`, which is when `encoded` is invalid or `decoded` is
+     * too small.
+     * @remark No memory is allocated.
+     */
+    CRONZ_NODISCARD_L2 bool Base64Decode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                                         std::size_t &written,
+                                         const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a Base64 encoded string in place.
+     * @param[in,out] data Base64 encoded string, padded or not, of which the first `written` bytes are replaced by the
+     * decoded bytes.
+     * @param[out] written Number of bytes written.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     * @remark Bytes are never written ahead of the characters read, so no memory is needed besides `data`.
+     */
+    CRONZ_NODISCARD_L2 bool Base64DecodeInPlace(const std::span<char> &data, std::size_t &written,
+                                                const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap)
+        noexcept;
+
+    /** @} */
+
+    /**
+     * @name Validation.
+     */
+    /** @{ */
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Tells if a string is a strictly formed Base64 encoded string, without decoding it.
+     * @tparam Padded Whether the padding is required, otherwise, it is forbidden.
+     * @param[in] encoded Base64 encoded string.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if every character is in the alphabet, the padding is as required and the unused trailing bits
+     * are zero, otherwise, `false`.
+     * @remark The characters are classified in a single pass, by ranges for the alphabets shaped as `Base64Alphabet`
+     * and by lookup for the others, with the highest instruction set level available.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L1 bool IsValidBase64(const char *encoded, const std::size_t &length,
+                                          const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Tells if a string is a strictly formed Base64 encoded string, without decoding it.
+     * @tparam Padded Whether the padding is required, otherwise, it is forbidden.
+     * @param[in] encoded Base64 encoded string.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if every character is in the alphabet, the padding is as required and the unused trailing bits
+     * are zero, otherwise, `false`.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L1 bool IsValidBase64(const std::string &encoded,
+                                          const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a strictly formed Base64 encoded string into a caller-provided buffer.
+     * @tparam Padded Whether the padding is required, otherwise, it is forbidden.
+     * @param[in] encoded Base64 encoded string.
+     * @param[out] decoded Buffer of the decoded bytes. Must hold `CalculateBase64DecodedLength` of `encoded`.
+     * @param[out] written Number of bytes written.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully decoded, otherwise, `false`, which is when `encoded` is not accepted by
+     * `IsValidBase64` or `decoded` is too small.
+     * @remark Unlike `Base64Decode`, every encoded string is accepted for exactly one byte sequence.
+     */
+    template <bool Padded = true>
+    CRONZ_NODISCARD_L2 bool Base64DecodeStrict(const std::span<const char> &encoded,
+                                               const std::span<std::byte> &decoded, std::size_t &written,
+                                               const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap)
+        noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a strictly formed Base64 encoded string.
+     * @tparam Padded Whether the padding is required, otherwise, it is forbidden.
+     * @tparam ReturnType Output data type.
+     * @param[in] encoded Base64 encoded string.
+     * @param[out] decoded Decoded data.
+     * @param[in] alphabet Alphabet to be used.
+     * @return `true` if successfully decoded, otherwise, `false`, which is when `encoded` is not accepted by
+     * `IsValidBase64`.
+     */
+    template <bool Padded = true, typename ReturnType>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    CRONZ_NODISCARD_L2 bool Base64DecodeStrict(const std::string &encoded, ReturnType &decoded,
+                                               const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap)
+        noexcept;
+
+    /** @} */
+
+    /**
+     * @name Compile-time alphabets.
+     */
+    /** @{ */
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Encodes data into a caller-provided buffer, with an alphabet known at compile time, e.g.
+     * `Base64Encode<Base64AlphabetSafe, false>(data, encoded, written)`.
+     * @tparam Alphabet Alphabet to be used.
+     * @tparam Padded Whether the encoded data should be padded.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold `CalculateBase64EncodedLength<Padded>` of the
+     * data length.
+     * @param[out] written Number of characters written.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     * @remark The alphabet and its decoding tables are constants of the instantiation, so, unlike the overloads with
+     * a run-time alphabet, they are neither passed nor reloaded, and the padding is not branched on.
+     * @remark This can be evaluated at compile time, in which case the vectorized kernels are not used.
+     */
+    template <Base64AlphabetType Alphabet, bool Padded = true>
+    CRONZ_NODISCARD_L2 constexpr bool Base64Encode(const std::span<const std::byte> &data,
+                                                   const std::span<char> &encoded, std::size_t &written) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Encodes a string with an alphabet known at compile time.
+     * @tparam Alphabet Alphabet to be used.
+     * @tparam Padded Whether the encoded data should be padded.
+     * @param[in] str String to be encoded.
+     * @return Encoded string. Upon failure, this will be empty.
+     */
+    template <Base64AlphabetType Alphabet, bool Padded = true>
+    CRONZ_NODISCARD_L1 std::string Base64Encode(const std::string &str) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a Base64 encoded string into a caller-provided buffer, with an alphabet known at compile time,
+     * e.g. `Base64Decode<Base64AlphabetSafe>(encoded, decoded, written)`.
+     * @tparam Alphabet Alphabet to be used.
+     * @param[in] encoded Base64 encoded string. The last group may be padded or not.
+     * @param[out] decoded Buffer of the decoded bytes. Must hold `CalculateBase64DecodedLength` of `encoded`.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     * @remark Accepts the same strings as the `Base64Decode` overloads with an indices map.
+     * @remark This can be evaluated at compile time, in which case the vectorized kernels are not used.
+     */
+    template <Base64AlphabetType Alphabet>
+    CRONZ_NODISCARD_L2 constexpr bool Base64Decode(const std::span<const char> &encoded,
+                                                   const std::span<std::byte> &decoded, std::size_t &written) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_base64
+     * @brief Decodes a Base64 encoded string with an alphabet known at compile time.
+     * @tparam Alphabet Alphabet to be used.
+     * @tparam ReturnType Output data type.
+     * @param[in] encoded Base64 encoded string.
+     * @param[out] decoded Decoded data.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     */
+    template <Base64AlphabetType Alphabet, typename ReturnType = std::string>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    CRONZ_NODISCARD_L2 bool Base64Decode(const std::string &encoded, ReturnType &decoded) noexcept;
+
     /** @} */
 
 CRONZ_END_MODULE_NAMESPACE
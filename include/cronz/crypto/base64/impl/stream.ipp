@@ -0,0 +1,340 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_BASE64_IMPL_STREAM_IPP
+#define CRONZ_CRYPTO_BASE64_IMPL_STREAM_IPP 1
+
+#include "cronz/crypto/base64/stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Tells if a character is whitespace that separates the lines of PEM and MIME data.
+     * @param[in] character Character to be tested.
+     * @return `true` if the character is `' '`, `'\t'`, `'\r'` or `'\n'`, otherwise, `false`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr bool IsBase64Whitespace(const unsigned char &character) noexcept {
+        return ' ' == character || '\t' == character || '\r' == character || '\n' == character;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    // Base64Encoder.
+    inline Base64Encoder::Base64Encoder(const Base64AlphabetType &alphabet, const bool &padded,
+                                        const std::size_t &lineLength, const bool &crlf) noexcept
+        : alphabet_(alphabet), lineLength_(lineLength / static_cast<std::size_t>(4) * static_cast<std::size_t>(4)),
+          padded_(padded), crlf_(crlf) {
+    }
+
+    inline std::size_t Base64Encoder::write_(const unsigned char *data, const std::size_t &length,
+                                             char *encoded) noexcept {
+        if (static_cast<std::size_t>(0) == lineLength_)
+            return Internal::Base64EncodeGroups(data, length, encoded, alphabet_);
+
+        char *out = encoded;
+        auto pos = static_cast<std::size_t>(0);
+
+        // The current line is completed first, so that the others start at a line boundary.
+        if (static_cast<std::size_t>(0) != column_ && lineLength_ != column_) {
+            pos = std::min(length / static_cast<std::size_t>(3), (lineLength_ - column_) / static_cast<std::size_t>(
+                               4)) * static_cast<std::size_t>(3);
+
+            const std::size_t written = Internal::Base64EncodeGroups(data, pos, out, alphabet_);
+            out += written;
+            column_ += written;
+        }
+
+        // The rest is encoded in one go, then its lines are moved apart, from the last one, to make room for the line
+        // breaks.
+        const std::size_t characters = Internal::Base64EncodeGroups(data + pos, length - pos, out, alphabet_);
+        if (static_cast<std::size_t>(0) == characters)
+            return static_cast<std::size_t>(out - encoded);
+
+        const std::size_t breakLength = crlf_ ? static_cast<std::size_t>(2) : static_cast<std::size_t>(1);
+        const std::size_t leadingBreak = (lineLength_ == column_) ? static_cast<std::size_t>(1) : static_cast<
+                                             std::size_t>(0);
+        const std::size_t lines = (characters + lineLength_ - static_cast<std::size_t>(1)) / lineLength_;
+
+        for (std::size_t line = lines; static_cast<std::size_t>(0) != line--;) {
+            const std::size_t breaks = line + leadingBreak;
+            if (static_cast<std::size_t>(0) == breaks)
+                break;
+
+            char *destination = out + line * lineLength_ + breaks * breakLength;
+            std::memmove(destination, out + line * lineLength_, std::min(lineLength_, characters - line *
+                                                                             lineLength_));
+
+            if (crlf_)
+                destination[-2] = '\r';
+
+            destination[-1] = '\n';
+        }
+
+        column_ = characters - (lines - static_cast<std::size_t>(1)) * lineLength_;
+        return static_cast<std::size_t>(out - encoded) + characters + (lines - static_cast<std::size_t>(1) +
+                                                                       leadingBreak) * breakLength;
+    }
+
+    inline char* Base64Encoder::lineBreak_(char *encoded) noexcept {
+        if (crlf_)
+            *encoded++ = '\r';
+
+        *encoded++ = '\n';
+        column_ = static_cast<std::size_t>(0);
+        return encoded;
+    }
+
+    inline std::size_t Base64Encoder::maxUpdateLength(const std::size_t &length) const noexcept {
+        const std::size_t characters = (pendingLength_ + length) / static_cast<std::size_t>(3) *
+                                       static_cast<std::size_t>(4);
+        if (static_cast<std::size_t>(0) == lineLength_)
+            return characters;
+
+        return characters + (column_ + characters) / lineLength_ * (crlf_ ? static_cast<std::size_t>(2)
+                                                                          : static_cast<std::size_t>(1));
+    }
+
+    inline std::size_t Base64Encoder::maxFinalLength() const noexcept {
+        if (static_cast<std::size_t>(0) == pendingLength_)
+            return static_cast<std::size_t>(0);
+
+        return static_cast<std::size_t>(4) + ((static_cast<std::size_t>(0) != lineLength_ && lineLength_ == column_)
+                                                  ? (crlf_ ? static_cast<std::size_t>(2) : static_cast<std::size_t>(1))
+                                                  : static_cast<std::size_t>(0));
+    }
+
+    inline std::size_t Base64Encoder::update(const void *data, const std::size_t &length, char *encoded) noexcept {
+        const auto bytes = static_cast<const unsigned char*>(data);
+
+        auto pos = static_cast<std::size_t>(0);
+        char *out = encoded;
+
+        // The pending bytes are completed into a group first.
+        if (static_cast<std::size_t>(0) != pendingLength_) {
+            while (static_cast<std::size_t>(3) > pendingLength_ && length != pos)
+                pending_[pendingLength_++] = bytes[pos++];
+
+            if (static_cast<std::size_t>(3) > pendingLength_)
+                return static_cast<std::size_t>(0);
+
+            out += write_(pending_.data(), static_cast<std::size_t>(3), out);
+            pendingLength_ = static_cast<std::size_t>(0);
+        }
+
+        const std::size_t whole = (length - pos) / static_cast<std::size_t>(3) * static_cast<std::size_t>(3);
+        out += write_(bytes + pos, whole, out);
+
+        for (pos += whole; length != pos; ++pos)
+            pending_[pendingLength_++] = bytes[pos];
+
+        return static_cast<std::size_t>(out - encoded);
+    }
+
+    inline bool Base64Encoder::update(const void *data, const std::size_t &length, std::string &encoded) noexcept {
+        const std::size_t size = encoded.size();
+
+        try {
+            encoded.resize(size + maxUpdateLength(length));
+        }
+        catch (...) {
+            return false;
+        }
+
+        encoded.resize(size + update(data, length, encoded.data() + size));
+        return true;
+    }
+
+    inline std::size_t Base64Encoder::finalize(char *encoded) noexcept {
+        char *out = encoded;
+
+        if (static_cast<std::size_t>(0) != pendingLength_) {
+            if (static_cast<std::size_t>(0) != lineLength_ && lineLength_ == column_)
+                out = lineBreak_(out);
+
+            const std::uint32_t group = (static_cast<std::uint32_t>(pending_[0]) << 16) |
+                                        ((static_cast<std::size_t>(2) == pendingLength_)
+                                             ? (static_cast<std::uint32_t>(pending_[1]) << 8)
+                                             : static_cast<std::uint32_t>(0));
+
+            *out++ = alphabet_[group >> 18];
+            *out++ = alphabet_[(group >> 12) & 0x3F];
+
+            if (static_cast<std::size_t>(2) == pendingLength_)
+                *out++ = alphabet_[(group >> 6) & 0x3F];
+            else if (padded_)
+                *out++ = Base64PaddingCharacter;
+
+            if (padded_)
+                *out++ = Base64PaddingCharacter;
+        }
+
+        reset();
+        return static_cast<std::size_t>(out - encoded);
+    }
+
+    inline bool Base64Encoder::finalize(std::string &encoded) noexcept {
+        const std::size_t size = encoded.size();
+
+        try {
+            encoded.resize(size + maxFinalLength());
+        }
+        catch (...) {
+            return false;
+        }
+
+        encoded.resize(size + finalize(encoded.data() + size));
+        return true;
+    }
+
+    inline void Base64Encoder::reset() noexcept {
+        column_ = static_cast<std::size_t>(0);
+        pendingLength_ = static_cast<std::size_t>(0);
+    }
+
+    // Base64Decoder.
+    inline Base64Decoder::Base64Decoder(const Base64IndicesMapType &alphabet, const bool &skipWhitespace) noexcept
+        : alphabet_(alphabet), table_(Internal::GenerateBase64DecodingTable(alphabet)),
+          skipWhitespace_(skipWhitespace) {
+    }
+
+    inline std::size_t Base64Decoder::flush_(unsigned char *decoded) noexcept {
+        const std::uint32_t group = (static_cast<std::uint32_t>(pending_[0]) << 18) |
+                                    (static_cast<std::uint32_t>(pending_[1]) << 12) |
+                                    (static_cast<std::uint32_t>(pending_[2]) << 6) | pending_[3];
+
+        // A group of `n` characters holds `n - 1` bytes.
+        const std::size_t length = pendingLength_ - static_cast<std::size_t>(1);
+        for (auto i = static_cast<std::size_t>(0); i < length; ++i)
+            decoded[i] = static_cast<unsigned char>(group >> (static_cast<std::size_t>(16) - i * 8));
+
+        pending_.fill(static_cast<unsigned char>(0));
+        pendingLength_ = static_cast<std::size_t>(0);
+        return length;
+    }
+
+    inline std::size_t Base64Decoder::maxUpdateLength(const std::size_t &length) const noexcept {
+        // Padding characters count, as they complete the group.
+        return (pendingLength_ + padding_ + length) / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+    }
+
+    inline std::size_t Base64Decoder::maxFinalLength() const noexcept {
+        return static_cast<std::size_t>(2);
+    }
+
+    inline bool Base64Decoder::update(const char *encoded, const std::size_t &length, void *decoded,
+                                      std::size_t &written) noexcept {
+        const auto characters = reinterpret_cast<const unsigned char*>(encoded);
+        const auto bytes = static_cast<unsigned char*>(decoded);
+
+        unsigned char *out = bytes;
+        for (auto pos = static_cast<std::size_t>(0); !failed_ && length != pos;) {
+            // Runs of whole groups are decoded in bulk, and whatever they stop at, one character at a time.
+            if (static_cast<std::size_t>(0) == (pendingLength_ | padding_)) {
+                const std::size_t consumed = Internal::Base64DecodeGroups(characters + pos, length - pos, out,
+                                                                          alphabet_, &table_);
+                pos += consumed;
+                out += consumed / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+
+                if (length == pos)
+                    break;
+            }
+
+            const unsigned char character = characters[pos++];
+            if (skipWhitespace_ && Internal::IsBase64Whitespace(character))
+                continue;
+
+            if (Base64PaddingCharacter == static_cast<char>(character)) {
+                // Padding completes a group of 2 or 3 characters, after which no group may follow.
+                failed_ = static_cast<std::size_t>(2) > pendingLength_ ||
+                          static_cast<std::size_t>(4) <= pendingLength_ + padding_;
+
+                if (!failed_ && static_cast<std::size_t>(4) == pendingLength_ + ++padding_)
+                    out += flush_(out);
+            }
+            else {
+                failed_ = static_cast<std::size_t>(0) != padding_ || Base64InvalidIndex == alphabet_[character];
+
+                if (!failed_) {
+                    pending_[pendingLength_++] = static_cast<unsigned char>(alphabet_[character]);
+
+                    if (static_cast<std::size_t>(4) == pendingLength_)
+                        out += flush_(out);
+                }
+            }
+        }
+
+        written = static_cast<std::size_t>(out - bytes);
+        return !failed_;
+    }
+
+    template <typename ReturnType>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    inline bool Base64Decoder::update(const char *encoded, const std::size_t &length, ReturnType &decoded) noexcept {
+        const std::size_t size = decoded.size();
+
+        try {
+            decoded.resize(size + maxUpdateLength(length));
+        }
+        catch (...) {
+            return false;
+        }
+
+        std::size_t written;
+        const bool result = update(encoded, length, decoded.data() + size, written);
+
+        decoded.resize(size + written);
+        return result;
+    }
+
+    inline bool Base64Decoder::finalize(void *decoded, std::size_t &written) noexcept {
+        // A single character holds no byte, and started padding must be complete.
+        const bool result = !failed_ && static_cast<std::size_t>(1) != pendingLength_ &&
+                            (static_cast<std::size_t>(0) == padding_ || static_cast<std::size_t>(0) == pendingLength_);
+
+        written = (result && static_cast<std::size_t>(0) != pendingLength_)
+                      ? flush_(static_cast<unsigned char*>(decoded))
+                      : static_cast<std::size_t>(0);
+
+        reset();
+        return result;
+    }
+
+    template <typename ReturnType>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    inline bool Base64Decoder::finalize(ReturnType &decoded) noexcept {
+        const std::size_t size = decoded.size();
+
+        try {
+            decoded.resize(size + maxFinalLength());
+        }
+        catch (...) {
+            return false;
+        }
+
+        std::size_t written;
+        const bool result = finalize(decoded.data() + size, written);
+
+        decoded.resize(size + written);
+        return result;
+    }
+
+    inline void Base64Decoder::reset() noexcept {
+        pending_.fill(static_cast<unsigned char>(0));
+        pendingLength_ = static_cast<std::size_t>(0);
+        padding_ = static_cast<std::size_t>(0);
+        failed_ = false;
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_CRYPTO_BASE64_IMPL_STREAM_IPP
@@ -0,0 +1,253 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_BASE64_STREAM_HPP
+#define CRONZ_CRYPTO_BASE64_STREAM_HPP 1
+
+/**
+ * @defgroup cronz_crypto_base64_stream Streaming
+ * @ingroup cronz_crypto_base64
+ */
+
+#include "cronz/crypto/base64.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    /**
+     * @ingroup cronz_crypto_base64_stream
+     * @brief Encodes data of any size chunk by chunk, in constant memory.
+     * @class Base64Encoder
+     * @remark Chunks may have any size. The 0-2 bytes that do not complete a group are kept until the next chunk, so
+     * the output does not depend on how the data is split.
+     * @remark Lines can be wrapped, e.g. at `LineLengthPEM` or `LineLengthMIME` columns. Line breaks are written
+     * between lines, not after the last one.
+     */
+    class Base64Encoder {
+        // Properties.
+        Base64AlphabetType alphabet_;
+        std::size_t lineLength_;
+        std::size_t column_ = static_cast<std::size_t>(0);
+        std::array<unsigned char, static_cast<std::size_t>(3)> pending_{};
+        std::size_t pendingLength_ = static_cast<std::size_t>(0);
+        bool padded_;
+        bool crlf_;
+
+        // Utilities.
+        std::size_t write_(const unsigned char *data, const std::size_t &length, char *encoded) noexcept;
+
+        char* lineBreak_(char *encoded) noexcept;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Line length of PEM ([RFC7468](https://datatracker.ietf.org/doc/html/rfc7468#section-2)).
+         */
+        inline static constexpr std::size_t LineLengthPEM = static_cast<std::size_t>(64);
+
+        /**
+         * @brief Line length of MIME ([RFC2045](https://datatracker.ietf.org/doc/html/rfc2045#section-6.8)).
+         */
+        inline static constexpr std::size_t LineLengthMIME = static_cast<std::size_t>(76);
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with initializers.
+         * @param[in] alphabet Alphabet to be used.
+         * @param[in] padded Whether the encoded data should be padded.
+         * @param[in] lineLength Number of characters per line, rounded down to a multiple of 4. `0` disables
+         * wrapping.
+         * @param[in] crlf Whether lines are broken with `\r\n` rather than `\n`.
+         */
+        explicit Base64Encoder(const Base64AlphabetType &alphabet = Base64Alphabet, const bool &padded = true,
+                               const std::size_t &lineLength = static_cast<std::size_t>(0),
+                               const bool &crlf = true) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Encoding.
+         */
+        /** @{ */
+        /**
+         * @brief Tells the maximum number of characters written by `update` for a chunk.
+         * @param[in] length Byte length of the chunk.
+         * @return Maximum number of characters, line breaks included.
+         */
+        CRONZ_NODISCARD_L1 std::size_t maxUpdateLength(const std::size_t &length) const noexcept;
+
+        /**
+         * @brief Tells the maximum number of characters written by `finalize`.
+         * @return Maximum number of characters, line breaks included.
+         */
+        CRONZ_NODISCARD_L1 std::size_t maxFinalLength() const noexcept;
+
+        /**
+         * @brief Encodes a chunk.
+         * @param[in] data Chunk to be encoded.
+         * @param[in] length Byte length of `data`.
+         * @param[out] encoded Output buffer of at least `maxUpdateLength(length)` characters.
+         * @return Number of characters written.
+         */
+        std::size_t update(const void *data, const std::size_t &length, char *encoded) noexcept;
+
+        /**
+         * @brief Encodes a chunk.
+         * @param[in] data Chunk to be encoded.
+         * @param[in] length Byte length of `data`.
+         * @param[out] encoded String to which the encoded characters are appended.
+         * @return `true` if successfully encoded, otherwise, `false`.
+         * @remark Upon failure, neither the encoder nor `encoded` is changed.
+         */
+        CRONZ_NODISCARD_L2 bool update(const void *data, const std::size_t &length, std::string &encoded) noexcept;
+
+        /**
+         * @brief Encodes the pending bytes, if any, and resets the encoder.
+         * @param[out] encoded Output buffer of at least `maxFinalLength()` characters.
+         * @return Number of characters written.
+         */
+        std::size_t finalize(char *encoded) noexcept;
+
+        /**
+         * @brief Encodes the pending bytes, if any, and resets the encoder.
+         * @param[out] encoded String to which the encoded characters are appended.
+         * @return `true` if successfully encoded, otherwise, `false`.
+         * @remark Upon failure, neither the encoder nor `encoded` is changed.
+         */
+        CRONZ_NODISCARD_L2 bool finalize(std::string &encoded) noexcept;
+
+        /**
+         * @brief Discards the pending bytes and starts a new line.
+         */
+        void reset() noexcept;
+
+        /** @} */
+    };
+
+    /**
+     * @ingroup cronz_crypto_base64_stream
+     * @brief Decodes data of any size chunk by chunk, in constant memory.
+     * @class Base64Decoder
+     * @remark Chunks may have any size. The 0-3 characters that do not complete a group are kept until the next
+     * chunk, so the output does not depend on how the data is split.
+     * @remark Whitespace (`' '`, `'\t'`, `'\r'` and `'\n'`) can be skipped, for PEM and MIME. Padding is optional, but
+     * nothing other than whitespace may follow it.
+     */
+    class Base64Decoder {
+        // Properties.
+        Base64IndicesMapType alphabet_;
+        Internal::Base64DecodingTable table_;
+        std::array<unsigned char, static_cast<std::size_t>(4)> pending_{};
+        std::size_t pendingLength_ = static_cast<std::size_t>(0);
+        std::size_t padding_ = static_cast<std::size_t>(0);
+        bool skipWhitespace_;
+        bool failed_ = false;
+
+        // Utilities.
+        std::size_t flush_(unsigned char *decoded) noexcept;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with initializers.
+         * @param[in] alphabet Indices map to be used.
+         * @param[in] skipWhitespace Whether whitespace should be skipped. If `false`, it is invalid.
+         */
+        explicit Base64Decoder(const Base64IndicesMapType &alphabet = Base64AlphabetIndicesMap,
+                               const bool &skipWhitespace = true) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Decoding.
+         */
+        /** @{ */
+        /**
+         * @brief Tells the maximum number of bytes written by `update` for a chunk.
+         * @param[in] length Length of the chunk.
+         * @return Maximum number of bytes.
+         */
+        CRONZ_NODISCARD_L1 std::size_t maxUpdateLength(const std::size_t &length) const noexcept;
+
+        /**
+         * @brief Tells the maximum number of bytes written by `finalize`.
+         * @return Maximum number of bytes.
+         */
+        CRONZ_NODISCARD_L1 std::size_t maxFinalLength() const noexcept;
+
+        /**
+         * @brief Decodes a chunk.
+         * @param[in] encoded Chunk to be decoded.
+         * @param[in] length Length of `encoded`.
+         * @param[out] decoded Output buffer of at least `maxUpdateLength(length)` bytes.
+         * @param[out] written Number of bytes written.
+         * @return `true` if successfully decoded, otherwise, `false`.
+         * @remark Upon failure, the bytes decoded before the invalid character are still written, and the decoder
+         * keeps failing until it is reset.
+         */
+        CRONZ_NODISCARD_L2 bool update(const char *encoded, const std::size_t &length, void *decoded,
+                                       std::size_t &written) noexcept;
+
+        /**
+         * @brief Decodes a chunk.
+         * @tparam ReturnType Output data type.
+         * @param[in] encoded Chunk to be decoded.
+         * @param[in] length Length of `encoded`.
+         * @param[out] decoded Container to which the decoded bytes are appended.
+         * @return `true` if successfully decoded, otherwise, `false`.
+         */
+        template <typename ReturnType = std::string>
+            requires Base64DecodeReturnTypeRequirement<ReturnType>
+        CRONZ_NODISCARD_L2 bool update(const char *encoded, const std::size_t &length, ReturnType &decoded) noexcept;
+
+        /**
+         * @brief Decodes the pending characters, if any, and resets the decoder.
+         * @param[out] decoded Output buffer of at least `maxFinalLength()` bytes.
+         * @param[out] written Number of bytes written.
+         * @return `true` if the data ended with a whole group, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool finalize(void *decoded, std::size_t &written) noexcept;
+
+        /**
+         * @brief Decodes the pending characters, if any, and resets the decoder.
+         * @tparam ReturnType Output data type.
+         * @param[out] decoded Container to which the decoded bytes are appended.
+         * @return `true` if the data ended with a whole group, otherwise, `false`.
+         */
+        template <typename ReturnType = std::string>
+            requires Base64DecodeReturnTypeRequirement<ReturnType>
+        CRONZ_NODISCARD_L2 bool finalize(ReturnType &decoded) noexcept;
+
+        /**
+         * @brief Discards the pending characters and clears the failure, if any.
+         */
+        void reset() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/crypto/base64/impl/stream.ipp"
+
+#endif // CRONZ_CRYPTO_BASE64_STREAM_HPP
@@ -0,0 +1,203 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_HASH_HPP
+#define CRONZ_CRYPTO_HASH_HPP 1
+
+/**
+ * @defgroup cronz_crypto_hash Non-cryptographic hashing
+ * @ingroup cronz_crypto
+ * @remark The hashes are [XXH3](https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md) of xxHash 0.8, so
+ * they are the same on every platform and interoperate with other implementations.
+ * @remark They are meant for hash tables, sharding and deduplication, not for signatures or integrity against an
+ * adversary, which need `SHA256`. A random secret seed keeps attacker-chosen keys, such as URLs or addresses from
+ * untrusted input, from colliding on purpose.
+ */
+
+#include "cronz/crypto/types.hpp"
+#include "cronz/internal/config.hpp"
+#include "cronz/internal/xxh3.hpp"
+#include "cronz/ip/address/v6.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief 128-bit hash.
+     */
+    struct Hash128Type {
+        /**
+         * @brief Low 64 bits.
+         */
+        std::uint64_t low;
+
+        /**
+         * @brief High 64 bits.
+         */
+        std::uint64_t high;
+
+        CRONZ_NODISCARD_L1 friend constexpr bool operator==(const Hash128Type &a,
+                                                            const Hash128Type &b) noexcept = default;
+    };
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Limits the addresses hashed by `Hash64` and `Hash128`.
+     * The type must be one of the following:
+     *  - `IP::IPv4Address`
+     *  - `IP::IPv6Address`
+     */
+    template <typename Address>
+    concept HashAddressRequirement = std::is_same_v<IP::IPv4Address, Address> ||
+                                     std::is_same_v<IP::IPv6Address, Address>;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes data into 64 bits.
+     * @param[in] data Data to be hashed.
+     * @param[in] seed Seed.
+     * @return 64-bit hash of the data.
+     * @remark The inputs of up to 240 bytes, such as most URLs, take a few multiplications without any loop over the
+     * input. The longer ones are accumulated 64 bytes at a time with the highest instruction set level available.
+     */
+    CRONZ_NODISCARD_L1 std::uint64_t Hash64(const std::span<const std::byte> &data,
+                                            const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes a string into 64 bits.
+     * @param[in] str String to be hashed.
+     * @param[in] seed Seed.
+     * @return 64-bit hash of the string.
+     */
+    CRONZ_NODISCARD_L1 std::uint64_t Hash64(const std::string &str,
+                                            const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes an address into 64 bits.
+     * @tparam Address Address type.
+     * @param[in] address Address to be hashed.
+     * @param[in] seed Seed.
+     * @return 64-bit hash of the address bytes, in network byte order.
+     * @remark An `IPv6Address` hashes the same as the `IP::IPAddress` that holds it.
+     */
+    template <typename Address>
+        requires HashAddressRequirement<Address>
+    CRONZ_NODISCARD_L1 std::uint64_t Hash64(const Address &address,
+                                            const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes data into 128 bits.
+     * @param[in] data Data to be hashed.
+     * @param[in] seed Seed.
+     * @return 128-bit hash of the data.
+     * @remark The low half is not `Hash64`, the two hashes being computed differently.
+     */
+    CRONZ_NODISCARD_L1 Hash128Type Hash128(const std::span<const std::byte> &data,
+                                           const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes a string into 128 bits.
+     * @param[in] str String to be hashed.
+     * @param[in] seed Seed.
+     * @return 128-bit hash of the string.
+     */
+    CRONZ_NODISCARD_L1 Hash128Type Hash128(const std::string &str,
+                                           const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Hashes an address into 128 bits.
+     * @tparam Address Address type.
+     * @param[in] address Address to be hashed.
+     * @param[in] seed Seed.
+     * @return 128-bit hash of the address bytes, in network byte order.
+     */
+    template <typename Address>
+        requires HashAddressRequirement<Address>
+    CRONZ_NODISCARD_L1 Hash128Type Hash128(const Address &address,
+                                           const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hash
+     * @brief Incremental hashing of data that does not fit in memory, or that is not contiguous.
+     * @class Hasher
+     * @remark The hashes are the same as `Hash64` and `Hash128` of the whole data, however it is split.
+     * @remark The state takes about 500 bytes and no allocation.
+     */
+    class Hasher {
+        // Properties.
+        Internal::XXH3State state_;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with initializers, which starts new data.
+         * @param[in] seed Seed.
+         */
+        explicit Hasher(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Hashing.
+         */
+        /** @{ */
+        /**
+         * @brief Appends data.
+         * @param[in] data Data to be appended.
+         */
+        void update(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Appends a string.
+         * @param[in] str String to be appended.
+         */
+        void update(const std::string &str) noexcept;
+
+        /**
+         * @brief Returns the 64-bit hash of the data so far.
+         * @return 64-bit hash.
+         * @remark More data can be appended afterwards.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t digest64() const noexcept;
+
+        /**
+         * @brief Returns the 128-bit hash of the data so far.
+         * @return 128-bit hash.
+         * @remark More data can be appended afterwards.
+         */
+        CRONZ_NODISCARD_L1 Hash128Type digest128() const noexcept;
+
+        /**
+         * @brief Discards the data and starts new data.
+         * @param[in] seed Seed.
+         */
+        void reset(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/crypto/impl/hash.ipp"
+
+#endif // CRONZ_CRYPTO_HASH_HPP
@@ -19,7 +19,12 @@
 #include "cronz/crypto/types.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     /**
@@ -76,6 +81,87 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
      */
     [[nodiscard]] bool HexToByte(const char &n1, const char &n2, std::uint8_t &byte) noexcept;
 
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Encodes data into a caller-provided buffer, two hex digits per byte.
+     * @tparam Lowercase If `true`, `HexDigitsLowercase` will be used, otherwise, `HexDigitsUppercase`. Defaults to
+     * `false`, as in `ByteToHex`.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold twice as many characters as `data` has bytes,
+     * and no terminating null character is written.
+     * @param[out] written Number of characters written.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     * @remark The nibbles are split and looked up 16 or 32 bytes at a time with the highest instruction set level
+     * available.
+     */
+    template <bool Lowercase = false>
+    [[nodiscard]] bool HexEncode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                 std::size_t &written) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Encodes data into a caller-provided buffer, two hex digits per byte.
+     * @param[in] data Data to be encoded.
+     * @param[out] encoded Buffer of the encoded characters. Must hold twice as many characters as `data` has bytes,
+     * and no terminating null character is written.
+     * @param[out] written Number of characters written.
+     * @param[in] lowercase If `true`, `HexDigitsLowercase` will be used, otherwise, `HexDigitsUppercase`.
+     * @return `true` if successfully encoded, otherwise, `false`, which is when `encoded` is too small.
+     */
+    [[nodiscard]] bool HexEncode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                 std::size_t &written, const bool &lowercase) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Encodes data, two hex digits per byte.
+     * @tparam Lowercase If `true`, `HexDigitsLowercase` will be used, otherwise, `HexDigitsUppercase`. Defaults to
+     * `false`, as in `ByteToHex`.
+     * @param[in] data Data to be encoded.
+     * @return Encoded string. Upon failure this will be empty.
+     */
+    template <bool Lowercase = false>
+    [[nodiscard]] std::string HexEncode(const std::span<const std::byte> &data) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Limits the output type of `HexDecode`.
+     * The type must be one of the following:
+     *  - `std::string`
+     *  - `std::vector<char>`
+     *  - `std::vector<unsigned char>`
+     */
+    template <typename ReturnType>
+    concept HexDecodeReturnTypeRequirement = std::is_same_v<std::string, ReturnType> ||
+                                             std::is_same_v<std::vector<char>, ReturnType> ||
+                                             std::is_same_v<std::vector<unsigned char>, ReturnType>;
+
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Decodes hex digits of either case into a caller-provided buffer.
+     * @param[in] encoded Hex digits, two per byte.
+     * @param[out] decoded Buffer of the decoded bytes. Must hold half as many bytes as `encoded` has characters.
+     * @param[out] written Number of bytes written.
+     * @return `true` if successfully decoded, otherwise, `false`, which is when `encoded` has an odd length or a
+     * character that is not a hex digit, or when `decoded` is too small.
+     * @remark The characters are classified, converted and packed 32 or 64 at a time with the highest instruction
+     * set level available.
+     */
+    [[nodiscard]] bool HexDecode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                                 std::size_t &written) noexcept;
+
+    /**
+     * @ingroup cronz_crypto_hex
+     * @brief Decodes hex digits of either case.
+     * @tparam ReturnType Output data type.
+     * @param[in] encoded Hex digits, two per byte.
+     * @param[out] decoded Decoded data.
+     * @return `true` if successfully decoded, otherwise, `false`, which is when `encoded` has an odd length or a
+     * character that is not a hex digit.
+     */
+    template <typename ReturnType = std::string>
+        requires HexDecodeReturnTypeRequirement<ReturnType>
+    [[nodiscard]] bool HexDecode(const std::span<const char> &encoded, ReturnType &decoded) noexcept;
+
 CRONZ_END_MODULE_NAMESPACE
 
 #include "cronz/crypto/impl/hex.ipp"
@@ -0,0 +1,147 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_HMAC_HPP
+#define CRONZ_CRYPTO_HMAC_HPP 1
+
+/**
+ * @defgroup cronz_crypto_hmac HMAC
+ * @ingroup cronz_crypto
+ * @remark Follows the instructions from [RFC2104](https://datatracker.ietf.org/doc/html/rfc2104).
+ */
+
+#include "cronz/crypto/sha.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    /**
+     * @ingroup cronz_crypto_hmac
+     * @brief Incremental HMAC-SHA256 authentication.
+     * @class HMACSHA256
+     * @remark The inner and outer key blocks are compressed once, by the constructor, and their states are kept, so
+     * a message only costs its own blocks and the two final ones. A keyed context can be copied to authenticate many
+     * messages with the same key, e.g. from several threads.
+     */
+    class HMACSHA256 {
+        // Properties.
+        SHA256 inner_;
+        SHA256 outer_;
+        SHA256 message_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Size of a digest, in bytes.
+         */
+        inline static constexpr std::size_t DigestSize = SHA256::DigestSize;
+
+        /**
+         * @brief Digest type.
+         */
+        using Digest = SHA256::Digest;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with a key initializer, which starts a new message.
+         * @param[in] key Key. Keys longer than a block are hashed first.
+         */
+        explicit HMACSHA256(const std::span<const std::byte> &key) noexcept;
+
+        /**
+         * @brief Constructor with a key initializer, which starts a new message.
+         * @param[in] key Key. Keys longer than a block are hashed first.
+         */
+        explicit HMACSHA256(const std::string &key) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Authentication.
+         */
+        /** @{ */
+        /**
+         * @brief Appends data to the message.
+         * @param[in] data Data to be appended.
+         */
+        void update(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Appends a string to the message.
+         * @param[in] str String to be appended.
+         */
+        void update(const std::string &str) noexcept;
+
+        /**
+         * @brief Completes the message.
+         * @return Digest of the message.
+         * @remark A new message with the same key is started afterwards.
+         */
+        CRONZ_NODISCARD_L1 Digest finalize() noexcept;
+
+        /**
+         * @brief Discards the message and starts a new one with the same key.
+         */
+        void reset() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Static utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Authenticates data.
+         * @param[in] key Key.
+         * @param[in] data Data to be authenticated.
+         * @return Digest of the data.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::span<const std::byte> &key,
+                                              const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Authenticates a string.
+         * @param[in] key Key.
+         * @param[in] str String to be authenticated.
+         * @return Digest of the string.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::string &key, const std::string &str) noexcept;
+
+        /** @} */
+    };
+
+    /**
+     * @ingroup cronz_crypto_hmac
+     * @brief Compares two byte sequences in a time that does not depend on their contents.
+     * @param[in] a First sequence.
+     * @param[in] b Second sequence.
+     * @return `true` if the sequences are equal, otherwise, `false`.
+     * @remark Digests and signatures must be compared with this, as the time an early-exit comparison takes tells an
+     * attacker how many leading bytes of a forged digest are right. Only the lengths, which are not secret, are
+     * compared first.
+     */
+    CRONZ_NODISCARD_L1 bool ConstantTimeEqual(const std::span<const std::byte> &a,
+                                              const std::span<const std::byte> &b) noexcept;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/crypto/impl/hmac.ipp"
+
+#endif // CRONZ_CRYPTO_HMAC_HPP
@@ -0,0 +1,627 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_IMPL_BASE32_HPP
+#define CRONZ_CRYPTO_IMPL_BASE32_HPP 1
+
+#include "cronz/crypto/base32.hpp"
+#include "cronz/internal/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Characters of a case-insensitive alphabet made of two ranges, such as the ones of `Base32Alphabet` and
+     * `Base32HexAlphabet`, in lowercase.
+     */
+    struct Base32Ranges {
+        /**
+         * @brief First characters of the ranges.
+         */
+        std::array<char, static_cast<std::size_t>(2)> first;
+
+        /**
+         * @brief Last characters of the ranges.
+         */
+        std::array<char, static_cast<std::size_t>(2)> last;
+
+        /**
+         * @brief Indices of the first characters of the ranges.
+         */
+        std::array<char, static_cast<std::size_t>(2)> index;
+    };
+
+    /**
+     * @brief Finds the ranges of an indices map.
+     * @param[in] alphabet Indices map.
+     * @param[out] ranges Ranges.
+     * @return `true` if the indices map is `Base32AlphabetIndicesMap` or `Base32HexAlphabetIndicesMap`, otherwise,
+     * `false`.
+     */
+    inline bool FindBase32Ranges(const Crypto::Base32IndicesMapType &alphabet, Base32Ranges &ranges) noexcept {
+        if (std::equal(alphabet.begin(), alphabet.end(), Crypto::Base32AlphabetIndicesMap.begin())) {
+            ranges = {{'a', '2'}, {'z', '7'}, {0, 26}};
+            return true;
+        }
+
+        if (std::equal(alphabet.begin(), alphabet.end(), Crypto::Base32HexAlphabetIndicesMap.begin())) {
+            ranges = {{'0', 'a'}, {'9', 'v'}, {0, 10}};
+            return true;
+        }
+
+        return false;
+    }
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Splits 2 groups of 5 bytes into 16 quintets.
+     * @param[in] data 16 bytes, of which the first 10 are used.
+     * @return Quintets, one per byte.
+     * @remark Every quintet is within the big-endian 16-bit word starting at its first byte, so each word is built
+     * by a shuffle and shifted into place by a multiplication.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base32Quintets(const __m128i &data) noexcept {
+        const __m128i shifts = _mm_setr_epi16(32, 1024, 128, 4096, 512, 64, 2048, 256);
+        const __m128i first = _mm_mulhi_epu16(_mm_shuffle_epi8(data, _mm_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3,
+                                                                                   4, 3, 5, 4)), shifts);
+        const __m128i second = _mm_mulhi_epu16(_mm_shuffle_epi8(data, _mm_setr_epi8(6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9,
+                                                                                    8, 9, 8, 10, 9)), shifts);
+
+        return _mm_packus_epi16(_mm_and_si128(first, _mm_set1_epi16(0x1F)), _mm_and_si128(second,
+                                                                                         _mm_set1_epi16(0x1F)));
+    }
+
+    /**
+     * @brief Splits 2 lanes of 2 groups of 5 bytes into 32 quintets.
+     * @param[in] data 2 lanes of 16 bytes, of which the first 10 are used.
+     * @return Quintets, one per byte.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base32Quintets(const __m256i &data) noexcept {
+        const __m256i shifts = _mm256_setr_epi16(32, 1024, 128, 4096, 512, 64, 2048, 256, 32, 1024, 128, 4096, 512,
+                                                 64, 2048, 256);
+        const __m256i first = _mm256_mulhi_epu16(_mm256_shuffle_epi8(data, _mm256_setr_epi8(
+                                                                         1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5,
+                                                                         4, 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3,
+                                                                         5, 4)), shifts);
+        const __m256i second = _mm256_mulhi_epu16(_mm256_shuffle_epi8(data, _mm256_setr_epi8(
+                                                                          6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10,
+                                                                          9, 6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8,
+                                                                          10, 9)), shifts);
+
+        return _mm256_packus_epi16(_mm256_and_si256(first, _mm256_set1_epi16(0x1F)),
+                                   _mm256_and_si256(second, _mm256_set1_epi16(0x1F)));
+    }
+
+    /**
+     * @brief Encodes 10 bytes per step with SSSE3.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of bytes encoded, a multiple of 10.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t Base32EncodeSSSE3(const unsigned char *data,
+                                                                      const std::size_t &length, char *encoded,
+                                                                      const Crypto::Base32AlphabetType &alphabet)
+        noexcept {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data()));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 16));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(10)) {
+            const __m128i quintets = Base32Quintets(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)));
+
+            // The alphabet is looked up a half at a time.
+            const __m128i upper = _mm_cmpgt_epi8(quintets, _mm_set1_epi8(15));
+            const __m128i characters = _mm_or_si128(_mm_andnot_si128(upper, _mm_shuffle_epi8(low, quintets)),
+                                                    _mm_and_si128(upper, _mm_shuffle_epi8(high, quintets)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(encoded + pos / 5 * 8), characters);
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes 20 bytes per step with AVX2.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of bytes encoded, a multiple of 20.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t Base32EncodeAVX2(const unsigned char *data,
+                                                                    const std::size_t &length, char *encoded,
+                                                                    const Crypto::Base32AlphabetType &alphabet)
+        noexcept {
+        const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                                            alphabet.data())));
+        const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                                             alphabet.data() + 16)));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(26) <= length; pos += static_cast<std::size_t>(20)) {
+            const __m256i quintets = Base32Quintets(_mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 10)), 1));
+
+            const __m256i upper = _mm256_cmpgt_epi8(quintets, _mm256_set1_epi8(15));
+            const __m256i characters = _mm256_or_si256(
+                _mm256_andnot_si256(upper, _mm256_shuffle_epi8(low, quintets)),
+                _mm256_and_si256(upper, _mm256_shuffle_epi8(high, quintets)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(encoded + pos / 5 * 8), characters);
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Merges 2 groups of 8 quintets into 2 groups of 5 bytes.
+     * @param[in] quintets Quintets, one per byte.
+     * @return Bytes, in the first 10 bytes.
+     * @remark Quintet pairs are merged into 10 bits, then 20 bits, then 40 bits, of which the bytes are reversed.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base32Groups(const __m128i &quintets) noexcept {
+        const __m128i halves = _mm_madd_epi16(_mm_maddubs_epi16(quintets, _mm_set1_epi16(0x0120)),
+                                              _mm_set1_epi32(0x00010400));
+        const __m128i groups = _mm_or_si128(_mm_slli_epi64(_mm_and_si128(halves, _mm_set1_epi64x(0xFFFFFFFFll)), 20),
+                                            _mm_srli_epi64(halves, 32));
+
+        return _mm_shuffle_epi8(groups, _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+    }
+
+    /**
+     * @brief Merges 2 lanes of 2 groups of 8 quintets into 2 lanes of 2 groups of 5 bytes.
+     * @param[in] quintets Quintets, one per byte.
+     * @return Bytes, in the first 10 bytes of each lane.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base32Groups(const __m256i &quintets) noexcept {
+        const __m256i halves = _mm256_madd_epi16(_mm256_maddubs_epi16(quintets, _mm256_set1_epi16(0x0120)),
+                                                 _mm256_set1_epi32(0x00010400));
+        const __m256i groups = _mm256_or_si256(
+            _mm256_slli_epi64(_mm256_and_si256(halves, _mm256_set1_epi64x(0xFFFFFFFFll)), 20),
+            _mm256_srli_epi64(halves, 32));
+
+        return _mm256_shuffle_epi8(groups, _mm256_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+                                                            4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+    }
+
+    /**
+     * @brief Maps 16 characters to their quintets by two ranges.
+     * @param[in] in Characters.
+     * @param[in] ranges Ranges of the alphabet.
+     * @return Quintets, or `0xFF` for the characters outside the ranges.
+     * @remark Letter ranges are matched on the characters with bit 5 set, which lowers the letters, and digit ranges
+     * on the characters as they are, as setting bit 5 would bring control characters into them.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base32Classify(const __m128i &in, const Base32Ranges &ranges) noexcept {
+        const __m128i lower = _mm_or_si128(in, _mm_set1_epi8(0x20));
+
+        __m128i quintets = _mm_set1_epi8(static_cast<char>(0xFF));
+        for (auto r = 0; r < 2; ++r) {
+            const __m128i source = ('a' <= ranges.first[r]) ? lower : in;
+            const __m128i within = Base64InRange(source, ranges.first[r], ranges.last[r]);
+            const __m128i values = _mm_add_epi8(source, _mm_set1_epi8(static_cast<char>(ranges.index[r] -
+                                                                                        ranges.first[r])));
+            quintets = _mm_xor_si128(quintets, _mm_and_si128(within, _mm_xor_si128(quintets, values)));
+        }
+
+        return quintets;
+    }
+
+    /**
+     * @brief Maps 32 characters to their quintets by two ranges.
+     * @param[in] in Characters.
+     * @param[in] ranges Ranges of the alphabet.
+     * @return Quintets, or `0xFF` for the characters outside the ranges.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base32Classify(const __m256i &in, const Base32Ranges &ranges) noexcept {
+        const __m256i lower = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+
+        __m256i quintets = _mm256_set1_epi8(static_cast<char>(0xFF));
+        for (auto r = 0; r < 2; ++r) {
+            const __m256i source = ('a' <= ranges.first[r]) ? lower : in;
+            const __m256i within = Base64InRange(source, ranges.first[r], ranges.last[r]);
+            const __m256i values = _mm256_add_epi8(source, _mm256_set1_epi8(static_cast<char>(ranges.index[r] -
+                                                                                              ranges.first[r])));
+            quintets = _mm256_blendv_epi8(quintets, values, within);
+        }
+
+        return quintets;
+    }
+
+    /**
+     * @brief Decodes 16 characters per step with SSSE3.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. 16 bytes are written per step, of which the last 6 are overwritten later.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`).
+     * @param[in] ranges Ranges of the alphabet (see `FindBase32Ranges`). If `nullptr`, `table` is looked up.
+     * @return Number of characters decoded, a multiple of 16. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t Base32DecodeSSSE3(const unsigned char *encoded,
+                                                                      const std::size_t &length,
+                                                                      unsigned char *decoded,
+                                                                      const Base64DecodingTable &table,
+                                                                      const Base32Ranges *ranges) noexcept {
+        __m128i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data() + r * 16));
+
+        // The ranges are copied, as the stores of bytes could otherwise alias them.
+        const bool classify = nullptr != ranges;
+        const Base32Ranges bounds = classify ? *ranges : Base32Ranges{};
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(16)) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + pos));
+            const __m128i quintets = classify ? Base32Classify(in, bounds) : Base64Lookup(rows, in);
+
+            if (0 != _mm_movemask_epi8(_mm_or_si128(quintets, in)))
+                break;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(decoded + pos / 8 * 5), Base32Groups(quintets));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes 32 characters per step with AVX2.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. 26 bytes are written per step, of which the last 6 are overwritten later.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`).
+     * @param[in] ranges Ranges of the alphabet (see `FindBase32Ranges`). If `nullptr`, `table` is looked up.
+     * @return Number of characters decoded, a multiple of 32. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t Base32DecodeAVX2(const unsigned char *encoded,
+                                                                    const std::size_t &length,
+                                                                    unsigned char *decoded,
+                                                                    const Base64DecodingTable &table,
+                                                                    const Base32Ranges *ranges) noexcept {
+        __m256i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data() +
+                                                                                               r * 16)));
+
+        // The ranges are copied, as the stores of bytes could otherwise alias them.
+        const bool classify = nullptr != ranges;
+        const Base32Ranges bounds = classify ? *ranges : Base32Ranges{};
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(32) <= length; pos += static_cast<std::size_t>(32)) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + pos));
+            const __m256i quintets = classify ? Base32Classify(in, bounds) : Base64Lookup(rows, in);
+
+            if (0 != _mm256_movemask_epi8(_mm256_or_si256(quintets, in)))
+                break;
+
+            // The 10 bytes of each lane are stored in order, the second store overwriting the rest of the first.
+            const __m256i groups = Base32Groups(quintets);
+            unsigned char *out = decoded + pos / 8 * 5;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(groups));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 10), _mm256_extracti128_si256(groups, 1));
+        }
+
+        return pos;
+    }
+#endif
+
+    /**
+     * @brief Encodes the leading whole groups of data with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the data of the higher ones.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of bytes encoded, a multiple of 5. The rest is left to the portable implementation.
+     */
+    inline std::size_t Base32EncodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                          [[maybe_unused]] const unsigned char *data,
+                                          [[maybe_unused]] const std::size_t &length,
+                                          [[maybe_unused]] char *encoded,
+                                          [[maybe_unused]] const Crypto::Base32AlphabetType &alphabet) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                pos += Base32EncodeAVX2(data + pos, length - pos, encoded + pos / 5 * 8, alphabet);
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += Base32EncodeSSSE3(data + pos, length - pos, encoded + pos / 5 * 8, alphabet);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes the leading whole groups of characters with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the characters of the higher ones.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Must hold 6 bytes more than the decoded ones.
+     * @param[in] alphabet Indices map to be used.
+     * @return Number of characters decoded, a multiple of 8. The rest, starting with the first invalid character or
+     * padding, is left to the portable implementation.
+     */
+    inline std::size_t Base32DecodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                          [[maybe_unused]] const unsigned char *encoded,
+                                          [[maybe_unused]] const std::size_t &length,
+                                          [[maybe_unused]] unsigned char *decoded,
+                                          [[maybe_unused]] const Crypto::Base32IndicesMapType &alphabet) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        // The default indices maps are classified by ranges, and the others are looked up.
+        Base32Ranges found;
+        const Base32Ranges *ranges = FindBase32Ranges(alphabet, found) ? &found : nullptr;
+        const Base64DecodingTable table = GenerateBase64DecodingTable(alphabet);
+
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                pos += Base32DecodeAVX2(encoded + pos, length - pos, decoded + pos / 8 * 5, table, ranges);
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += Base32DecodeSSSE3(encoded + pos, length - pos, decoded + pos / 8 * 5, table, ranges);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes data.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters. Must hold `CalculateBase32EncodedLength(length, padded)` characters.
+     * @param[in] padded Whether the encoded data should be padded.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of characters written.
+     */
+    inline std::size_t Base32EncodeData(const unsigned char *data, const std::size_t &length, char *encoded,
+                                        const bool &padded, const Crypto::Base32AlphabetType &alphabet) noexcept {
+        std::size_t pos = Base32EncodeBlocks(DetectSIMDLevel(), data, length, encoded, alphabet);
+        std::size_t written = pos / static_cast<std::size_t>(5) * static_cast<std::size_t>(8);
+
+        for (; pos + static_cast<std::size_t>(5) <= length; pos += static_cast<std::size_t>(5)) {
+            auto group = static_cast<std::uint64_t>(0);
+            for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(5); ++i)
+                group = (group << 8) | data[pos + i];
+
+            for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(8); ++i)
+                encoded[written++] = alphabet[(group >> (static_cast<std::size_t>(35) - i * 5)) & 0x1F];
+        }
+
+        const std::size_t rest = length - pos;
+        if (static_cast<std::size_t>(0) == rest)
+            return written;
+
+        // The remaining bytes are completed with zero bits, and take as many characters as their bits need.
+        auto group = static_cast<std::uint64_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(5); ++i)
+            group = (group << 8) | ((i < rest) ? data[pos + i] : static_cast<unsigned char>(0));
+
+        const std::size_t characters = (rest * static_cast<std::size_t>(8) + static_cast<std::size_t>(4)) /
+                                       static_cast<std::size_t>(5);
+        for (auto i = static_cast<std::size_t>(0); i < characters; ++i)
+            encoded[written++] = alphabet[(group >> (static_cast<std::size_t>(35) - i * 5)) & 0x1F];
+
+        if (padded) {
+            for (std::size_t i = characters; i < static_cast<std::size_t>(8); ++i)
+                encoded[written++] = Crypto::Base32PaddingCharacter;
+        }
+
+        return written;
+    }
+
+    /**
+     * @brief Decodes data, of which the last group may be padded or not.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Must hold `CalculateBase32DecodedLength(encoded, length)` bytes.
+     * @param[in] alphabet Indices map to be used.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     */
+    inline bool Base32DecodeData(const unsigned char *encoded, const std::size_t &length, unsigned char *decoded,
+                                 const Crypto::Base32IndicesMapType &alphabet, std::size_t &written) noexcept {
+        // The last 16 characters are kept from the kernels, whose wider stores would go past the decoded bytes.
+        auto pos = static_cast<std::size_t>(0);
+        if (static_cast<std::size_t>(32) <= length && SIMDLevel::None != DetectSIMDLevel())
+            pos = Base32DecodeBlocks(DetectSIMDLevel(), encoded, length - static_cast<std::size_t>(16), decoded,
+                                     alphabet);
+
+        std::size_t out = pos / static_cast<std::size_t>(8) * static_cast<std::size_t>(5);
+        for (; pos + static_cast<std::size_t>(8) <= length; pos += static_cast<std::size_t>(8)) {
+            auto group = static_cast<std::uint64_t>(0);
+            auto indices = static_cast<unsigned char>(0);
+            for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(8); ++i) {
+                const auto index = static_cast<unsigned char>(alphabet[encoded[pos + i]]);
+                indices |= index;
+                group = (group << 5) | index;
+            }
+
+            // Only `Base32InvalidIndex` has the high bit set.
+            if (0 != (indices & 0x80))
+                break;
+
+            for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(5); ++i)
+                decoded[out++] = static_cast<unsigned char>(group >> (static_cast<std::size_t>(32) - i * 8));
+        }
+
+        written = out;
+
+        // Whole groups stop either at the end, or at the last group, or at an invalid group.
+        std::size_t characters = length - pos;
+        if (static_cast<std::size_t>(0) == characters)
+            return true;
+
+        if (static_cast<std::size_t>(8) < characters)
+            return false;
+
+        const unsigned char *tail = encoded + pos;
+        if (static_cast<std::size_t>(8) == characters) {
+            for (auto i = 0; i < 6 && Crypto::Base32PaddingCharacter == static_cast<char>(tail[characters - 1]); ++i)
+                --characters;
+        }
+
+        // Groups of 2, 4, 5 and 7 characters hold 1, 2, 3 and 4 bytes, and the other lengths cannot be produced.
+        const std::size_t bytes = characters * static_cast<std::size_t>(5) / static_cast<std::size_t>(8);
+        if (static_cast<std::size_t>(8) <= characters ||
+            (bytes * static_cast<std::size_t>(8) + static_cast<std::size_t>(4)) / static_cast<std::size_t>(5) !=
+            characters)
+            return false;
+
+        auto group = static_cast<std::uint64_t>(0);
+        auto indices = static_cast<unsigned char>(0);
+        for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(8); ++i) {
+            const auto index = (i < characters) ? static_cast<unsigned char>(alphabet[tail[i]])
+                                                : static_cast<unsigned char>(0);
+            indices |= index;
+            group = (group << 5) | index;
+        }
+
+        if (0 != (indices & 0x80))
+            return false;
+
+        for (auto i = static_cast<std::size_t>(0); i < bytes; ++i)
+            decoded[out++] = static_cast<unsigned char>(group >> (static_cast<std::size_t>(32) - i * 8));
+
+        written = out;
+        return true;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    // Encoding.
+    template <bool Padded>
+    inline constexpr std::size_t CalculateBase32EncodedLength(const std::size_t &length) noexcept {
+        // Whole groups take 8 characters, and the 1 to 4 remaining bytes take 2, 4, 5 or 7 characters, or 8 if padded.
+        const std::size_t rest = length % static_cast<std::size_t>(5);
+        const std::size_t tail = (static_cast<std::size_t>(0) == rest)
+                                     ? static_cast<std::size_t>(0)
+                                     : (Padded ? static_cast<std::size_t>(8)
+                                               : (rest * static_cast<std::size_t>(8) + static_cast<std::size_t>(4)) /
+                                                 static_cast<std::size_t>(5));
+
+        return length / static_cast<std::size_t>(5) * static_cast<std::size_t>(8) + tail;
+    }
+
+    inline constexpr std::size_t CalculateBase32EncodedLength(const std::size_t &length,
+                                                              const bool &padded) noexcept {
+        return padded ? CalculateBase32EncodedLength<true>(length) : CalculateBase32EncodedLength<false>(length);
+    }
+
+    template <bool Padded>
+    inline bool Base32Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                             std::size_t &written, const Base32AlphabetType &alphabet) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (encoded.size() < CalculateBase32EncodedLength<Padded>(data.size()))
+            return false;
+
+        written = Internal::Base32EncodeData(reinterpret_cast<const unsigned char*>(data.data()), data.size(),
+                                             encoded.data(), Padded, alphabet);
+        return true;
+    }
+
+    inline bool Base32Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                             std::size_t &written, const bool &padded, const Base32AlphabetType &alphabet) noexcept {
+        return padded
+                   ? Base32Encode<true>(data, encoded, written, alphabet)
+                   : Base32Encode<false>(data, encoded, written, alphabet);
+    }
+
+    template <bool Padded>
+    inline std::string Base32Encode(const std::string &str, const Base32AlphabetType &alphabet) noexcept {
+        std::string encoded;
+
+        try {
+            encoded.resize(CalculateBase32EncodedLength<Padded>(str.length()));
+        }
+        catch (...) {
+            return encoded;
+        }
+
+        [[maybe_unused]] const std::size_t _ = Internal::Base32EncodeData(
+            reinterpret_cast<const unsigned char*>(str.data()), str.length(), encoded.data(), Padded, alphabet);
+        return encoded;
+    }
+
+    // Decoding.
+    inline constexpr std::size_t CalculateBase32DecodedLength(const std::size_t &length) noexcept {
+        // A trailing group of `n` characters holds `5n / 8` bytes.
+        return length / static_cast<std::size_t>(8) * static_cast<std::size_t>(5) +
+               length % static_cast<std::size_t>(8) * static_cast<std::size_t>(5) / static_cast<std::size_t>(8);
+    }
+
+    inline constexpr std::size_t CalculateBase32DecodedLength(const char *encoded,
+                                                              const std::size_t &length) noexcept {
+        std::size_t characters = length;
+        for (auto i = 0; i < 6 && static_cast<std::size_t>(0) != characters &&
+                         Base32PaddingCharacter == encoded[characters - static_cast<std::size_t>(1)]; ++i)
+            --characters;
+
+        return CalculateBase32DecodedLength(characters);
+    }
+
+    inline bool Base32Decode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                             std::size_t &written, const Base32IndicesMapType &alphabet) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (decoded.size() < CalculateBase32DecodedLength(encoded.data(), encoded.size()))
+            return false;
+
+        return Internal::Base32DecodeData(reinterpret_cast<const unsigned char*>(encoded.data()), encoded.size(),
+                                          reinterpret_cast<unsigned char*>(decoded.data()), alphabet, written);
+    }
+
+    template <typename ReturnType>
+        requires Base32DecodeReturnTypeRequirement<ReturnType>
+    inline bool Base32Decode(const std::string &encoded, ReturnType &decoded,
+                             const Base32IndicesMapType &alphabet) noexcept {
+        try {
+            decoded.resize(CalculateBase32DecodedLength(encoded.data(), encoded.length()));
+        }
+        catch (...) {
+            return false;
+        }
+
+        std::size_t written;
+        const bool result = Internal::Base32DecodeData(reinterpret_cast<const unsigned char*>(encoded.data()),
+                                                       encoded.length(),
+                                                       reinterpret_cast<unsigned char*>(decoded.data()), alphabet,
+                                                       written);
+
+        decoded.resize(written);
+        return result;
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_CRYPTO_IMPL_BASE32_HPP
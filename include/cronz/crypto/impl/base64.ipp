@@ -12,45 +12,1103 @@
 #define CRONZ_CRYPTO_IMPL_BASE64_HPP 1
 
 #include "cronz/crypto/base64.hpp"
+#include "cronz/internal/simd.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstring>
+#include <utility>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Decoding table of the ASCII characters, `0xFF` marking the characters that are not in the alphabet.
+     */
+    using Base64DecodingTable = std::array<std::uint8_t, static_cast<std::size_t>(128)>;
+
+    /**
+     * @brief Builds the decoding table of the ASCII characters from a `Base64IndicesMapType`.
+     * @param[in] alphabet Indices map.
+     * @return Decoding table.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr Base64DecodingTable GenerateBase64DecodingTable(
+        const Crypto::Base64IndicesMapType &alphabet) noexcept {
+        Base64DecodingTable table{};
+        for (auto c = static_cast<std::size_t>(0); c < table.size(); ++c)
+            table[c] = static_cast<std::uint8_t>(alphabet[c]);
+
+        return table;
+    }
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Splits 4 groups of 3 bytes into 16 sextets.
+     * @param[in] data 16 bytes, of which the first 12 are used.
+     * @return Sextets, one per byte.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base64Sextets(const __m128i &data) noexcept {
+        const __m128i in = _mm_shuffle_epi8(data, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+        // Each 32-bit lane holds `b1 b0 b2 b1`, from which the multiplications move the sextets to their bytes.
+        const __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+                                             _mm_set1_epi32(0x04000040));
+        const __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+                                            _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(high, low);
+    }
+
+    /**
+     * @brief Splits 2 times 4 groups of 3 bytes into 32 sextets.
+     * @param[in] data 2 lanes of 16 bytes, of which the first 12 of each are used.
+     * @return Sextets, one per byte.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base64Sextets(const __m256i &data) noexcept {
+        const __m256i in = _mm256_shuffle_epi8(data, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11,
+                                                                      10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9,
+                                                                      11, 10));
+
+        const __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)),
+                                                _mm256_set1_epi32(0x04000040));
+        const __m256i low = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)),
+                                               _mm256_set1_epi32(0x01000010));
+        return _mm256_or_si256(high, low);
+    }
+
+    /**
+     * @brief Encodes 12 bytes per step with SSSE3.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @param[in] standard Whether the alphabet differs from `Base64Alphabet` in its last two characters at most.
+     * @return Number of bytes encoded, a multiple of 12.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t Base64EncodeSSSE3(const unsigned char *data,
+                                                                      const std::size_t &length, char *encoded,
+                                                                      const Crypto::Base64AlphabetType &alphabet,
+                                                                      const bool &standard) noexcept {
+        // Standard alphabets are ranges, which are reached by adding an offset picked by the range of the sextet.
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              static_cast<char>(alphabet[62] - 62),
+                                              static_cast<char>(alphabet[63] - 63), 'A', 0, 0);
+
+        const __m128i quarters[4] = {
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data())),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 16)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 32)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 48))
+        };
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(12)) {
+            const __m128i sextets = Base64Sextets(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)));
+
+            __m128i characters;
+            if (standard) {
+                __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+                range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets),
+                                                          _mm_set1_epi8(13)));
+                characters = _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range));
+            }
+            else {
+                // Any other alphabet is looked up a quarter at a time.
+                const __m128i quarter = _mm_and_si128(_mm_srli_epi16(sextets, 4), _mm_set1_epi8(0x03));
+
+                characters = _mm_setzero_si128();
+                for (auto q = 0; q < 4; ++q)
+                    characters = _mm_or_si128(characters, _mm_and_si128(
+                                                  _mm_cmpeq_epi8(quarter, _mm_set1_epi8(static_cast<char>(q))),
+                                                  _mm_shuffle_epi8(quarters[q], sextets)));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(encoded + pos / 3 * 4), characters);
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes 24 bytes per step with AVX2.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @param[in] standard Whether the alphabet differs from `Base64Alphabet` in its last two characters at most.
+     * @return Number of bytes encoded, a multiple of 24.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t Base64EncodeAVX2(const unsigned char *data,
+                                                                    const std::size_t &length, char *encoded,
+                                                                    const Crypto::Base64AlphabetType &alphabet,
+                                                                    const bool &standard) noexcept {
+        const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, static_cast<char>(alphabet[62] - 62), static_cast<char>(alphabet[63] - 63), 'A', 0, 0));
+
+        const __m256i quarters[4] = {
+            _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data()))),
+            _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 16))),
+            _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 32))),
+            _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + 48)))
+        };
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(28) <= length; pos += static_cast<std::size_t>(24)) {
+            const __m256i sextets = Base64Sextets(_mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 12)), 1));
+
+            __m256i characters;
+            if (standard) {
+                __m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+                range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets),
+                                                                _mm256_set1_epi8(13)));
+                characters = _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, range));
+            }
+            else {
+                const __m256i quarter = _mm256_and_si256(_mm256_srli_epi16(sextets, 4), _mm256_set1_epi8(0x03));
+
+                characters = _mm256_setzero_si256();
+                for (auto q = 0; q < 4; ++q)
+                    characters = _mm256_or_si256(characters, _mm256_and_si256(
+                                                     _mm256_cmpeq_epi8(quarter,
+                                                                       _mm256_set1_epi8(static_cast<char>(q))),
+                                                     _mm256_shuffle_epi8(quarters[q], sextets)));
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(encoded + pos / 3 * 4), characters);
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes 48 bytes per step with AVX-512 VBMI.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used, which is looked up as a whole by a single permutation.
+     * @return Number of bytes encoded, a multiple of 48.
+     */
+    CRONZ_SIMD_TARGET("avx512f,avx512bw,avx512vbmi") inline std::size_t Base64EncodeAVX512VBMI(
+        const unsigned char *data, const std::size_t &length, char *encoded,
+        const Crypto::Base64AlphabetType &alphabet) noexcept {
+        // Each 32-bit lane gathers `b1 b0 b2 b1` of its group, and the multishift picks the sextets out of it.
+        const __m512i gather = _mm512_setr_epi32(0x01020001, 0x04050304, 0x07080607, 0x0A0B090A, 0x0D0E0C0D,
+                                                 0x10110F10, 0x13141213, 0x16171516, 0x191A1819, 0x1C1D1B1C,
+                                                 0x1F201E1F, 0x22232122, 0x25262425, 0x28292728, 0x2B2C2A2B,
+                                                 0x2E2F2D2E);
+        const __m512i shifts = _mm512_set1_epi64(0x3036242A1016040All);
+        const __m512i lookup = _mm512_loadu_si512(alphabet.data());
+
+        // Zero-masked forms, as the unmasked ones start from undefined registers that trip some compilers' warnings.
+        const auto all = ~static_cast<__mmask64>(0);
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(48) <= length; pos += static_cast<std::size_t>(48)) {
+            const __m512i in = _mm512_maskz_loadu_epi8(static_cast<__mmask64>(0x0000FFFFFFFFFFFFull), data + pos);
+            const __m512i sextets = _mm512_maskz_multishift_epi64_epi8(all, shifts,
+                                                                       _mm512_maskz_permutexvar_epi8(all, gather, in));
+
+            _mm512_storeu_si512(encoded + pos / 3 * 4, _mm512_maskz_permutexvar_epi8(all, sextets, lookup));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Looks up 16 characters in a decoding table.
+     * @param[in] rows Rows of 16 entries of the decoding table.
+     * @param[in] in Characters.
+     * @return Table entries, or `0` for non-ASCII characters, which are to be caught by their own high bit.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base64Lookup(const __m128i *rows, const __m128i &in) noexcept {
+        const __m128i row = _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0F));
+
+        __m128i entries = _mm_setzero_si128();
+        for (auto r = 0; r < 8; ++r)
+            entries = _mm_or_si128(entries, _mm_and_si128(_mm_cmpeq_epi8(row, _mm_set1_epi8(static_cast<char>(r))),
+                                                          _mm_shuffle_epi8(rows[r], in)));
+
+        return entries;
+    }
+
+    /**
+     * @brief Looks up 2 lanes of 16 characters in a decoding table.
+     * @param[in] rows Rows of 16 entries of the decoding table, broadcast to both lanes.
+     * @param[in] in Characters.
+     * @return Table entries, or `0` for non-ASCII characters, which are to be caught by their own high bit.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base64Lookup(const __m256i *rows, const __m256i &in) noexcept {
+        const __m256i row = _mm256_and_si256(_mm256_srli_epi16(in, 4), _mm256_set1_epi8(0x0F));
+
+        __m256i entries = _mm256_setzero_si256();
+        for (auto r = 0; r < 8; ++r)
+            entries = _mm256_or_si256(entries, _mm256_and_si256(
+                                          _mm256_cmpeq_epi8(row, _mm256_set1_epi8(static_cast<char>(r))),
+                                          _mm256_shuffle_epi8(rows[r], in)));
+
+        return entries;
+    }
+
+    /**
+     * @brief Tells which of 16 characters are within a range.
+     * @param[in] in Characters.
+     * @param[in] first First character of the range.
+     * @param[in] last Last character of the range.
+     * @return `0xFF` for the characters within the range, otherwise, `0`.
+     * @remark The range is moved to the bottom of the signed bytes, so a single comparison bounds it from both sides.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i Base64InRange(const __m128i &in, const char &first,
+                                                              const char &last) noexcept {
+        return _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(-128 + (last - first + 1))),
+                              _mm_add_epi8(in, _mm_set1_epi8(static_cast<char>(-128 - first))));
+    }
+
+    /**
+     * @brief Tells which of 32 characters are within a range.
+     * @param[in] in Characters.
+     * @param[in] first First character of the range.
+     * @param[in] last Last character of the range.
+     * @return `0xFF` for the characters within the range, otherwise, `0`.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i Base64InRange(const __m256i &in, const char &first,
+                                                             const char &last) noexcept {
+        return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + (last - first + 1))),
+                                 _mm256_add_epi8(in, _mm256_set1_epi8(static_cast<char>(-128 - first))));
+    }
+
+    /**
+     * @brief Decodes 16 characters per step with SSSE3.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. 16 bytes are written per step, of which the last 4 are overwritten later.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`).
+     * @return Number of characters decoded, a multiple of 16. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t Base64DecodeSSSE3(const unsigned char *encoded,
+                                                                      const std::size_t &length,
+                                                                      unsigned char *decoded,
+                                                                      const Base64DecodingTable &table) noexcept {
+        __m128i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data() + r * 16));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(16)) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + pos));
+            const __m128i sextets = Base64Lookup(rows, in);
+
+            if (0 != _mm_movemask_epi8(_mm_or_si128(sextets, in)))
+                break;
+
+            // Sextet pairs are merged into 12 bits, then 24 bits, of which the bytes are reversed.
+            const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+            const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(decoded + pos / 4 * 3), _mm_shuffle_epi8(
+                                 groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes 32 characters per step with AVX2.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. 32 bytes are written per step, of which the last 8 are overwritten later.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`).
+     * @return Number of characters decoded, a multiple of 32. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t Base64DecodeAVX2(const unsigned char *encoded,
+                                                                    const std::size_t &length,
+                                                                    unsigned char *decoded,
+                                                                    const Base64DecodingTable &table) noexcept {
+        __m256i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data() +
+                                                                                               r * 16)));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(32) <= length; pos += static_cast<std::size_t>(32)) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + pos));
+            const __m256i sextets = Base64Lookup(rows, in);
+
+            if (0 != _mm256_movemask_epi8(_mm256_or_si256(sextets, in)))
+                break;
+
+            const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+            const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+            const __m256i lanes = _mm256_shuffle_epi8(groups, _mm256_setr_epi8(
+                                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1,
+                                                          0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(decoded + pos / 4 * 3), _mm256_permutevar8x32_epi32(
+                                    lanes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes 64 characters per step with AVX-512 VBMI.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Exactly 48 bytes are written per step.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`), which is looked up as a whole by a single
+     * permutation.
+     * @return Number of characters decoded, a multiple of 64. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx512f,avx512bw,avx512vbmi") inline std::size_t Base64DecodeAVX512VBMI(
+        const unsigned char *encoded, const std::size_t &length, unsigned char *decoded,
+        const Base64DecodingTable &table) noexcept {
+        const __m512i low = _mm512_loadu_si512(table.data());
+        const __m512i high = _mm512_loadu_si512(table.data() + 64);
+
+        // Bytes 2, 1 and 0 of each 32-bit lane, in order.
+        static constexpr std::array<std::uint8_t, 64> order = []() {
+            std::array<std::uint8_t, 64> bytes{};
+            for (auto i = 0; i < 48; ++i)
+                bytes[i] = static_cast<std::uint8_t>(i / 3 * 4 + 2 - i % 3);
+
+            return bytes;
+        }();
+
+        const __m512i pack = _mm512_loadu_si512(order.data());
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(64) <= length; pos += static_cast<std::size_t>(64)) {
+            const __m512i in = _mm512_loadu_si512(encoded + pos);
+            const __m512i sextets = _mm512_permutex2var_epi8(low, in, high);
+
+            if (0 != _mm512_movepi8_mask(_mm512_or_si512(sextets, in)))
+                break;
+
+            const __m512i pairs = _mm512_maddubs_epi16(sextets, _mm512_set1_epi32(0x01400140));
+            const __m512i groups = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00011000));
+
+            _mm512_mask_storeu_epi8(decoded + pos / 4 * 3, static_cast<__mmask64>(0x0000FFFFFFFFFFFFull),
+                                    _mm512_maskz_permutexvar_epi8(~static_cast<__mmask64>(0), pack, groups));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Validates 16 characters per step with SSSE3.
+     * @param[in] encoded Characters to be validated.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Indices map, of which the ASCII characters are looked up as a decoding table.
+     * @param[in] extras Characters of the indices `62` and `63` if the alphabet is otherwise `Base64Alphabet`,
+     * classified by ranges instead of the table, otherwise, `nullptr`.
+     * @return Number of characters validated, a multiple of 16. Validation stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t Base64ValidateSSSE3(const unsigned char *encoded,
+                                                                        const std::size_t &length,
+                                                                        const Crypto::Base64IndicesMapType &alphabet,
+                                                                        const char *extras) noexcept {
+        __m128i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() + r * 16));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(16)) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + pos));
+
+            if (nullptr != extras) {
+                const __m128i valid = _mm_or_si128(
+                    _mm_or_si128(Base64InRange(in, 'A', 'Z'), Base64InRange(in, 'a', 'z')),
+                    _mm_or_si128(Base64InRange(in, '0', '9'),
+                                 _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(extras[0])),
+                                              _mm_cmpeq_epi8(in, _mm_set1_epi8(extras[1])))));
+
+                if (0xFFFF != _mm_movemask_epi8(valid))
+                    break;
+            }
+            else if (0 != _mm_movemask_epi8(_mm_or_si128(Base64Lookup(rows, in), in)))
+                break;
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Validates 32 characters per step with AVX2.
+     * @param[in] encoded Characters to be validated.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Indices map, of which the ASCII characters are looked up as a decoding table.
+     * @param[in] extras Characters of the indices `62` and `63` if the alphabet is otherwise `Base64Alphabet`,
+     * classified by ranges instead of the table, otherwise, `nullptr`.
+     * @return Number of characters validated, a multiple of 32. Validation stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t Base64ValidateAVX2(const unsigned char *encoded,
+                                                                      const std::size_t &length,
+                                                                      const Crypto::Base64IndicesMapType &alphabet,
+                                                                      const char *extras) noexcept {
+        __m256i rows[8];
+        for (auto r = 0; r < 8; ++r)
+            rows[r] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet.data() +
+                                                                                               r * 16)));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(32) <= length; pos += static_cast<std::size_t>(32)) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + pos));
+
+            if (nullptr != extras) {
+                const __m256i valid = _mm256_or_si256(
+                    _mm256_or_si256(Base64InRange(in, 'A', 'Z'), Base64InRange(in, 'a', 'z')),
+                    _mm256_or_si256(Base64InRange(in, '0', '9'),
+                                    _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8(extras[0])),
+                                                    _mm256_cmpeq_epi8(in, _mm256_set1_epi8(extras[1])))));
+
+                if (-1 != _mm256_movemask_epi8(valid))
+                    break;
+            }
+            else if (0 != _mm256_movemask_epi8(_mm256_or_si256(Base64Lookup(rows, in), in)))
+                break;
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Validates 64 characters per step with AVX-512 VBMI.
+     * @param[in] encoded Characters to be validated.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Indices map, of which the ASCII characters are looked up as a whole by a single
+     * permutation, whatever the alphabet.
+     * @return Number of characters validated, which is `length` or a multiple of 64. Validation stops before the
+     * first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx512f,avx512bw,avx512vbmi") inline std::size_t Base64ValidateAVX512VBMI(
+        const unsigned char *encoded, const std::size_t &length,
+        const Crypto::Base64IndicesMapType &alphabet) noexcept {
+        const __m512i low = _mm512_loadu_si512(alphabet.data());
+        const __m512i high = _mm512_loadu_si512(alphabet.data() + 64);
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(64) <= length; pos += static_cast<std::size_t>(64)) {
+            const __m512i in = _mm512_loadu_si512(encoded + pos);
+            if (0 != _mm512_movepi8_mask(_mm512_or_si512(_mm512_permutex2var_epi8(low, in, high), in)))
+                return pos;
+        }
+
+        // Nothing is written, so the last characters are loaded under a mask, within the same pass.
+        const auto mask = static_cast<__mmask64>((static_cast<std::uint64_t>(1) << (length - pos)) -
+                                                 static_cast<std::uint64_t>(1));
+        const __m512i in = _mm512_maskz_loadu_epi8(mask, encoded + pos);
+        if (0 != (mask & _mm512_movepi8_mask(_mm512_or_si512(_mm512_permutex2var_epi8(low, in, high), in))))
+            return pos;
+
+        return length;
+    }
+#endif
+
+    /**
+     * @brief Encodes the leading whole groups of data with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the data of the higher ones.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of bytes encoded, a multiple of 3. The rest is left to the portable implementation.
+     */
+    inline std::size_t Base64EncodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                          [[maybe_unused]] const unsigned char *data,
+                                          [[maybe_unused]] const std::size_t &length,
+                                          [[maybe_unused]] char *encoded,
+                                          [[maybe_unused]] const Crypto::Base64AlphabetType &alphabet) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        const bool standard = std::equal(alphabet.begin(), alphabet.end() - 2, Crypto::Base64Alphabet.begin());
+
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+                pos += Base64EncodeAVX512VBMI(data + pos, length - pos, encoded + pos / 3 * 4, alphabet);
+                [[fallthrough]];
+
+            case SIMDLevel::AVX2:
+                pos += Base64EncodeAVX2(data + pos, length - pos, encoded + pos / 3 * 4, alphabet, standard);
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += Base64EncodeSSSE3(data + pos, length - pos, encoded + pos / 3 * 4, alphabet, standard);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes the leading whole groups of characters with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the characters of the higher ones.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Must be at least `length` bytes long.
+     * @param[in] table Decoding table (see `GenerateBase64DecodingTable`).
+     * @return Number of characters decoded, a multiple of 4. The rest, starting with the first invalid character or
+     * padding, is left to the portable implementation.
+     */
+    inline std::size_t Base64DecodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                          [[maybe_unused]] const unsigned char *encoded,
+                                          [[maybe_unused]] const std::size_t &length,
+                                          [[maybe_unused]] unsigned char *decoded,
+                                          [[maybe_unused]] const Base64DecodingTable &table) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        // A lower level takes over the remaining characters of a higher one, unless it stopped early.
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+                pos += Base64DecodeAVX512VBMI(encoded + pos, length - pos, decoded + pos / 4 * 3, table);
+                if (length - pos >= static_cast<std::size_t>(64))
+                    break;
+
+                [[fallthrough]];
+
+            case SIMDLevel::AVX2:
+                pos += Base64DecodeAVX2(encoded + pos, length - pos, decoded + pos / 4 * 3, table);
+                if (length - pos >= static_cast<std::size_t>(32))
+                    break;
+
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += Base64DecodeSSSE3(encoded + pos, length - pos, decoded + pos / 4 * 3, table);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Finds the characters of the indices `62` and `63` of an alphabet that is otherwise `Base64Alphabet`.
+     * @param[in] alphabet Indices map of the alphabet.
+     * @param[out] extras Characters of the indices `62` and `63`.
+     * @return `true` if the alphabet is shaped as `Base64Alphabet`, otherwise, `false`.
+     * @remark Other characters mapped to the same indices are left to the portable implementation.
+     */
+    inline bool FindBase64Extras(const Crypto::Base64IndicesMapType &alphabet, std::array<char, 2> &extras) noexcept {
+        const Crypto::Base64IndicesMapType &standard = Crypto::Base64AlphabetIndicesMap;
+        for (const auto &[first, last] : {std::pair('A', 'Z'), std::pair('a', 'z'), std::pair('0', '9')}) {
+            if (!std::equal(alphabet.begin() + first, alphabet.begin() + last + 1, standard.begin() + first))
+                return false;
+        }
+
+        for (auto i = 0; i < 2; ++i) {
+            const void *extra = std::memchr(alphabet.data(), 62 + i, 128);
+            if (nullptr == extra)
+                return false;
+
+            extras[i] = static_cast<char>(static_cast<const char*>(extra) - alphabet.data());
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Validates the leading characters with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in] encoded Characters to be validated.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Indices map to be used.
+     * @return Number of characters validated. The rest, starting with the first invalid character, is left to the
+     * portable implementation.
+     */
+    inline std::size_t Base64ValidateBlocks([[maybe_unused]] const SIMDLevel &level,
+                                            [[maybe_unused]] const unsigned char *encoded,
+                                            [[maybe_unused]] const std::size_t &length,
+                                            [[maybe_unused]] const Crypto::Base64IndicesMapType &alphabet) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+                pos = Base64ValidateAVX512VBMI(encoded, length, alphabet);
+                break;
+
+            case SIMDLevel::AVX2:
+            case SIMDLevel::SSSE3: {
+                // Ranges take fewer instructions than the lookup, for the alphabets they fit.
+                std::array<char, 2> extras{};
+                const char *ranges = FindBase64Extras(alphabet, extras) ? extras.data() : nullptr;
+
+                if (SIMDLevel::AVX2 == level && static_cast<std::size_t>(32) <= length) {
+                    pos = Base64ValidateAVX2(encoded, length, alphabet, ranges);
+                    if (length - pos >= static_cast<std::size_t>(32))
+                        break;
+                }
+
+                pos += Base64ValidateSSSE3(encoded + pos, length - pos, alphabet, ranges);
+                break;
+            }
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes whole groups of 3 bytes.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`. Trailing bytes that do not form a group are ignored.
+     * @param[out] encoded Encoded characters. Exactly 4 characters are written per group.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of characters written.
+     */
+    inline std::size_t Base64EncodeGroups(const unsigned char *data, const std::size_t &length, char *encoded,
+                                          const Crypto::Base64AlphabetType &alphabet) noexcept {
+        auto pos = Base64EncodeBlocks(DetectSIMDLevel(), data, length, encoded, alphabet);
+
+        char *out = encoded + pos / static_cast<std::size_t>(3) * static_cast<std::size_t>(4);
+        for (; pos + static_cast<std::size_t>(3) <= length; pos += static_cast<std::size_t>(3)) {
+            const std::uint32_t group = (static_cast<std::uint32_t>(data[pos]) << 16) |
+                                        (static_cast<std::uint32_t>(data[pos + 1]) << 8) | data[pos + 2];
+
+            *out++ = alphabet[group >> 18];
+            *out++ = alphabet[(group >> 12) & 0x3F];
+            *out++ = alphabet[(group >> 6) & 0x3F];
+            *out++ = alphabet[group & 0x3F];
+        }
+
+        return static_cast<std::size_t>(out - encoded);
+    }
+
+    /**
+     * @brief Decodes whole groups of 4 characters, up to the first group with a character outside the indices map.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`. Trailing characters that do not form a group are ignored.
+     * @param[out] decoded Decoded bytes. Exactly 3 bytes are written per decoded group.
+     * @param[in] alphabet Indices map to be used.
+     * @param[in] table Decoding table of `alphabet` (see `GenerateBase64DecodingTable`). If `nullptr`, it is built
+     * when needed.
+     * @return Number of characters decoded, a multiple of 4.
+     * @remark `decoded` may be `encoded`, as bytes are never written ahead of the characters read.
+     */
+    inline std::size_t Base64DecodeGroups(const unsigned char *encoded, const std::size_t &length,
+                                          unsigned char *decoded, const Crypto::Base64IndicesMapType &alphabet,
+                                          const Base64DecodingTable *table = nullptr) noexcept {
+        // The last 16 characters are kept from the kernels, whose wider stores would go past the decoded bytes.
+        auto pos = static_cast<std::size_t>(0);
+        if (static_cast<std::size_t>(32) <= length && SIMDLevel::None != DetectSIMDLevel()) {
+            pos = (nullptr != table)
+                      ? Base64DecodeBlocks(DetectSIMDLevel(), encoded, length - static_cast<std::size_t>(16), decoded,
+                                           *table)
+                      : Base64DecodeBlocks(DetectSIMDLevel(), encoded, length - static_cast<std::size_t>(16), decoded,
+                                           GenerateBase64DecodingTable(alphabet));
+        }
+
+        unsigned char *out = decoded + pos / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+        for (; pos + static_cast<std::size_t>(4) <= length; pos += static_cast<std::size_t>(4)) {
+            const auto c0 = static_cast<unsigned char>(alphabet[encoded[pos]]);
+            const auto c1 = static_cast<unsigned char>(alphabet[encoded[pos + 1]]);
+            const auto c2 = static_cast<unsigned char>(alphabet[encoded[pos + 2]]);
+            const auto c3 = static_cast<unsigned char>(alphabet[encoded[pos + 3]]);
+
+            // Only `Base64InvalidIndex` has the high bit set.
+            if (0 != ((c0 | c1 | c2 | c3) & 0x80))
+                break;
+
+            const std::uint32_t group = (static_cast<std::uint32_t>(c0) << 18) | (static_cast<std::uint32_t>(c1) <<
+                                            12) | (static_cast<std::uint32_t>(c2) << 6) | c3;
+
+            *out++ = static_cast<unsigned char>(group >> 16);
+            *out++ = static_cast<unsigned char>(group >> 8);
+            *out++ = static_cast<unsigned char>(group);
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes data.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters. Must hold `CalculateBase64EncodedLength(length, padded)` characters.
+     * @param[in] padded Whether the encoded data should be padded.
+     * @param[in] alphabet Alphabet to be used.
+     * @return Number of characters written.
+     */
+    inline std::size_t Base64EncodeData(const unsigned char *data, const std::size_t &length, char *encoded,
+                                        const bool &padded, const Crypto::Base64AlphabetType &alphabet) noexcept {
+        std::size_t written = Base64EncodeGroups(data, length, encoded, alphabet);
+
+        const std::size_t rest = length % static_cast<std::size_t>(3);
+        if (static_cast<std::size_t>(0) == rest)
+            return written;
+
+        const unsigned char *tail = data + (length - rest);
+        const std::uint32_t group = (static_cast<std::uint32_t>(tail[0]) << 16) |
+                                    ((static_cast<std::size_t>(2) == rest) ? (static_cast<std::uint32_t>(tail[1]) << 8)
+                                                                           : static_cast<std::uint32_t>(0));
+
+        encoded[written++] = alphabet[group >> 18];
+        encoded[written++] = alphabet[(group >> 12) & 0x3F];
+
+        if (static_cast<std::size_t>(2) == rest)
+            encoded[written++] = alphabet[(group >> 6) & 0x3F];
+        else if (padded)
+            encoded[written++] = Crypto::Base64PaddingCharacter;
+
+        if (padded)
+            encoded[written++] = Crypto::Base64PaddingCharacter;
+
+        return written;
+    }
+
+    /**
+     * @brief Decodes the trailing 2 or 3 characters, without padding.
+     * @param[in] tail Characters to be decoded.
+     * @param[in] characters Number of characters. A group of `n` characters holds `n - 1` bytes.
+     * @param[out] decoded Decoded bytes, of which `written` are already written.
+     * @param[in] alphabet Indices map to be used.
+     * @param[in] canonical Whether the unused trailing bits must be zero.
+     * @param[in,out] written Number of bytes written.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     */
+    inline bool Base64DecodeTail(const unsigned char *tail, const std::size_t &characters, unsigned char *decoded,
+                                 const Crypto::Base64IndicesMapType &alphabet, const bool &canonical,
+                                 std::size_t &written) noexcept {
+        auto group = static_cast<std::uint32_t>(0);
+        auto indices = static_cast<unsigned char>(0);
+        for (auto i = static_cast<std::size_t>(0); i < characters; ++i) {
+            const auto index = static_cast<unsigned char>(alphabet[tail[i]]);
+            indices |= index;
+            group |= static_cast<std::uint32_t>(index) << (static_cast<std::size_t>(18) - i * 6);
+        }
+
+        if (0 != (indices & 0x80))
+            return false;
+
+        // The bits below the decoded bytes are not used.
+        const std::size_t bytes = characters - static_cast<std::size_t>(1);
+        const std::uint32_t unused = (static_cast<std::uint32_t>(1) << (static_cast<std::size_t>(24) - bytes * 8)) -
+                                     static_cast<std::uint32_t>(1);
+        if (canonical && static_cast<std::uint32_t>(0) != (group & unused))
+            return false;
+
+        for (auto i = static_cast<std::size_t>(0); i < bytes; ++i)
+            decoded[written++] = static_cast<unsigned char>(group >> (static_cast<std::size_t>(16) - i * 8));
+
+        return true;
+    }
+
+    /**
+     * @brief Decodes data, of which the last group may be padded or not.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Must hold `CalculateBase64DecodedLength(encoded, length)` bytes. May be
+     * `encoded`.
+     * @param[in] alphabet Indices map to be used.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     */
+    inline bool Base64DecodeData(const unsigned char *encoded, const std::size_t &length, unsigned char *decoded,
+                                 const Crypto::Base64IndicesMapType &alphabet, std::size_t &written) noexcept {
+        const std::size_t pos = Base64DecodeGroups(encoded, length, decoded, alphabet);
+        written = pos / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+
+        // Whole groups stop either at the end, or at the last group, or at an invalid group.
+        const std::size_t remaining = length - pos;
+        if (static_cast<std::size_t>(0) == remaining)
+            return true;
+
+        if (static_cast<std::size_t>(4) < remaining)
+            return false;
+
+        const unsigned char *tail = encoded + pos;
+
+        std::size_t characters = remaining;
+        if (static_cast<std::size_t>(4) == characters && Crypto::Base64PaddingCharacter == static_cast<char>(tail[3]))
+            characters -= (Crypto::Base64PaddingCharacter == static_cast<char>(tail[2])) ? static_cast<std::size_t>(2)
+                                                                                          : static_cast<std::size_t>(1);
+
+        // A group of `n` characters holds `n - 1` bytes.
+        if (static_cast<std::size_t>(2) > characters || static_cast<std::size_t>(4) == characters)
+            return false;
+
+        return Base64DecodeTail(tail, characters, decoded, alphabet, false, written);
+    }
+
+    /**
+     * @brief Tells the number of characters of a strictly formed Base64 encoded string, without its padding.
+     * @tparam Padded Whether the padding is required, otherwise, it is forbidden.
+     * @param[in] encoded Base64 encoded string.
+     * @param[in] length Length of `encoded`.
+     * @param[out] characters Number of characters without the padding.
+     * @return `true` if the length and the padding are valid, otherwise, `false`.
+     * @remark Padding characters that are not stripped are left to be rejected as characters outside the alphabet.
+     */
+    template <bool Padded>
+    inline bool Base64StrictLength(const unsigned char *encoded, const std::size_t &length,
+                                   std::size_t &characters) noexcept {
+        characters = length;
+        if constexpr (Padded) {
+            if (static_cast<std::size_t>(0) != length % static_cast<std::size_t>(4))
+                return false;
+
+            for (auto i = 0; i < 2 && static_cast<std::size_t>(0) != characters &&
+                             Crypto::Base64PaddingCharacter == static_cast<char>(encoded[characters - 1]); ++i)
+                --characters;
+
+            return true;
+        }
+
+        return static_cast<std::size_t>(1) != length % static_cast<std::size_t>(4);
+    }
+
+    /**
+     * @brief Validates characters against an indices map.
+     * @param[in] encoded Characters to be validated.
+     * @param[in] length Length of `encoded`.
+     * @param[in] alphabet Indices map to be used.
+     * @return `true` if every character is in the indices map, otherwise, `false`.
+     */
+    inline bool Base64ValidateCharacters(const unsigned char *encoded, const std::size_t &length,
+                                         const Crypto::Base64IndicesMapType &alphabet) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+        if (static_cast<std::size_t>(16) <= length)
+            pos = Base64ValidateBlocks(DetectSIMDLevel(), encoded, length, alphabet);
+
+        // Only `Base64InvalidIndex` has the high bit set, so the indices are merged without branching.
+        auto indices = static_cast<unsigned char>(0);
+        for (; pos < length; ++pos)
+            indices |= static_cast<unsigned char>(alphabet[encoded[pos]]);
+
+        return 0 == (indices & 0x80);
+    }
+
+    /**
+     * @brief Tells if the unused trailing bits of the last character are zero, as written by an encoder.
+     * @param[in] encoded Characters in the indices map, without padding.
+     * @param[in] characters Number of characters.
+     * @param[in] alphabet Indices map to be used.
+     * @return `true` if the trailing bits are zero, otherwise, `false`.
+     */
+    inline bool IsBase64Canonical(const unsigned char *encoded, const std::size_t &characters,
+                                  const Crypto::Base64IndicesMapType &alphabet) noexcept {
+        const std::size_t rest = characters % static_cast<std::size_t>(4);
+        if (static_cast<std::size_t>(0) == rest)
+            return true;
+
+        // 2 characters hold 8 bits of 12, and 3 characters hold 16 bits of 18.
+        const auto last = static_cast<unsigned char>(alphabet[encoded[characters - 1]]);
+        return 0 == (last & ((static_cast<std::size_t>(2) == rest) ? 0x0F : 0x03));
+    }
+
+    /**
+     * @brief Decodes strictly formed characters, without padding.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] characters Number of characters, as told by `Base64StrictLength`.
+     * @param[out] decoded Decoded bytes. Must hold `CalculateBase64DecodedLength(characters)` bytes.
+     * @param[in] alphabet Indices map to be used.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @return `true` if every character is in the indices map and the trailing bits are zero, otherwise, `false`.
+     */
+    inline bool Base64DecodeStrictData(const unsigned char *encoded, const std::size_t &characters,
+                                       unsigned char *decoded, const Crypto::Base64IndicesMapType &alphabet,
+                                       std::size_t &written) noexcept {
+        const std::size_t whole = characters / static_cast<std::size_t>(4) * static_cast<std::size_t>(4);
+        const std::size_t pos = Base64DecodeGroups(encoded, whole, decoded, alphabet);
+        written = pos / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+
+        if (whole != pos)
+            return false;
+
+        return whole == characters || Base64DecodeTail(encoded + whole, characters - whole, decoded, alphabet, true,
+                                                       written);
+    }
+
+    /**
+     * @brief Indices map of an alphabet, built at compile time.
+     * @tparam Alphabet Alphabet.
+     */
+    template <Crypto::Base64AlphabetType Alphabet>
+    inline constexpr Crypto::Base64IndicesMapType Base64IndicesMapOf = Crypto::GenerateBase64IndicesMap(Alphabet);
+
+    /**
+     * @brief Decoding table of an alphabet, built at compile time.
+     * @tparam Alphabet Alphabet.
+     */
+    template <Crypto::Base64AlphabetType Alphabet>
+    inline constexpr Base64DecodingTable Base64DecodingTableOf = GenerateBase64DecodingTable(
+        Base64IndicesMapOf<Alphabet>);
+
+    /**
+     * @brief Encodes data with an alphabet known at compile time.
+     * @tparam Alphabet Alphabet to be used.
+     * @tparam Padded Whether the encoded data should be padded.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters. Must hold `CalculateBase64EncodedLength<Padded>(length)` characters.
+     * @return Number of characters written.
+     * @remark The alphabet is a constant of the instantiation, so it is neither passed nor reloaded in the loops.
+     * @remark The vectorized kernels are used unless the function is evaluated at compile time.
+     */
+    template <Crypto::Base64AlphabetType Alphabet, bool Padded>
+    inline constexpr std::size_t Base64EncodeStatic(const std::byte *data, const std::size_t &length,
+                                                    char *encoded) noexcept {
+        // The length is kept local, as the stores of characters could otherwise alias it.
+        const std::size_t size = length;
+
+        auto pos = static_cast<std::size_t>(0);
+        if (!std::is_constant_evaluated())
+            pos = Base64EncodeBlocks(DetectSIMDLevel(), reinterpret_cast<const unsigned char*>(data), size, encoded,
+                                     Alphabet);
+
+        const auto byte = [data](const std::size_t &i) {
+            return std::to_integer<std::uint32_t>(data[i]);
+        };
+
+        std::size_t written = pos / static_cast<std::size_t>(3) * static_cast<std::size_t>(4);
+        for (; pos + static_cast<std::size_t>(3) <= size; pos += static_cast<std::size_t>(3)) {
+            const std::uint32_t group = (byte(pos) << 16) | (byte(pos + 1) << 8) | byte(pos + 2);
+
+            encoded[written++] = Alphabet[group >> 18];
+            encoded[written++] = Alphabet[(group >> 12) & 0x3F];
+            encoded[written++] = Alphabet[(group >> 6) & 0x3F];
+            encoded[written++] = Alphabet[group & 0x3F];
+        }
+
+        const std::size_t rest = size - pos;
+        if (static_cast<std::size_t>(0) == rest)
+            return written;
+
+        const std::uint32_t group = (byte(pos) << 16) | ((static_cast<std::size_t>(2) == rest)
+                                                              ? (byte(pos + 1) << 8)
+                                                              : static_cast<std::uint32_t>(0));
+
+        encoded[written++] = Alphabet[group >> 18];
+        encoded[written++] = Alphabet[(group >> 12) & 0x3F];
+
+        if (static_cast<std::size_t>(2) == rest)
+            encoded[written++] = Alphabet[(group >> 6) & 0x3F];
+        else if constexpr (Padded)
+            encoded[written++] = Crypto::Base64PaddingCharacter;
+
+        if constexpr (Padded)
+            encoded[written++] = Crypto::Base64PaddingCharacter;
+
+        return written;
+    }
+
+    /**
+     * @brief Decodes data, of which the last group may be padded or not, with an alphabet known at compile time.
+     * @tparam Alphabet Alphabet to be used.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes. Must hold `CalculateBase64DecodedLength(encoded, length)` bytes.
+     * @param[out] written Number of bytes written, including the ones written before a failure.
+     * @return `true` if successfully decoded, otherwise, `false`.
+     * @remark The vectorized kernels are used unless the function is evaluated at compile time.
+     */
+    template <Crypto::Base64AlphabetType Alphabet>
+    inline constexpr bool Base64DecodeStatic(const char *encoded, const std::size_t &length, std::byte *decoded,
+                                             std::size_t &written) noexcept {
+        // Counters are kept local, as the stores of bytes could otherwise alias them.
+        const std::size_t size = length;
+
+        // As in `Base64DecodeGroups`, the last 16 characters are kept from the kernels.
+        auto pos = static_cast<std::size_t>(0);
+        if (!std::is_constant_evaluated() && static_cast<std::size_t>(32) <= size)
+            pos = Base64DecodeBlocks(DetectSIMDLevel(), reinterpret_cast<const unsigned char*>(encoded),
+                                     size - static_cast<std::size_t>(16), reinterpret_cast<unsigned char*>(decoded),
+                                     Base64DecodingTableOf<Alphabet>);
+
+        const auto sextet = [encoded](const std::size_t &i) {
+            return static_cast<std::uint32_t>(static_cast<unsigned char>(
+                Base64IndicesMapOf<Alphabet>[static_cast<unsigned char>(encoded[i])]));
+        };
+
+        std::size_t out = pos / static_cast<std::size_t>(4) * static_cast<std::size_t>(3);
+
+        // Only the characters outside the alphabet have the high bit set.
+        for (; pos + static_cast<std::size_t>(4) <= size; pos += static_cast<std::size_t>(4)) {
+            const std::uint32_t s0 = sextet(pos);
+            const std::uint32_t s1 = sextet(pos + 1);
+            const std::uint32_t s2 = sextet(pos + 2);
+            const std::uint32_t s3 = sextet(pos + 3);
+            if (static_cast<std::uint32_t>(0) != ((s0 | s1 | s2 | s3) & 0x80))
+                break;
+
+            const std::uint32_t group = (s0 << 18) | (s1 << 12) | (s2 << 6) | s3;
+            decoded[out] = static_cast<std::byte>(group >> 16);
+            decoded[out + 1] = static_cast<std::byte>(group >> 8);
+            decoded[out + 2] = static_cast<std::byte>(group);
+            out += static_cast<std::size_t>(3);
+        }
+
+        written = out;
+
+        // Whole groups stop either at the end, or at the last group, or at an invalid group.
+        std::size_t characters = size - pos;
+        if (static_cast<std::size_t>(0) == characters)
+            return true;
+
+        if (static_cast<std::size_t>(4) < characters)
+            return false;
+
+        if (static_cast<std::size_t>(4) == characters && Crypto::Base64PaddingCharacter == encoded[pos + 3])
+            characters -= (Crypto::Base64PaddingCharacter == encoded[pos + 2]) ? static_cast<std::size_t>(2)
+                                                                                : static_cast<std::size_t>(1);
+
+        // A group of `n` characters holds `n - 1` bytes.
+        if (static_cast<std::size_t>(2) > characters || static_cast<std::size_t>(4) == characters)
+            return false;
+
+        auto group = static_cast<std::uint32_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < characters; ++i) {
+            const std::uint32_t value = sextet(pos + i);
+            if (static_cast<std::uint32_t>(0) != (value & 0x80))
+                return false;
+
+            group |= value << (static_cast<std::size_t>(18) - i * 6);
+        }
+
+        for (auto i = static_cast<std::size_t>(0); i < characters - static_cast<std::size_t>(1); ++i)
+            decoded[out++] = static_cast<std::byte>(group >> (static_cast<std::size_t>(16) - i * 8));
+
+        written = out;
+        return true;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
 
 CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     // Generic.
     inline bool IsInBase64Alphabet(const char &character, const Base64AlphabetType &alphabet) noexcept {
-        return std::ranges::any_of(alphabet, [character](const auto &c) {
-            return character == c;
-        });
+        return nullptr != std::memchr(alphabet.data(), character, alphabet.size());
     }
 
     inline bool IsInBase64AlphabetIndicesMap(const char &character, const Base64IndicesMapType &alphabet) noexcept {
-        return '\0' != alphabet[character];
+        return Base64InvalidIndex != alphabet[static_cast<unsigned char>(character)];
     }
 
     // Encoding.
     template <bool Padded>
-    inline std::size_t CalculateBase64EncodedLength(const std::size_t &length) noexcept {
-        if (static_cast<std::size_t>(0) == length)
-            return static_cast<std::size_t>(0);
+    inline constexpr std::size_t CalculateBase64EncodedLength(const std::size_t &length) noexcept {
+        // Whole groups take 4 characters, and the 1 or 2 remaining bytes take 2 or 3 characters, or 4 if padded.
+        const std::size_t rest = length % static_cast<std::size_t>(3);
+        const std::size_t tail = (static_cast<std::size_t>(0) == rest)
+                                     ? static_cast<std::size_t>(0)
+                                     : (Padded ? static_cast<std::size_t>(4) : rest + static_cast<std::size_t>(1));
 
-        if constexpr (Padded) {
-            const std::size_t len = CalculateBase64EncodedLength<false>(length);
-            return (static_cast<std::size_t>(0) == (len % static_cast<std::size_t>(4)))
-                       ? len
-                       : (len + (static_cast<std::size_t>(4) - (len % static_cast<std::size_t>(4))));
-        }
-
-        else {
-            return static_cast<std::size_t>(0) == (length % static_cast<std::size_t>(3))
-                       ? (static_cast<std::size_t>(4) * (length / static_cast<std::size_t>(3)))
-                       : static_cast<std::size_t>(std::ceil(
-                               static_cast<float>(4.0) * static_cast<float>(length) / static_cast<float>(3.0)));
-        }
+        return length / static_cast<std::size_t>(3) * static_cast<std::size_t>(4) + tail;
     }
 
-    inline std::size_t CalculateBase64EncodedLength(const std::size_t &length, const bool &padded) noexcept {
+    inline constexpr std::size_t CalculateBase64EncodedLength(const std::size_t &length,
+                                                               const bool &padded) noexcept {
         return padded ? CalculateBase64EncodedLength<true>(length) : CalculateBase64EncodedLength<false>(length);
     }
 
@@ -82,53 +1140,15 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     template <bool Padded>
     inline bool Base64Encode(const void *data, const std::size_t &length, std::string &encoded,
                              const Base64AlphabetType &alphabet) noexcept {
-        const std::size_t len = CalculateBase64EncodedLength<Padded>(length);
-
         try {
-            encoded.resize(len);
+            encoded.resize(CalculateBase64EncodedLength<Padded>(length));
         }
         catch (...) {
             return false;
         }
 
-        const auto str = static_cast<const unsigned char*>(data);
-
-        const unsigned char *const end = str + length;
-        const unsigned char *pos = str;
-
-        auto offset = static_cast<std::size_t>(0);
-        while (end != pos) {
-            auto c = static_cast<unsigned char>(*pos);
-
-            encoded[offset++] = alphabet[(c >> 2) & 0x3F];
-            encoded[offset++] = alphabet[(c << 4) + ((end != ++pos) ? ((c = *pos) >> 4) : 0)
-                &
-                0x3F];
-
-            if constexpr (Padded) {
-                encoded[offset++] = (end != pos)
-                                        ? alphabet[(c << 2) + ((end != ++pos)
-                                                                   ? ((c = *pos) >> 6)
-                                                                   : 0) & 0x3F]
-                                        : Base64PaddingCharacter;
-                encoded[offset++] = (end != pos) ? alphabet[c & 0x3F] : Base64PaddingCharacter;
-
-                pos = (end != pos) ? ++pos : pos;
-            }
-            else if (end != pos) {
-                if (end != ++pos) {
-                    encoded[offset++] = alphabet[(c << 2) + ((c = *pos) >> 6) & 0x3F];
-                    encoded[offset++] = alphabet[c & 0x3F];
-
-                    ++pos;
-                }
-                else {
-                    encoded[offset++] = alphabet[(c << 2) & 0x3F];
-                    encoded[offset++] = alphabet[c & 0x3F];
-                }
-            }
-        }
-
+        [[maybe_unused]] const std::size_t _ = Internal::Base64EncodeData(static_cast<const unsigned char*>(data),
+                                                                          length, encoded.data(), Padded, alphabet);
         return true;
     }
 
@@ -150,11 +1170,48 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
         return padded ? Base64Encode<true>(str, encoded, alphabet) : Base64Encode<false>(str, encoded, alphabet);
     }
 
+    template <bool Padded>
+    inline bool Base64Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                             std::size_t &written, const Base64AlphabetType &alphabet) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (encoded.size() < CalculateBase64EncodedLength<Padded>(data.size()))
+            return false;
+
+        written = Internal::Base64EncodeData(reinterpret_cast<const unsigned char*>(data.data()), data.size(),
+                                             encoded.data(), Padded, alphabet);
+        return true;
+    }
+
+    inline bool Base64Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                             std::size_t &written, const bool &padded, const Base64AlphabetType &alphabet) noexcept {
+        return padded
+                   ? Base64Encode<true>(data, encoded, written, alphabet)
+                   : Base64Encode<false>(data, encoded, written, alphabet);
+    }
+
     // Decoding.
+    inline constexpr std::size_t CalculateBase64DecodedLength(const std::size_t &length) noexcept {
+        // A trailing group of `n` characters holds `n - 1` bytes.
+        const std::size_t rest = length % static_cast<std::size_t>(4);
+        return length / static_cast<std::size_t>(4) * static_cast<std::size_t>(3) +
+               ((static_cast<std::size_t>(1) < rest) ? rest - static_cast<std::size_t>(1) : static_cast<std::size_t>(
+                    0));
+    }
+
+    inline constexpr std::size_t CalculateBase64DecodedLength(const char *encoded,
+                                                              const std::size_t &length) noexcept {
+        std::size_t characters = length;
+        for (auto i = 0; i < 2 && static_cast<std::size_t>(0) != characters &&
+                         Base64PaddingCharacter == encoded[characters - static_cast<std::size_t>(1)]; ++i)
+            --characters;
+
+        return CalculateBase64DecodedLength(characters);
+    }
+
     template <typename ReturnType>
         requires Base64DecodeReturnTypeRequirement<ReturnType>
     inline ReturnType Base64Decode(const char *encoded, const Base64IndicesMapType &alphabet) noexcept {
-        std::string decoded;
+        ReturnType decoded;
         if (!Base64Decode<ReturnType>(encoded, std::strlen(encoded), decoded, alphabet))
             decoded.clear();
 
@@ -165,7 +1222,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
         requires Base64DecodeReturnTypeRequirement<ReturnType>
     inline ReturnType Base64Decode(const char *encoded, const std::size_t &length,
                                     const Base64IndicesMapType &alphabet) noexcept {
-        std::string decoded;
+        ReturnType decoded;
         if (!Base64Decode<ReturnType>(encoded, length, decoded, alphabet))
             decoded.clear();
 
@@ -189,78 +1246,157 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     inline bool Base64Decode(const char *encoded, const std::size_t &length, ReturnType &decoded,
                              const Base64IndicesMapType &alphabet) noexcept {
         try {
-            decoded.resize(length);
+            decoded.resize(CalculateBase64DecodedLength(encoded, length));
         }
         catch (...) {
             return false;
         }
 
-        const auto u = reinterpret_cast<const unsigned char*>(encoded);
+        std::size_t written;
+        const bool result = Internal::Base64DecodeData(reinterpret_cast<const unsigned char*>(encoded), length,
+                                                       reinterpret_cast<unsigned char*>(decoded.data()), alphabet,
+                                                       written);
 
-        const unsigned char *const end = u + length;
-        const unsigned char *pos = u;
+        decoded.resize(written);
+        return result;
+    }
 
-        auto offset = static_cast<std::size_t>(0);
-        while (end != pos) {
-            const std::size_t remaining = end - pos;
-            if (static_cast<std::size_t>(2) > remaining)
-                return false;
+    template <typename ReturnType>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    inline bool Base64Decode(const std::string &encoded, ReturnType &decoded,
+                             const Base64IndicesMapType &alphabet) noexcept {
+        return Base64Decode<ReturnType>(encoded.c_str(), encoded.length(), decoded, alphabet);
+    }
 
-            unsigned char c[4] = {*pos, *++pos, '\0', '\0'};
-            if (!IsInBase64AlphabetIndicesMap(static_cast<const char>(c[0]), alphabet) ||
-                !IsInBase64AlphabetIndicesMap(static_cast<const char>(c[1]), alphabet))
-                return false;
+    inline bool Base64Decode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                             std::size_t &written, const Base64IndicesMapType &alphabet) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (decoded.size() < CalculateBase64DecodedLength(encoded.data(), encoded.size()))
+            return false;
 
-            decoded[offset++] = static_cast<ReturnType::value_type>((alphabet[c[0]] << 2) | (alphabet[c[1]] >> 4));
+        return Internal::Base64DecodeData(reinterpret_cast<const unsigned char*>(encoded.data()), encoded.size(),
+                                          reinterpret_cast<unsigned char*>(decoded.data()), alphabet, written);
+    }
 
-            if (end == ++pos)
-                break;
+    inline bool Base64DecodeInPlace(const std::span<char> &data, std::size_t &written,
+                                    const Base64IndicesMapType &alphabet) noexcept {
+        return Internal::Base64DecodeData(reinterpret_cast<const unsigned char*>(data.data()), data.size(),
+                                          reinterpret_cast<unsigned char*>(data.data()), alphabet, written);
+    }
 
-            if ('=' == *pos)
-                goto last_padding_test;
+    // Validation.
+    template <bool Padded>
+    inline bool IsValidBase64(const char *encoded, const std::size_t &length,
+                              const Base64IndicesMapType &alphabet) noexcept {
+        const auto characters = reinterpret_cast<const unsigned char*>(encoded);
 
-            c[2] = *pos;
-            if (!IsInBase64AlphabetIndicesMap(static_cast<const char>(c[2]), alphabet))
-                return false;
+        std::size_t count;
+        return Internal::Base64StrictLength<Padded>(characters, length, count) &&
+               Internal::Base64ValidateCharacters(characters, count, alphabet) &&
+               Internal::IsBase64Canonical(characters, count, alphabet);
+    }
 
-            decoded[offset++] = static_cast<ReturnType::value_type>(((alphabet[c[1]] << 4) & 0xF0) | (alphabet[c[2]] >>
-                2));
+    template <bool Padded>
+    inline bool IsValidBase64(const std::string &encoded, const Base64IndicesMapType &alphabet) noexcept {
+        return IsValidBase64<Padded>(encoded.c_str(), encoded.length(), alphabet);
+    }
 
-            if (end == ++pos)
-                break;
+    template <bool Padded>
+    inline bool Base64DecodeStrict(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                                   std::size_t &written, const Base64IndicesMapType &alphabet) noexcept {
+        const auto characters = reinterpret_cast<const unsigned char*>(encoded.data());
 
-            if ('=' == *pos) {
-                ++pos;
-                break;
-            }
+        written = static_cast<std::size_t>(0);
+        std::size_t count;
+        if (!Internal::Base64StrictLength<Padded>(characters, encoded.size(), count) ||
+            decoded.size() < CalculateBase64DecodedLength(count))
+            return false;
 
-            c[3] = *pos;
+        return Internal::Base64DecodeStrictData(characters, count, reinterpret_cast<unsigned char*>(decoded.data()),
+                                                alphabet, written);
+    }
 
-            decoded[offset++] = static_cast<ReturnType::value_type>(((alphabet[c[2]] << 6) & 0xC0) | alphabet[c[3]]);
+    template <bool Padded, typename ReturnType>
+        requires Base64DecodeReturnTypeRequirement<ReturnType>
+    inline bool Base64DecodeStrict(const std::string &encoded, ReturnType &decoded,
+                                   const Base64IndicesMapType &alphabet) noexcept {
+        const auto characters = reinterpret_cast<const unsigned char*>(encoded.data());
 
-            ++pos;
-        }
+        std::size_t count;
+        if (!Internal::Base64StrictLength<Padded>(characters, encoded.length(), count))
+            return false;
 
-    after_loop:
+        try {
+            decoded.resize(CalculateBase64DecodedLength(count));
+        }
+        catch (...) {
+            return false;
+        }
 
-        decoded.resize(offset);
+        std::size_t written;
+        const bool result = Internal::Base64DecodeStrictData(characters, count,
+                                                             reinterpret_cast<unsigned char*>(decoded.data()),
+                                                             alphabet, written);
 
-        return (end == pos);
+        decoded.resize(written);
+        return result;
+    }
 
-    last_padding_test:
-        if (end == ++pos || '=' != *pos)
+    // Compile-time alphabets.
+    template <Base64AlphabetType Alphabet, bool Padded>
+    inline constexpr bool Base64Encode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                                       std::size_t &written) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (encoded.size() < CalculateBase64EncodedLength<Padded>(data.size()))
             return false;
 
-        ++pos;
+        written = Internal::Base64EncodeStatic<Alphabet, Padded>(data.data(), data.size(), encoded.data());
+        return true;
+    }
+
+    template <Base64AlphabetType Alphabet, bool Padded>
+    inline std::string Base64Encode(const std::string &str) noexcept {
+        std::string encoded;
 
-        goto after_loop;
+        try {
+            encoded.resize(CalculateBase64EncodedLength<Padded>(str.length()));
+        }
+        catch (...) {
+            return encoded;
+        }
+
+        [[maybe_unused]] const std::size_t _ = Internal::Base64EncodeStatic<Alphabet, Padded>(
+            reinterpret_cast<const std::byte*>(str.data()), str.length(), encoded.data());
+        return encoded;
     }
 
-    template <typename ReturnType>
+    template <Base64AlphabetType Alphabet>
+    inline constexpr bool Base64Decode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                                       std::size_t &written) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (decoded.size() < CalculateBase64DecodedLength(encoded.data(), encoded.size()))
+            return false;
+
+        return Internal::Base64DecodeStatic<Alphabet>(encoded.data(), encoded.size(), decoded.data(), written);
+    }
+
+    template <Base64AlphabetType Alphabet, typename ReturnType>
         requires Base64DecodeReturnTypeRequirement<ReturnType>
-    inline bool Base64Decode(const std::string &encoded, ReturnType &decoded,
-                             const Base64IndicesMapType &alphabet) noexcept {
-        return Base64Decode<ReturnType>(encoded.c_str(), encoded.length(), decoded, alphabet);
+    inline bool Base64Decode(const std::string &encoded, ReturnType &decoded) noexcept {
+        try {
+            decoded.resize(CalculateBase64DecodedLength(encoded.data(), encoded.length()));
+        }
+        catch (...) {
+            return false;
+        }
+
+        std::size_t written;
+        const bool result = Internal::Base64DecodeStatic<Alphabet>(encoded.data(), encoded.length(),
+                                                                   reinterpret_cast<std::byte*>(decoded.data()),
+                                                                   written);
+
+        decoded.resize(written);
+        return result;
     }
 
 CRONZ_END_MODULE_NAMESPACE
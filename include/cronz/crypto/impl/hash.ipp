@@ -0,0 +1,80 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_IMPL_HASH_HPP
+#define CRONZ_CRYPTO_IMPL_HASH_HPP 1
+
+#include "cronz/crypto/hash.hpp"
+#include "cronz/internal/simd.hpp"
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    // One-shot hashing.
+    inline std::uint64_t Hash64(const std::span<const std::byte> &data, const std::uint64_t &seed) noexcept {
+        return Internal::XXH3Hash64(data.data(), data.size(), seed);
+    }
+
+    inline std::uint64_t Hash64(const std::string &str, const std::uint64_t &seed) noexcept {
+        return Internal::XXH3Hash64(str.data(), str.length(), seed);
+    }
+
+    template <typename Address>
+        requires HashAddressRequirement<Address>
+    inline std::uint64_t Hash64(const Address &address, const std::uint64_t &seed) noexcept {
+        return Internal::XXH3Hash64Short(address.bytes.data(), address.bytes.size(), Internal::XXH3DefaultSecret.data(),
+                                         seed);
+    }
+
+    inline Hash128Type Hash128(const std::span<const std::byte> &data, const std::uint64_t &seed) noexcept {
+        const Internal::UInt128 hash = Internal::XXH3Hash128(data.data(), data.size(), seed);
+        return {hash.low, hash.high};
+    }
+
+    inline Hash128Type Hash128(const std::string &str, const std::uint64_t &seed) noexcept {
+        const Internal::UInt128 hash = Internal::XXH3Hash128(str.data(), str.length(), seed);
+        return {hash.low, hash.high};
+    }
+
+    template <typename Address>
+        requires HashAddressRequirement<Address>
+    inline Hash128Type Hash128(const Address &address, const std::uint64_t &seed) noexcept {
+        const Internal::UInt128 hash = Internal::XXH3Hash128Short(address.bytes.data(), address.bytes.size(),
+                                                                  Internal::XXH3DefaultSecret.data(), seed);
+        return {hash.low, hash.high};
+    }
+
+    // Incremental hashing.
+    inline Hasher::Hasher(const std::uint64_t &seed) noexcept {
+        Internal::XXH3Reset(state_, seed);
+    }
+
+    inline void Hasher::update(const std::span<const std::byte> &data) noexcept {
+        Internal::XXH3Update(Internal::DetectSIMDLevel(), state_, data.data(), data.size());
+    }
+
+    inline void Hasher::update(const std::string &str) noexcept {
+        Internal::XXH3Update(Internal::DetectSIMDLevel(), state_, str.data(), str.length());
+    }
+
+    inline std::uint64_t Hasher::digest64() const noexcept {
+        return Internal::XXH3Digest64(Internal::DetectSIMDLevel(), state_);
+    }
+
+    inline Hash128Type Hasher::digest128() const noexcept {
+        const Internal::UInt128 hash = Internal::XXH3Digest128(Internal::DetectSIMDLevel(), state_);
+        return {hash.low, hash.high};
+    }
+
+    inline void Hasher::reset(const std::uint64_t &seed) noexcept {
+        Internal::XXH3Reset(state_, seed);
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_CRYPTO_IMPL_HASH_HPP
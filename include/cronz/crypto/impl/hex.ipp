@@ -12,23 +12,297 @@
 #define CRONZ_CRYPTO_IMPL_HEX_HPP 1
 
 #include "cronz/crypto/hex.hpp"
+#include "cronz/internal/simd.hpp"
 
-CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
-    inline bool IsHexDigit(const char &nibble) noexcept {
-        return ('0' <= nibble && nibble <= '9') || ('a' <= nibble && nibble <= 'f') || ('A' <= nibble && nibble <= 'F');
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Values of the hex digits, `0xFF` marking the characters that are not hex digits.
+     */
+    inline constexpr std::array<std::uint8_t, static_cast<std::size_t>(256)> HexDigitValues = []() {
+        std::array<std::uint8_t, static_cast<std::size_t>(256)> values{};
+        values.fill(static_cast<std::uint8_t>(0xFF));
+
+        for (auto i = 0; i < 16; ++i) {
+            values[static_cast<unsigned char>(Crypto::HexDigitsLowercase[i])] = static_cast<std::uint8_t>(i);
+            values[static_cast<unsigned char>(Crypto::HexDigitsUppercase[i])] = static_cast<std::uint8_t>(i);
+        }
+
+        return values;
+    }();
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Tells which of 16 characters are hex digits, and their values.
+     * @param[in] in Characters.
+     * @param[out] values Values of the hex digits.
+     * @return `0xFF` for the hex digits, otherwise, `0`.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline __m128i HexDigits(const __m128i &in, __m128i &values) noexcept {
+        // Subtractions move each range to the bottom, where an unsigned minimum bounds it.
+        const __m128i digits = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+        const __m128i letters = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+        const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+
+        values = _mm_or_si128(_mm_and_si128(isDigit, digits),
+                              _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+        return _mm_or_si128(isDigit, isLetter);
     }
 
-    inline std::uint8_t GetHexDigitValue(const char &nibble) noexcept {
-        if ('0' <= nibble && nibble <= '9')
-            return nibble - '0';
+    /**
+     * @brief Tells which of 32 characters are hex digits, and their values.
+     * @param[in] in Characters.
+     * @param[out] values Values of the hex digits.
+     * @return `0xFF` for the hex digits, otherwise, `0`.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i HexDigits(const __m256i &in, __m256i &values) noexcept {
+        const __m256i digits = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+        const __m256i letters = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+
+        const __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+        const __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+
+        values = _mm256_or_si256(_mm256_and_si256(isDigit, digits),
+                                 _mm256_and_si256(isLetter, _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+        return _mm256_or_si256(isDigit, isLetter);
+    }
 
-        if ('a' <= nibble && nibble <= 'f')
-            return nibble - 'a' + 10;
+    /**
+     * @brief Encodes 16 bytes per step with SSSE3.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] digits Hex digits to be used.
+     * @return Number of bytes encoded, a multiple of 16.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t HexEncodeSSSE3(const unsigned char *data, const std::size_t &length,
+                                                                   char *encoded, const char *digits) noexcept {
+        const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
 
-        if ('A' <= nibble && nibble <= 'F')
-            return nibble - 'A' + 10;
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(16) <= length; pos += static_cast<std::size_t>(16)) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            const __m128i high = _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0F)));
+            const __m128i low = _mm_shuffle_epi8(lookup, _mm_and_si128(in, _mm_set1_epi8(0x0F)));
 
-        return static_cast<std::uint8_t>(0);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(encoded + pos * 2), _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(encoded + pos * 2 + 16), _mm_unpackhi_epi8(high, low));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes 32 bytes per step with AVX2.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] digits Hex digits to be used.
+     * @return Number of bytes encoded, a multiple of 32.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t HexEncodeAVX2(const unsigned char *data, const std::size_t &length,
+                                                                 char *encoded, const char *digits) noexcept {
+        const __m256i lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(32) <= length; pos += static_cast<std::size_t>(32)) {
+            // Quarters 0, 2, 1 and 3, so that the in-lane interleaving yields the characters in order.
+            const __m256i in = _mm256_permute4x64_epi64(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)), 0xD8);
+            const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(in, 4),
+                                                                               _mm256_set1_epi8(0x0F)));
+            const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(in, _mm256_set1_epi8(0x0F)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(encoded + pos * 2), _mm256_unpacklo_epi8(high, low));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(encoded + pos * 2 + 32), _mm256_unpackhi_epi8(high, low));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes 32 characters per step with SSSE3.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes.
+     * @return Number of characters decoded, a multiple of 32. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t HexDecodeSSSE3(const unsigned char *encoded,
+                                                                   const std::size_t &length,
+                                                                   unsigned char *decoded) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(32) <= length; pos += static_cast<std::size_t>(32)) {
+            __m128i first;
+            __m128i second;
+            const __m128i valid = _mm_and_si128(
+                HexDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + pos)), first),
+                HexDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + pos + 16)), second));
+
+            if (0xFFFF != _mm_movemask_epi8(valid))
+                break;
+
+            // The high nibble of each pair is weighed 16, then the 16-bit sums are packed into bytes.
+            const __m128i weights = _mm_set1_epi16(0x0110);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(decoded + pos / 2), _mm_packus_epi16(
+                                 _mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights)));
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes 64 characters per step with AVX2.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes.
+     * @return Number of characters decoded, a multiple of 64. Decoding stops before the first invalid step.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline std::size_t HexDecodeAVX2(const unsigned char *encoded, const std::size_t &length,
+                                                                 unsigned char *decoded) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+        for (; pos + static_cast<std::size_t>(64) <= length; pos += static_cast<std::size_t>(64)) {
+            __m256i first;
+            __m256i second;
+            const __m256i valid = _mm256_and_si256(
+                HexDigits(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + pos)), first),
+                HexDigits(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + pos + 32)), second));
+
+            if (-1 != _mm256_movemask_epi8(valid))
+                break;
+
+            // The packing works within lanes, so the quarters are put back in order afterward.
+            const __m256i weights = _mm256_set1_epi16(0x0110);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(decoded + pos / 2), _mm256_permute4x64_epi64(
+                                    _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights),
+                                                        _mm256_maddubs_epi16(second, weights)), 0xD8));
+        }
+
+        return pos;
+    }
+#endif
+
+    /**
+     * @brief Encodes the leading bytes of data with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the data of the higher ones.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters.
+     * @param[in] digits Hex digits to be used.
+     * @return Number of bytes encoded. The rest is left to the portable implementation.
+     */
+    inline std::size_t HexEncodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                       [[maybe_unused]] const unsigned char *data,
+                                       [[maybe_unused]] const std::size_t &length, [[maybe_unused]] char *encoded,
+                                       [[maybe_unused]] const char *digits) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                pos += HexEncodeAVX2(data + pos, length - pos, encoded + pos * 2, digits);
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += HexEncodeSSSE3(data + pos, length - pos, encoded + pos * 2, digits);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Decodes the leading characters with the highest instruction set level available.
+     * @param[in] level Instruction set level. Each level also handles the rest of the characters of the higher ones.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`.
+     * @param[out] decoded Decoded bytes.
+     * @return Number of characters decoded, an even number. The rest, starting with the first invalid character, is
+     * left to the portable implementation.
+     */
+    inline std::size_t HexDecodeBlocks([[maybe_unused]] const SIMDLevel &level,
+                                       [[maybe_unused]] const unsigned char *encoded,
+                                       [[maybe_unused]] const std::size_t &length,
+                                       [[maybe_unused]] unsigned char *decoded) noexcept {
+        auto pos = static_cast<std::size_t>(0);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                pos += HexDecodeAVX2(encoded + pos, length - pos, decoded + pos / 2);
+                if (length - pos >= static_cast<std::size_t>(64))
+                    break;
+
+                [[fallthrough]];
+
+            case SIMDLevel::SSSE3:
+                pos += HexDecodeSSSE3(encoded + pos, length - pos, decoded + pos / 2);
+                break;
+
+            default:
+                break;
+        }
+#endif
+
+        return pos;
+    }
+
+    /**
+     * @brief Encodes data, two hex digits per byte.
+     * @param[in] data Data to be encoded.
+     * @param[in] length Byte length of `data`.
+     * @param[out] encoded Encoded characters. Must hold `2 * length` characters.
+     * @param[in] digits Hex digits to be used.
+     */
+    inline void HexEncodeData(const unsigned char *data, const std::size_t &length, char *encoded,
+                              const char *digits) noexcept {
+        for (std::size_t pos = HexEncodeBlocks(DetectSIMDLevel(), data, length, encoded, digits); pos < length;
+             ++pos) {
+            encoded[pos * 2] = digits[data[pos] >> 4];
+            encoded[pos * 2 + 1] = digits[data[pos] & 0x0F];
+        }
+    }
+
+    /**
+     * @brief Decodes hex digits of either case.
+     * @param[in] encoded Characters to be decoded.
+     * @param[in] length Length of `encoded`, an even number.
+     * @param[out] decoded Decoded bytes. Must hold `length / 2` bytes.
+     * @return `true` if every character is a hex digit, otherwise, `false`.
+     */
+    inline bool HexDecodeData(const unsigned char *encoded, const std::size_t &length,
+                              unsigned char *decoded) noexcept {
+        // Only the characters that are not hex digits have the high bit set, so the values are merged without
+        // branching.
+        auto values = static_cast<std::uint8_t>(0);
+        for (std::size_t pos = HexDecodeBlocks(DetectSIMDLevel(), encoded, length, decoded); pos < length;
+             pos += static_cast<std::size_t>(2)) {
+            const std::uint8_t high = HexDigitValues[encoded[pos]];
+            const std::uint8_t low = HexDigitValues[encoded[pos + 1]];
+
+            values |= high | low;
+            decoded[pos / 2] = static_cast<unsigned char>((high << 4) | low);
+        }
+
+        return 0 == (values & 0x80);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    inline bool IsHexDigit(const char &nibble) noexcept {
+        return static_cast<std::uint8_t>(0xFF) != Internal::HexDigitValues[static_cast<unsigned char>(nibble)];
+    }
+
+    inline std::uint8_t GetHexDigitValue(const char &nibble) noexcept {
+        const std::uint8_t value = Internal::HexDigitValues[static_cast<unsigned char>(nibble)];
+        return (static_cast<std::uint8_t>(0xFF) != value) ? value : static_cast<std::uint8_t>(0);
     }
 
     template <bool Lowercase>
@@ -40,13 +314,82 @@ CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
     }
 
     inline bool HexToByte(const char &n1, const char &n2, std::uint8_t &byte) noexcept {
-        if (!IsHexDigit(n1) || !IsHexDigit(n2))
+        const std::uint8_t high = Internal::HexDigitValues[static_cast<unsigned char>(n1)];
+        const std::uint8_t low = Internal::HexDigitValues[static_cast<unsigned char>(n2)];
+        if (0 != ((high | low) & 0x80))
+            return false;
+
+        byte = static_cast<std::uint8_t>((high << 4) | low);
+        return true;
+    }
+
+    template <bool Lowercase>
+    inline bool HexEncode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                          std::size_t &written) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (encoded.size() / static_cast<std::size_t>(2) < data.size())
+            return false;
+
+        Internal::HexEncodeData(reinterpret_cast<const unsigned char*>(data.data()), data.size(), encoded.data(),
+                                Lowercase ? HexDigitsLowercase.data() : HexDigitsUppercase.data());
+
+        written = data.size() * static_cast<std::size_t>(2);
+        return true;
+    }
+
+    inline bool HexEncode(const std::span<const std::byte> &data, const std::span<char> &encoded,
+                          std::size_t &written, const bool &lowercase) noexcept {
+        return lowercase ? HexEncode<true>(data, encoded, written) : HexEncode<false>(data, encoded, written);
+    }
+
+    template <bool Lowercase>
+    inline std::string HexEncode(const std::span<const std::byte> &data) noexcept {
+        std::string encoded;
+
+        try {
+            encoded.resize(data.size() * static_cast<std::size_t>(2));
+        }
+        catch (...) {
+            return encoded;
+        }
+
+        std::size_t written;
+        [[maybe_unused]] const bool _ = HexEncode<Lowercase>(data, encoded, written);
+        return encoded;
+    }
+
+    inline bool HexDecode(const std::span<const char> &encoded, const std::span<std::byte> &decoded,
+                          std::size_t &written) noexcept {
+        written = static_cast<std::size_t>(0);
+        if (static_cast<std::size_t>(0) != encoded.size() % static_cast<std::size_t>(2) ||
+            decoded.size() < encoded.size() / static_cast<std::size_t>(2))
             return false;
 
-        byte = (GetHexDigitValue(n1) << 4) | GetHexDigitValue(n2);
+        if (!Internal::HexDecodeData(reinterpret_cast<const unsigned char*>(encoded.data()), encoded.size(),
+                                     reinterpret_cast<unsigned char*>(decoded.data())))
+            return false;
+
+        written = encoded.size() / static_cast<std::size_t>(2);
         return true;
     }
 
+    template <typename ReturnType>
+        requires HexDecodeReturnTypeRequirement<ReturnType>
+    inline bool HexDecode(const std::span<const char> &encoded, ReturnType &decoded) noexcept {
+        if (static_cast<std::size_t>(0) != encoded.size() % static_cast<std::size_t>(2))
+            return false;
+
+        try {
+            decoded.resize(encoded.size() / static_cast<std::size_t>(2));
+        }
+        catch (...) {
+            return false;
+        }
+
+        return Internal::HexDecodeData(reinterpret_cast<const unsigned char*>(encoded.data()), encoded.size(),
+                                       reinterpret_cast<unsigned char*>(decoded.data()));
+    }
+
 CRONZ_END_MODULE_NAMESPACE
 
 #endif // CRONZ_CRYPTO_IMPL_HEX_HPP
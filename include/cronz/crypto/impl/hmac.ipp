@@ -0,0 +1,102 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_IMPL_HMAC_HPP
+#define CRONZ_CRYPTO_IMPL_HMAC_HPP 1
+
+#include "cronz/crypto/hmac.hpp"
+
+#include <array>
+#include <cstring>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    // HMAC-SHA256 authentication.
+    inline HMACSHA256::HMACSHA256(const std::span<const std::byte> &key) noexcept {
+        std::array<unsigned char, SHA256::BlockSize> block{};
+
+        if (SHA256::BlockSize < key.size()) {
+            const SHA256::Digest digest = SHA256::Hash(key);
+            std::memcpy(block.data(), digest.data(), digest.size());
+        }
+        else if (!key.empty()) {
+            std::memcpy(block.data(), key.data(), key.size());
+        }
+
+        for (unsigned char &byte : block)
+            byte ^= static_cast<unsigned char>(0x36);
+
+        inner_.update(std::as_bytes(std::span(block)));
+
+        // 0x36 ^ 0x5C turns the inner padding into the outer one.
+        for (unsigned char &byte : block)
+            byte ^= static_cast<unsigned char>(0x36 ^ 0x5C);
+
+        outer_.update(std::as_bytes(std::span(block)));
+        block.fill(static_cast<unsigned char>(0));
+
+        message_ = inner_;
+    }
+
+    inline HMACSHA256::HMACSHA256(const std::string &key) noexcept
+        : HMACSHA256(std::as_bytes(std::span(key.data(), key.length()))) {
+    }
+
+    inline void HMACSHA256::update(const std::span<const std::byte> &data) noexcept {
+        message_.update(data);
+    }
+
+    inline void HMACSHA256::update(const std::string &str) noexcept {
+        message_.update(str);
+    }
+
+    inline HMACSHA256::Digest HMACSHA256::finalize() noexcept {
+        const Digest inner = message_.finalize();
+
+        SHA256 outer = outer_;
+        outer.update(std::as_bytes(std::span(inner)));
+
+        message_ = inner_;
+        return outer.finalize();
+    }
+
+    inline void HMACSHA256::reset() noexcept {
+        message_ = inner_;
+    }
+
+    inline HMACSHA256::Digest HMACSHA256::Hash(const std::span<const std::byte> &key,
+                                               const std::span<const std::byte> &data) noexcept {
+        HMACSHA256 hmac(key);
+        hmac.update(data);
+        return hmac.finalize();
+    }
+
+    inline HMACSHA256::Digest HMACSHA256::Hash(const std::string &key, const std::string &str) noexcept {
+        HMACSHA256 hmac(key);
+        hmac.update(str);
+        return hmac.finalize();
+    }
+
+    // Comparison.
+    inline bool ConstantTimeEqual(const std::span<const std::byte> &a, const std::span<const std::byte> &b) noexcept {
+        if (a.size() != b.size())
+            return false;
+
+        // The differences are accumulated rather than branched on, and the accumulator is read once, at the end.
+        auto difference = static_cast<unsigned char>(0);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            difference |= static_cast<unsigned char>(a[i] ^ b[i]);
+
+        const volatile unsigned char result = difference;
+        return static_cast<unsigned char>(0) == result;
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_CRYPTO_IMPL_HMAC_HPP
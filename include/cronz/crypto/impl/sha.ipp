@@ -0,0 +1,1256 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_IMPL_SHA_HPP
+#define CRONZ_CRYPTO_IMPL_SHA_HPP 1
+
+#include "cronz/crypto/sha.hpp"
+#include "cronz/internal/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Implementations of the SHA compression functions.
+     */
+    enum class SHAImplementation : std::uint8_t {
+        Portable,
+        AVX2,
+        Extensions
+    };
+
+    /**
+     * @brief Detects the fastest implementation of the SHA compression functions.
+     * @return `SHAImplementation::Extensions` if the SHA extensions are supported, otherwise,
+     * `SHAImplementation::AVX2` if AVX2 is supported, otherwise, `SHAImplementation::Portable`.
+     * @remark The AVX2 implementation only compresses several messages at once, and single messages are compressed
+     * with the portable implementation instead.
+     */
+    CRONZ_NODISCARD_L1 inline SHAImplementation DetectSHAImplementation() noexcept {
+        if (DetectSHAExtensions())
+            return SHAImplementation::Extensions;
+
+        if (SIMDLevel::AVX2 <= DetectSIMDLevel())
+            return SHAImplementation::AVX2;
+
+        return SHAImplementation::Portable;
+    }
+
+    /**
+     * @brief SHA-256 round constants.
+     */
+    inline constexpr std::array<std::uint32_t, static_cast<std::size_t>(64)> SHA256RoundConstants = {
+            0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+            0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+            0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+            0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+            0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+            0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+            0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+            0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+    };
+
+    /**
+     * @brief Initial SHA-256 state.
+     */
+    inline constexpr std::array<std::uint32_t, static_cast<std::size_t>(8)> SHA256InitialState = {
+            0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+    };
+
+    /**
+     * @brief Initial SHA-1 state.
+     */
+    inline constexpr std::array<std::uint32_t, static_cast<std::size_t>(5)> SHA1InitialState = {
+            0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0
+    };
+
+    /**
+     * @brief Loads 4 bytes as a big-endian 32-bit word, independently of the host byte order.
+     * @param[in] data Bytes to be loaded.
+     * @return Loaded word, `data[0]` being the most significant byte.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint32_t LoadBE32(const unsigned char *data) noexcept {
+        return (static_cast<std::uint32_t>(data[0]) << 24) | (static_cast<std::uint32_t>(data[1]) << 16) |
+               (static_cast<std::uint32_t>(data[2]) << 8) | static_cast<std::uint32_t>(data[3]);
+    }
+
+    /**
+     * @brief Stores a 32-bit word as 4 big-endian bytes, independently of the host byte order.
+     * @param[in] word Word to be stored.
+     * @param[out] data Stored bytes, `data[0]` being the most significant byte.
+     */
+    inline void StoreBE32(const std::uint32_t &word, unsigned char *data) noexcept {
+        data[0] = static_cast<unsigned char>(word >> 24);
+        data[1] = static_cast<unsigned char>(word >> 16);
+        data[2] = static_cast<unsigned char>(word >> 8);
+        data[3] = static_cast<unsigned char>(word);
+    }
+
+    /**
+     * @brief Pads the end of a message into its last blocks.
+     * @param[in] rest Bytes of the message following its last whole block.
+     * @param[in] restLength Byte length of `rest`, less than 64.
+     * @param[in] length Byte length of the whole message.
+     * @param[out] padded Last blocks. Must hold 128 bytes.
+     * @return Number of blocks in `padded`, which is either 1 or 2.
+     */
+    inline std::size_t SHAPad(const unsigned char *rest, const std::size_t &restLength, const std::uint64_t &length,
+                              unsigned char *padded) noexcept {
+        const std::size_t blocks = restLength < static_cast<std::size_t>(56) ? static_cast<std::size_t>(1) :
+                                                                                 static_cast<std::size_t>(2);
+        const std::size_t end = blocks * static_cast<std::size_t>(64);
+
+        if (0 != restLength)
+            std::memcpy(padded, rest, restLength);
+
+        padded[restLength] = static_cast<unsigned char>(0x80);
+        std::memset(padded + restLength + 1, 0, end - static_cast<std::size_t>(8) - restLength - 1);
+
+        // The length is given in bits.
+        StoreBE32(static_cast<std::uint32_t>(length >> 29), padded + end - 8);
+        StoreBE32(static_cast<std::uint32_t>(length << 3), padded + end - 4);
+
+        return blocks;
+    }
+
+    /**
+     * @brief Writes the digest of a state.
+     * @tparam DigestSize Size of the digest, in bytes.
+     * @param[in] state State.
+     * @return Digest, made of the leading words of `state` in big-endian byte order.
+     */
+    template <std::size_t DigestSize>
+    CRONZ_NODISCARD_L1 inline std::array<std::uint8_t, DigestSize> SHADigest(const std::uint32_t *state) noexcept {
+        std::array<std::uint8_t, DigestSize> digest;
+        for (auto i = static_cast<std::size_t>(0); i < DigestSize / 4; ++i)
+            StoreBE32(state[i], digest.data() + i * 4);
+
+        return digest;
+    }
+
+    /**
+     * @brief Applies a SHA-256 round.
+     * @param[in] a First word of the state.
+     * @param[in] b Second word of the state.
+     * @param[in] c Third word of the state.
+     * @param[in,out] d Fourth word of the state.
+     * @param[in] e Fifth word of the state.
+     * @param[in] f Sixth word of the state.
+     * @param[in] g Seventh word of the state.
+     * @param[in,out] h Eighth word of the state, which becomes the first one.
+     * @param[in] kw Sum of the round constant and the message word.
+     */
+    inline void SHA256Round(const std::uint32_t &a, const std::uint32_t &b, const std::uint32_t &c, std::uint32_t &d,
+                            const std::uint32_t &e, const std::uint32_t &f, const std::uint32_t &g, std::uint32_t &h,
+                            const std::uint32_t &kw) noexcept {
+        const std::uint32_t t1 = h + (std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25)) + (g ^ (e & (f ^ g))) +
+                                 kw;
+        const std::uint32_t t2 = (std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22)) + ((a & b) | (c & (a | b)));
+
+        d += t1;
+        h = t1 + t2;
+    }
+
+    /**
+     * @brief Tells a SHA-256 message word, expanding the message schedule as needed.
+     * @param[in,out] w Last 16 message words.
+     * @param[in] t Index of the word, which follows the previous ones.
+     * @return Message word.
+     */
+    inline std::uint32_t SHA256Word(std::uint32_t (&w)[16], const int &t) noexcept {
+        if (16 <= t) {
+            const std::uint32_t w2 = w[(t - 2) & 15];
+            const std::uint32_t w15 = w[(t - 15) & 15];
+
+            w[t & 15] += (std::rotr(w2, 17) ^ std::rotr(w2, 19) ^ (w2 >> 10)) + w[(t - 7) & 15] +
+                         (std::rotr(w15, 7) ^ std::rotr(w15, 18) ^ (w15 >> 3));
+        }
+
+        return w[t & 15];
+    }
+
+    /**
+     * @brief Compresses blocks into a SHA-256 state.
+     * @param[in,out] state State.
+     * @param[in] blocks Blocks to be compressed.
+     * @param[in] count Number of blocks.
+     */
+    inline void SHA256BlocksPortable(std::uint32_t *state, const unsigned char *blocks,
+                                     const std::size_t &count) noexcept {
+        std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        std::uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            const unsigned char *block = blocks + i * static_cast<std::size_t>(64);
+
+            std::uint32_t w[16];
+            for (auto j = 0; j < 16; ++j)
+                w[j] = LoadBE32(block + j * 4);
+
+            const std::uint32_t a0 = a, b0 = b, c0 = c, d0 = d, e0 = e, f0 = f, g0 = g, h0 = h;
+
+            // The roles of the words rotate with each round, and come back every 8 rounds.
+            for (auto t = 0; t < 64; t += 8) {
+                SHA256Round(a, b, c, d, e, f, g, h, SHA256RoundConstants[t] + SHA256Word(w, t));
+                SHA256Round(h, a, b, c, d, e, f, g, SHA256RoundConstants[t + 1] + SHA256Word(w, t + 1));
+                SHA256Round(g, h, a, b, c, d, e, f, SHA256RoundConstants[t + 2] + SHA256Word(w, t + 2));
+                SHA256Round(f, g, h, a, b, c, d, e, SHA256RoundConstants[t + 3] + SHA256Word(w, t + 3));
+                SHA256Round(e, f, g, h, a, b, c, d, SHA256RoundConstants[t + 4] + SHA256Word(w, t + 4));
+                SHA256Round(d, e, f, g, h, a, b, c, SHA256RoundConstants[t + 5] + SHA256Word(w, t + 5));
+                SHA256Round(c, d, e, f, g, h, a, b, SHA256RoundConstants[t + 6] + SHA256Word(w, t + 6));
+                SHA256Round(b, c, d, e, f, g, h, a, SHA256RoundConstants[t + 7] + SHA256Word(w, t + 7));
+            }
+
+            a += a0, b += b0, c += c0, d += d0, e += e0, f += f0, g += g0, h += h0;
+        }
+
+        state[0] = a, state[1] = b, state[2] = c, state[3] = d;
+        state[4] = e, state[5] = f, state[6] = g, state[7] = h;
+    }
+
+    /**
+     * @brief Applies a SHA-1 round.
+     * @tparam Function Index of the round function, which is the index of the round divided by 20.
+     * @param[in] a First word of the state.
+     * @param[in,out] b Second word of the state.
+     * @param[in] c Third word of the state.
+     * @param[in] d Fourth word of the state.
+     * @param[in,out] e Fifth word of the state, which becomes the first one.
+     * @param[in] w Message word.
+     */
+    template <int Function>
+    inline void SHA1Round(const std::uint32_t &a, std::uint32_t &b, const std::uint32_t &c, const std::uint32_t &d,
+                          std::uint32_t &e, const std::uint32_t &w) noexcept {
+        if constexpr (0 == Function)
+            e += static_cast<std::uint32_t>(0x5A827999) + (d ^ (b & (c ^ d)));
+        else if constexpr (2 == Function)
+            e += static_cast<std::uint32_t>(0x8F1BBCDC) + ((b & c) | (d & (b | c)));
+        else
+            e += (1 == Function ? static_cast<std::uint32_t>(0x6ED9EBA1) : static_cast<std::uint32_t>(0xCA62C1D6)) +
+                 (b ^ c ^ d);
+
+        e += std::rotl(a, 5) + w;
+        b = std::rotl(b, 30);
+    }
+
+    /**
+     * @brief Tells a SHA-1 message word, expanding the message schedule as needed.
+     * @param[in,out] w Last 16 message words.
+     * @param[in] t Index of the word, which follows the previous ones.
+     * @return Message word.
+     */
+    inline std::uint32_t SHA1Word(std::uint32_t (&w)[16], const int &t) noexcept {
+        if (16 <= t)
+            w[t & 15] = std::rotl(w[(t - 3) & 15] ^ w[(t - 8) & 15] ^ w[(t - 14) & 15] ^ w[t & 15], 1);
+
+        return w[t & 15];
+    }
+
+    /**
+     * @brief Applies the 20 SHA-1 rounds sharing a round function.
+     * @tparam Function Index of the round function.
+     * @param[in,out] a First word of the state.
+     * @param[in,out] b Second word of the state.
+     * @param[in,out] c Third word of the state.
+     * @param[in,out] d Fourth word of the state.
+     * @param[in,out] e Fifth word of the state.
+     * @param[in,out] w Last 16 message words.
+     */
+    template <int Function>
+    inline void SHA1Rounds(std::uint32_t &a, std::uint32_t &b, std::uint32_t &c, std::uint32_t &d, std::uint32_t &e,
+                           std::uint32_t (&w)[16]) noexcept {
+        // The roles of the words rotate with each round, and come back every 5 rounds.
+        for (int t = Function * 20; t < Function * 20 + 20; t += 5) {
+            SHA1Round<Function>(a, b, c, d, e, SHA1Word(w, t));
+            SHA1Round<Function>(e, a, b, c, d, SHA1Word(w, t + 1));
+            SHA1Round<Function>(d, e, a, b, c, SHA1Word(w, t + 2));
+            SHA1Round<Function>(c, d, e, a, b, SHA1Word(w, t + 3));
+            SHA1Round<Function>(b, c, d, e, a, SHA1Word(w, t + 4));
+        }
+    }
+
+    /**
+     * @brief Compresses blocks into a SHA-1 state.
+     * @param[in,out] state State.
+     * @param[in] blocks Blocks to be compressed.
+     * @param[in] count Number of blocks.
+     */
+    inline void SHA1BlocksPortable(std::uint32_t *state, const unsigned char *blocks,
+                                   const std::size_t &count) noexcept {
+        std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            const unsigned char *block = blocks + i * static_cast<std::size_t>(64);
+
+            std::uint32_t w[16];
+            for (auto j = 0; j < 16; ++j)
+                w[j] = LoadBE32(block + j * 4);
+
+            const std::uint32_t a0 = a, b0 = b, c0 = c, d0 = d, e0 = e;
+
+            SHA1Rounds<0>(a, b, c, d, e, w);
+            SHA1Rounds<1>(a, b, c, d, e, w);
+            SHA1Rounds<2>(a, b, c, d, e, w);
+            SHA1Rounds<3>(a, b, c, d, e, w);
+
+            a += a0, b += b0, c += c0, d += d0, e += e0;
+        }
+
+        state[0] = a, state[1] = b, state[2] = c, state[3] = d, state[4] = e;
+    }
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Applies 4 SHA-256 rounds to interleaved states with the SHA extensions.
+     * @tparam Lanes Number of states.
+     * @param[in,out] abef Words A, B, E and F of the states.
+     * @param[in,out] cdgh Words C, D, G and H of the states.
+     * @param[in] w Message words of the states.
+     * @param[in] group Index of the rounds divided by 4.
+     */
+    template <std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA256RoundsSHANI(__m128i (&abef)[Lanes], __m128i (&cdgh)[Lanes],
+                                                                 const __m128i (&w)[Lanes], const int &group) noexcept {
+        const __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA256RoundConstants.data() + group * 4));
+
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            const __m128i kw = _mm_add_epi32(w[l], k);
+            cdgh[l] = _mm_sha256rnds2_epu32(cdgh[l], abef[l], kw);
+            abef[l] = _mm_sha256rnds2_epu32(abef[l], cdgh[l], _mm_shuffle_epi32(kw, 0x0E));
+        }
+    }
+
+    /**
+     * @brief Expands the SHA-256 message schedules of interleaved states with the SHA extensions.
+     * @tparam Lanes Number of states.
+     * @param[in,out] w0 Oldest message words, which are replaced by the next ones.
+     * @param[in] w1 Second oldest message words.
+     * @param[in] w2 Third oldest message words.
+     * @param[in] w3 Newest message words.
+     */
+    template <std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA256ScheduleSHANI(__m128i (&w0)[Lanes], const __m128i (&w1)[Lanes],
+                                                                   const __m128i (&w2)[Lanes],
+                                                                   const __m128i (&w3)[Lanes]) noexcept {
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l)
+            w0[l] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(w0[l], w1[l]),
+                                                       _mm_alignr_epi8(w3[l], w2[l], 4)), w3[l]);
+    }
+
+    /**
+     * @brief Compresses blocks into SHA-256 states with the SHA extensions.
+     * @tparam Lanes Number of states, whose rounds are interleaved to hide the latency of the instructions.
+     * @param[in,out] states States.
+     * @param[in] blocks Blocks to be compressed into each state.
+     * @param[in] count Number of blocks of each state.
+     */
+    template <std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA256BlocksSHANI(std::uint32_t *const *states,
+                                                                 const unsigned char *const *blocks,
+                                                                 const std::size_t &count) noexcept {
+        const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0Bll, 0x0405060700010203ll);
+
+        // The instructions take the words as ABEF and CDGH.
+        __m128i abef[Lanes];
+        __m128i cdgh[Lanes];
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            const __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(states[l])), 0xB1);
+            const __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(states[l] + 4)),
+                                                   0x1B);
+
+            abef[l] = _mm_alignr_epi8(abcd, efgh, 8);
+            cdgh[l] = _mm_blend_epi16(efgh, abcd, 0xF0);
+        }
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            __m128i abefSaved[Lanes];
+            __m128i cdghSaved[Lanes];
+            __m128i w0[Lanes];
+            __m128i w1[Lanes];
+            __m128i w2[Lanes];
+            __m128i w3[Lanes];
+
+            for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+                const unsigned char *block = blocks[l] + i * static_cast<std::size_t>(64);
+
+                abefSaved[l] = abef[l];
+                cdghSaved[l] = cdgh[l];
+                w0[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), mask);
+                w1[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16)), mask);
+                w2[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 32)), mask);
+                w3[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 48)), mask);
+            }
+
+            SHA256RoundsSHANI<Lanes>(abef, cdgh, w0, 0);
+            SHA256RoundsSHANI<Lanes>(abef, cdgh, w1, 1);
+            SHA256RoundsSHANI<Lanes>(abef, cdgh, w2, 2);
+            SHA256RoundsSHANI<Lanes>(abef, cdgh, w3, 3);
+
+            for (auto group = 4; group < 16; group += 4) {
+                SHA256ScheduleSHANI<Lanes>(w0, w1, w2, w3);
+                SHA256RoundsSHANI<Lanes>(abef, cdgh, w0, group);
+                SHA256ScheduleSHANI<Lanes>(w1, w2, w3, w0);
+                SHA256RoundsSHANI<Lanes>(abef, cdgh, w1, group + 1);
+                SHA256ScheduleSHANI<Lanes>(w2, w3, w0, w1);
+                SHA256RoundsSHANI<Lanes>(abef, cdgh, w2, group + 2);
+                SHA256ScheduleSHANI<Lanes>(w3, w0, w1, w2);
+                SHA256RoundsSHANI<Lanes>(abef, cdgh, w3, group + 3);
+            }
+
+            for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+                abef[l] = _mm_add_epi32(abef[l], abefSaved[l]);
+                cdgh[l] = _mm_add_epi32(cdgh[l], cdghSaved[l]);
+            }
+        }
+
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            const __m128i feba = _mm_shuffle_epi32(abef[l], 0x1B);
+            const __m128i dchg = _mm_shuffle_epi32(cdgh[l], 0xB1);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(states[l]), _mm_blend_epi16(feba, dchg, 0xF0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(states[l] + 4), _mm_alignr_epi8(dchg, feba, 8));
+        }
+    }
+
+    /**
+     * @brief Applies 4 SHA-1 rounds to interleaved states with the SHA extensions.
+     * @tparam Function Index of the round function, which is the index of the rounds divided by 20.
+     * @tparam First Whether these are the first rounds of the block.
+     * @tparam Lanes Number of states.
+     * @param[in,out] abcd Words A, B, C and D of the states.
+     * @param[in,out] e Word E of the states in the first rounds, and words A, B, C and D preceding the last rounds in
+     * the other ones.
+     * @param[in] w Message words of the states.
+     */
+    template <int Function, bool First = false, std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA1RoundsSHANI(__m128i (&abcd)[Lanes], __m128i (&e)[Lanes],
+                                                               const __m128i (&w)[Lanes]) noexcept {
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            __m128i ew;
+            if constexpr (First)
+                ew = _mm_add_epi32(e[l], w[l]);
+            else
+                ew = _mm_sha1nexte_epu32(e[l], w[l]);
+
+            e[l] = abcd[l];
+            abcd[l] = _mm_sha1rnds4_epu32(abcd[l], ew, Function);
+        }
+    }
+
+    /**
+     * @brief Expands the SHA-1 message schedules of interleaved states with the SHA extensions.
+     * @tparam Lanes Number of states.
+     * @param[in,out] w0 Oldest message words, which are replaced by the next ones.
+     * @param[in] w1 Second oldest message words.
+     * @param[in] w2 Third oldest message words.
+     * @param[in] w3 Newest message words.
+     */
+    template <std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA1ScheduleSHANI(__m128i (&w0)[Lanes], const __m128i (&w1)[Lanes],
+                                                                 const __m128i (&w2)[Lanes],
+                                                                 const __m128i (&w3)[Lanes]) noexcept {
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l)
+            w0[l] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w0[l], w1[l]), w2[l]), w3[l]);
+    }
+
+    /**
+     * @brief Compresses blocks into SHA-1 states with the SHA extensions.
+     * @tparam Lanes Number of states, whose rounds are interleaved to hide the latency of the instructions.
+     * @param[in,out] states States.
+     * @param[in] blocks Blocks to be compressed into each state.
+     * @param[in] count Number of blocks of each state.
+     */
+    template <std::size_t Lanes>
+    CRONZ_SIMD_TARGET("sha,sse4.1") inline void SHA1BlocksSHANI(std::uint32_t *const *states,
+                                                               const unsigned char *const *blocks,
+                                                               const std::size_t &count) noexcept {
+        const __m128i mask = _mm_set_epi64x(0x0001020304050607ll, 0x08090A0B0C0D0E0Fll);
+
+        // The instructions take the words in reverse order, and E in the highest one.
+        __m128i abcd[Lanes];
+        __m128i e[Lanes];
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            abcd[l] = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(states[l])), 0x1B);
+            e[l] = _mm_set_epi32(static_cast<int>(states[l][4]), 0, 0, 0);
+        }
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            __m128i abcdSaved[Lanes];
+            __m128i eSaved[Lanes];
+            __m128i w0[Lanes];
+            __m128i w1[Lanes];
+            __m128i w2[Lanes];
+            __m128i w3[Lanes];
+
+            for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+                const unsigned char *block = blocks[l] + i * static_cast<std::size_t>(64);
+
+                abcdSaved[l] = abcd[l];
+                eSaved[l] = e[l];
+                w0[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), mask);
+                w1[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16)), mask);
+                w2[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 32)), mask);
+                w3[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 48)), mask);
+            }
+
+            // Rounds 0-19.
+            SHA1RoundsSHANI<0, true>(abcd, e, w0);
+            SHA1RoundsSHANI<0>(abcd, e, w1);
+            SHA1RoundsSHANI<0>(abcd, e, w2);
+            SHA1RoundsSHANI<0>(abcd, e, w3);
+            SHA1ScheduleSHANI<Lanes>(w0, w1, w2, w3);
+            SHA1RoundsSHANI<0>(abcd, e, w0);
+
+            // Rounds 20-39.
+            SHA1ScheduleSHANI<Lanes>(w1, w2, w3, w0);
+            SHA1RoundsSHANI<1>(abcd, e, w1);
+            SHA1ScheduleSHANI<Lanes>(w2, w3, w0, w1);
+            SHA1RoundsSHANI<1>(abcd, e, w2);
+            SHA1ScheduleSHANI<Lanes>(w3, w0, w1, w2);
+            SHA1RoundsSHANI<1>(abcd, e, w3);
+            SHA1ScheduleSHANI<Lanes>(w0, w1, w2, w3);
+            SHA1RoundsSHANI<1>(abcd, e, w0);
+            SHA1ScheduleSHANI<Lanes>(w1, w2, w3, w0);
+            SHA1RoundsSHANI<1>(abcd, e, w1);
+
+            // Rounds 40-59.
+            SHA1ScheduleSHANI<Lanes>(w2, w3, w0, w1);
+            SHA1RoundsSHANI<2>(abcd, e, w2);
+            SHA1ScheduleSHANI<Lanes>(w3, w0, w1, w2);
+            SHA1RoundsSHANI<2>(abcd, e, w3);
+            SHA1ScheduleSHANI<Lanes>(w0, w1, w2, w3);
+            SHA1RoundsSHANI<2>(abcd, e, w0);
+            SHA1ScheduleSHANI<Lanes>(w1, w2, w3, w0);
+            SHA1RoundsSHANI<2>(abcd, e, w1);
+            SHA1ScheduleSHANI<Lanes>(w2, w3, w0, w1);
+            SHA1RoundsSHANI<2>(abcd, e, w2);
+
+            // Rounds 60-79.
+            SHA1ScheduleSHANI<Lanes>(w3, w0, w1, w2);
+            SHA1RoundsSHANI<3>(abcd, e, w3);
+            SHA1ScheduleSHANI<Lanes>(w0, w1, w2, w3);
+            SHA1RoundsSHANI<3>(abcd, e, w0);
+            SHA1ScheduleSHANI<Lanes>(w1, w2, w3, w0);
+            SHA1RoundsSHANI<3>(abcd, e, w1);
+            SHA1ScheduleSHANI<Lanes>(w2, w3, w0, w1);
+            SHA1RoundsSHANI<3>(abcd, e, w2);
+            SHA1ScheduleSHANI<Lanes>(w3, w0, w1, w2);
+            SHA1RoundsSHANI<3>(abcd, e, w3);
+
+            for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+                e[l] = _mm_sha1nexte_epu32(e[l], eSaved[l]);
+                abcd[l] = _mm_add_epi32(abcd[l], abcdSaved[l]);
+            }
+        }
+
+        for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(states[l]), _mm_shuffle_epi32(abcd[l], 0x1B));
+            states[l][4] = static_cast<std::uint32_t>(_mm_extract_epi32(e[l], 3));
+        }
+    }
+
+    /**
+     * @brief Rotates the words of a vector to the right.
+     * @tparam Bits Number of bits to rotate by.
+     * @param[in] x Vector.
+     * @return Rotated vector.
+     */
+    template <int Bits>
+    CRONZ_SIMD_TARGET("avx2") inline __m256i SHARotateRight(const __m256i &x) noexcept {
+        return _mm256_or_si256(_mm256_srli_epi32(x, Bits), _mm256_slli_epi32(x, 32 - Bits));
+    }
+
+    /**
+     * @brief Loads 32 bytes of each of 8 blocks as 8 vectors of big-endian words, each vector holding a word of all
+     * the blocks.
+     * @param[in] blocks Blocks.
+     * @param[in] offset Offset of the bytes within the blocks.
+     * @param[out] w Words.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void SHALoadWordsAVX2(const unsigned char *const *blocks,
+                                                           const std::size_t &offset, __m256i *w) noexcept {
+        const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+        __m256i rows[8];
+        for (auto l = 0; l < 8; ++l)
+            rows[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + offset));
+
+        // 8x8 transposition of the words.
+        __m256i pairs[8];
+        for (auto l = 0; l < 8; l += 2) {
+            pairs[l] = _mm256_unpacklo_epi32(rows[l], rows[l + 1]);
+            pairs[l + 1] = _mm256_unpackhi_epi32(rows[l], rows[l + 1]);
+        }
+
+        __m256i quads[8];
+        for (auto l = 0; l < 8; l += 4) {
+            quads[l] = _mm256_unpacklo_epi64(pairs[l], pairs[l + 2]);
+            quads[l + 1] = _mm256_unpackhi_epi64(pairs[l], pairs[l + 2]);
+            quads[l + 2] = _mm256_unpacklo_epi64(pairs[l + 1], pairs[l + 3]);
+            quads[l + 3] = _mm256_unpackhi_epi64(pairs[l + 1], pairs[l + 3]);
+        }
+
+        for (auto j = 0; j < 4; ++j) {
+            w[j] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(quads[j], quads[j + 4], 0x20), mask);
+            w[j + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(quads[j], quads[j + 4], 0x31), mask);
+        }
+    }
+
+    /**
+     * @brief Applies a SHA-256 round to 8 states with AVX2.
+     * @param[in] a First words of the states.
+     * @param[in] b Second words of the states.
+     * @param[in] c Third words of the states.
+     * @param[in,out] d Fourth words of the states.
+     * @param[in] e Fifth words of the states.
+     * @param[in] f Sixth words of the states.
+     * @param[in] g Seventh words of the states.
+     * @param[in,out] h Eighth words of the states, which become the first ones.
+     * @param[in] kw Sums of the round constant and the message words.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void SHA256RoundAVX2(const __m256i &a, const __m256i &b, const __m256i &c,
+                                                          __m256i &d, const __m256i &e, const __m256i &f,
+                                                          const __m256i &g, __m256i &h, const __m256i &kw) noexcept {
+        const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(SHARotateRight<6>(e), SHARotateRight<11>(e)),
+                                            SHARotateRight<25>(e));
+        const __m256i ch = _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+        const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1), _mm256_add_epi32(ch, kw));
+
+        const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(SHARotateRight<2>(a), SHARotateRight<13>(a)),
+                                            SHARotateRight<22>(a));
+        const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+
+        d = _mm256_add_epi32(d, t1);
+        h = _mm256_add_epi32(t1, _mm256_add_epi32(s0, maj));
+    }
+
+    /**
+     * @brief Tells the SHA-256 message words of 8 states, expanding the message schedules as needed.
+     * @param[in,out] w Last 16 message words of the states.
+     * @param[in] t Index of the words, which follow the previous ones.
+     * @return Sums of the round constant and the message words.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i SHA256WordAVX2(__m256i (&w)[16], const int &t) noexcept {
+        if (16 <= t) {
+            const __m256i w2 = w[(t - 2) & 15];
+            const __m256i w15 = w[(t - 15) & 15];
+            const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(SHARotateRight<17>(w2), SHARotateRight<19>(w2)),
+                                                _mm256_srli_epi32(w2, 10));
+            const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(SHARotateRight<7>(w15), SHARotateRight<18>(w15)),
+                                                _mm256_srli_epi32(w15, 3));
+
+            w[t & 15] = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], s1), _mm256_add_epi32(w[(t - 7) & 15], s0));
+        }
+
+        return _mm256_add_epi32(w[t & 15], _mm256_set1_epi32(static_cast<int>(SHA256RoundConstants[t])));
+    }
+
+    /**
+     * @brief Compresses blocks into 8 SHA-256 states with AVX2, each state taking the words of a vector.
+     * @param[in,out] states States.
+     * @param[in] blocks Blocks to be compressed into each state.
+     * @param[in] count Number of blocks of each state.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void SHA256BlocksAVX2(std::uint32_t *const *states,
+                                                           const unsigned char *const *blocks,
+                                                           const std::size_t &count) noexcept {
+        alignas(32) std::uint32_t lanes[8][8];
+        for (auto j = 0; j < 8; ++j)
+            for (auto l = 0; l < 8; ++l)
+                lanes[j][l] = states[l][j];
+
+        __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[0]));
+        __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[1]));
+        __m256i c = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[2]));
+        __m256i d = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[3]));
+        __m256i e = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[4]));
+        __m256i f = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[5]));
+        __m256i g = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[6]));
+        __m256i h = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[7]));
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            const auto offset = i * static_cast<std::size_t>(64);
+
+            __m256i w[16];
+            SHALoadWordsAVX2(blocks, offset, w);
+            SHALoadWordsAVX2(blocks, offset + static_cast<std::size_t>(32), w + 8);
+
+            const __m256i a0 = a, b0 = b, c0 = c, d0 = d, e0 = e, f0 = f, g0 = g, h0 = h;
+
+            for (auto t = 0; t < 64; t += 8) {
+                SHA256RoundAVX2(a, b, c, d, e, f, g, h, SHA256WordAVX2(w, t));
+                SHA256RoundAVX2(h, a, b, c, d, e, f, g, SHA256WordAVX2(w, t + 1));
+                SHA256RoundAVX2(g, h, a, b, c, d, e, f, SHA256WordAVX2(w, t + 2));
+                SHA256RoundAVX2(f, g, h, a, b, c, d, e, SHA256WordAVX2(w, t + 3));
+                SHA256RoundAVX2(e, f, g, h, a, b, c, d, SHA256WordAVX2(w, t + 4));
+                SHA256RoundAVX2(d, e, f, g, h, a, b, c, SHA256WordAVX2(w, t + 5));
+                SHA256RoundAVX2(c, d, e, f, g, h, a, b, SHA256WordAVX2(w, t + 6));
+                SHA256RoundAVX2(b, c, d, e, f, g, h, a, SHA256WordAVX2(w, t + 7));
+            }
+
+            a = _mm256_add_epi32(a, a0), b = _mm256_add_epi32(b, b0);
+            c = _mm256_add_epi32(c, c0), d = _mm256_add_epi32(d, d0);
+            e = _mm256_add_epi32(e, e0), f = _mm256_add_epi32(f, f0);
+            g = _mm256_add_epi32(g, g0), h = _mm256_add_epi32(h, h0);
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), a);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), b);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), c);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), d);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[4]), e);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[5]), f);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[6]), g);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[7]), h);
+
+        for (auto j = 0; j < 8; ++j)
+            for (auto l = 0; l < 8; ++l)
+                states[l][j] = lanes[j][l];
+    }
+
+    /**
+     * @brief Applies a SHA-1 round to 8 states with AVX2.
+     * @tparam Function Index of the round function, which is the index of the round divided by 20.
+     * @param[in] a First words of the states.
+     * @param[in,out] b Second words of the states.
+     * @param[in] c Third words of the states.
+     * @param[in] d Fourth words of the states.
+     * @param[in,out] e Fifth words of the states, which become the first ones.
+     * @param[in] w Message words.
+     */
+    template <int Function>
+    CRONZ_SIMD_TARGET("avx2") inline void SHA1RoundAVX2(const __m256i &a, __m256i &b, const __m256i &c,
+                                                        const __m256i &d, __m256i &e, const __m256i &w) noexcept {
+        constexpr std::array<std::uint32_t, static_cast<std::size_t>(4)> constants = {
+                0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+        };
+
+        __m256i function;
+        if constexpr (0 == Function)
+            function = _mm256_xor_si256(d, _mm256_and_si256(b, _mm256_xor_si256(c, d)));
+        else if constexpr (2 == Function)
+            function = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c)));
+        else
+            function = _mm256_xor_si256(b, _mm256_xor_si256(c, d));
+
+        e = _mm256_add_epi32(_mm256_add_epi32(e, SHARotateRight<27>(a)), _mm256_add_epi32(function, w));
+        e = _mm256_add_epi32(e, _mm256_set1_epi32(static_cast<int>(constants[Function])));
+        b = SHARotateRight<2>(b);
+    }
+
+    /**
+     * @brief Tells the SHA-1 message words of 8 states, expanding the message schedules as needed.
+     * @param[in,out] w Last 16 message words of the states.
+     * @param[in] t Index of the words, which follow the previous ones.
+     * @return Message words.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline __m256i SHA1WordAVX2(__m256i (&w)[16], const int &t) noexcept {
+        if (16 <= t)
+            w[t & 15] = SHARotateRight<31>(_mm256_xor_si256(_mm256_xor_si256(w[(t - 3) & 15], w[(t - 8) & 15]),
+                                                            _mm256_xor_si256(w[(t - 14) & 15], w[t & 15])));
+
+        return w[t & 15];
+    }
+
+    /**
+     * @brief Applies the 20 SHA-1 rounds sharing a round function to 8 states with AVX2.
+     * @tparam Function Index of the round function.
+     * @param[in,out] a First words of the states.
+     * @param[in,out] b Second words of the states.
+     * @param[in,out] c Third words of the states.
+     * @param[in,out] d Fourth words of the states.
+     * @param[in,out] e Fifth words of the states.
+     * @param[in,out] w Last 16 message words of the states.
+     */
+    template <int Function>
+    CRONZ_SIMD_TARGET("avx2") inline void SHA1RoundsAVX2(__m256i &a, __m256i &b, __m256i &c, __m256i &d, __m256i &e,
+                                                         __m256i (&w)[16]) noexcept {
+        for (int t = Function * 20; t < Function * 20 + 20; t += 5) {
+            SHA1RoundAVX2<Function>(a, b, c, d, e, SHA1WordAVX2(w, t));
+            SHA1RoundAVX2<Function>(e, a, b, c, d, SHA1WordAVX2(w, t + 1));
+            SHA1RoundAVX2<Function>(d, e, a, b, c, SHA1WordAVX2(w, t + 2));
+            SHA1RoundAVX2<Function>(c, d, e, a, b, SHA1WordAVX2(w, t + 3));
+            SHA1RoundAVX2<Function>(b, c, d, e, a, SHA1WordAVX2(w, t + 4));
+        }
+    }
+
+    /**
+     * @brief Compresses blocks into 8 SHA-1 states with AVX2, each state taking the words of a vector.
+     * @param[in,out] states States.
+     * @param[in] blocks Blocks to be compressed into each state.
+     * @param[in] count Number of blocks of each state.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void SHA1BlocksAVX2(std::uint32_t *const *states,
+                                                         const unsigned char *const *blocks,
+                                                         const std::size_t &count) noexcept {
+        alignas(32) std::uint32_t lanes[5][8];
+        for (auto j = 0; j < 5; ++j)
+            for (auto l = 0; l < 8; ++l)
+                lanes[j][l] = states[l][j];
+
+        __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[0]));
+        __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[1]));
+        __m256i c = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[2]));
+        __m256i d = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[3]));
+        __m256i e = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[4]));
+
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            const auto offset = i * static_cast<std::size_t>(64);
+
+            __m256i w[16];
+            SHALoadWordsAVX2(blocks, offset, w);
+            SHALoadWordsAVX2(blocks, offset + static_cast<std::size_t>(32), w + 8);
+
+            const __m256i a0 = a, b0 = b, c0 = c, d0 = d, e0 = e;
+
+            SHA1RoundsAVX2<0>(a, b, c, d, e, w);
+            SHA1RoundsAVX2<1>(a, b, c, d, e, w);
+            SHA1RoundsAVX2<2>(a, b, c, d, e, w);
+            SHA1RoundsAVX2<3>(a, b, c, d, e, w);
+
+            a = _mm256_add_epi32(a, a0), b = _mm256_add_epi32(b, b0), c = _mm256_add_epi32(c, c0);
+            d = _mm256_add_epi32(d, d0), e = _mm256_add_epi32(e, e0);
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), a);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), b);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), c);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), d);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[4]), e);
+
+        for (auto j = 0; j < 5; ++j)
+            for (auto l = 0; l < 8; ++l)
+                states[l][j] = lanes[j][l];
+    }
+
+#endif
+
+    /**
+     * @brief Compresses blocks into a SHA-256 state.
+     * @param[in] implementation Implementation to be used. `SHAImplementation::AVX2` falls back to the portable one.
+     * @param[in,out] state State.
+     * @param[in] blocks Blocks to be compressed.
+     * @param[in] count Number of blocks.
+     */
+    inline void SHA256Blocks([[maybe_unused]] const SHAImplementation &implementation, std::uint32_t *state,
+                             const unsigned char *blocks, const std::size_t &count) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SHAImplementation::Extensions == implementation) {
+            SHA256BlocksSHANI<1>(&state, &blocks, count);
+            return;
+        }
+#endif
+
+        SHA256BlocksPortable(state, blocks, count);
+    }
+
+    /**
+     * @brief Compresses blocks into a SHA-1 state.
+     * @param[in] implementation Implementation to be used. `SHAImplementation::AVX2` falls back to the portable one.
+     * @param[in,out] state State.
+     * @param[in] blocks Blocks to be compressed.
+     * @param[in] count Number of blocks.
+     */
+    inline void SHA1Blocks([[maybe_unused]] const SHAImplementation &implementation, std::uint32_t *state,
+                           const unsigned char *blocks, const std::size_t &count) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SHAImplementation::Extensions == implementation) {
+            SHA1BlocksSHANI<1>(&state, &blocks, count);
+            return;
+        }
+#endif
+
+        SHA1BlocksPortable(state, blocks, count);
+    }
+
+    /**
+     * @brief Appends data to an incremental SHA message.
+     * @tparam Blocks Function compressing blocks, such as `SHA256Blocks`.
+     * @tparam Words Number of words of the state.
+     * @param[in,out] state State.
+     * @param[in,out] buffer Bytes of the message following its last compressed block.
+     * @param[in,out] length Byte length of the message.
+     * @param[in] data Data to be appended.
+     * @param[in] size Byte length of `data`.
+     */
+    template <auto Blocks, std::size_t Words>
+    inline void SHAUpdate(std::array<std::uint32_t, Words> &state,
+                          std::array<unsigned char, static_cast<std::size_t>(64)> &buffer, std::uint64_t &length,
+                          const unsigned char *data, std::size_t size) noexcept {
+        if (0 == size)
+            return;
+
+        const SHAImplementation implementation = DetectSHAImplementation();
+        const auto used = static_cast<std::size_t>(length % static_cast<std::uint64_t>(64));
+        length += static_cast<std::uint64_t>(size);
+
+        if (0 != used) {
+            const std::size_t taken = std::min(static_cast<std::size_t>(64) - used, size);
+            std::memcpy(buffer.data() + used, data, taken);
+
+            if (used + taken < static_cast<std::size_t>(64))
+                return;
+
+            Blocks(implementation, state.data(), buffer.data(), static_cast<std::size_t>(1));
+            data += taken;
+            size -= taken;
+        }
+
+        if (static_cast<std::size_t>(64) <= size) {
+            Blocks(implementation, state.data(), data, size / static_cast<std::size_t>(64));
+            data += size & ~static_cast<std::size_t>(63);
+            size &= static_cast<std::size_t>(63);
+        }
+
+        if (0 != size)
+            std::memcpy(buffer.data(), data, size);
+    }
+
+    /**
+     * @brief Completes an incremental SHA message.
+     * @tparam Blocks Function compressing blocks, such as `SHA256Blocks`.
+     * @tparam DigestSize Size of the digest, in bytes.
+     * @tparam Words Number of words of the state.
+     * @param[in,out] state State, which is left compressed with the padding.
+     * @param[in] buffer Bytes of the message following its last compressed block.
+     * @param[in] length Byte length of the message.
+     * @return Digest of the message.
+     */
+    template <auto Blocks, std::size_t DigestSize, std::size_t Words>
+    CRONZ_NODISCARD_L1 inline std::array<std::uint8_t, DigestSize> SHAFinalize(
+            std::array<std::uint32_t, Words> &state,
+            const std::array<unsigned char, static_cast<std::size_t>(64)> &buffer,
+            const std::uint64_t &length) noexcept {
+        unsigned char padded[128];
+        const std::size_t blocks = SHAPad(buffer.data(), static_cast<std::size_t>(length % static_cast<std::uint64_t>(
+                                                             64)), length, padded);
+
+        Blocks(DetectSHAImplementation(), state.data(), padded, blocks);
+        return SHADigest<DigestSize>(state.data());
+    }
+
+    /**
+     * @brief Hashes many messages, spreading them over parallel lanes.
+     * @tparam Lanes Number of lanes.
+     * @tparam DigestSize Size of the digests, in bytes.
+     * @tparam Words Number of words of the states.
+     * @tparam Message Type of a function telling a message, as `std::span<const std::byte>`, by its index.
+     * @tparam Kernel Type of a function compressing blocks into `Lanes` states, such as `SHA256BlocksSHANI<Lanes>`.
+     * @param[in] count Number of messages.
+     * @param[in] message Function telling a message by its index.
+     * @param[in] initial Initial state.
+     * @param[in] kernel Function compressing blocks into `Lanes` states.
+     * @param[out] digests Digests of the messages.
+     * @remark Each lane takes the next message as soon as its one is done, and the lanes are compressed together for
+     * as many blocks as all of them have in a row. Idle lanes repeat the blocks of another lane into a scratch state.
+     */
+    template <std::size_t Lanes, std::size_t DigestSize, std::size_t Words, typename Message, typename Kernel>
+    inline void SHAHashMessages(const std::size_t &count, const Message &message,
+                                const std::array<std::uint32_t, Words> &initial, const Kernel &kernel,
+                                std::array<std::uint8_t, DigestSize> *digests) noexcept {
+        struct Lane {
+            std::array<std::uint32_t, Words> state;
+            const unsigned char *blocks;
+            std::size_t remaining;
+            std::size_t index;
+            bool padding;
+            std::size_t paddingBlocks;
+            unsigned char padded[128];
+        };
+
+        std::array<Lane, Lanes> lanes;
+        std::array<std::array<std::uint32_t, Words>, Lanes> scratch{};
+        const std::size_t total = count;
+        auto next = static_cast<std::size_t>(0);
+
+        // Starts the next message on a lane, or leaves it idle once there are no more.
+        const auto start = [&](Lane &lane) noexcept {
+            lane.index = next;
+            if (total == next)
+                return;
+
+            ++next;
+
+            const std::span<const std::byte> data = message(lane.index);
+            const auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+            const std::size_t whole = data.size() / static_cast<std::size_t>(64);
+
+            lane.state = initial;
+            lane.paddingBlocks = SHAPad(bytes + whole * static_cast<std::size_t>(64), data.size() % static_cast<
+                                            std::size_t>(64), static_cast<std::uint64_t>(data.size()), lane.padded);
+            lane.padding = 0 == whole;
+            lane.blocks = lane.padding ? lane.padded : bytes;
+            lane.remaining = lane.padding ? lane.paddingBlocks : whole;
+        };
+
+        for (Lane &lane : lanes)
+            start(lane);
+
+        for (;;) {
+            const Lane *active = nullptr;
+            auto step = static_cast<std::size_t>(0);
+            for (const Lane &lane : lanes) {
+                if (total != lane.index && (nullptr == active || lane.remaining < step)) {
+                    active = &lane;
+                    step = lane.remaining;
+                }
+            }
+
+            if (nullptr == active)
+                break;
+
+            std::array<std::uint32_t*, Lanes> states;
+            std::array<const unsigned char*, Lanes> blocks;
+            for (auto l = static_cast<std::size_t>(0); l < Lanes; ++l) {
+                const bool idle = total == lanes[l].index;
+                states[l] = idle ? scratch[l].data() : lanes[l].state.data();
+                blocks[l] = idle ? active->blocks : lanes[l].blocks;
+            }
+
+            kernel(states.data(), blocks.data(), step);
+
+            for (Lane &lane : lanes) {
+                if (total == lane.index)
+                    continue;
+
+                lane.blocks += step * static_cast<std::size_t>(64);
+                lane.remaining -= step;
+                if (0 != lane.remaining)
+                    continue;
+
+                if (!lane.padding) {
+                    lane.padding = true;
+                    lane.blocks = lane.padded;
+                    lane.remaining = lane.paddingBlocks;
+                } else {
+                    digests[lane.index] = SHADigest<DigestSize>(lane.state.data());
+                    start(lane);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Hashes many messages with SHA-256.
+     * @tparam Message Type of a function telling a message, as `std::span<const std::byte>`, by its index.
+     * @param[in] implementation Implementation to be used.
+     * @param[in] count Number of messages.
+     * @param[in] message Function telling a message by its index.
+     * @param[out] digests Digests of the messages.
+     */
+    template <typename Message>
+    inline void SHA256HashMessages(const SHAImplementation &implementation, const std::size_t &count,
+                                   const Message &message, Crypto::SHA256::Digest *digests) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (implementation) {
+            case SHAImplementation::Extensions:
+                SHAHashMessages<2>(count, message, SHA256InitialState, SHA256BlocksSHANI<2>, digests);
+                return;
+
+            case SHAImplementation::AVX2:
+                SHAHashMessages<8>(count, message, SHA256InitialState, SHA256BlocksAVX2, digests);
+                return;
+
+            default:
+                break;
+        }
+#else
+        static_cast<void>(implementation);
+#endif
+
+        SHAHashMessages<1>(count, message, SHA256InitialState, [](std::uint32_t *const *states,
+                                                                  const unsigned char *const *blocks,
+                                                                  const std::size_t &n) noexcept {
+            SHA256BlocksPortable(states[0], blocks[0], n);
+        }, digests);
+    }
+
+    /**
+     * @brief Hashes many messages with SHA-1.
+     * @tparam Message Type of a function telling a message, as `std::span<const std::byte>`, by its index.
+     * @param[in] implementation Implementation to be used.
+     * @param[in] count Number of messages.
+     * @param[in] message Function telling a message by its index.
+     * @param[out] digests Digests of the messages.
+     */
+    template <typename Message>
+    inline void SHA1HashMessages(const SHAImplementation &implementation, const std::size_t &count,
+                                 const Message &message, Crypto::SHA1::Digest *digests) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (implementation) {
+            case SHAImplementation::Extensions:
+                SHAHashMessages<2>(count, message, SHA1InitialState, SHA1BlocksSHANI<2>, digests);
+                return;
+
+            case SHAImplementation::AVX2:
+                SHAHashMessages<8>(count, message, SHA1InitialState, SHA1BlocksAVX2, digests);
+                return;
+
+            default:
+                break;
+        }
+#else
+        static_cast<void>(implementation);
+#endif
+
+        SHAHashMessages<1>(count, message, SHA1InitialState, [](std::uint32_t *const *states,
+                                                                const unsigned char *const *blocks,
+                                                                const std::size_t &n) noexcept {
+            SHA1BlocksPortable(states[0], blocks[0], n);
+        }, digests);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    // SHA256 constructors.
+    inline SHA256::SHA256() noexcept {
+        reset();
+    }
+
+    // SHA256 hashing.
+    inline void SHA256::update(const std::span<const std::byte> &data) noexcept {
+        Internal::SHAUpdate<Internal::SHA256Blocks>(state_, buffer_, length_, reinterpret_cast<const unsigned char*>(
+                                                        data.data()), data.size());
+    }
+
+    inline void SHA256::update(const std::string &str) noexcept {
+        Internal::SHAUpdate<Internal::SHA256Blocks>(state_, buffer_, length_, reinterpret_cast<const unsigned char*>(
+                                                        str.data()), str.size());
+    }
+
+    inline SHA256::Digest SHA256::finalize() noexcept {
+        const Digest digest = Internal::SHAFinalize<Internal::SHA256Blocks, DigestSize>(state_, buffer_, length_);
+        reset();
+
+        return digest;
+    }
+
+    inline void SHA256::reset() noexcept {
+        state_ = Internal::SHA256InitialState;
+        length_ = static_cast<std::uint64_t>(0);
+    }
+
+    // SHA256 static utility functions.
+    inline SHA256::Digest SHA256::Hash(const std::span<const std::byte> &data) noexcept {
+        SHA256 sha;
+        sha.update(data);
+
+        return sha.finalize();
+    }
+
+    inline SHA256::Digest SHA256::Hash(const std::string &str) noexcept {
+        SHA256 sha;
+        sha.update(str);
+
+        return sha.finalize();
+    }
+
+    inline bool SHA256::Hash(const std::span<const std::span<const std::byte>> &messages,
+                             const std::span<Digest> &digests) noexcept {
+        if (digests.size() < messages.size())
+            return false;
+
+        Internal::SHA256HashMessages(Internal::DetectSHAImplementation(), messages.size(),
+                                     [&messages](const std::size_t &i) noexcept {
+            return messages[i];
+        }, digests.data());
+
+        return true;
+    }
+
+    inline bool SHA256::Hash(const std::span<const std::string> &messages, const std::span<Digest> &digests) noexcept {
+        if (digests.size() < messages.size())
+            return false;
+
+        Internal::SHA256HashMessages(Internal::DetectSHAImplementation(), messages.size(),
+                                     [&messages](const std::size_t &i) noexcept {
+            return std::as_bytes(std::span(messages[i].data(), messages[i].size()));
+        }, digests.data());
+
+        return true;
+    }
+
+    // SHA1 constructors.
+    inline SHA1::SHA1() noexcept {
+        reset();
+    }
+
+    // SHA1 hashing.
+    inline void SHA1::update(const std::span<const std::byte> &data) noexcept {
+        Internal::SHAUpdate<Internal::SHA1Blocks>(state_, buffer_, length_, reinterpret_cast<const unsigned char*>(
+                                                      data.data()), data.size());
+    }
+
+    inline void SHA1::update(const std::string &str) noexcept {
+        Internal::SHAUpdate<Internal::SHA1Blocks>(state_, buffer_, length_, reinterpret_cast<const unsigned char*>(
+                                                      str.data()), str.size());
+    }
+
+    inline SHA1::Digest SHA1::finalize() noexcept {
+        const Digest digest = Internal::SHAFinalize<Internal::SHA1Blocks, DigestSize>(state_, buffer_, length_);
+        reset();
+
+        return digest;
+    }
+
+    inline void SHA1::reset() noexcept {
+        state_ = Internal::SHA1InitialState;
+        length_ = static_cast<std::uint64_t>(0);
+    }
+
+    // SHA1 static utility functions.
+    inline SHA1::Digest SHA1::Hash(const std::span<const std::byte> &data) noexcept {
+        SHA1 sha;
+        sha.update(data);
+
+        return sha.finalize();
+    }
+
+    inline SHA1::Digest SHA1::Hash(const std::string &str) noexcept {
+        SHA1 sha;
+        sha.update(str);
+
+        return sha.finalize();
+    }
+
+    inline bool SHA1::Hash(const std::span<const std::span<const std::byte>> &messages,
+                           const std::span<Digest> &digests) noexcept {
+        if (digests.size() < messages.size())
+            return false;
+
+        Internal::SHA1HashMessages(Internal::DetectSHAImplementation(), messages.size(),
+                                   [&messages](const std::size_t &i) noexcept {
+            return messages[i];
+        }, digests.data());
+
+        return true;
+    }
+
+    inline bool SHA1::Hash(const std::span<const std::string> &messages, const std::span<Digest> &digests) noexcept {
+        if (digests.size() < messages.size())
+            return false;
+
+        Internal::SHA1HashMessages(Internal::DetectSHAImplementation(), messages.size(),
+                                   [&messages](const std::size_t &i) noexcept {
+            return std::as_bytes(std::span(messages[i].data(), messages[i].size()));
+        }, digests.data());
+
+        return true;
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_CRYPTO_IMPL_SHA_HPP
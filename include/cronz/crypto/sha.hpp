@@ -0,0 +1,274 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_CRYPTO_SHA_HPP
+#define CRONZ_CRYPTO_SHA_HPP 1
+
+/**
+ * @defgroup cronz_crypto_sha SHA
+ * @ingroup cronz_crypto
+ * @remark Follows the instructions from [FIPS 180-4](https://csrc.nist.gov/pubs/fips/180-4/upd1/final).
+ * @remark The digests are plain bytes, so they can be written with `HexEncode` or `Base64Encode` over
+ * `std::as_bytes(std::span(digest))`.
+ */
+
+#include "cronz/crypto/types.hpp"
+#include "cronz/internal/config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(Crypto)
+    /**
+     * @ingroup cronz_crypto_sha
+     * @brief Incremental SHA-256 hashing.
+     * @class SHA256
+     * @remark The blocks are compressed with the SHA extensions when the processor supports them, and with a portable
+     * implementation otherwise.
+     * @remark Many short messages, such as URLs, are better hashed at once with `SHA256::Hash(messages, digests)`,
+     * which compresses the blocks of several messages in parallel lanes.
+     */
+    class SHA256 {
+        // Properties.
+        std::array<std::uint32_t, static_cast<std::size_t>(8)> state_;
+        std::array<unsigned char, static_cast<std::size_t>(64)> buffer_;
+        std::uint64_t length_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Size of a digest, in bytes.
+         */
+        inline static constexpr std::size_t DigestSize = static_cast<std::size_t>(32);
+
+        /**
+         * @brief Size of a block, in bytes.
+         */
+        inline static constexpr std::size_t BlockSize = static_cast<std::size_t>(64);
+
+        /**
+         * @brief Digest type.
+         */
+        using Digest = std::array<std::uint8_t, DigestSize>;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor, which starts a new message.
+         */
+        SHA256() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Hashing.
+         */
+        /** @{ */
+        /**
+         * @brief Appends data to the message.
+         * @param[in] data Data to be appended.
+         */
+        void update(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Appends a string to the message.
+         * @param[in] str String to be appended.
+         */
+        void update(const std::string &str) noexcept;
+
+        /**
+         * @brief Completes the message.
+         * @return Digest of the message.
+         * @remark A new message is started afterwards.
+         */
+        CRONZ_NODISCARD_L1 Digest finalize() noexcept;
+
+        /**
+         * @brief Discards the message and starts a new one.
+         */
+        void reset() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Static utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Hashes data.
+         * @param[in] data Data to be hashed.
+         * @return Digest of the data.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Hashes a string.
+         * @param[in] str String to be hashed.
+         * @return Digest of the string.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::string &str) noexcept;
+
+        /**
+         * @brief Hashes many messages at once.
+         * @param[in] messages Messages to be hashed.
+         * @param[out] digests Digests of the messages, in the same order. Must hold as many digests as `messages`.
+         * @return `true` if successfully hashed, otherwise, `false`, which is when `digests` is too small.
+         * @remark The messages are spread over parallel lanes, each one taking the next message as soon as it is done.
+         * The lanes are interleaved SHA extension streams, or AVX2 words on processors without the SHA extensions.
+         */
+        CRONZ_NODISCARD_L2 static bool Hash(const std::span<const std::span<const std::byte>> &messages,
+                                            const std::span<Digest> &digests) noexcept;
+
+        /**
+         * @brief Hashes many strings at once.
+         * @param[in] messages Strings to be hashed.
+         * @param[out] digests Digests of the strings, in the same order. Must hold as many digests as `messages`.
+         * @return `true` if successfully hashed, otherwise, `false`, which is when `digests` is too small.
+         * @see `SHA256::Hash(messages, digests)` over byte spans.
+         */
+        CRONZ_NODISCARD_L2 static bool Hash(const std::span<const std::string> &messages,
+                                            const std::span<Digest> &digests) noexcept;
+
+        /** @} */
+    };
+
+    /**
+     * @ingroup cronz_crypto_sha
+     * @brief Incremental SHA-1 hashing.
+     * @class SHA1
+     * @remark SHA-1 is not collision resistant, so it should only be used where it is required by a protocol, or for
+     * fingerprints that are not exposed to an adversary.
+     * @remark The blocks are compressed with the SHA extensions when the processor supports them, and with a portable
+     * implementation otherwise.
+     */
+    class SHA1 {
+        // Properties.
+        std::array<std::uint32_t, static_cast<std::size_t>(5)> state_;
+        std::array<unsigned char, static_cast<std::size_t>(64)> buffer_;
+        std::uint64_t length_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Size of a digest, in bytes.
+         */
+        inline static constexpr std::size_t DigestSize = static_cast<std::size_t>(20);
+
+        /**
+         * @brief Size of a block, in bytes.
+         */
+        inline static constexpr std::size_t BlockSize = static_cast<std::size_t>(64);
+
+        /**
+         * @brief Digest type.
+         */
+        using Digest = std::array<std::uint8_t, DigestSize>;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor, which starts a new message.
+         */
+        SHA1() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Hashing.
+         */
+        /** @{ */
+        /**
+         * @brief Appends data to the message.
+         * @param[in] data Data to be appended.
+         */
+        void update(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Appends a string to the message.
+         * @param[in] str String to be appended.
+         */
+        void update(const std::string &str) noexcept;
+
+        /**
+         * @brief Completes the message.
+         * @return Digest of the message.
+         * @remark A new message is started afterwards.
+         */
+        CRONZ_NODISCARD_L1 Digest finalize() noexcept;
+
+        /**
+         * @brief Discards the message and starts a new one.
+         */
+        void reset() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Static utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Hashes data.
+         * @param[in] data Data to be hashed.
+         * @return Digest of the data.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::span<const std::byte> &data) noexcept;
+
+        /**
+         * @brief Hashes a string.
+         * @param[in] str String to be hashed.
+         * @return Digest of the string.
+         */
+        CRONZ_NODISCARD_L1 static Digest Hash(const std::string &str) noexcept;
+
+        /**
+         * @brief Hashes many messages at once.
+         * @param[in] messages Messages to be hashed.
+         * @param[out] digests Digests of the messages, in the same order. Must hold as many digests as `messages`.
+         * @return `true` if successfully hashed, otherwise, `false`, which is when `digests` is too small.
+         * @see `SHA256::Hash(messages, digests)` for the lanes.
+         */
+        CRONZ_NODISCARD_L2 static bool Hash(const std::span<const std::span<const std::byte>> &messages,
+                                            const std::span<Digest> &digests) noexcept;
+
+        /**
+         * @brief Hashes many strings at once.
+         * @param[in] messages Strings to be hashed.
+         * @param[out] digests Digests of the strings, in the same order. Must hold as many digests as `messages`.
+         * @return `true` if successfully hashed, otherwise, `false`, which is when `digests` is too small.
+         */
+        CRONZ_NODISCARD_L2 static bool Hash(const std::span<const std::string> &messages,
+                                            const std::span<Digest> &digests) noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/crypto/impl/sha.ipp"
+
+#endif // CRONZ_CRYPTO_SHA_HPP
@@ -0,0 +1,71 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_ENDIAN_HPP
+#define CRONZ_INTERNAL_ENDIAN_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+#include "cronz/internal/config.hpp"
+
+#include <bit>
+#include <cstdint>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Reverses the bytes of a 32-bit word.
+     * @param[in] word Word to be reversed.
+     * @return Reversed word.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint32_t ByteSwap32(const std::uint32_t &word) noexcept {
+        return ((word & static_cast<std::uint32_t>(0x000000FFu)) << 24) |
+               ((word & static_cast<std::uint32_t>(0x0000FF00u)) << 8) |
+               ((word & static_cast<std::uint32_t>(0x00FF0000u)) >> 8) |
+               ((word & static_cast<std::uint32_t>(0xFF000000u)) >> 24);
+    }
+
+    /**
+     * @brief Reverses the bytes of a 64-bit word.
+     * @param[in] word Word to be reversed.
+     * @return Reversed word.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t ByteSwap64(const std::uint64_t &word) noexcept {
+        return (static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(word))) << 32) |
+               static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(word >> 32)));
+    }
+
+    /**
+     * @brief Converts a 32-bit word between network (big-endian) and host byte order.
+     * @param[in] word Word to be converted.
+     * @return Converted word.
+     * @remark The conversion is symmetric, so the same function serves both directions.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint32_t NetworkToHost32(const std::uint32_t &word) noexcept {
+        if constexpr (std::endian::little == std::endian::native)
+            return ByteSwap32(word);
+        else
+            return word;
+    }
+
+    /**
+     * @brief Converts a 64-bit word between network (big-endian) and host byte order.
+     * @param[in] word Word to be converted.
+     * @return Converted word.
+     * @remark The conversion is symmetric, so the same function serves both directions.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t NetworkToHost64(const std::uint64_t &word) noexcept {
+        if constexpr (std::endian::little == std::endian::native)
+            return ByteSwap64(word);
+        else
+            return word;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_ENDIAN_HPP
@@ -0,0 +1,89 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_HASH_HPP
+#define CRONZ_INTERNAL_HASH_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+#include "cronz/internal/xxh3.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Finalizes a 64-bit value so that every input bit affects every output bit.
+     * @param[in] value Value to be mixed.
+     * @return Mixed value.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t HashMix(std::uint64_t value) noexcept {
+        value ^= value >> 33;
+        value *= static_cast<std::uint64_t>(0xFF51AFD7ED558CCDull);
+        value ^= value >> 33;
+        value *= static_cast<std::uint64_t>(0xC4CEB9FE1A85EC53ull);
+        value ^= value >> 33;
+        return value;
+    }
+
+    /**
+     * @brief Combines a hash with another value in an order-dependent way.
+     * @param[in] hash Current hash.
+     * @param[in] value Value to be combined.
+     * @return Combined hash.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t HashCombine(const std::uint64_t &hash,
+                                                                 const std::uint64_t &value) noexcept {
+        return HashMix(hash ^ (value + static_cast<std::uint64_t>(0x9E3779B97F4A7C15ull) + (hash << 6) + (hash >> 2)));
+    }
+
+    /**
+     * @brief Hashes a byte sequence.
+     * @param[in] data Data to be hashed.
+     * @param[in] length Byte length of `data`.
+     * @param[in] seed Seed.
+     * @return 64-bit hash of `data`, which is its XXH3 hash.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t HashBytes(const void *data, const std::size_t &length,
+                                                     const std::uint64_t &seed = static_cast<std::uint64_t>(0))
+        noexcept {
+        return XXH3Hash64(data, length, seed);
+    }
+
+    /**
+     * @brief Transparent string hasher for hash tables, which hashes with `HashBytes`.
+     * @remark Being transparent, it lets the tables keyed by `std::string` be looked up with `std::string_view`,
+     * without building a key.
+     */
+    struct StringHash {
+        using is_transparent = void;
+
+        /**
+         * @brief Hashes a string.
+         * @param[in] str String to be hashed.
+         * @return Hash of `str`.
+         */
+        CRONZ_NODISCARD_L1 std::size_t operator()(const std::string_view &str) const noexcept {
+            return static_cast<std::size_t>(HashBytes(str.data(), str.length()));
+        }
+    };
+
+    /**
+     * @brief Hash table keyed by strings, hashed with `StringHash` and looked up with any string type.
+     * @tparam Value Value type.
+     */
+    template <typename Value>
+    using StringMap = std::unordered_map<std::string, Value, StringHash, std::equal_to<>>;
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_HASH_HPP
@@ -0,0 +1,170 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_SIMD_HPP
+#define CRONZ_INTERNAL_SIMD_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+#include "cronz/internal/config.hpp"
+
+#include <cstdint>
+
+// Instruction sets selected at run time, for kernels compiled with per-function targets. Define `CRONZ_DISABLE_SIMD` to
+// force the portable implementations.
+#ifndef CRONZ_DISABLE_SIMD
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CRONZ_SIMD_DISPATCH 1
+#define CRONZ_SIMD_TARGET(targets) __attribute__((target(targets)))
+#endif
+#endif
+
+#ifdef CRONZ_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Instruction set levels of run-time dispatched kernels, each one including the previous ones.
+     */
+    enum class SIMDLevel : std::uint8_t {
+        None,
+        SSSE3,
+        AVX2,
+        AVX512VBMI
+    };
+
+    /**
+     * @brief Detects the highest instruction set level supported by the processor and the operating system.
+     * @return Detected level, which is `SIMDLevel::None` if `CRONZ_SIMD_DISPATCH` is not defined.
+     * @remark The detection is done once, upon the first call.
+     */
+    CRONZ_NODISCARD_L1 inline SIMDLevel DetectSIMDLevel() noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        static const SIMDLevel level = []() noexcept {
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+                return SIMDLevel::AVX512VBMI;
+
+            if (__builtin_cpu_supports("avx2"))
+                return SIMDLevel::AVX2;
+
+            if (__builtin_cpu_supports("ssse3"))
+                return SIMDLevel::SSSE3;
+
+            return SIMDLevel::None;
+        }();
+
+        return level;
+#else
+        return SIMDLevel::None;
+#endif
+    }
+
+    /**
+     * @brief Detects the SHA extensions, which are not part of the `SIMDLevel` order.
+     * @return `true` if SHA and SSE4.1 instructions are supported, always `false` if `CRONZ_SIMD_DISPATCH` is not
+     * defined.
+     * @remark The detection is done once, upon the first call.
+     */
+    CRONZ_NODISCARD_L1 inline bool DetectSHAExtensions() noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        static const bool supported = []() noexcept {
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+        }();
+
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Loads 8 bytes as a little-endian 64-bit word, independently of the host byte order.
+     * @param[in] data Bytes to be loaded.
+     * @return Loaded word, `data[0]` being the least significant byte.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t LoadLE64(const void *data) noexcept {
+        const auto bytes = static_cast<const unsigned char*>(data);
+
+        auto word = static_cast<std::uint64_t>(0);
+        for (auto i = 0; i < 8; ++i)
+            word |= static_cast<std::uint64_t>(bytes[i]) << (i * 8);
+
+        return word;
+    }
+
+    /**
+     * @brief Marks the bytes of a word equal to a character.
+     * @param[in] word Word to be searched.
+     * @param[in] c Character.
+     * @return Word with the high bit set in exactly the bytes equal to `c`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t SWAREqual(const std::uint64_t &word, const char &c) noexcept {
+        constexpr auto low7 = static_cast<std::uint64_t>(0x7F7F7F7F7F7F7F7Full);
+
+        const std::uint64_t x = word ^ (static_cast<std::uint64_t>(0x0101010101010101ull) *
+                                        static_cast<unsigned char>(c));
+        return ~(((x & low7) + low7) | x | low7);
+    }
+
+    /**
+     * @brief Marks the bytes of a word within a character range.
+     * @tparam Low Lower bound of the range, inclusive. Must be an ASCII character.
+     * @tparam High Upper bound of the range, inclusive. Must be an ASCII character.
+     * @param[in] word Word to be searched.
+     * @return Word with the high bit set in exactly the bytes within `Low`-`High`.
+     */
+    template <unsigned char Low, unsigned char High>
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t SWARRange(const std::uint64_t &word) noexcept {
+        static_assert(Low <= High && High < static_cast<unsigned char>(0x80));
+
+        constexpr auto ones = static_cast<std::uint64_t>(0x0101010101010101ull);
+        const std::uint64_t b = word & static_cast<std::uint64_t>(0x7F7F7F7F7F7F7F7Full);
+
+        // `b + (0x80 - Low)` overflows into the high bit from `Low` on, and `b + (0x7F - High)` past `High`.
+        return (b + ones * static_cast<std::uint64_t>(0x80 - Low)) & ~(b + ones * static_cast<std::uint64_t>(
+            0x7F - High)) & ~word & static_cast<std::uint64_t>(0x8080808080808080ull);
+    }
+
+    /**
+     * @brief Marks the ASCII decimal digits of a word.
+     * @param[in] word Word to be searched.
+     * @return Word with the high bit set in exactly the bytes within `'0'`-`'9'`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t SWARDigits(const std::uint64_t &word) noexcept {
+        return SWARRange<'0', '9'>(word);
+    }
+
+    /**
+     * @brief Marks the ASCII hexadecimal digits of a word, in either case.
+     * @param[in] word Word to be searched.
+     * @return Word with the high bit set in exactly the bytes within `'0'`-`'9'`, `'a'`-`'f'` and `'A'`-`'F'`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t SWARHexDigits(const std::uint64_t &word) noexcept {
+        // Setting 0x20 folds the uppercase letters (and only them) onto the lowercase ones.
+        return SWARRange<'0', '9'>(word) | SWARRange<'a', 'f'>(word | static_cast<std::uint64_t>(
+            0x2020202020202020ull));
+    }
+
+    /**
+     * @brief Gathers the high bits of the bytes of a word.
+     * @param[in] word Word with marked bytes (see `SWAREqual`, `SWARDigits`).
+     * @return 8-bit mask, bit `i` being the high bit of byte `i`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint32_t SWARMask(const std::uint64_t &word) noexcept {
+        return static_cast<std::uint32_t>(((word >> 7) * static_cast<std::uint64_t>(0x0102040810204080ull)) >> 56);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_SIMD_HPP
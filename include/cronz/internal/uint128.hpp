@@ -0,0 +1,112 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_UINT128_HPP
+#define CRONZ_INTERNAL_UINT128_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+#include "cronz/internal/config.hpp"
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Unsigned 128-bit integer made of two 64-bit halves, with the operations needed by address arithmetic.
+     * @remark Members are ordered so that the defaulted comparisons are numeric.
+     */
+    struct UInt128 {
+        std::uint64_t high;
+        std::uint64_t low;
+
+        CRONZ_NODISCARD_L1 friend constexpr bool operator==(const UInt128 &a, const UInt128 &b) noexcept = default;
+
+        CRONZ_NODISCARD_L1 friend constexpr std::strong_ordering operator<=>(const UInt128 &a,
+                                                                             const UInt128 &b) noexcept = default;
+    };
+
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator~(const UInt128 &a) noexcept {
+        return {~a.high, ~a.low};
+    }
+
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator|(const UInt128 &a, const UInt128 &b) noexcept {
+        return {a.high | b.high, a.low | b.low};
+    }
+
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator&(const UInt128 &a, const UInt128 &b) noexcept {
+        return {a.high & b.high, a.low & b.low};
+    }
+
+    /**
+     * @brief Shifts right.
+     * @param[in] a Word to be shifted.
+     * @param[in] shift Shift count, within `0`-`127`.
+     * @return Shifted word.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator>>(const UInt128 &a, const std::uint32_t &shift) noexcept {
+        if (static_cast<std::uint32_t>(64) <= shift)
+            return {static_cast<std::uint64_t>(0), a.high >> (shift - static_cast<std::uint32_t>(64))};
+
+        if (static_cast<std::uint32_t>(0) == shift)
+            return a;
+
+        return {a.high >> shift, (a.low >> shift) | (a.high << (static_cast<std::uint32_t>(64) - shift))};
+    }
+
+    /**
+     * @brief Adds a 64-bit word, wrapping around.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator+(const UInt128 &a, const std::uint64_t &b) noexcept {
+        const std::uint64_t low = a.low + b;
+        return {a.high + static_cast<std::uint64_t>(low < b), low};
+    }
+
+    /**
+     * @brief Subtracts a 64-bit word, wrapping around.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 operator-(const UInt128 &a, const std::uint64_t &b) noexcept {
+        return {a.high - static_cast<std::uint64_t>(a.low < b), a.low - b};
+    }
+
+    /**
+     * @brief Multiplies two 64-bit words into a 128-bit one.
+     * @param[in] a Multiplicand.
+     * @param[in] b Multiplier.
+     * @return Full product.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr UInt128 MultiplyFull(const std::uint64_t &a, const std::uint64_t &b) noexcept {
+#ifdef __SIZEOF_INT128__
+        __extension__ const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#else
+        const std::uint64_t lolo = (a & static_cast<std::uint64_t>(0xFFFFFFFF)) * (b & static_cast<std::uint64_t>(
+            0xFFFFFFFF));
+        const std::uint64_t hilo = (a >> 32) * (b & static_cast<std::uint64_t>(0xFFFFFFFF));
+        const std::uint64_t lohi = (a & static_cast<std::uint64_t>(0xFFFFFFFF)) * (b >> 32);
+        const std::uint64_t hihi = (a >> 32) * (b >> 32);
+
+        const std::uint64_t cross = (lolo >> 32) + (hilo & static_cast<std::uint64_t>(0xFFFFFFFF)) + lohi;
+        return {(hilo >> 32) + (cross >> 32) + hihi, (cross << 32) | (lolo & static_cast<std::uint64_t>(0xFFFFFFFF))};
+#endif
+    }
+
+    /**
+     * @brief Counts the trailing zero bits.
+     * @param[in] a Word to be counted.
+     * @return Number of trailing zero bits. `128` for zero.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr int CountTrailingZeros(const UInt128 &a) noexcept {
+        return (static_cast<std::uint64_t>(0) != a.low) ? std::countr_zero(a.low) : (64 + std::countr_zero(a.high));
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_UINT128_HPP
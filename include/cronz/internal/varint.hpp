@@ -0,0 +1,76 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_VARINT_HPP
+#define CRONZ_INTERNAL_VARINT_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Tells the number of bytes in the LEB128 representation of a value.
+     * @param[in] value Value.
+     * @return Number of bytes, in `[1, 10]`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::size_t VarintLength(std::uint64_t value) noexcept {
+        auto length = static_cast<std::size_t>(1);
+        while (static_cast<std::uint64_t>(0x80) <= value) {
+            value >>= 7;
+            ++length;
+        }
+
+        return length;
+    }
+
+    /**
+     * @brief Writes a value in LEB128 representation.
+     * @param[in] value Value.
+     * @param[out] out Output. Must have room for `VarintLength(value)` bytes.
+     * @return Number of bytes written.
+     */
+    inline std::size_t EncodeVarint(std::uint64_t value, unsigned char *out) noexcept {
+        auto length = static_cast<std::size_t>(0);
+        while (static_cast<std::uint64_t>(0x80) <= value) {
+            out[length++] = static_cast<unsigned char>(value | static_cast<std::uint64_t>(0x80));
+            value >>= 7;
+        }
+
+        out[length++] = static_cast<unsigned char>(value);
+        return length;
+    }
+
+    /**
+     * @brief Reads a value in LEB128 representation.
+     * @param[in,out] beg Input. Upon success, advanced past the value.
+     * @param[in] end End of the input.
+     * @param[out] value Value.
+     * @return `true` if a complete value within 64 bits is read, otherwise, `false`.
+     */
+    CRONZ_NODISCARD_L2 inline bool DecodeVarint(const unsigned char *&beg, const unsigned char *end,
+                                                std::uint64_t &value) noexcept {
+        value = static_cast<std::uint64_t>(0);
+
+        for (auto shift = static_cast<unsigned>(0); beg < end && shift < static_cast<unsigned>(64); shift += 7) {
+            const unsigned char byte = *beg++;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if (0 == (byte & 0x80))
+                return true;
+        }
+
+        return false;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_VARINT_HPP
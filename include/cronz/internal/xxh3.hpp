@@ -0,0 +1,912 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_INTERNAL_XXH3_HPP
+#define CRONZ_INTERNAL_XXH3_HPP 1
+
+#include "cronz/internal/namespace.hpp"
+#include "cronz/internal/config.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/simd.hpp"
+#include "cronz/internal/uint128.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// XXH3 of xxHash 0.8 (https://github.com/Cyan4973/xxHash), whose hashes are stable across versions and platforms.
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    inline constexpr auto XXH3Prime32_1 = static_cast<std::uint32_t>(0x9E3779B1);
+    inline constexpr auto XXH3Prime32_2 = static_cast<std::uint32_t>(0x85EBCA77);
+    inline constexpr auto XXH3Prime32_3 = static_cast<std::uint32_t>(0xC2B2AE3D);
+    inline constexpr auto XXH3Prime64_1 = static_cast<std::uint64_t>(0x9E3779B185EBCA87ull);
+    inline constexpr auto XXH3Prime64_2 = static_cast<std::uint64_t>(0xC2B2AE3D27D4EB4Full);
+    inline constexpr auto XXH3Prime64_3 = static_cast<std::uint64_t>(0x165667B19E3779F9ull);
+    inline constexpr auto XXH3Prime64_4 = static_cast<std::uint64_t>(0x85EBCA77C2B2AE63ull);
+    inline constexpr auto XXH3Prime64_5 = static_cast<std::uint64_t>(0x27D4EB2F165667C5ull);
+    inline constexpr auto XXH3PrimeMX1 = static_cast<std::uint64_t>(0x165667919E3779F9ull);
+    inline constexpr auto XXH3PrimeMX2 = static_cast<std::uint64_t>(0x9FB21C651E98DF25ull);
+
+    /**
+     * @brief Size of an XXH3 secret, in bytes.
+     */
+    inline constexpr auto XXH3SecretSize = static_cast<std::size_t>(192);
+
+    /**
+     * @brief Size of an XXH3 stripe, in bytes. A stripe is accumulated into all the accumulators at once.
+     */
+    inline constexpr auto XXH3StripeSize = static_cast<std::size_t>(64);
+
+    /**
+     * @brief Number of XXH3 stripes in a block, after which the accumulators are scrambled.
+     */
+    inline constexpr auto XXH3BlockStripes = static_cast<std::size_t>(16);
+
+    /**
+     * @brief Longest input hashed without the accumulators.
+     */
+    inline constexpr auto XXH3MidSizeMax = static_cast<std::size_t>(240);
+
+    /**
+     * @brief Default XXH3 secret.
+     */
+    inline constexpr std::array<unsigned char, XXH3SecretSize> XXH3DefaultSecret = {
+            0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+            0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+            0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+            0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+            0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+            0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+            0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+            0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+            0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+            0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+            0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+            0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E
+    };
+
+    /**
+     * @brief Loads 4 bytes as a little-endian 32-bit word.
+     * @param[in] data Bytes to be loaded.
+     * @return Loaded word.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint32_t XXH3Read32(const unsigned char *data) noexcept {
+        std::uint32_t word;
+        std::memcpy(&word, data, sizeof(word));
+
+        if constexpr (std::endian::big == std::endian::native)
+            return ByteSwap32(word);
+        else
+            return word;
+    }
+
+    /**
+     * @brief Loads 8 bytes as a little-endian 64-bit word.
+     * @param[in] data Bytes to be loaded.
+     * @return Loaded word.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Read64(const unsigned char *data) noexcept {
+        std::uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+
+        if constexpr (std::endian::big == std::endian::native)
+            return ByteSwap64(word);
+        else
+            return word;
+    }
+
+    /**
+     * @brief Multiplies two words into 128 bits and folds the halves together.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t XXH3Fold(const std::uint64_t &a,
+                                                              const std::uint64_t &b) noexcept {
+        const UInt128 product = MultiplyFull(a, b);
+        return product.low ^ product.high;
+    }
+
+    /**
+     * @brief Final mix of XXH64, used by the shortest inputs.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t XXH64Avalanche(std::uint64_t hash) noexcept {
+        hash ^= hash >> 33;
+        hash *= XXH3Prime64_2;
+        hash ^= hash >> 29;
+        hash *= XXH3Prime64_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /**
+     * @brief Final mix of XXH3.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t XXH3Avalanche(std::uint64_t hash) noexcept {
+        hash ^= hash >> 37;
+        hash *= XXH3PrimeMX1;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /**
+     * @brief Stronger final mix of XXH3, for the inputs of 4-8 bytes whose words overlap.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t XXH3Rrmxmx(std::uint64_t hash,
+                                                                const std::uint64_t &length) noexcept {
+        hash ^= std::rotl(hash, 49) ^ std::rotl(hash, 24);
+        hash *= XXH3PrimeMX2;
+        hash ^= (hash >> 35) + length;
+        hash *= XXH3PrimeMX2;
+        hash ^= hash >> 28;
+        return hash;
+    }
+
+    /**
+     * @brief Mixes 16 bytes of input with 16 bytes of secret.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Mix16(const unsigned char *input, const unsigned char *secret,
+                                                     const std::uint64_t &seed) noexcept {
+        return XXH3Fold(XXH3Read64(input) ^ (XXH3Read64(secret) + seed),
+                        XXH3Read64(input + 8) ^ (XXH3Read64(secret + 8) - seed));
+    }
+
+    /**
+     * @brief Mixes two 16-byte pieces of input into a 128-bit accumulator.
+     */
+    inline void XXH3Mix32(UInt128 &accumulator, const unsigned char *input1, const unsigned char *input2,
+                          const unsigned char *secret, const std::uint64_t &seed) noexcept {
+        accumulator.low += XXH3Mix16(input1, secret, seed);
+        accumulator.low ^= XXH3Read64(input2) + XXH3Read64(input2 + 8);
+        accumulator.high += XXH3Mix16(input2, secret + 16, seed);
+        accumulator.high ^= XXH3Read64(input1) + XXH3Read64(input1 + 8);
+    }
+
+    /**
+     * @brief Hashes an input of up to `XXH3MidSizeMax` bytes into 64 bits.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] secret Secret, which is `XXH3DefaultSecret` for the seeded hashes.
+     * @param[in] seed Seed.
+     * @return Hash.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Hash64Short(const unsigned char *input, const std::size_t &length,
+                                                           const unsigned char *secret,
+                                                           const std::uint64_t &seed) noexcept {
+        const auto length64 = static_cast<std::uint64_t>(length);
+
+        if (static_cast<std::size_t>(16) < length) {
+            std::uint64_t accumulator = length64 * XXH3Prime64_1;
+
+            if (static_cast<std::size_t>(128) < length) {
+                for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(128); i += 16)
+                    accumulator += XXH3Mix16(input + i, secret + i, seed);
+
+                accumulator = XXH3Avalanche(accumulator);
+
+                auto end = XXH3Mix16(input + length - 16, secret + 119, seed);
+                for (auto i = static_cast<std::size_t>(128); i + 16 <= length; i += 16)
+                    end += XXH3Mix16(input + i, secret + i - 125, seed);
+
+                return XXH3Avalanche(accumulator + end);
+            }
+
+            // The pieces are taken from both ends towards the middle.
+            if (static_cast<std::size_t>(32) < length) {
+                if (static_cast<std::size_t>(64) < length) {
+                    if (static_cast<std::size_t>(96) < length) {
+                        accumulator += XXH3Mix16(input + 48, secret + 96, seed);
+                        accumulator += XXH3Mix16(input + length - 64, secret + 112, seed);
+                    }
+
+                    accumulator += XXH3Mix16(input + 32, secret + 64, seed);
+                    accumulator += XXH3Mix16(input + length - 48, secret + 80, seed);
+                }
+
+                accumulator += XXH3Mix16(input + 16, secret + 32, seed);
+                accumulator += XXH3Mix16(input + length - 32, secret + 48, seed);
+            }
+
+            accumulator += XXH3Mix16(input, secret, seed);
+            accumulator += XXH3Mix16(input + length - 16, secret + 16, seed);
+            return XXH3Avalanche(accumulator);
+        }
+
+        if (static_cast<std::size_t>(8) < length) {
+            const std::uint64_t low = XXH3Read64(input) ^ ((XXH3Read64(secret + 24) ^ XXH3Read64(secret + 32)) + seed);
+            const std::uint64_t high = XXH3Read64(input + length - 8) ^ ((XXH3Read64(secret + 40) ^
+                                                                         XXH3Read64(secret + 48)) - seed);
+
+            return XXH3Avalanche(length64 + ByteSwap64(low) + high + XXH3Fold(low, high));
+        }
+
+        if (static_cast<std::size_t>(4) <= length) {
+            const std::uint64_t mixedSeed = seed ^ (static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(
+                                                        seed))) << 32);
+            const std::uint64_t word = static_cast<std::uint64_t>(XXH3Read32(input + length - 4)) +
+                                       (static_cast<std::uint64_t>(XXH3Read32(input)) << 32);
+
+            return XXH3Rrmxmx(word ^ ((XXH3Read64(secret + 8) ^ XXH3Read64(secret + 16)) - mixedSeed), length64);
+        }
+
+        if (static_cast<std::size_t>(0) != length) {
+            const std::uint32_t combined = (static_cast<std::uint32_t>(input[0]) << 16) |
+                                           (static_cast<std::uint32_t>(input[length >> 1]) << 24) |
+                                           static_cast<std::uint32_t>(input[length - 1]) |
+                                           (static_cast<std::uint32_t>(length) << 8);
+
+            return XXH64Avalanche(static_cast<std::uint64_t>(combined) ^ (static_cast<std::uint64_t>(
+                XXH3Read32(secret) ^ XXH3Read32(secret + 4)) + seed));
+        }
+
+        return XXH64Avalanche(seed ^ XXH3Read64(secret + 56) ^ XXH3Read64(secret + 64));
+    }
+
+    /**
+     * @brief Hashes an input of up to `XXH3MidSizeMax` bytes into 128 bits.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] secret Secret, which is `XXH3DefaultSecret` for the seeded hashes.
+     * @param[in] seed Seed.
+     * @return Hash.
+     */
+    CRONZ_NODISCARD_L1 inline UInt128 XXH3Hash128Short(const unsigned char *input, const std::size_t &length,
+                                                      const unsigned char *secret,
+                                                      const std::uint64_t &seed) noexcept {
+        const auto length64 = static_cast<std::uint64_t>(length);
+
+        if (static_cast<std::size_t>(16) < length) {
+            UInt128 accumulator = {static_cast<std::uint64_t>(0), length64 * XXH3Prime64_1};
+
+            if (static_cast<std::size_t>(128) < length) {
+                for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(128); i += 32)
+                    XXH3Mix32(accumulator, input + i, input + i + 16, secret + i, seed);
+
+                accumulator.low = XXH3Avalanche(accumulator.low);
+                accumulator.high = XXH3Avalanche(accumulator.high);
+
+                for (auto i = static_cast<std::size_t>(128); i + 32 <= length; i += 32)
+                    XXH3Mix32(accumulator, input + i, input + i + 16, secret + i - 125, seed);
+
+                XXH3Mix32(accumulator, input + length - 16, input + length - 32, secret + 103,
+                          static_cast<std::uint64_t>(0) - seed);
+            } else {
+                if (static_cast<std::size_t>(32) < length) {
+                    if (static_cast<std::size_t>(64) < length) {
+                        if (static_cast<std::size_t>(96) < length)
+                            XXH3Mix32(accumulator, input + 48, input + length - 64, secret + 96, seed);
+
+                        XXH3Mix32(accumulator, input + 32, input + length - 48, secret + 64, seed);
+                    }
+
+                    XXH3Mix32(accumulator, input + 16, input + length - 32, secret + 32, seed);
+                }
+
+                XXH3Mix32(accumulator, input, input + length - 16, secret, seed);
+            }
+
+            return {
+                static_cast<std::uint64_t>(0) - XXH3Avalanche(accumulator.low * XXH3Prime64_1 + accumulator.high *
+                                                              XXH3Prime64_4 + (length64 - seed) * XXH3Prime64_2),
+                XXH3Avalanche(accumulator.low + accumulator.high)
+            };
+        }
+
+        if (static_cast<std::size_t>(8) < length) {
+            const std::uint64_t low = XXH3Read64(input);
+            std::uint64_t high = XXH3Read64(input + length - 8);
+
+            UInt128 mixed = MultiplyFull(low ^ high ^ ((XXH3Read64(secret + 32) ^ XXH3Read64(secret + 40)) - seed),
+                                         XXH3Prime64_1);
+            mixed.low += (length64 - 1) << 54;
+            high ^= (XXH3Read64(secret + 48) ^ XXH3Read64(secret + 56)) + seed;
+            mixed.high += high + (high & static_cast<std::uint64_t>(0xFFFFFFFF)) * static_cast<std::uint64_t>(
+                XXH3Prime32_2 - 1);
+            mixed.low ^= ByteSwap64(mixed.high);
+
+            UInt128 hash = MultiplyFull(mixed.low, XXH3Prime64_2);
+            hash.high += mixed.high * XXH3Prime64_2;
+            return {XXH3Avalanche(hash.high), XXH3Avalanche(hash.low)};
+        }
+
+        if (static_cast<std::size_t>(4) <= length) {
+            const std::uint64_t mixedSeed = seed ^ (static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(
+                                                        seed))) << 32);
+            const std::uint64_t word = static_cast<std::uint64_t>(XXH3Read32(input)) +
+                                       (static_cast<std::uint64_t>(XXH3Read32(input + length - 4)) << 32);
+
+            UInt128 hash = MultiplyFull(word ^ ((XXH3Read64(secret + 16) ^ XXH3Read64(secret + 24)) + mixedSeed),
+                                        XXH3Prime64_1 + (length64 << 2));
+            hash.high += hash.low << 1;
+            hash.low ^= hash.high >> 3;
+            hash.low ^= hash.low >> 35;
+            hash.low *= XXH3PrimeMX2;
+            hash.low ^= hash.low >> 28;
+            hash.high = XXH3Avalanche(hash.high);
+            return hash;
+        }
+
+        if (static_cast<std::size_t>(0) != length) {
+            const std::uint32_t combined = (static_cast<std::uint32_t>(input[0]) << 16) |
+                                           (static_cast<std::uint32_t>(input[length >> 1]) << 24) |
+                                           static_cast<std::uint32_t>(input[length - 1]) |
+                                           (static_cast<std::uint32_t>(length) << 8);
+            const std::uint32_t swapped = std::rotl(ByteSwap32(combined), 13);
+
+            return {
+                XXH64Avalanche(static_cast<std::uint64_t>(swapped) ^ (static_cast<std::uint64_t>(
+                    XXH3Read32(secret + 8) ^ XXH3Read32(secret + 12)) - seed)),
+                XXH64Avalanche(static_cast<std::uint64_t>(combined) ^ (static_cast<std::uint64_t>(
+                    XXH3Read32(secret) ^ XXH3Read32(secret + 4)) + seed))
+            };
+        }
+
+        return {XXH64Avalanche(seed ^ XXH3Read64(secret + 80) ^ XXH3Read64(secret + 88)),
+                XXH64Avalanche(seed ^ XXH3Read64(secret + 64) ^ XXH3Read64(secret + 72))};
+    }
+
+    /**
+     * @brief Accumulates stripes.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] input Stripes.
+     * @param[in] secret Secret of the first stripe, the next ones starting 8 bytes further each.
+     * @param[in] stripes Number of stripes.
+     */
+    inline void XXH3AccumulatePortable(std::uint64_t *accumulators, const unsigned char *input,
+                                       const unsigned char *secret, const std::size_t &stripes) noexcept {
+        std::uint64_t acc[8];
+        std::memcpy(acc, accumulators, sizeof(acc));
+
+        for (auto s = static_cast<std::size_t>(0); s < stripes; ++s) {
+            for (auto i = 0; i < 8; ++i) {
+                const std::uint64_t data = XXH3Read64(input + s * XXH3StripeSize + i * 8);
+                const std::uint64_t key = data ^ XXH3Read64(secret + s * 8 + i * 8);
+
+                acc[i ^ 1] += data;
+                acc[i] += (key & static_cast<std::uint64_t>(0xFFFFFFFF)) * (key >> 32);
+            }
+        }
+
+        std::memcpy(accumulators, acc, sizeof(acc));
+    }
+
+    /**
+     * @brief Scrambles the accumulators at the end of a block.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] secret Secret.
+     */
+    inline void XXH3ScramblePortable(std::uint64_t *accumulators, const unsigned char *secret) noexcept {
+        for (auto i = 0; i < 8; ++i) {
+            std::uint64_t acc = accumulators[i];
+            acc ^= acc >> 47;
+            acc ^= XXH3Read64(secret + i * 8);
+            accumulators[i] = acc * XXH3Prime32_1;
+        }
+    }
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Accumulates stripes with SSSE3, two accumulators per vector.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] input Stripes.
+     * @param[in] secret Secret of the first stripe, the next ones starting 8 bytes further each.
+     * @param[in] stripes Number of stripes.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline void XXH3AccumulateSSSE3(std::uint64_t *accumulators,
+                                                               const unsigned char *input,
+                                                               const unsigned char *secret,
+                                                               const std::size_t &stripes) noexcept {
+        __m128i acc[4];
+        for (auto i = 0; i < 4; ++i)
+            acc[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+
+        for (auto s = static_cast<std::size_t>(0); s < stripes; ++s) {
+            for (auto i = 0; i < 4; ++i) {
+                const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + s * XXH3StripeSize) +
+                                                     i);
+                const __m128i key = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                                            secret + s * 8) + i));
+
+                // Each accumulator takes the product of the halves of its key, and the data of its neighbor.
+                acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(_mm_mul_epu32(key, _mm_srli_epi64(key, 32)),
+                                                             _mm_shuffle_epi32(data, 0x4E)));
+            }
+        }
+
+        for (auto i = 0; i < 4; ++i)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, acc[i]);
+    }
+
+    /**
+     * @brief Scrambles the accumulators at the end of a block with SSSE3.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] secret Secret.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline void XXH3ScrambleSSSE3(std::uint64_t *accumulators,
+                                                             const unsigned char *secret) noexcept {
+        const __m128i prime = _mm_set1_epi32(static_cast<int>(XXH3Prime32_1));
+
+        for (auto i = 0; i < 4; ++i) {
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+            acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+            acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+
+            // 64-bit product made of 32-bit ones.
+            acc = _mm_add_epi64(_mm_mul_epu32(acc, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(acc, 32),
+                                                                                        prime), 32));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, acc);
+        }
+    }
+
+    /**
+     * @brief Accumulates stripes with AVX2, four accumulators per vector.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] input Stripes.
+     * @param[in] secret Secret of the first stripe, the next ones starting 8 bytes further each.
+     * @param[in] stripes Number of stripes.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void XXH3AccumulateAVX2(std::uint64_t *accumulators, const unsigned char *input,
+                                                             const unsigned char *secret,
+                                                             const std::size_t &stripes) noexcept {
+        __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators));
+        __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators + 4));
+
+        for (auto s = static_cast<std::size_t>(0); s < stripes; ++s) {
+            const unsigned char *stripe = input + s * XXH3StripeSize;
+            const unsigned char *key = secret + s * 8;
+
+            const __m256i data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe));
+            const __m256i data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe + 32));
+            const __m256i key0 = _mm256_xor_si256(data0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key)));
+            const __m256i key1 = _mm256_xor_si256(data1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                                                             key + 32)));
+
+            acc0 = _mm256_add_epi64(acc0, _mm256_add_epi64(_mm256_mul_epu32(key0, _mm256_srli_epi64(key0, 32)),
+                                                           _mm256_shuffle_epi32(data0, 0x4E)));
+            acc1 = _mm256_add_epi64(acc1, _mm256_add_epi64(_mm256_mul_epu32(key1, _mm256_srli_epi64(key1, 32)),
+                                                           _mm256_shuffle_epi32(data1, 0x4E)));
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators), acc0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators + 4), acc1);
+    }
+
+    /**
+     * @brief Scrambles the accumulators at the end of a block with AVX2.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] secret Secret.
+     */
+    CRONZ_SIMD_TARGET("avx2") inline void XXH3ScrambleAVX2(std::uint64_t *accumulators,
+                                                           const unsigned char *secret) noexcept {
+        const __m256i prime = _mm256_set1_epi32(static_cast<int>(XXH3Prime32_1));
+
+        for (auto i = 0; i < 2; ++i) {
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators) + i);
+            acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+            acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+            acc = _mm256_add_epi64(_mm256_mul_epu32(acc, prime),
+                                   _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime), 32));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators) + i, acc);
+        }
+    }
+
+#endif
+
+    /**
+     * @brief Accumulates stripes with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] input Stripes.
+     * @param[in] secret Secret of the first stripe, the next ones starting 8 bytes further each.
+     * @param[in] stripes Number of stripes.
+     * @remark `SIMDLevel::AVX512VBMI` and `SIMDLevel::AVX2` use the AVX2 kernels, `SIMDLevel::SSSE3` the SSSE3 ones,
+     * and lower levels the portable ones. `XXH3Scramble` is dispatched the same way.
+     */
+    inline void XXH3Accumulate([[maybe_unused]] const SIMDLevel &level, std::uint64_t *accumulators,
+                               const unsigned char *input, const unsigned char *secret,
+                               const std::size_t &stripes) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                XXH3AccumulateAVX2(accumulators, input, secret, stripes);
+                return;
+
+            case SIMDLevel::SSSE3:
+                XXH3AccumulateSSSE3(accumulators, input, secret, stripes);
+                return;
+
+            default:
+                break;
+        }
+#endif
+
+        XXH3AccumulatePortable(accumulators, input, secret, stripes);
+    }
+
+    /**
+     * @brief Scrambles the accumulators with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in] secret Secret.
+     */
+    inline void XXH3Scramble([[maybe_unused]] const SIMDLevel &level, std::uint64_t *accumulators,
+                             const unsigned char *secret) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        switch (level) {
+            case SIMDLevel::AVX512VBMI:
+            case SIMDLevel::AVX2:
+                XXH3ScrambleAVX2(accumulators, secret);
+                return;
+
+            case SIMDLevel::SSSE3:
+                XXH3ScrambleSSSE3(accumulators, secret);
+                return;
+
+            default:
+                break;
+        }
+#endif
+
+        XXH3ScramblePortable(accumulators, secret);
+    }
+
+    /**
+     * @brief Initial values of the accumulators.
+     */
+    inline constexpr std::array<std::uint64_t, static_cast<std::size_t>(8)> XXH3InitialAccumulators = {
+            XXH3Prime32_3, XXH3Prime64_1, XXH3Prime64_2, XXH3Prime64_3, XXH3Prime64_4, XXH3Prime32_2, XXH3Prime64_5,
+            XXH3Prime32_1
+    };
+
+    /**
+     * @brief Accumulates stripes following the ones already accumulated, scrambling at the end of each block.
+     * @param[in] level Instruction set level.
+     * @param[in,out] accumulators Accumulators.
+     * @param[in,out] blockStripes Number of stripes already accumulated into the current block.
+     * @param[in] input Stripes.
+     * @param[in] stripes Number of stripes.
+     * @param[in] secret Secret.
+     */
+    inline void XXH3ConsumeStripes(const SIMDLevel &level, std::uint64_t *accumulators, std::size_t &blockStripes,
+                                   const unsigned char *input, std::size_t stripes,
+                                   const unsigned char *secret) noexcept {
+        std::size_t done = blockStripes;
+
+        while (XXH3BlockStripes - done <= stripes) {
+            const std::size_t taken = XXH3BlockStripes - done;
+
+            XXH3Accumulate(level, accumulators, input, secret + done * 8, taken);
+            XXH3Scramble(level, accumulators, secret + XXH3SecretSize - XXH3StripeSize);
+
+            input += taken * XXH3StripeSize;
+            stripes -= taken;
+            done = static_cast<std::size_t>(0);
+        }
+
+        if (static_cast<std::size_t>(0) != stripes) {
+            XXH3Accumulate(level, accumulators, input, secret + done * 8, stripes);
+            done += stripes;
+        }
+
+        blockStripes = done;
+    }
+
+    /**
+     * @brief Merges the accumulators into 64 bits.
+     * @param[in] accumulators Accumulators.
+     * @param[in] secret Secret.
+     * @param[in] start Initial value.
+     * @return Hash.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Merge(const std::uint64_t *accumulators, const unsigned char *secret,
+                                                     const std::uint64_t &start) noexcept {
+        std::uint64_t hash = start;
+        for (auto i = 0; i < 4; ++i)
+            hash += XXH3Fold(accumulators[i * 2] ^ XXH3Read64(secret + i * 16),
+                             accumulators[i * 2 + 1] ^ XXH3Read64(secret + i * 16 + 8));
+
+        return XXH3Avalanche(hash);
+    }
+
+    /**
+     * @brief Accumulates an input longer than `XXH3MidSizeMax` bytes.
+     * @param[in] level Instruction set level.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] secret Secret.
+     * @param[out] accumulators Accumulators.
+     * @remark The last stripe always ends with the input, overlapping the previous one as needed.
+     */
+    inline void XXH3AccumulateLong(const SIMDLevel &level, const unsigned char *input, const std::size_t &length,
+                                   const unsigned char *secret, std::uint64_t *accumulators) noexcept {
+        std::memcpy(accumulators, XXH3InitialAccumulators.data(), sizeof(XXH3InitialAccumulators));
+
+        auto blockStripes = static_cast<std::size_t>(0);
+        XXH3ConsumeStripes(level, accumulators, blockStripes, input, (length - 1) / XXH3StripeSize, secret);
+        XXH3Accumulate(level, accumulators, input + length - XXH3StripeSize,
+                       secret + XXH3SecretSize - XXH3StripeSize - 7, static_cast<std::size_t>(1));
+    }
+
+    /**
+     * @brief Derives the secret of a seed from the default one.
+     * @param[in] seed Seed.
+     * @param[out] secret Secret.
+     */
+    inline void XXH3DeriveSecret(const std::uint64_t &seed, unsigned char *secret) noexcept {
+        for (auto i = static_cast<std::size_t>(0); i < XXH3SecretSize; i += 16) {
+            std::uint64_t low = XXH3Read64(XXH3DefaultSecret.data() + i) + seed;
+            std::uint64_t high = XXH3Read64(XXH3DefaultSecret.data() + i + 8) - seed;
+
+            if constexpr (std::endian::big == std::endian::native) {
+                low = ByteSwap64(low);
+                high = ByteSwap64(high);
+            }
+
+            std::memcpy(secret + i, &low, sizeof(low));
+            std::memcpy(secret + i + 8, &high, sizeof(high));
+        }
+    }
+
+    /**
+     * @brief Hashes an input into 64 bits.
+     * @param[in] level Instruction set level of the inputs longer than `XXH3MidSizeMax` bytes.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] seed Seed.
+     * @return XXH3 64-bit hash.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Hash64(const SIMDLevel &level, const void *input,
+                                                      const std::size_t &length, const std::uint64_t &seed) noexcept {
+        const auto bytes = static_cast<const unsigned char*>(input);
+
+        if (length <= XXH3MidSizeMax)
+            return XXH3Hash64Short(bytes, length, XXH3DefaultSecret.data(), seed);
+
+        // The seeded secret is only derived for the long inputs.
+        unsigned char derived[XXH3SecretSize];
+        const unsigned char *secret = XXH3DefaultSecret.data();
+        if (static_cast<std::uint64_t>(0) != seed) {
+            XXH3DeriveSecret(seed, derived);
+            secret = derived;
+        }
+
+        std::uint64_t accumulators[8];
+        XXH3AccumulateLong(level, bytes, length, secret, accumulators);
+        return XXH3Merge(accumulators, secret + 11, static_cast<std::uint64_t>(length) * XXH3Prime64_1);
+    }
+
+    /**
+     * @brief Hashes an input into 64 bits with the highest instruction set level available.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] seed Seed.
+     * @return XXH3 64-bit hash.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Hash64(const void *input, const std::size_t &length,
+                                                      const std::uint64_t &seed) noexcept {
+        if (length <= XXH3MidSizeMax)
+            return XXH3Hash64Short(static_cast<const unsigned char*>(input), length, XXH3DefaultSecret.data(), seed);
+
+        return XXH3Hash64(DetectSIMDLevel(), input, length, seed);
+    }
+
+    /**
+     * @brief Hashes an input into 128 bits.
+     * @param[in] level Instruction set level of the inputs longer than `XXH3MidSizeMax` bytes.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] seed Seed.
+     * @return XXH3 128-bit hash.
+     */
+    CRONZ_NODISCARD_L1 inline UInt128 XXH3Hash128(const SIMDLevel &level, const void *input,
+                                                 const std::size_t &length, const std::uint64_t &seed) noexcept {
+        const auto bytes = static_cast<const unsigned char*>(input);
+
+        if (length <= XXH3MidSizeMax)
+            return XXH3Hash128Short(bytes, length, XXH3DefaultSecret.data(), seed);
+
+        unsigned char derived[XXH3SecretSize];
+        const unsigned char *secret = XXH3DefaultSecret.data();
+        if (static_cast<std::uint64_t>(0) != seed) {
+            XXH3DeriveSecret(seed, derived);
+            secret = derived;
+        }
+
+        std::uint64_t accumulators[8];
+        XXH3AccumulateLong(level, bytes, length, secret, accumulators);
+
+        const auto length64 = static_cast<std::uint64_t>(length);
+        return {XXH3Merge(accumulators, secret + XXH3SecretSize - 64 - 11, ~(length64 * XXH3Prime64_2)),
+                XXH3Merge(accumulators, secret + 11, length64 * XXH3Prime64_1)};
+    }
+
+    /**
+     * @brief Hashes an input into 128 bits with the highest instruction set level available.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     * @param[in] seed Seed.
+     * @return XXH3 128-bit hash.
+     */
+    CRONZ_NODISCARD_L1 inline UInt128 XXH3Hash128(const void *input, const std::size_t &length,
+                                                 const std::uint64_t &seed) noexcept {
+        if (length <= XXH3MidSizeMax)
+            return XXH3Hash128Short(static_cast<const unsigned char*>(input), length, XXH3DefaultSecret.data(), seed);
+
+        return XXH3Hash128(DetectSIMDLevel(), input, length, seed);
+    }
+
+    /**
+     * @brief State of an incremental XXH3 hash.
+     */
+    struct XXH3State {
+        /**
+         * @brief Accumulators.
+         */
+        std::array<std::uint64_t, static_cast<std::size_t>(8)> accumulators;
+
+        /**
+         * @brief Secret, derived from the seed.
+         */
+        std::array<unsigned char, XXH3SecretSize> secret;
+
+        /**
+         * @brief Input that is not accumulated yet, which is kept until more input follows. The last accumulated
+         * stripe is kept at its end, as the last stripe of the input may overlap it.
+         */
+        std::array<unsigned char, static_cast<std::size_t>(256)> buffer;
+
+        /**
+         * @brief Seed.
+         */
+        std::uint64_t seed;
+
+        /**
+         * @brief Byte length of the whole input.
+         */
+        std::uint64_t length;
+
+        /**
+         * @brief Number of bytes in `buffer`.
+         */
+        std::size_t buffered;
+
+        /**
+         * @brief Number of stripes accumulated into the current block.
+         */
+        std::size_t blockStripes;
+    };
+
+    /**
+     * @brief Starts a new incremental XXH3 hash.
+     * @param[out] state State.
+     * @param[in] seed Seed.
+     */
+    inline void XXH3Reset(XXH3State &state, const std::uint64_t &seed) noexcept {
+        state.accumulators = XXH3InitialAccumulators;
+        XXH3DeriveSecret(seed, state.secret.data());
+        state.seed = seed;
+        state.length = static_cast<std::uint64_t>(0);
+        state.buffered = static_cast<std::size_t>(0);
+        state.blockStripes = static_cast<std::size_t>(0);
+    }
+
+    /**
+     * @brief Appends input to an incremental XXH3 hash.
+     * @param[in] level Instruction set level.
+     * @param[in,out] state State.
+     * @param[in] input Input.
+     * @param[in] length Byte length of `input`.
+     */
+    inline void XXH3Update(const SIMDLevel &level, XXH3State &state, const void *input,
+                           const std::size_t &length) noexcept {
+        if (static_cast<std::size_t>(0) == length)
+            return;
+
+        auto bytes = static_cast<const unsigned char*>(input);
+        const unsigned char *end = bytes + length;
+        constexpr std::size_t capacity = sizeof(XXH3State::buffer);
+
+        state.length += static_cast<std::uint64_t>(length);
+
+        if (length <= capacity - state.buffered) {
+            std::memcpy(state.buffer.data() + state.buffered, bytes, length);
+            state.buffered += length;
+            return;
+        }
+
+        // The buffer is only accumulated once more input follows it.
+        if (static_cast<std::size_t>(0) != state.buffered) {
+            const std::size_t taken = capacity - state.buffered;
+            std::memcpy(state.buffer.data() + state.buffered, bytes, taken);
+            bytes += taken;
+
+            XXH3ConsumeStripes(level, state.accumulators.data(), state.blockStripes, state.buffer.data(),
+                               capacity / XXH3StripeSize, state.secret.data());
+            state.buffered = static_cast<std::size_t>(0);
+        }
+
+        if (capacity < static_cast<std::size_t>(end - bytes)) {
+            const std::size_t stripes = static_cast<std::size_t>(end - bytes - 1) / XXH3StripeSize;
+
+            XXH3ConsumeStripes(level, state.accumulators.data(), state.blockStripes, bytes, stripes,
+                               state.secret.data());
+            bytes += stripes * XXH3StripeSize;
+            std::memcpy(state.buffer.data() + capacity - XXH3StripeSize, bytes - XXH3StripeSize, XXH3StripeSize);
+        }
+
+        state.buffered = static_cast<std::size_t>(end - bytes);
+        std::memcpy(state.buffer.data(), bytes, state.buffered);
+    }
+
+    /**
+     * @brief Accumulates the rest of an incremental XXH3 hash, which is left unchanged.
+     * @param[in] level Instruction set level.
+     * @param[in] state State, which must have more than `XXH3MidSizeMax` bytes of input.
+     * @param[out] accumulators Accumulators.
+     */
+    inline void XXH3AccumulateRest(const SIMDLevel &level, const XXH3State &state,
+                                   std::uint64_t *accumulators) noexcept {
+        std::memcpy(accumulators, state.accumulators.data(), sizeof(state.accumulators));
+
+        unsigned char stripe[XXH3StripeSize];
+        const unsigned char *last = stripe;
+
+        if (XXH3StripeSize <= state.buffered) {
+            std::size_t blockStripes = state.blockStripes;
+            XXH3ConsumeStripes(level, accumulators, blockStripes, state.buffer.data(),
+                               (state.buffered - 1) / XXH3StripeSize, state.secret.data());
+            last = state.buffer.data() + state.buffered - XXH3StripeSize;
+        } else {
+            // The last stripe takes the missing bytes from the end of the last accumulated one.
+            const std::size_t missing = XXH3StripeSize - state.buffered;
+            std::memcpy(stripe, state.buffer.data() + state.buffer.size() - missing, missing);
+            std::memcpy(stripe + missing, state.buffer.data(), state.buffered);
+        }
+
+        XXH3Accumulate(level, accumulators, last, state.secret.data() + XXH3SecretSize - XXH3StripeSize - 7,
+                       static_cast<std::size_t>(1));
+    }
+
+    /**
+     * @brief Completes an incremental XXH3 hash into 64 bits, which can be continued afterwards.
+     * @param[in] level Instruction set level.
+     * @param[in] state State.
+     * @return XXH3 64-bit hash of the input so far.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint64_t XXH3Digest64(const SIMDLevel &level, const XXH3State &state) noexcept {
+        if (state.length <= static_cast<std::uint64_t>(XXH3MidSizeMax))
+            return XXH3Hash64Short(state.buffer.data(), static_cast<std::size_t>(state.length),
+                                   XXH3DefaultSecret.data(), state.seed);
+
+        std::uint64_t accumulators[8];
+        XXH3AccumulateRest(level, state, accumulators);
+        return XXH3Merge(accumulators, state.secret.data() + 11, state.length * XXH3Prime64_1);
+    }
+
+    /**
+     * @brief Completes an incremental XXH3 hash into 128 bits, which can be continued afterwards.
+     * @param[in] level Instruction set level.
+     * @param[in] state State.
+     * @return XXH3 128-bit hash of the input so far.
+     */
+    CRONZ_NODISCARD_L1 inline UInt128 XXH3Digest128(const SIMDLevel &level, const XXH3State &state) noexcept {
+        if (state.length <= static_cast<std::uint64_t>(XXH3MidSizeMax))
+            return XXH3Hash128Short(state.buffer.data(), static_cast<std::size_t>(state.length),
+                                    XXH3DefaultSecret.data(), state.seed);
+
+        std::uint64_t accumulators[8];
+        XXH3AccumulateRest(level, state, accumulators);
+        return {XXH3Merge(accumulators, state.secret.data() + XXH3SecretSize - 64 - 11,
+                          ~(state.length * XXH3Prime64_2)),
+                XXH3Merge(accumulators, state.secret.data() + 11, state.length * XXH3Prime64_1)};
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_INTERNAL_XXH3_HPP
@@ -17,6 +17,10 @@
  */
 
 #include "cronz/ip/address.hpp"
+#include "cronz/ip/anonymize.hpp"
+#include "cronz/ip/network.hpp"
+#include "cronz/ip/set.hpp"
+#include "cronz/ip/table.hpp"
 #include "cronz/ip/types.hpp"
 
 #endif // CRONZ_IP_HPP
@@ -18,5 +18,7 @@
 
 #include "cronz/ip/address/v4.hpp"
 #include "cronz/ip/address/v6.hpp"
+#include "cronz/ip/address/ip.hpp"
+#include "cronz/ip/address/batch.hpp"
 
 #endif // CRONZ_IP_ADDRESS_HPP
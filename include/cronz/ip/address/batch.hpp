@@ -0,0 +1,103 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_ADDRESS_BATCH_HPP
+#define CRONZ_IP_ADDRESS_BATCH_HPP 1
+
+/**
+ * @defgroup cronz_ip_address_batch Batch
+ * @ingroup cronz_ip_address
+ */
+
+#include "cronz/ip/address/v4.hpp"
+#include "cronz/ip/address/v6.hpp"
+
+#include <charconv>
+#include <span>
+#include <string_view>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_address_batch
+     * @brief Writes addresses into a character range, separated by a delimiter.
+     * @param[in] addresses Addresses to be written.
+     * @param[out] first Beginning of the range.
+     * @param[in] last End of the range.
+     * @param[in] delimiter Delimiter written between the addresses, but not after the last one.
+     * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+     * `std::errc::value_too_large`.
+     * @remark `addresses.size() * (IPv4Address::MaxLength + delimiter.length())` characters always suffice.
+     * @remark Characters in `[ptr, last)` may be overwritten as well. Upon failure, the content of the range is
+     * unspecified.
+     */
+    CRONZ_NODISCARD_L2 std::to_chars_result FormatAddresses(const std::span<const IPv4Address> &addresses, char *first,
+                                                            char *last, const std::string_view &delimiter = "\n")
+        noexcept;
+
+    /**
+     * @ingroup cronz_ip_address_batch
+     * @brief Writes addresses into a character range, separated by a delimiter.
+     * @tparam Compress Whether to compress the output. If false, zero fields will be printed as well.
+     * @param[in] addresses Addresses to be written.
+     * @param[out] first Beginning of the range.
+     * @param[in] last End of the range.
+     * @param[in] delimiter Delimiter written between the addresses, but not after the last one.
+     * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+     * `std::errc::value_too_large`.
+     * @remark `addresses.size() * (IPv6Address::MaxLength + delimiter.length())` characters always suffice.
+     * @remark Characters in `[ptr, last)` may be overwritten as well. Upon failure, the content of the range is
+     * unspecified.
+     */
+    template <bool Compress = true>
+    CRONZ_NODISCARD_L2 std::to_chars_result FormatAddresses(const std::span<const IPv6Address> &addresses, char *first,
+                                                            char *last, const std::string_view &delimiter = "\n")
+        noexcept;
+
+    /**
+     * @ingroup cronz_ip_address_batch
+     * @brief Parses delimited addresses from a character range.
+     * @param[in] first Beginning of the range.
+     * @param[in] last End of the range.
+     * @param[out] addresses Parsed addresses.
+     * @param[out] count Number of parsed addresses.
+     * @param[in] delimiter Delimiter between the addresses. Must not be empty.
+     * @return Pointer past the consumed characters and `std::errc()` once the range or `addresses` is exhausted,
+     * otherwise, the beginning of the first invalid field and `std::errc::invalid_argument`.
+     * @remark Every field must be an address as a whole. A delimiter at the end of the range is accepted.
+     * @remark When `addresses` is exhausted first, the returned pointer is the beginning of the next field.
+     */
+    CRONZ_NODISCARD_L2 std::from_chars_result ParseAddresses(const char *first, const char *last,
+                                                             const std::span<IPv4Address> &addresses,
+                                                             std::size_t &count,
+                                                             const std::string_view &delimiter = "\n") noexcept;
+
+    /**
+     * @ingroup cronz_ip_address_batch
+     * @brief Parses delimited addresses from a character range.
+     * @param[in] first Beginning of the range.
+     * @param[in] last End of the range.
+     * @param[out] addresses Parsed addresses.
+     * @param[out] count Number of parsed addresses.
+     * @param[in] delimiter Delimiter between the addresses. Must not be empty.
+     * @return Pointer past the consumed characters and `std::errc()` once the range or `addresses` is exhausted,
+     * otherwise, the beginning of the first invalid field and `std::errc::invalid_argument`.
+     * @remark Every field must be an address as a whole. A delimiter at the end of the range is accepted.
+     * @remark When `addresses` is exhausted first, the returned pointer is the beginning of the next field.
+     */
+    CRONZ_NODISCARD_L2 std::from_chars_result ParseAddresses(const char *first, const char *last,
+                                                             const std::span<IPv6Address> &addresses,
+                                                             std::size_t &count,
+                                                             const std::string_view &delimiter = "\n") noexcept;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/address/impl/batch.ipp"
+
+#endif // CRONZ_IP_ADDRESS_BATCH_HPP
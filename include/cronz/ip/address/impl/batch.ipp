@@ -0,0 +1,128 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_ADDRESS_IMPL_BATCH_IPP
+#define CRONZ_IP_ADDRESS_IMPL_BATCH_IPP 1
+
+#include "cronz/ip/address/batch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Writes addresses into a character range, separated by a delimiter (see `IP::FormatAddresses`).
+     * @tparam Compress Whether to compress IPv6 addresses.
+     * @tparam Address Address type.
+     * @remark Addresses are formatted directly into the range while there is room for the widest form, and through a
+     * scratch buffer near its end.
+     */
+    template <bool Compress, typename Address>
+    CRONZ_NODISCARD_L1 inline std::to_chars_result FormatAddresses(const std::span<const Address> &addresses,
+                                                                   char *first, char *last,
+                                                                   const std::string_view &delimiter) noexcept {
+        // The formatters may write one byte past the result.
+        constexpr auto room = static_cast<std::ptrdiff_t>(Address::MaxLength + 1);
+        const SIMDLevel level = DetectSIMDLevel();
+
+        char *o = first;
+        for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+            if (static_cast<std::size_t>(0) != i) {
+                if (static_cast<std::ptrdiff_t>(delimiter.length()) > last - o)
+                    return {last, std::errc::value_too_large};
+
+                std::memcpy(o, delimiter.data(), delimiter.length());
+                o += delimiter.length();
+            }
+
+            if (room <= last - o) {
+                if constexpr (std::is_same_v<Address, IP::IPv4Address>)
+                    o += FormatIPv4(level, addresses[i].bytes, o);
+                else
+                    o += FormatIPv6<Compress>(level, addresses[i].bytes, o);
+            }
+            else {
+                std::to_chars_result result;
+                if constexpr (std::is_same_v<Address, IP::IPv4Address>)
+                    result = addresses[i].toChars(o, last);
+                else
+                    result = addresses[i].template toChars<Compress>(o, last);
+
+                if (std::errc() != result.ec)
+                    return result;
+
+                o = result.ptr;
+            }
+        }
+
+        return {o, std::errc()};
+    }
+
+    /**
+     * @brief Parses delimited addresses from a character range (see `IP::ParseAddresses`).
+     * @tparam Address Address type.
+     */
+    template <typename Address>
+    CRONZ_NODISCARD_L1 inline std::from_chars_result ParseAddresses(const char *first, const char *last,
+                                                                    const std::span<Address> &addresses,
+                                                                    std::size_t &count,
+                                                                    const std::string_view &delimiter) noexcept {
+        count = static_cast<std::size_t>(0);
+        if (delimiter.empty())
+            return {first, std::errc::invalid_argument};
+
+        const std::string_view input(first, last - first);
+
+        auto offset = static_cast<std::size_t>(0);
+        while (offset < input.length() && count < addresses.size()) {
+            std::size_t end = input.find(delimiter, offset);
+            if (std::string_view::npos == end)
+                end = input.length();
+
+            if (!addresses[count].parse(first + offset, end - offset))
+                return {first + offset, std::errc::invalid_argument};
+
+            ++count;
+            offset = std::min(end + delimiter.length(), input.length());
+        }
+
+        return {first + offset, std::errc()};
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    inline std::to_chars_result FormatAddresses(const std::span<const IPv4Address> &addresses, char *first, char *last,
+                                                const std::string_view &delimiter) noexcept {
+        return Internal::FormatAddresses<true>(addresses, first, last, delimiter);
+    }
+
+    template <bool Compress>
+    inline std::to_chars_result FormatAddresses(const std::span<const IPv6Address> &addresses, char *first, char *last,
+                                                const std::string_view &delimiter) noexcept {
+        return Internal::FormatAddresses<Compress>(addresses, first, last, delimiter);
+    }
+
+    inline std::from_chars_result ParseAddresses(const char *first, const char *last,
+                                                 const std::span<IPv4Address> &addresses, std::size_t &count,
+                                                 const std::string_view &delimiter) noexcept {
+        return Internal::ParseAddresses(first, last, addresses, count, delimiter);
+    }
+
+    inline std::from_chars_result ParseAddresses(const char *first, const char *last,
+                                                 const std::span<IPv6Address> &addresses, std::size_t &count,
+                                                 const std::string_view &delimiter) noexcept {
+        return Internal::ParseAddresses(first, last, addresses, count, delimiter);
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_ADDRESS_IMPL_BATCH_IPP
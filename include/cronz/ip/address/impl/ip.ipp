@@ -0,0 +1,227 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_ADDRESS_IMPL_IP_IPP
+#define CRONZ_IP_ADDRESS_IMPL_IP_IPP 1
+
+#include "cronz/ip/address/ip.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/xxh3.hpp"
+
+#include <cstring>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Prefix of IPv4-mapped addresses (`::ffff:0:0/96`) in the high 64 bits, in host byte order.
+     */
+    inline constexpr std::uint64_t IPv4MappedPrefix = static_cast<std::uint64_t>(0x0000FFFF00000000ull);
+
+    /**
+     * @brief Compares two 64-bit words.
+     * @param[in] a First word.
+     * @param[in] b Second word.
+     * @return `1` if `a` is greater, `-1` if `a` is less, otherwise, `0`.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr int CompareWords(const std::uint64_t &a, const std::uint64_t &b) noexcept {
+        return static_cast<int>(a > b) - static_cast<int>(a < b);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPAddress::IPAddress() noexcept : bytes{} {
+    }
+
+    inline IPAddress::IPAddress(const IPv4Address &address) noexcept : bytes{} {
+        high64 = Internal::NetworkToHost64(Internal::IPv4MappedPrefix | static_cast<std::uint64_t>(
+                                               Internal::NetworkToHost32(address.uint32)));
+    }
+
+    inline IPAddress::IPAddress(const IPv6Address &address) noexcept : bytes(address.bytes) {
+    }
+
+    inline IPAddress::IPAddress(
+            const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept : bytes(bytes) {
+    }
+
+    inline IPAddress::IPAddress(const char *str) noexcept : IPAddress(Parse(str)) {
+    }
+
+    inline IPAddress::IPAddress(const char *str, const std::size_t &length) noexcept : IPAddress(Parse(str, length)) {
+    }
+
+    inline IPAddress::IPAddress(const std::string &str) noexcept : IPAddress(Parse(str)) {
+    }
+
+    // Instance-based utility functions.
+    inline bool IPAddress::parse(const char *str) noexcept {
+        return parse(str, std::strlen(str));
+    }
+
+    inline bool IPAddress::parse(const char *str, const std::size_t &length) noexcept {
+        if (nullptr != std::memchr(str, ':', length))
+            return Internal::ParseIPv6(str, length, bytes);
+
+        IPv4Address address;
+        if (!Internal::ParseIPv4(str, length, address.bytes))
+            return false;
+
+        *this = IPAddress(address);
+        return true;
+    }
+
+    inline bool IPAddress::parse(const std::string &str) noexcept {
+        return parse(str.c_str(), str.length());
+    }
+
+    inline std::from_chars_result IPAddress::fromChars(const char *first, const char *last) noexcept {
+        // No IPv6 address begins with a dotted quad, so the families cannot be confused.
+        IPv4Address address;
+        const std::from_chars_result result = address.fromChars(first, last);
+        if (std::errc() == result.ec) {
+            *this = IPAddress(address);
+            return result;
+        }
+
+        IPv6Address v6;
+        const std::from_chars_result v6Result = v6.fromChars(first, last);
+        if (std::errc() == v6Result.ec)
+            bytes = v6.bytes;
+
+        return v6Result;
+    }
+
+    template <bool Compress>
+    inline std::to_chars_result IPAddress::toChars(char *first, char *last) const noexcept {
+        IPv4Address address;
+        if (toIPv4(address))
+            return address.toChars(first, last);
+
+        return toIPv6().toChars<Compress>(first, last);
+    }
+
+    template <bool Compress>
+    inline std::string IPAddress::stringify() const noexcept {
+        std::string str;
+        if (!stringify<Compress>(str))
+            str.clear();
+
+        return str;
+    }
+
+    template <bool Compress>
+    inline bool IPAddress::stringify(std::string &str) const noexcept {
+        char buffer[MaxLength + 1];
+        const std::to_chars_result result = toChars<Compress>(buffer, buffer + MaxLength + 1);
+
+        try {
+            str.assign(buffer, result.ptr);
+        }
+        catch (...) {
+            return false;
+        }
+
+        return true;
+    }
+
+    template <bool Compress>
+    inline std::size_t IPAddress::length() const noexcept {
+        IPv4Address address;
+        if (toIPv4(address))
+            return address.length();
+
+        return toIPv6().length<Compress>();
+    }
+
+    inline bool IPAddress::isIPv4() const noexcept {
+        return static_cast<std::uint64_t>(0) == (low64 | ((Internal::NetworkToHost64(high64) ^
+                                                            Internal::IPv4MappedPrefix) >> 32));
+    }
+
+    inline bool IPAddress::isIPv6() const noexcept {
+        return !isIPv4();
+    }
+
+    inline bool IPAddress::toIPv4(IPv4Address &address) const noexcept {
+        if (!isIPv4())
+            return false;
+
+        std::memcpy(address.bytes.data(), bytes.data() + 12, 4);
+        return true;
+    }
+
+    inline IPv6Address IPAddress::toIPv6() const noexcept {
+        return IPv6Address(bytes);
+    }
+
+    inline std::uint64_t IPAddress::hash(const std::uint64_t &seed) const noexcept {
+        return Internal::XXH3Hash64Short(bytes.data(), bytes.size(), Internal::XXH3DefaultSecret.data(), seed);
+    }
+
+    inline void IPAddress::reset() noexcept {
+        bytes.fill(static_cast<std::uint8_t>(0));
+    }
+
+    // Operators.
+    inline IPAddress::operator bool() const noexcept {
+        return static_cast<std::uint64_t>(0) != (low64 | high64);
+    }
+
+    inline IPAddress& IPAddress::operator=(const char *str) noexcept {
+        if (!parse(str))
+            reset();
+
+        return *this;
+    }
+
+    inline IPAddress& IPAddress::operator=(const std::string &str) noexcept {
+        if (!parse(str))
+            reset();
+
+        return *this;
+    }
+
+    inline bool IPAddress::operator==(const IPAddress &address) const noexcept {
+        return static_cast<std::uint64_t>(0) == ((this->low64 ^ address.low64) | (this->high64 ^ address.high64));
+    }
+
+    inline bool IPAddress::operator!=(const IPAddress &address) const noexcept {
+        return !operator==(address);
+    }
+
+    inline std::strong_ordering IPAddress::operator<=>(const IPAddress &address) const noexcept {
+        // `low64` holds the first 8 bytes of the address, thus the most significant half, which outweighs the other.
+        const int order = 2 * Internal::CompareWords(Internal::NetworkToHost64(this->low64),
+                                                     Internal::NetworkToHost64(address.low64)) +
+                          Internal::CompareWords(Internal::NetworkToHost64(this->high64),
+                                                 Internal::NetworkToHost64(address.high64));
+
+        return order <=> 0;
+    }
+
+    // Static utility functions.
+    inline IPAddress IPAddress::Parse(const char *str) noexcept {
+        return Parse(str, std::strlen(str));
+    }
+
+    inline IPAddress IPAddress::Parse(const char *str, const std::size_t &length) noexcept {
+        IPAddress address;
+        [[maybe_unused]] const bool _ = address.parse(str, length);
+        return address;
+    }
+
+    inline IPAddress IPAddress::Parse(const std::string &str) noexcept {
+        return Parse(str.c_str(), str.length());
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_ADDRESS_IMPL_IP_IPP
@@ -12,92 +12,491 @@
 #define CRONZ_IP_ADDRESS_IMPL_V4_IPP 1
 
 #include "cronz/ip/address/v4.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/simd.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstring>
+#include <string>
+#include <type_traits>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Weights of the digits at an octet start and the two bytes after it, indexed by the octet length.
+     */
+    inline constexpr std::uint32_t IPv4DigitWeights[4][3] = {{0, 0, 0}, {1, 0, 0}, {10, 1, 0}, {100, 10, 1}};
+
+    /**
+     * @brief Decimal forms of the octets, padded to 4 bytes, the last byte being the number of digits.
+     */
+    inline constexpr auto IPv4Octets = []() constexpr {
+        std::array<std::array<char, 4>, 256> table{};
+
+        for (auto octet = 0; octet < 256; ++octet) {
+            std::array<char, 4> &entry = table[octet];
+
+            if (100 <= octet)
+                entry = {static_cast<char>('0' + octet / 100), static_cast<char>('0' + octet / 10 % 10),
+                         static_cast<char>('0' + octet % 10), static_cast<char>(3)};
+            else if (10 <= octet)
+                entry = {static_cast<char>('0' + octet / 10), static_cast<char>('0' + octet % 10), '\0',
+                         static_cast<char>(2)};
+            else
+                entry = {static_cast<char>('0' + octet), '\0', '\0', static_cast<char>(1)};
+        }
+
+        return table;
+    }();
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Shuffle masks that move the digits of each octet into the hundreds, tens and ones bytes of a 32-bit lane,
+     * indexed by the octet lengths in base 3 (see `ParseIPv4SSSE3`).
+     */
+    inline constexpr auto IPv4Shuffles = []() constexpr {
+        std::array<std::array<std::uint8_t, 16>, 81> table{};
+
+        for (auto index = 0; index < 81; ++index) {
+            const int lengths[4] = {index / 27 + 1, index / 9 % 3 + 1, index / 3 % 3 + 1, index % 3 + 1};
+
+            auto start = 0;
+            for (auto octet = 0; octet < 4; ++octet) {
+                const int l = lengths[octet];
+                std::uint8_t *lane = &table[index][octet * 4];
+
+                lane[0] = (3 == l) ? static_cast<std::uint8_t>(start) : static_cast<std::uint8_t>(0x80);
+                lane[1] = (2 <= l) ? static_cast<std::uint8_t>(start + l - 2) : static_cast<std::uint8_t>(0x80);
+                lane[2] = static_cast<std::uint8_t>(start + l - 1);
+                lane[3] = static_cast<std::uint8_t>(0x80);
+
+                start += l + 1;
+            }
+        }
+
+        return table;
+    }();
+
+    /**
+     * @brief Shuffle masks that compact the hundreds, tens, ones and dot bytes of each octet into the dotted-decimal
+     * form, indexed by the octet lengths in base 3 (see `FormatIPv4SSSE3`).
+     */
+    inline constexpr auto IPv4FormatShuffles = []() constexpr {
+        std::array<std::array<std::uint8_t, 16>, 81> table{};
+
+        for (auto index = 0; index < 81; ++index) {
+            const int lengths[4] = {index / 27 + 1, index / 9 % 3 + 1, index / 3 % 3 + 1, index % 3 + 1};
+
+            table[index].fill(static_cast<std::uint8_t>(0x80));
+
+            auto offset = 0;
+            for (auto octet = 0; octet < 4; ++octet) {
+                for (auto digit = 3 - lengths[octet]; digit < 4; ++digit)
+                    table[index][offset++] = static_cast<std::uint8_t>(octet * 4 + digit);
+            }
+        }
+
+        return table;
+    }();
+
+    /**
+     * @brief Writes the dotted-decimal form of an IPv4 address with SSSE3.
+     * @param[in] value Address bytes in memory order.
+     * @param[out] str Output buffer of at least 16 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     * @remark The digits of all octets are computed at once by multiplying with fixed-point reciprocals, and compacted
+     * with a single shuffle.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline std::size_t FormatIPv4SSSE3(const std::array<std::uint8_t, 4> &value,
+                                                                   char *str) noexcept {
+        const int lengths[4] = {
+            IPv4Octets[value[0]][3], IPv4Octets[value[1]][3], IPv4Octets[value[2]][3], IPv4Octets[value[3]][3]
+        };
+
+        std::uint32_t packed;
+        std::memcpy(&packed, value.data(), sizeof(packed));
+
+        // `x / 100` is `(x * 41) >> 12` and `x / 10` is `(x * 103) >> 10` within the ranges involved.
+        const __m128i octets = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(packed)), _mm_setzero_si128());
+        const __m128i hundreds = _mm_srli_epi16(_mm_mullo_epi16(octets, _mm_set1_epi16(41)), 12);
+        const __m128i remainders = _mm_sub_epi16(octets, _mm_mullo_epi16(hundreds, _mm_set1_epi16(100)));
+        const __m128i tens = _mm_srli_epi16(_mm_mullo_epi16(remainders, _mm_set1_epi16(103)), 10);
+        const __m128i ones = _mm_sub_epi16(remainders, _mm_mullo_epi16(tens, _mm_set1_epi16(10)));
+
+        // Hundreds, tens, ones and a dot for each octet.
+        const __m128i digits = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_packus_epi16(hundreds, hundreds), _mm_packus_epi16(tens, tens)),
+            _mm_unpacklo_epi8(_mm_packus_epi16(ones, ones), _mm_set1_epi8('.' - '0')));
+
+        const __m128i chars = _mm_shuffle_epi8(
+            _mm_add_epi8(digits, _mm_set1_epi8('0')), _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                IPv4FormatShuffles[(lengths[0] - 1) * 27 + (lengths[1] - 1) * 9 + (lengths[2] - 1) * 3 + (lengths[3] -
+                    1)].data())));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(str), chars);
+
+        return static_cast<std::size_t>(3 + lengths[0] + lengths[1] + lengths[2] + lengths[3]);
+    }
+#endif
+
+    /**
+     * @brief Writes the dotted-decimal form of an IPv4 address without vector instructions (see `FormatIPv4`).
+     * @param[in] value Address bytes in memory order.
+     * @param[out] str Output buffer of at least 16 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     */
+    CRONZ_NODISCARD_L1 inline std::size_t FormatIPv4Portable(const std::array<std::uint8_t, 4> &value,
+                                                             char *str) noexcept {
+        auto offset = static_cast<std::size_t>(0);
+
+        for (auto i = 0; i < 4; ++i) {
+            const std::array<char, 4> &entry = IPv4Octets[value[i]];
+
+            // The whole entry is copied, the padding being overwritten by the next dot or octet.
+            std::memcpy(str + offset, entry.data(), entry.size());
+            offset += static_cast<std::size_t>(entry[3]);
+            str[offset] = '.';
+            offset += static_cast<std::size_t>(3 != i);
+        }
+
+        return offset;
+    }
+
+    /**
+     * @brief Writes the dotted-decimal form of an IPv4 address with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in] value Address bytes in memory order.
+     * @param[out] str Output buffer of at least 16 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     */
+    CRONZ_NODISCARD_L1 inline std::size_t FormatIPv4([[maybe_unused]] const SIMDLevel &level,
+                                                     const std::array<std::uint8_t, 4> &value, char *str) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SIMDLevel::SSSE3 <= level)
+            return FormatIPv4SSSE3(value, str);
+#endif
+
+        return FormatIPv4Portable(value, str);
+    }
+
+    /**
+     * @brief Writes the dotted-decimal form of an IPv4 address.
+     * @param[in] value Address bytes in memory order.
+     * @param[out] str Output buffer of at least 16 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     */
+    CRONZ_NODISCARD_L1 inline std::size_t FormatIPv4(const std::array<std::uint8_t, 4> &value, char *str) noexcept {
+        return FormatIPv4(DetectSIMDLevel(), value, str);
+    }
+
+    /**
+     * @brief Finds the octets of a classified IPv4 block.
+     * @param[in] dotMask Positions of the dots.
+     * @param[in] digitMask Positions of the decimal digits.
+     * @param[in] n Number of characters, without the trailing dot.
+     * @param[out] starts Positions of the octets.
+     * @param[out] lengths Lengths of the octets.
+     * @return `true` if the block is made of four octets of 1-3 digits separated by dots, otherwise, `false`.
+     */
+    CRONZ_NODISCARD_L1 inline bool FindIPv4Octets(std::uint32_t dotMask, std::uint32_t digitMask, const std::size_t &n,
+                                                  std::uint32_t (&starts)[4], std::uint32_t (&lengths)[4]) noexcept {
+        const std::uint32_t used = (static_cast<std::uint32_t>(1) << n) - static_cast<std::uint32_t>(1);
+        dotMask &= used;
+        digitMask &= used;
+
+        if ((dotMask | digitMask) != used || 3 != std::popcount(dotMask))
+            return false;
+
+        const auto dot1 = static_cast<std::uint32_t>(std::countr_zero(dotMask));
+        dotMask &= dotMask - static_cast<std::uint32_t>(1);
+        const auto dot2 = static_cast<std::uint32_t>(std::countr_zero(dotMask));
+        dotMask &= dotMask - static_cast<std::uint32_t>(1);
+        const auto dot3 = static_cast<std::uint32_t>(std::countr_zero(dotMask));
+
+        starts[0] = static_cast<std::uint32_t>(0);
+        starts[1] = dot1 + static_cast<std::uint32_t>(1);
+        starts[2] = dot2 + static_cast<std::uint32_t>(1);
+        starts[3] = dot3 + static_cast<std::uint32_t>(1);
+
+        lengths[0] = dot1;
+        lengths[1] = dot2 - dot1 - static_cast<std::uint32_t>(1);
+        lengths[2] = dot3 - dot2 - static_cast<std::uint32_t>(1);
+        lengths[3] = static_cast<std::uint32_t>(n) - dot3 - static_cast<std::uint32_t>(1);
+
+        // Every octet has 1-3 digits (an empty octet wraps around).
+        return !((static_cast<std::uint32_t>(2) < lengths[0] - static_cast<std::uint32_t>(1)) |
+                 (static_cast<std::uint32_t>(2) < lengths[1] - static_cast<std::uint32_t>(1)) |
+                 (static_cast<std::uint32_t>(2) < lengths[2] - static_cast<std::uint32_t>(1)) |
+                 (static_cast<std::uint32_t>(2) < lengths[3] - static_cast<std::uint32_t>(1)));
+    }
+
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Parses an IPv4 block with SSSE3 (see `ParseIPv4`).
+     * @param[in] block Characters, zero-padded to 18 bytes and aligned to 16 bytes.
+     * @param[in] n Number of characters, without the trailing dot.
+     * @param[out] value Address bytes in memory order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark The dots and digits are classified with two comparisons, and the digits of all octets are weighted at
+     * once after a shuffle that aligns them.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline bool ParseIPv4SSSE3(const unsigned char *block, const std::size_t &n,
+                                                          std::array<std::uint8_t, 4> &value) noexcept {
+        const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+        const __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+
+        const auto dotMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('.'))));
+        const auto digitMask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits)));
+
+        std::uint32_t starts[4];
+        std::uint32_t lengths[4];
+        if (!FindIPv4Octets(dotMask, digitMask, n, starts, lengths))
+            return false;
+
+        const std::uint32_t index = (lengths[0] - static_cast<std::uint32_t>(1)) * static_cast<std::uint32_t>(27) +
+                                    (lengths[1] - static_cast<std::uint32_t>(1)) * static_cast<std::uint32_t>(9) +
+                                    (lengths[2] - static_cast<std::uint32_t>(1)) * static_cast<std::uint32_t>(3) +
+                                    (lengths[3] - static_cast<std::uint32_t>(1));
+
+        const __m128i shuffled = _mm_shuffle_epi8(
+            digits, _mm_loadu_si128(reinterpret_cast<const __m128i*>(IPv4Shuffles[index].data())));
+        const __m128i octets = _mm_madd_epi16(_mm_maddubs_epi16(shuffled, _mm_setr_epi8(
+                                                  100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0)),
+                                              _mm_set1_epi16(1));
+
+        if (0 != _mm_movemask_epi8(_mm_cmpgt_epi32(octets, _mm_set1_epi32(255))))
+            return false;
+
+        const auto packed = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_shuffle_epi8(
+            octets, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1))));
+        std::memcpy(value.data(), &packed, sizeof(packed));
+
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Parses an IPv4 block without vector instructions (see `ParseIPv4`).
+     * @param[in] block Characters, zero-padded to 18 bytes.
+     * @param[in] n Number of characters, without the trailing dot.
+     * @param[out] value Address bytes in memory order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark The dots and digits are classified 8 bytes at a time (SWAR), and the digits are weighted without
+     * per-character branches.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParseIPv4Portable(const unsigned char *block, const std::size_t &n,
+                                                     std::array<std::uint8_t, 4> &value) noexcept {
+        const std::uint64_t low = LoadLE64(block);
+        const std::uint64_t high = LoadLE64(block + 8);
+
+        const std::uint32_t dotMask = SWARMask(SWAREqual(low, '.')) | (SWARMask(SWAREqual(high, '.')) << 8);
+        const std::uint32_t digitMask = SWARMask(SWARDigits(low)) | (SWARMask(SWARDigits(high)) << 8);
+
+        std::uint32_t starts[4];
+        std::uint32_t lengths[4];
+        if (!FindIPv4Octets(dotMask, digitMask, n, starts, lengths))
+            return false;
+
+        std::uint32_t octets[4];
+        for (auto i = 0; i < 4; ++i) {
+            const unsigned char *digit = &block[starts[i]];
+            const std::uint32_t (&weights)[3] = IPv4DigitWeights[lengths[i]];
+
+            // Bytes past the octet are weighted by zero, and wrap around harmlessly.
+            octets[i] = static_cast<std::uint32_t>(digit[0] - '0') * weights[0] +
+                        static_cast<std::uint32_t>(digit[1] - '0') * weights[1] +
+                        static_cast<std::uint32_t>(digit[2] - '0') * weights[2];
+        }
+
+        if (static_cast<std::uint32_t>(255) < (octets[0] | octets[1] | octets[2] | octets[3]))
+            return false;
+
+        for (auto i = 0; i < 4; ++i)
+            value[i] = static_cast<std::uint8_t>(octets[i]);
+
+        return true;
+    }
+
+    /**
+     * @brief Parses the dotted-decimal form of an IPv4 address with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in memory order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark The input is copied into a 16-byte block, and the dots and digits are classified at once. The octet
+     * lengths are then taken from the dot positions, and the digits are weighted without per-character branches.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParseIPv4([[maybe_unused]] const SIMDLevel &level, const char *str,
+                                             const std::size_t &length, std::array<std::uint8_t, 4> &value) noexcept {
+        if (static_cast<std::size_t>(7) > length || length > static_cast<std::size_t>(15))
+            return false;
+
+        // A single trailing dot is accepted.
+        const std::size_t n = length - static_cast<std::size_t>('.' == str[length - static_cast<std::size_t>(1)]);
+
+        // Two extra bytes, so that the digit reads of the last octet stay within the block.
+        alignas(16) unsigned char block[18] = {};
+        std::memcpy(block, str, n);
+
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SIMDLevel::SSSE3 <= level)
+            return ParseIPv4SSSE3(block, n, value);
+#endif
+
+        return ParseIPv4Portable(block, n, value);
+    }
+
+    /**
+     * @brief Parses the dotted-decimal form of an IPv4 address.
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in memory order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParseIPv4(const char *str, const std::size_t &length,
+                                             std::array<std::uint8_t, 4> &value) noexcept {
+        return ParseIPv4(DetectSIMDLevel(), str, length, value);
+    }
+
+    /**
+     * @brief Parses the dotted-decimal form of an IPv4 address one character at a time (see `ParseIPv4`).
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in memory order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark Accepts exactly the strings `ParseIPv4` accepts, and serves the constant evaluation of the parsing
+     * functions, which cannot run the block-based parser.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr bool ParseIPv4Constant(const char *str, const std::size_t &length,
+                                                               std::array<std::uint8_t, 4> &value) noexcept {
+        if (static_cast<std::size_t>(7) > length || length > static_cast<std::size_t>(15))
+            return false;
+
+        // A single trailing dot is accepted.
+        const std::size_t n = length - static_cast<std::size_t>('.' == str[length - static_cast<std::size_t>(1)]);
+
+        std::array<std::uint8_t, 4> octets{};
+        auto octet = static_cast<std::size_t>(0);
+        auto digits = static_cast<std::size_t>(0);
+        auto number = static_cast<std::uint32_t>(0);
+
+        for (auto i = static_cast<std::size_t>(0); i <= n; ++i) {
+            if (i == n || '.' == str[i]) {
+                if (static_cast<std::size_t>(0) == digits || static_cast<std::uint32_t>(255) < number ||
+                    (static_cast<std::size_t>(3) == octet) != (i == n))
+                    return false;
+
+                octets[octet++] = static_cast<std::uint8_t>(number);
+                digits = static_cast<std::size_t>(0);
+                number = static_cast<std::uint32_t>(0);
+                continue;
+            }
+
+            const auto digit = static_cast<std::uint32_t>(static_cast<unsigned char>(str[i]) - '0');
+            if (static_cast<std::uint32_t>(9) < digit || static_cast<std::size_t>(3) == digits)
+                return false;
+
+            number = number * static_cast<std::uint32_t>(10) + digit;
+            ++digits;
+        }
+
+        value = octets;
+        return true;
+    }
+
+    /**
+     * @brief Reports an invalid address literal.
+     * @remark Being not `constexpr`, a call to this function fails the compilation of the literal.
+     */
+    inline void InvalidAddressLiteral() noexcept {
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
 
 CRONZ_BEGIN_MODULE_NAMESPACE(IP)
     // Constructors.
-    inline IPv4Address::IPv4Address() noexcept : int32(static_cast<std::int32_t>(0)) {
+    inline constexpr IPv4Address::IPv4Address() noexcept : bytes{} {
     }
 
-    inline IPv4Address::IPv4Address(const std::int32_t &int32) noexcept : int32(int32) {
+    inline constexpr IPv4Address::IPv4Address(const std::int32_t &int32) noexcept : bytes(
+            std::bit_cast<std::array<std::uint8_t, static_cast<std::size_t>(4)>>(int32)) {
     }
 
-    inline IPv4Address::IPv4Address(const std::uint32_t &uint32) noexcept : uint32(uint32) {
+    inline constexpr IPv4Address::IPv4Address(const std::uint32_t &uint32) noexcept : bytes(
+            std::bit_cast<std::array<std::uint8_t, static_cast<std::size_t>(4)>>(uint32)) {
     }
 
-    inline IPv4Address::IPv4Address(const std::uint8_t &byte1, const std::uint8_t &byte2, const std::uint8_t &byte3,
-                                    const std::uint8_t &byte4) noexcept : bytes{byte1, byte2, byte3, byte4} {
+    inline constexpr IPv4Address::IPv4Address(const std::uint8_t &byte1, const std::uint8_t &byte2,
+                                              const std::uint8_t &byte3, const std::uint8_t &byte4) noexcept
+        : bytes{byte1, byte2, byte3, byte4} {
     }
 
-    inline IPv4Address::IPv4Address(
+    inline constexpr IPv4Address::IPv4Address(
             const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes) noexcept : bytes(bytes) {
     }
 
-    inline IPv4Address::IPv4Address(const std::bitset<static_cast<std::size_t>(32)> &bits) noexcept : bits(bits) {
+    inline IPv4Address::IPv4Address(const std::bitset<static_cast<std::size_t>(32)> &bits) noexcept : IPv4Address(
+            static_cast<std::uint32_t>(bits.to_ulong())) {
     }
 
-    inline IPv4Address::IPv4Address(const char *str) noexcept : IPv4Address(Parse(str)) {
+    inline constexpr IPv4Address::IPv4Address(const char *str) noexcept : IPv4Address(Parse(str)) {
     }
 
-    inline IPv4Address::IPv4Address(const char *str, const std::size_t &length) noexcept : IPv4Address(
+    inline constexpr IPv4Address::IPv4Address(const char *str, const std::size_t &length) noexcept : IPv4Address(
             Parse(str, length)) {
     }
 
-    inline IPv4Address::IPv4Address(const std::string &str) noexcept : IPv4Address(Parse(str)) {
+    inline constexpr IPv4Address::IPv4Address(const std::string &str) noexcept : IPv4Address(Parse(str)) {
     }
 
     // Instance-based utility functions.
-    inline bool IPv4Address::parse(const char *str) noexcept {
-        return parse(str, std::strlen(str));
+    inline constexpr bool IPv4Address::parse(const char *str) noexcept {
+        return parse(str, std::char_traits<char>::length(str));
     }
 
-    inline bool IPv4Address::parse(const char *str, const std::size_t &length) noexcept {
-        if (static_cast<std::size_t>(7) > length || length > static_cast<std::size_t>(15))
+    inline constexpr bool IPv4Address::parse(const char *str, const std::size_t &length) noexcept {
+        if (!std::is_constant_evaluated())
+            return Internal::ParseIPv4(str, length, bytes);
+
+        std::array<std::uint8_t, static_cast<std::size_t>(4)> value{};
+        if (!Internal::ParseIPv4Constant(str, length, value))
             return false;
 
-        uint32 = static_cast<std::uint32_t>(0);
+        bytes = value;
+        return true;
+    }
 
-        const char *const end = str + length;
-        const char *previous = str;
+    inline constexpr bool IPv4Address::parse(const std::string &str) noexcept {
+        return parse(str.c_str(), str.length());
+    }
 
-        auto byteIndex = static_cast<std::size_t>(0);
-        while (previous < end) {
-            if (static_cast<std::size_t>(3) < byteIndex)
-                return false;
+    inline std::from_chars_result IPv4Address::fromChars(const char *first, const char *last) noexcept {
+        // One character more than the longest address, so that longer runs fail.
+        const char *const limit = first + std::min(last - first, static_cast<std::ptrdiff_t>(MaxLength + 1));
 
-            const char *const current = std::ranges::find(previous, end, '.');
-            if (const auto byteLength = static_cast<std::size_t>(current - previous); static_cast<std::size_t>(0) ==
-                byteLength || byteLength > static_cast<std::size_t>(3))
-                return false;
+        const char *end = first;
+        while (end < limit && (('0' <= *end && *end <= '9') || '.' == *end))
+            ++end;
 
-            std::uint8_t &byte = bytes[byteIndex];
-            while (previous < current) {
-                if (const char c = *previous; '0' <= c && c <= '9') {
-                    const auto digit = static_cast<std::uint8_t>(c - '0');
-                    if (static_cast<std::uint8_t>(25) < byte || (static_cast<std::uint8_t>(25) == byte && static_cast<
-                        std::uint8_t>(5) < digit))
-                        return false;
-
-                    byte = (byte * static_cast<std::uint8_t>(10)) + static_cast<std::uint8_t>(digit);
-                }
-                else {
-                    return false;
-                }
+        if (!parse(first, end - first))
+            return {first, std::errc::invalid_argument};
 
-                ++previous;
-            }
+        return {end, std::errc()};
+    }
 
-            ++previous;
-            ++byteIndex;
-        }
+    inline std::to_chars_result IPv4Address::toChars(char *first, char *last) const noexcept {
+        if (static_cast<std::ptrdiff_t>(MaxLength + 1) <= last - first)
+            return {first + Internal::FormatIPv4(bytes, first), std::errc()};
 
-        return static_cast<std::size_t>(4) == byteIndex;
-    }
+        char buffer[MaxLength + 1];
+        const std::size_t len = Internal::FormatIPv4(bytes, buffer);
+        if (static_cast<std::ptrdiff_t>(len) > last - first)
+            return {last, std::errc::value_too_large};
 
-    inline bool IPv4Address::parse(const std::string &str) noexcept {
-        return parse(str.c_str(), str.length());
+        std::memcpy(first, buffer, len);
+        return {first + len, std::errc()};
     }
 
     inline std::string IPv4Address::stringify() const noexcept {
@@ -109,128 +508,103 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
     }
 
     inline bool IPv4Address::stringify(std::string &str) const noexcept {
+        char buffer[MaxLength + 1];
+        const std::size_t len = Internal::FormatIPv4(bytes, buffer);
+
         try {
-            str.resize(length());
+            str.assign(buffer, len);
         }
         catch (...) {
             return false;
         }
 
-        auto offset = static_cast<std::size_t>(0);
-        for (std::uint8_t byte : bytes) {
-            if (static_cast<std::size_t>(0) != offset)
-                str[offset++] = '.';
-
-            auto length = static_cast<std::size_t>(0);
-
-            do {
-                str[offset++] = static_cast<char>('0' + static_cast<char>(byte % static_cast<std::uint8_t>(10)));
-                byte /= static_cast<std::uint8_t>(10);
-                ++length;
-            }
-            while (static_cast<std::size_t>(0) != byte);
-
-            if (static_cast<std::size_t>(2) == length)
-                std::swap(str[offset - static_cast<std::size_t>(1)], str[offset - static_cast<std::size_t>(2)]);
-            else if (static_cast<std::size_t>(3) == length)
-                std::swap(str[offset - static_cast<std::size_t>(1)], str[offset - static_cast<std::size_t>(3)]);
-        }
-
         return true;
     }
 
     inline std::size_t IPv4Address::length() const noexcept {
-        auto length = static_cast<std::size_t>(7);
-
-        for (std::uint8_t byte : bytes) {
-            while (static_cast<std::uint8_t>(9) < byte) {
-                byte /= static_cast<std::uint8_t>(10);
-                ++length;
-            }
-        }
+        return static_cast<std::size_t>(3 + Internal::IPv4Octets[bytes[0]][3] + Internal::IPv4Octets[bytes[1]][3] +
+                                        Internal::IPv4Octets[bytes[2]][3] + Internal::IPv4Octets[bytes[3]][3]);
+    }
 
-        return length;
+    inline std::bitset<static_cast<std::size_t>(32)> IPv4Address::bits() const noexcept {
+        return std::bitset<static_cast<std::size_t>(32)>(static_cast<unsigned long>(uint32));
     }
 
-    inline void IPv4Address::reset() noexcept {
-        this->uint32 = static_cast<std::uint32_t>(0);
+    inline constexpr void IPv4Address::reset() noexcept {
+        bytes = {};
     }
 
     // Operators.
-    inline IPv4Address::operator bool() const noexcept {
-        return static_cast<std::uint32_t>(0) != uint32;
+    inline constexpr IPv4Address::operator bool() const noexcept {
+        return static_cast<std::uint32_t>(0) != std::bit_cast<std::uint32_t>(bytes);
     }
 
-    inline IPv4Address& IPv4Address::operator=(const std::int32_t &int32) noexcept {
-        this->int32 = int32;
+    inline constexpr IPv4Address& IPv4Address::operator=(const std::int32_t &int32) noexcept {
+        bytes = std::bit_cast<std::array<std::uint8_t, static_cast<std::size_t>(4)>>(int32);
         return *this;
     }
 
-    inline IPv4Address& IPv4Address::operator=(const std::uint32_t &uint32) noexcept {
-        this->uint32 = uint32;
+    inline constexpr IPv4Address& IPv4Address::operator=(const std::uint32_t &uint32) noexcept {
+        bytes = std::bit_cast<std::array<std::uint8_t, static_cast<std::size_t>(4)>>(uint32);
         return *this;
     }
 
-    inline IPv4Address& IPv4Address::operator=(
+    inline constexpr IPv4Address& IPv4Address::operator=(
             const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes) noexcept {
         this->bytes = bytes;
         return *this;
     }
 
     inline IPv4Address& IPv4Address::operator=(const std::bitset<static_cast<std::size_t>(32)> &bits) noexcept {
-        this->bits = bits;
-        return *this;
+        return operator=(static_cast<std::uint32_t>(bits.to_ulong()));
     }
 
-    inline IPv4Address& IPv4Address::operator=(const char *str) noexcept {
+    inline constexpr IPv4Address& IPv4Address::operator=(const char *str) noexcept {
         return parse(str) ? *this : operator=(static_cast<std::uint32_t>(0));
     }
 
-    inline IPv4Address& IPv4Address::operator=(const std::string &str) noexcept {
+    inline constexpr IPv4Address& IPv4Address::operator=(const std::string &str) noexcept {
         return parse(str) ? *this : operator=(static_cast<std::uint32_t>(0));
     }
 
-    inline bool IPv4Address::operator==(const IPv4Address &address) const noexcept {
-        return this->uint32 == address.uint32;
+    inline constexpr bool IPv4Address::operator==(const IPv4Address &address) const noexcept {
+        return std::bit_cast<std::uint32_t>(this->bytes) == std::bit_cast<std::uint32_t>(address.bytes);
     }
 
-    inline bool IPv4Address::operator!=(const IPv4Address &address) const noexcept {
-        return this->uint32 != address.uint32;
+    inline constexpr bool IPv4Address::operator!=(const IPv4Address &address) const noexcept {
+        return !operator==(address);
     }
 
-    // Destructors.
-    inline IPv4Address::~IPv4Address() noexcept = default;
+    inline constexpr std::strong_ordering IPv4Address::operator<=>(const IPv4Address &address) const noexcept {
+        return Internal::NetworkToHost32(std::bit_cast<std::uint32_t>(this->bytes)) <=>
+               Internal::NetworkToHost32(std::bit_cast<std::uint32_t>(address.bytes));
+    }
 
     // Static utility functions.
-    inline IPv4Address IPv4Address::Parse(const char *str) noexcept {
-        return Parse(str, std::strlen(str));
+    inline constexpr IPv4Address IPv4Address::Parse(const char *str) noexcept {
+        return Parse(str, std::char_traits<char>::length(str));
     }
 
-    inline IPv4Address IPv4Address::Parse(const char *str, const std::size_t &length) noexcept {
+    inline constexpr IPv4Address IPv4Address::Parse(const char *str, const std::size_t &length) noexcept {
         IPv4Address address;
         [[maybe_unused]] const bool _ = Parse(str, length, address);
         return address;
     }
 
-    inline IPv4Address IPv4Address::Parse(const std::string &str) noexcept {
+    inline constexpr IPv4Address IPv4Address::Parse(const std::string &str) noexcept {
         return Parse(str.c_str(), str.length());
     }
 
-    inline bool IPv4Address::Parse(const char *str, IPv4Address &address) noexcept {
-        return Parse(str, std::strlen(str), address);
+    inline constexpr bool IPv4Address::Parse(const char *str, IPv4Address &address) noexcept {
+        return Parse(str, std::char_traits<char>::length(str), address);
     }
 
-    inline bool IPv4Address::Parse(const char *str, const std::size_t &length, IPv4Address &address) noexcept {
-        const auto v = address.uint32;
-        if (!address.parse(str, length)) {
-            address.uint32 = v;
-            return false;
-        }
-
-        return true;
+    inline constexpr bool IPv4Address::Parse(const char *str, const std::size_t &length,
+                                             IPv4Address &address) noexcept {
+        return address.parse(str, length);
     }
 
-    inline bool IPv4Address::Parse(const std::string &str, IPv4Address &address) noexcept {
+    inline constexpr bool IPv4Address::Parse(const std::string &str, IPv4Address &address) noexcept {
         return Parse(str.c_str(), str.length(), address);
     }
 
@@ -242,6 +616,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         return address.stringify(str);
     }
 
+    // Literals.
+    inline namespace Literals {
+        consteval IPv4Address operator""_ipv4(const char *str, std::size_t length) noexcept {
+            IPv4Address address;
+            if (!address.parse(str, length))
+                Internal::InvalidAddressLiteral();
+
+            return address;
+        }
+    }
+
 CRONZ_END_MODULE_NAMESPACE
 
 #endif // CRONZ_IP_ADDRESS_IMPL_V4_IPP
@@ -13,370 +13,743 @@
 
 #include "cronz/ip/address/v6.hpp"
 #include "cronz/crypto/hex.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/simd.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstring>
 #include <limits>
+#include <string>
+#include <type_traits>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+#ifdef CRONZ_SIMD_DISPATCH
+    /**
+     * @brief Shuffle masks that expand the explicit groups of an IPv6 address around its `::` and swap them into
+     * network order, indexed by `count * 9 + gap` (see `ExpandIPv6GroupsSSSE3`).
+     */
+    inline constexpr auto IPv6Shuffles = []() constexpr {
+        std::array<std::array<std::uint8_t, 16>, 81> table{};
+
+        for (auto count = 0; count <= 8; ++count) {
+            for (auto gap = 0; gap <= count; ++gap) {
+                std::uint8_t *mask = table[count * 9 + gap].data();
+
+                for (auto group = 0; group < 8; ++group) {
+                    int source = -1;
+                    if (group < gap)
+                        source = group;
+                    else if (group >= 8 - (count - gap))
+                        source = group - (8 - count);
+
+                    mask[group * 2] = (0 > source) ? static_cast<std::uint8_t>(0x80)
+                                                   : static_cast<std::uint8_t>(source * 2 + 1);
+                    mask[group * 2 + 1] = (0 > source) ? static_cast<std::uint8_t>(0x80)
+                                                       : static_cast<std::uint8_t>(source * 2);
+                }
+            }
+        }
 
-CRONZ_BEGIN_MODULE_NAMESPACE(IP)
-    // Constructors.
-    inline IPv6Address::IPv6Address() noexcept : bits{0} {
+        return table;
+    }();
+
+    /**
+     * @brief Classifies the characters of an IPv6 block with SSSE3.
+     * @param[in] chars Characters, zero-padded to 48 bytes.
+     * @param[out] colonMask Positions of the colons.
+     * @param[out] hexMask Positions of the hexadecimal digits.
+     * @param[out] dotMask Positions of the dots.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline void ClassifyIPv6SSSE3(const unsigned char *chars, std::uint64_t &colonMask,
+                                                             std::uint64_t &hexMask, std::uint64_t &dotMask) noexcept {
+        for (auto i = 0; i < 3; ++i) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i * 16));
+            const __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+            const __m128i letters = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i hex = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits),
+                                             _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters));
+
+            colonMask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(':'))))) << (i * 16);
+            hexMask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(hex))) << (i * 16);
+            dotMask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('.'))))) << (i * 16);
+        }
     }
 
-    inline IPv6Address::IPv6Address(
-            const std::array<std::uint16_t, static_cast<std::size_t>(8)> &groups) noexcept : groups(groups) {
+    /**
+     * @brief Expands the explicit groups of an IPv6 address around its `::` with SSSE3.
+     * @param[in] groups Explicit groups in host order, followed by zeros up to 8 groups.
+     * @param[in] count Number of explicit groups.
+     * @param[in] left Number of explicit groups preceding the `::`.
+     * @param[out] value Address bytes in network order.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline void ExpandIPv6GroupsSSSE3(const std::uint16_t *groups, const std::size_t &count,
+                                                                 const std::size_t &left,
+                                                                 std::array<std::uint8_t, 16> &value) noexcept {
+        const __m128i expanded = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(groups)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(IPv6Shuffles[count * 9 + left].data())));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(value.data()), expanded);
     }
 
-    inline IPv6Address::IPv6Address(
-            const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept : bytes(bytes) {
+    /**
+     * @brief Expands the bytes of an IPv6 address into lowercase hexadecimal digits with SSSE3.
+     * @param[in] value Address bytes in network order.
+     * @param[out] digits Output buffer of at least 32 bytes, receiving 4 digits per group.
+     */
+    CRONZ_SIMD_TARGET("ssse3") inline void ExpandIPv6DigitsSSSE3(const std::array<std::uint8_t, 16> &value,
+                                                                 char *digits) noexcept {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(value.data()));
+        const __m128i mask = _mm_set1_epi8(0x0F);
+        const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Crypto::HexDigitsLowercase.data()));
+
+        const __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        const __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(bytes, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(digits), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(digits + 16), _mm_unpackhi_epi8(high, low));
     }
+#endif
+
+    /**
+     * @brief Classifies the characters of an IPv6 block with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in] chars Characters, zero-padded to 48 bytes.
+     * @param[out] colonMask Positions of the colons.
+     * @param[out] hexMask Positions of the hexadecimal digits.
+     * @param[out] dotMask Positions of the dots.
+     */
+    inline void ClassifyIPv6([[maybe_unused]] const SIMDLevel &level, const unsigned char *chars,
+                             std::uint64_t &colonMask, std::uint64_t &hexMask, std::uint64_t &dotMask) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SIMDLevel::SSSE3 <= level) {
+            ClassifyIPv6SSSE3(chars, colonMask, hexMask, dotMask);
+            return;
+        }
+#endif
 
-    inline IPv6Address::IPv6Address(const std::bitset<static_cast<std::size_t>(128)> &bits) noexcept : bits(bits) {
-    }
+        for (auto i = 0; i < 6; ++i) {
+            const std::uint64_t word = LoadLE64(chars + i * 8);
 
-    inline IPv6Address::IPv6Address(const char *str) noexcept : IPv6Address(Parse(str)) {
+            colonMask |= static_cast<std::uint64_t>(SWARMask(SWAREqual(word, ':'))) << (i * 8);
+            hexMask |= static_cast<std::uint64_t>(SWARMask(SWARHexDigits(word))) << (i * 8);
+            dotMask |= static_cast<std::uint64_t>(SWARMask(SWAREqual(word, '.'))) << (i * 8);
+        }
     }
 
-    inline IPv6Address::IPv6Address(const char *str, const std::size_t &length) noexcept : IPv6Address(
-            Parse(str, length)) {
+    /**
+     * @brief Expands the explicit groups of an IPv6 address around its `::` with the highest instruction set level
+     * available.
+     * @param[in] level Instruction set level.
+     * @param[in] groups Explicit groups in host order, followed by zeros up to 8 groups.
+     * @param[in] count Number of explicit groups.
+     * @param[in] left Number of explicit groups preceding the `::`.
+     * @param[out] value Address bytes in network order.
+     */
+    inline void ExpandIPv6Groups([[maybe_unused]] const SIMDLevel &level, const std::uint16_t *groups,
+                                 const std::size_t &count, const std::size_t &left,
+                                 std::array<std::uint8_t, 16> &value) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SIMDLevel::SSSE3 <= level) {
+            ExpandIPv6GroupsSSSE3(groups, count, left, value);
+            return;
+        }
+#endif
+
+        const std::size_t right = static_cast<std::size_t>(8) - (count - left);
+        for (auto j = static_cast<std::size_t>(0); j < static_cast<std::size_t>(8); ++j) {
+            std::uint16_t group = static_cast<std::uint16_t>(0);
+            if (j < left)
+                group = groups[j];
+            else if (j >= right)
+                group = groups[j - (static_cast<std::size_t>(8) - count)];
+
+            value[j * 2] = static_cast<std::uint8_t>(group >> 8);
+            value[j * 2 + 1] = static_cast<std::uint8_t>(group);
+        }
     }
 
-    inline IPv6Address::IPv6Address(const std::string &str) noexcept : IPv6Address(Parse(str)) {
-    }
+    /**
+     * @brief Parses the textual form of an IPv6 address, including the embedded IPv4 form (e.g. `::ffff:1.2.3.4`),
+     * with the highest instruction set level available.
+     * @param[in] level Instruction set level.
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in network order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark The input is copied into a 64-byte block, and the colons, hexadecimal digits and dots are classified at
+     * once. The groups are then read between the colon positions, and expanded around the `::` with a single shuffle.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParseIPv6(const SIMDLevel &level, const char *str, const std::size_t &length,
+                                             std::array<std::uint8_t, 16> &value) noexcept {
+        if (static_cast<std::size_t>(2) > length || length > static_cast<std::size_t>(45))
+            return false;
 
-    // Instance-based utility functions.
-    inline bool IPv6Address::findLargestZeroSequence(std::pair<std::size_t, std::size_t> &sequence) const noexcept {
-        std::pair test = {
-                std::numeric_limits<std::size_t>::max(),
-                std::numeric_limits<std::size_t>::max()
+        // Eight leading bytes, so that the 4-byte reads of the first group stay within the block.
+        alignas(16) unsigned char block[64] = {};
+        std::memcpy(block + 8, str, length);
+        const unsigned char *const chars = block + 8;
+
+        auto colonMask = static_cast<std::uint64_t>(0);
+        auto hexMask = static_cast<std::uint64_t>(0);
+        auto dotMask = static_cast<std::uint64_t>(0);
+
+        ClassifyIPv6(level, chars, colonMask, hexMask, dotMask);
+
+        const std::uint64_t used = (static_cast<std::uint64_t>(1) << length) - static_cast<std::uint64_t>(1);
+        colonMask &= used;
+        hexMask &= used;
+        dotMask &= used;
+
+        if ((colonMask | hexMask | dotMask) != used)
+            return false;
+
+        // Adjacent colons. A single pair is the `::`, anything more (`:::`, two `::`) is invalid.
+        const std::uint64_t pairs = colonMask & (colonMask >> 1);
+        if (1 < std::popcount(pairs))
+            return false;
+
+        const bool hasGap = (static_cast<std::uint64_t>(0) != pairs);
+        const auto gapPosition = static_cast<std::size_t>(std::countr_zero(pairs));
+
+        // End of the hexadecimal part.
+        std::size_t end = length;
+
+        std::array<std::uint8_t, 4> tail{};
+        const bool hasTail = (static_cast<std::uint64_t>(0) != dotMask);
+        if (hasTail) {
+            if (static_cast<std::uint64_t>(0) == colonMask)
+                return false;
+
+            // The embedded IPv4 address follows the last colon, and must not have the trailing dot `ParseIPv4` allows.
+            const auto tailStart = static_cast<std::size_t>(64 - std::countl_zero(colonMask));
+            if (static_cast<std::uint64_t>(0) != (dotMask & ((static_cast<std::uint64_t>(1) << tailStart) -
+                                                             static_cast<std::uint64_t>(1))) ||
+                '.' == str[length - static_cast<std::size_t>(1)] ||
+                !ParseIPv4(level, str + tailStart, length - tailStart, tail))
+                return false;
+
+            // The last colon separates the tail, unless it belongs to the `::`.
+            end = tailStart - static_cast<std::size_t>(1);
+            if (hasGap && (gapPosition + static_cast<std::size_t>(1)) == end)
+                end = tailStart;
+        }
+
+        // Explicit groups in host order, the first `left` of them preceding the `::`.
+        std::uint16_t groups[8] = {};
+        auto count = static_cast<std::size_t>(0);
+        auto left = static_cast<std::size_t>(8);
+
+        const std::size_t halves[2][2] = {
+            {static_cast<std::size_t>(0), hasGap ? gapPosition : end},
+            {hasGap ? (gapPosition + static_cast<std::size_t>(2)) : end, end}
         };
 
-        for (auto i = static_cast<std::size_t>(0); i < groups.size(); ++i) {
-            if (static_cast<std::uint16_t>(0) == groups[i]) {
-                if (std::numeric_limits<std::size_t>::max() == test.first)
-                    test.first = i;
+        for (auto h = 0; h < 2; ++h) {
+            const std::size_t b = halves[h][1];
 
-                test.second = i;
-            }
-            else if (std::numeric_limits<std::size_t>::max() != test.first) {
-                if (std::numeric_limits<std::size_t>::max() == test.first || (test.second - test.first) > (sequence.
-                    second - sequence.first))
-                    sequence = test;
+            if (1 == h && hasGap)
+                left = count;
 
-                test.first = test.second = std::numeric_limits<std::size_t>::max();
+            if (halves[h][0] == b)
+                continue;
+
+            const std::uint64_t colons = colonMask & ((static_cast<std::uint64_t>(1) << b) - static_cast<
+                                             std::uint64_t>(1));
+            for (std::size_t a = halves[h][0];; ) {
+                const std::uint64_t next = colons & ~((static_cast<std::uint64_t>(1) << a) - static_cast<
+                                                          std::uint64_t>(1));
+                const std::size_t c = (static_cast<std::uint64_t>(0) == next)
+                                          ? b : static_cast<std::size_t>(std::countr_zero(next));
+
+                // Every group has 1-4 digits (an empty group wraps around).
+                const std::size_t l = c - a;
+                if (static_cast<std::size_t>(3) < l - static_cast<std::size_t>(1) || static_cast<std::size_t>(8) ==
+                    count)
+                    return false;
+
+                // The 4 bytes ending at the group, bytes before the group being masked out.
+                const unsigned char *digit = chars + c - static_cast<std::size_t>(4);
+                auto group = static_cast<std::uint32_t>(0);
+                for (auto i = 0; i < 4; ++i)
+                    group = (group << 4) + (static_cast<std::uint32_t>(digit[i] & 0x0F) +
+                                            static_cast<std::uint32_t>(9) * static_cast<std::uint32_t>(digit[i] >> 6));
+
+                groups[count++] = static_cast<std::uint16_t>(group & ((static_cast<std::uint32_t>(1) << (l * 4)) -
+                                                                      static_cast<std::uint32_t>(1)));
+
+                if (c == b)
+                    break;
+
+                a = c + static_cast<std::size_t>(1);
             }
         }
 
-        if (std::numeric_limits<std::size_t>::max() != test.first && std::numeric_limits<std::size_t>::max() != test.
-            second)
-            sequence = test;
-
-        return (std::numeric_limits<std::size_t>::max() != sequence.first) && (std::numeric_limits<std::size_t>::max()
-            != sequence.second);
-    }
+        if (hasTail) {
+            if (static_cast<std::size_t>(6) < count)
+                return false;
 
-    // Conversion.
-    inline bool IPv6Address::parse(const char *str) noexcept {
-        return parse(str, std::strlen(str));
-    }
+            groups[count++] = static_cast<std::uint16_t>((tail[0] << 8) | tail[1]);
+            groups[count++] = static_cast<std::uint16_t>((tail[2] << 8) | tail[3]);
+        }
 
-    inline bool IPv6Address::parse(const char *str, const std::size_t &length) noexcept {
-        if (static_cast<std::size_t>(2) > length || length > static_cast<std::size_t>(39))
+        // The `::` stands for at least one group.
+        if (hasGap ? (static_cast<std::size_t>(8) == count) : (static_cast<std::size_t>(8) != count))
             return false;
 
-        reset();
+        ExpandIPv6Groups(level, groups, count, left, value);
 
-        const char *const beg = str;
-        const char *const end = str + length;
-        const char *const last = end - static_cast<std::size_t>(1);
+        return true;
+    }
 
-        auto groupIndex = static_cast<std::size_t>(0);
+    /**
+     * @brief Parses the textual form of an IPv6 address, including the embedded IPv4 form (e.g. `::ffff:1.2.3.4`).
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in network order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParseIPv6(const char *str, const std::size_t &length,
+                                             std::array<std::uint8_t, 16> &value) noexcept {
+        return ParseIPv6(DetectSIMDLevel(), str, length, value);
+    }
 
-        bool doubleColons = false;
-        std::size_t doubleColonsPos = std::numeric_limits<std::size_t>::max();
+    /**
+     * @brief Parses the textual form of an IPv6 address one character at a time (see `ParseIPv6`).
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[out] value Address bytes in network order. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark Accepts exactly the strings `ParseIPv6` accepts, and serves the constant evaluation of the parsing
+     * functions, which cannot run the block-based parser.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr bool ParseIPv6Constant(const char *str, const std::size_t &length,
+                                                               std::array<std::uint8_t, 16> &value) noexcept {
+        if (static_cast<std::size_t>(2) > length || length > static_cast<std::size_t>(45))
+            return false;
 
-        std::array<char, static_cast<std::size_t>(4)> characters{};
-        std::array<std::uint8_t, static_cast<std::size_t>(2)> bytes{};
+        // Explicit groups, the first `gap` of them preceding the `::`.
+        std::uint16_t groups[8] = {};
+        auto count = static_cast<std::size_t>(0);
+        std::size_t gap = std::numeric_limits<std::size_t>::max();
 
-        const char *previous = beg;
-        while (previous < end) {
-            if (groups.size() == groupIndex)
+        auto i = static_cast<std::size_t>(0);
+        if (':' == str[0]) {
+            if (':' != str[1])
                 return false;
 
-            const char *current = std::ranges::find(previous, end, ':');
-            const std::size_t currentLength = current - previous;
+            gap = static_cast<std::size_t>(0);
+            i = static_cast<std::size_t>(2);
+        }
 
-            if (static_cast<std::size_t>(4) < currentLength)
-                return false;
+        while (i < length) {
+            const std::size_t start = i;
+            auto group = static_cast<std::uint32_t>(0);
 
-            if (static_cast<std::size_t>(0) == currentLength) {
-                if (current == last)
-                    return true;
+            for (; i < length && static_cast<std::size_t>(5) > i - start; ++i) {
+                const auto c = static_cast<unsigned char>(str[i]);
 
-                if (current == beg) {
-                    if (':' != current[1])
-                        return false;
+                auto nibble = static_cast<std::uint32_t>(c - '0');
+                if (static_cast<std::uint32_t>(9) < nibble) {
+                    nibble = static_cast<std::uint32_t>((c | 0x20) - 'a');
+                    if (static_cast<std::uint32_t>(5) < nibble)
+                        break;
 
-                    ++current;
-                }
-                else if (doubleColons || ((current + static_cast<std::size_t>(1)) >= end) || ':' != current[-1]) {
-                    return false;
+                    nibble += static_cast<std::uint32_t>(10);
                 }
 
-                doubleColons = true;
-                doubleColonsPos = groupIndex;
+                group = (group << 4) | nibble;
             }
-            else {
-                characters.fill('0');
-                memcpy(characters.data() + (characters.size() - currentLength), previous, currentLength);
 
-                if (!Crypto::HexToByte(characters[0], characters[1], bytes[0]) ||
-                    !Crypto::HexToByte(characters[2], characters[3], bytes[1]))
+            // The embedded IPv4 address takes the rest, without the trailing dot `ParseIPv4Constant` allows.
+            if (i < length && '.' == str[i]) {
+                std::array<std::uint8_t, 4> tail{};
+                if (static_cast<std::size_t>(6) < count || '.' == str[length - static_cast<std::size_t>(1)] ||
+                    !ParseIPv4Constant(str + start, length - start, tail))
                     return false;
 
-                memcpy(&groups[groupIndex++], bytes.data(), bytes.size());
+                groups[count++] = static_cast<std::uint16_t>((tail[0] << 8) | tail[1]);
+                groups[count++] = static_cast<std::uint16_t>((tail[2] << 8) | tail[3]);
+                break;
             }
 
-            previous = current + static_cast<std::size_t>(1);
-        }
-
-        if (!doubleColons && ':' == last[0])
-            return false;
+            // Every group has 1-4 digits.
+            const std::size_t digits = i - start;
+            if (static_cast<std::size_t>(0) == digits || static_cast<std::size_t>(4) < digits ||
+                static_cast<std::size_t>(8) == count)
+                return false;
 
-        if (doubleColons) {
-            std::size_t numFilledGroups = groupIndex - doubleColonsPos;
-            if (static_cast<std::size_t>(0) == numFilledGroups) {
-                if (static_cast<std::size_t>(2) == length)
-                    return true;
+            groups[count++] = static_cast<std::uint16_t>(group);
+            if (i == length)
+                break;
 
+            if (':' != str[i++] || i == length)
                 return false;
-            }
 
-            auto i = static_cast<std::size_t>(1);
-            while (doubleColonsPos < groupIndex) {
-                std::swap(groups[doubleColonsPos + numFilledGroups - i], groups[groups.size() - i]);
+            if (':' == str[i]) {
+                if (std::numeric_limits<std::size_t>::max() != gap)
+                    return false;
+
+                gap = count;
                 ++i;
-                --numFilledGroups;
-                ++doubleColonsPos;
             }
+        }
 
-            return true;
+        // The `::` stands for at least one group.
+        const bool hasGap = (std::numeric_limits<std::size_t>::max() != gap);
+        if (hasGap ? (static_cast<std::size_t>(8) == count) : (static_cast<std::size_t>(8) != count))
+            return false;
+
+        const std::size_t right = static_cast<std::size_t>(8) - (count - (hasGap ? gap : count));
+        for (auto j = static_cast<std::size_t>(0); j < static_cast<std::size_t>(8); ++j) {
+            auto group = static_cast<std::uint16_t>(0);
+            if (j < gap && j < count)
+                group = groups[j];
+            else if (hasGap && j >= right)
+                group = groups[j - (static_cast<std::size_t>(8) - count)];
+
+            value[j * 2] = static_cast<std::uint8_t>(group >> 8);
+            value[j * 2 + 1] = static_cast<std::uint8_t>(group);
         }
 
-        return groupIndex == groups.size();
+        return true;
     }
 
-    inline bool IPv6Address::parse(const std::string &str) noexcept {
-        return parse(str.c_str(), str.length());
+    /**
+     * @brief Expands the bytes of an IPv6 address into lowercase hexadecimal digits with the highest instruction set
+     * level available.
+     * @param[in] level Instruction set level.
+     * @param[in] value Address bytes in network order.
+     * @param[out] digits Output buffer of at least 32 bytes, receiving 4 digits per group.
+     */
+    inline void ExpandIPv6Digits([[maybe_unused]] const SIMDLevel &level, const std::array<std::uint8_t, 16> &value,
+                                 char *digits) noexcept {
+#ifdef CRONZ_SIMD_DISPATCH
+        if (SIMDLevel::SSSE3 <= level) {
+            ExpandIPv6DigitsSSSE3(value, digits);
+            return;
+        }
+#endif
+
+        for (auto i = 0; i < 16; ++i)
+            Crypto::ByteToHex<true>(value[i], digits[i * 2], digits[i * 2 + 1]);
     }
 
+    /**
+     * @brief Writes the textual form of an IPv6 address with the highest instruction set level available.
+     * @tparam Compress Whether to replace the longest run of zero groups with `::`, as stated by
+     * [RFC5952](https://datatracker.ietf.org/doc/html/rfc5952).
+     * @param[in] level Instruction set level.
+     * @param[in] value Address bytes in network order.
+     * @param[out] str Output buffer of at least 40 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     * @remark The zero run is found once, in the same pass that reads the groups.
+     */
     template <bool Compress>
-    inline std::string IPv6Address::stringify() const noexcept {
-        std::string str;
-        if (!stringify<Compress>(str))
-            str.clear();
+    CRONZ_NODISCARD_L1 inline std::size_t FormatIPv6(const SIMDLevel &level, const std::array<std::uint8_t, 16> &value,
+                                                     char *str) noexcept {
+        // Three extra bytes, so that the 4-byte copies of the last group stay within the buffer.
+        char digits[35];
+        ExpandIPv6Digits(level, value, digits);
+
+        if constexpr (!Compress) {
+            for (auto i = 0; i < 8; ++i) {
+                std::memcpy(str + i * 5, digits + i * 4, 4);
+                str[i * 5 + 4] = ':';
+            }
 
-        return str;
+            return static_cast<std::size_t>(39);
+        }
+        else {
+            // Longest run of at least two zero groups, the first one on ties.
+            std::uint32_t groups[8];
+            auto runStart = 8;
+            auto runLength = 1;
+            for (auto i = 0, current = 0; i < 8; ++i) {
+                groups[i] = (static_cast<std::uint32_t>(value[i * 2]) << 8) | value[i * 2 + 1];
+
+                current = (static_cast<std::uint32_t>(0) == groups[i]) ? (current + 1) : 0;
+                if (current > runLength) {
+                    runStart = i + 1 - current;
+                    runLength = current;
+                }
+            }
+
+            auto offset = static_cast<std::size_t>(0);
+            for (auto i = 0; i < 8; ++i) {
+                if (i == runStart) {
+                    if (0 == i)
+                        str[offset++] = ':';
+
+                    str[offset++] = ':';
+                    i += runLength - 1;
+                    continue;
+                }
+
+                // 4 bytes are copied, starting past the leading zeros.
+                const auto count = static_cast<std::size_t>((std::bit_width(groups[i] | 1u) + 3) >> 2);
+                std::memcpy(str + offset, digits + (i * 4 + 4 - count), 4);
+                offset += count;
+
+                str[offset] = ':';
+                offset += static_cast<std::size_t>(7 != i);
+            }
+
+            return offset;
+        }
     }
 
+    /**
+     * @brief Writes the textual form of an IPv6 address.
+     * @tparam Compress Whether to replace the longest run of zero groups with `::`, as stated by
+     * [RFC5952](https://datatracker.ietf.org/doc/html/rfc5952).
+     * @param[in] value Address bytes in network order.
+     * @param[out] str Output buffer of at least 40 bytes. The bytes past the result may be overwritten.
+     * @return Number of characters written.
+     */
     template <bool Compress>
-    inline bool IPv6Address::stringify(std::string &str) const noexcept {
-        const std::size_t len = IPv6Address::length<Compress>();
+    CRONZ_NODISCARD_L1 inline std::size_t FormatIPv6(const std::array<std::uint8_t, 16> &value, char *str) noexcept {
+        return FormatIPv6<Compress>(DetectSIMDLevel(), value, str);
+    }
 
-        try {
-            str.resize(len);
-        }
-        catch (...) {
-            return false;
-        }
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
 
-        if constexpr (Compress) {
-            std::pair<std::size_t, std::size_t> sequence;
-            [[maybe_unused]] bool _ = findLargestZeroSequence(sequence);
-            _ = _ || (static_cast<std::size_t>(1) <= (sequence.second - sequence.first));
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline constexpr IPv6Address::IPv6Address() noexcept : bytes{} {
+    }
 
-            char temp;
+    inline constexpr IPv6Address::IPv6Address(
+            const std::array<std::uint16_t, static_cast<std::size_t>(8)> &groups) noexcept : bytes(
+            std::bit_cast<std::array<std::uint8_t, static_cast<std::size_t>(16)>>(groups)) {
+    }
 
-            bool n = false;
-            for (auto o = static_cast<std::size_t>(0), byteIndex = static_cast<std::size_t>(0), groupIndex = static_cast
-                              <std::size_t>(0); o < len; byteIndex += static_cast<std::size_t>(2), ++groupIndex) {
-                if (sequence.first <= groupIndex && groupIndex <= sequence.second) {
-                    n = (sequence.second == groupIndex);
-                    if (sequence.first == groupIndex || n)
-                        str[o++] = ':';
+    inline constexpr IPv6Address::IPv6Address(
+            const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept : bytes(bytes) {
+    }
 
-                    continue;
-                }
+    inline IPv6Address::IPv6Address(const std::bitset<static_cast<std::size_t>(128)> &bits) noexcept : bytes{} {
+        operator=(bits);
+    }
 
-                if (static_cast<std::size_t>(0) != o && !n)
-                    str[o++] = ':';
+    inline constexpr IPv6Address::IPv6Address(const char *str) noexcept : IPv6Address(Parse(str)) {
+    }
 
-                n = false;
+    inline constexpr IPv6Address::IPv6Address(const char *str, const std::size_t &length) noexcept : IPv6Address(
+            Parse(str, length)) {
+    }
 
-                const std::uint8_t b1 = bytes[byteIndex];
-                const std::uint8_t b2 = bytes[byteIndex + static_cast<std::size_t>(1)];
+    inline constexpr IPv6Address::IPv6Address(const std::string &str) noexcept : IPv6Address(Parse(str)) {
+    }
 
-                if (static_cast<std::uint8_t>(0) != b1) {
-                    if (static_cast<std::uint8_t>(16) <= b1) {
-                        Crypto::ByteToHex<true>(b1, str[o], str[o + static_cast<std::size_t>(1)]);
-                        o += static_cast<std::size_t>(2);
-                    }
-                    else {
-                        Crypto::ByteToHex<true>(b1, temp, str[o]);
-                        o += static_cast<std::size_t>(1);
-                    }
+    // Instance-based utility functions.
+    inline bool IPv6Address::findLargestZeroSequence(std::pair<std::size_t, std::size_t> &sequence) const noexcept {
+        std::pair test = {
+                std::numeric_limits<std::size_t>::max(),
+                std::numeric_limits<std::size_t>::max()
+        };
 
-                    Crypto::ByteToHex<true>(b2, str[o], str[o + static_cast<std::size_t>(1)]);
+        for (auto i = static_cast<std::size_t>(0); i < groups.size(); ++i) {
+            if (static_cast<std::uint16_t>(0) == groups[i]) {
+                if (std::numeric_limits<std::size_t>::max() == test.first)
+                    test.first = i;
 
-                    o += static_cast<std::size_t>(2);
-                }
-                else {
-                    if (static_cast<std::uint8_t>(16) <= b2) {
-                        Crypto::ByteToHex<true>(b2, str[o], str[o + static_cast<std::size_t>(1)]);
-                        o += static_cast<std::size_t>(2);
-                    }
-                    else {
-                        Crypto::ByteToHex<true>(b2, temp, str[o]);
-                        o += static_cast<std::size_t>(1);
-                    }
-                }
+                test.second = i;
             }
+            else if (std::numeric_limits<std::size_t>::max() != test.first) {
+                if (std::numeric_limits<std::size_t>::max() == test.first || (test.second - test.first) > (sequence.
+                    second - sequence.first))
+                    sequence = test;
 
-            return true;
-        }
-        else {
-            std::size_t i;
-            std::size_t j;
-            for (i = static_cast<std::size_t>(0), j = static_cast<std::size_t>(0); i < len; i += static_cast<
-                     std::size_t>(5), j += static_cast<std::size_t>(2)) {
-                Crypto::ByteToHex<true>(bytes[j], str[i], str[i + static_cast<std::size_t>(1)]);
-                Crypto::ByteToHex<true>(bytes[j + static_cast<std::size_t>(1)], str[i + static_cast<std::size_t>(2)],
-                                     str[i + static_cast<std::size_t>(3)]);
+                test.first = test.second = std::numeric_limits<std::size_t>::max();
             }
-
-            for (i = static_cast<std::size_t>(4); i < len; i += static_cast<std::size_t>(5))
-                str[i] = ':';
         }
 
+        if (std::numeric_limits<std::size_t>::max() != test.first && std::numeric_limits<std::size_t>::max() != test.
+            second)
+            sequence = test;
+
+        return (std::numeric_limits<std::size_t>::max() != sequence.first) && (std::numeric_limits<std::size_t>::max()
+            != sequence.second);
+    }
+
+    // Conversion.
+    inline constexpr bool IPv6Address::parse(const char *str) noexcept {
+        return parse(str, std::char_traits<char>::length(str));
+    }
+
+    inline constexpr bool IPv6Address::parse(const char *str, const std::size_t &length) noexcept {
+        if (!std::is_constant_evaluated())
+            return Internal::ParseIPv6(str, length, bytes);
+
+        std::array<std::uint8_t, static_cast<std::size_t>(16)> value{};
+        if (!Internal::ParseIPv6Constant(str, length, value))
+            return false;
+
+        bytes = value;
         return true;
     }
 
-    template <bool Compress>
-    inline std::size_t IPv6Address::length() const noexcept {
-        if constexpr (Compress) {
-            std::pair<std::size_t, std::size_t> sequence;
-            [[maybe_unused]] bool _ = findLargestZeroSequence(sequence);
-            _ = _ || (static_cast<std::size_t>(1) <= (sequence.second - sequence.first));
+    inline constexpr bool IPv6Address::parse(const std::string &str) noexcept {
+        return parse(str.c_str(), str.length());
+    }
 
-            auto len = static_cast<std::size_t>(7);
-            if (_) {
-                len -= (sequence.second - sequence.first);
+    inline std::from_chars_result IPv6Address::fromChars(const char *first, const char *last) noexcept {
+        // One character more than the longest address with an embedded IPv4 address, so that longer runs fail.
+        const char *const limit = first + std::min(last - first, static_cast<std::ptrdiff_t>(46));
 
-                if (static_cast<std::size_t>(0) == sequence.first)
-                    ++len;
+        const char *end = first;
+        while (end < limit && (Crypto::IsHexDigit(*end) || ':' == *end || '.' == *end))
+            ++end;
 
-                if (static_cast<std::size_t>(7) == sequence.second)
-                    ++len;
-            }
+        if (!parse(first, end - first))
+            return {first, std::errc::invalid_argument};
 
-            for (auto i = static_cast<std::size_t>(0), groupIndex = static_cast<std::size_t>(0); i < bytes.size(); i +=
-                 static_cast<std::size_t>(2), ++groupIndex) {
-                if (sequence.first <= groupIndex && groupIndex <= sequence.second)
-                    continue;
+        return {end, std::errc()};
+    }
 
-                const std::uint8_t &b1 = bytes[i];
-                const std::uint8_t &b2 = bytes[i + static_cast<std::size_t>(1)];
+    template <bool Compress>
+    inline std::to_chars_result IPv6Address::toChars(char *first, char *last) const noexcept {
+        if (static_cast<std::ptrdiff_t>(MaxLength + 1) <= last - first)
+            return {first + Internal::FormatIPv6<Compress>(bytes, first), std::errc()};
 
-                if (static_cast<std::uint8_t>(0) != b1) {
-                    len += static_cast<std::size_t>(3);
+        char buffer[MaxLength + 1];
+        const std::size_t len = Internal::FormatIPv6<Compress>(bytes, buffer);
+        if (static_cast<std::ptrdiff_t>(len) > last - first)
+            return {last, std::errc::value_too_large};
 
-                    if (static_cast<std::uint8_t>(16) <= b1)
-                        ++len;
-                }
-                else {
-                    ++len;
+        std::memcpy(first, buffer, len);
+        return {first + len, std::errc()};
+    }
 
-                    if (static_cast<std::uint8_t>(16) <= b2)
-                        ++len;
-                }
-            }
+    template <bool Compress>
+    inline std::string IPv6Address::stringify() const noexcept {
+        std::string str;
+        if (!stringify<Compress>(str))
+            str.clear();
+
+        return str;
+    }
+
+    template <bool Compress>
+    inline bool IPv6Address::stringify(std::string &str) const noexcept {
+        char buffer[MaxLength + 1];
+        const std::size_t len = Internal::FormatIPv6<Compress>(bytes, buffer);
+
+        try {
+            str.assign(buffer, len);
+        }
+        catch (...) {
+            return false;
+        }
 
-            return len;
+        return true;
+    }
+
+    template <bool Compress>
+    inline std::size_t IPv6Address::length() const noexcept {
+        if constexpr (Compress) {
+            char buffer[MaxLength + 1];
+            return Internal::FormatIPv6<Compress>(bytes, buffer);
         }
         else {
-            return static_cast<std::size_t>(39);
+            return MaxLength;
         }
     }
 
-    inline void IPv6Address::reset() noexcept {
-        bytes.fill(static_cast<std::uint8_t>(0));
+    inline std::bitset<static_cast<std::size_t>(128)> IPv6Address::bits() const noexcept {
+        return (std::bitset<static_cast<std::size_t>(128)>(static_cast<unsigned long long>(high64)) << 64) |
+               std::bitset<static_cast<std::size_t>(128)>(static_cast<unsigned long long>(low64));
+    }
+
+    inline constexpr void IPv6Address::reset() noexcept {
+        bytes = {};
     }
 
     // Operators.
-    inline IPv6Address::operator bool() const noexcept {
-        return static_cast<std::uint64_t>(0) != low64 && static_cast<std::uint64_t>(0) != high64;
+    inline constexpr IPv6Address::operator bool() const noexcept {
+        const auto words = std::bit_cast<std::array<std::uint64_t, static_cast<std::size_t>(2)>>(bytes);
+        return static_cast<std::uint64_t>(0) != (words[0] | words[1]);
     }
 
-    inline IPv6Address& IPv6Address::operator=(
+    inline constexpr IPv6Address& IPv6Address::operator=(
             const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept {
         this->bytes = bytes;
         return *this;
     }
 
     inline IPv6Address& IPv6Address::operator=(const std::bitset<static_cast<std::size_t>(128)> &bits) noexcept {
-        this->bits = bits;
+        const std::bitset<static_cast<std::size_t>(128)> mask(~static_cast<unsigned long long>(0));
+
+        low64 = static_cast<std::uint64_t>((bits & mask).to_ullong());
+        high64 = static_cast<std::uint64_t>((bits >> 64).to_ullong());
         return *this;
     }
 
-    inline IPv6Address& IPv6Address::operator=(const char *str) noexcept {
+    inline constexpr IPv6Address& IPv6Address::operator=(const char *str) noexcept {
+        if (!parse(str))
+            reset();
+
         return *this;
     }
 
-    inline IPv6Address& IPv6Address::operator=(const std::string &str) noexcept {
+    inline constexpr IPv6Address& IPv6Address::operator=(const std::string &str) noexcept {
+        if (!parse(str))
+            reset();
+
         return *this;
     }
 
-    inline bool IPv6Address::operator==(const IPv6Address &address) const noexcept {
-        return this->low64 == address.low64 && this->high64 == address.high64;
+    inline constexpr bool IPv6Address::operator==(const IPv6Address &address) const noexcept {
+        const auto a = std::bit_cast<std::array<std::uint64_t, static_cast<std::size_t>(2)>>(this->bytes);
+        const auto b = std::bit_cast<std::array<std::uint64_t, static_cast<std::size_t>(2)>>(address.bytes);
+
+        return static_cast<std::uint64_t>(0) == ((a[0] ^ b[0]) | (a[1] ^ b[1]));
     }
 
-    inline bool IPv6Address::operator!=(const IPv6Address &address) const noexcept {
-        return this->low64 != address.low64 || this->high64 != address.high64;
+    inline constexpr bool IPv6Address::operator!=(const IPv6Address &address) const noexcept {
+        return !operator==(address);
     }
 
-    // Destructors.
-    inline IPv6Address::~IPv6Address() noexcept = default;
+    inline constexpr std::strong_ordering IPv6Address::operator<=>(const IPv6Address &address) const noexcept {
+        const auto a = std::bit_cast<std::array<std::uint64_t, static_cast<std::size_t>(2)>>(this->bytes);
+        const auto b = std::bit_cast<std::array<std::uint64_t, static_cast<std::size_t>(2)>>(address.bytes);
+
+        // The first word holds the first 8 bytes of the address, thus the most significant half.
+        if (a[0] != b[0])
+            return Internal::NetworkToHost64(a[0]) <=> Internal::NetworkToHost64(b[0]);
+
+        return Internal::NetworkToHost64(a[1]) <=> Internal::NetworkToHost64(b[1]);
+    }
 
     // Static utility functions.
-    inline IPv6Address IPv6Address::Parse(const char *str) noexcept {
-        return Parse(str, std::strlen(str));
+    inline constexpr IPv6Address IPv6Address::Parse(const char *str) noexcept {
+        return Parse(str, std::char_traits<char>::length(str));
     }
 
-    inline IPv6Address IPv6Address::Parse(const char *str, const std::size_t &length) noexcept {
+    inline constexpr IPv6Address IPv6Address::Parse(const char *str, const std::size_t &length) noexcept {
         IPv6Address address;
         [[maybe_unused]] const bool _ = Parse(str, length, address);
         return address;
     }
 
-    inline IPv6Address IPv6Address::Parse(const std::string &str) noexcept {
+    inline constexpr IPv6Address IPv6Address::Parse(const std::string &str) noexcept {
         return Parse(str.c_str(), str.length());
     }
 
-    inline bool IPv6Address::Parse(const char *str, IPv6Address &address) noexcept {
-        return Parse(str, std::strlen(str), address);
+    inline constexpr bool IPv6Address::Parse(const char *str, IPv6Address &address) noexcept {
+        return Parse(str, std::char_traits<char>::length(str), address);
     }
 
-    inline bool IPv6Address::Parse(const char *str, const std::size_t &length, IPv6Address &address) noexcept {
-        const auto v = address.bytes;
-        if (!address.parse(str, length)) {
-            address.bytes = v;
-            return false;
-        }
-
-        return true;
+    inline constexpr bool IPv6Address::Parse(const char *str, const std::size_t &length,
+                                             IPv6Address &address) noexcept {
+        return address.parse(str, length);
     }
 
-    inline bool IPv6Address::Parse(const std::string &str, IPv6Address &address) noexcept {
+    inline constexpr bool IPv6Address::Parse(const std::string &str, IPv6Address &address) noexcept {
         return Parse(str.c_str(), str.length(), address);
     }
 
@@ -390,6 +763,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         return address.stringify<Compress>(str);
     }
 
+    // Literals.
+    inline namespace Literals {
+        consteval IPv6Address operator""_ipv6(const char *str, std::size_t length) noexcept {
+            IPv6Address address;
+            if (!address.parse(str, length))
+                Internal::InvalidAddressLiteral();
+
+            return address;
+        }
+    }
+
 CRONZ_END_MODULE_NAMESPACE
 
 #endif // CRONZ_IP_ADDRESS_IMPL_V6_IPP
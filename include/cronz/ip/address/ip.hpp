@@ -0,0 +1,339 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_ADDRESS_IP_HPP
+#define CRONZ_IP_ADDRESS_IP_HPP 1
+
+#include "cronz/ip/address/v4.hpp"
+#include "cronz/ip/address/v6.hpp"
+
+#include <array>
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_address
+     * @brief Address container for either IP family.
+     * @struct IPAddress
+     * @remark IPv4 addresses are kept as IPv4-mapped IPv6 addresses (`::ffff:0:0/96`,
+     * [RFC4291](https://datatracker.ietf.org/doc/html/rfc4291#section-2.5.5.2)), so `192.0.2.1` and
+     * `::ffff:192.0.2.1` are the same address.
+     * @remark The container is 16 bytes and trivially copyable, so it can be copied with `std::memcpy` and used as a
+     * key of hash tables without any indirection.
+     */
+    struct IPAddress {
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Maximum length of the string representation of an address.
+         */
+        inline static constexpr std::size_t MaxLength = IPv6Address::MaxLength;
+
+        union {
+            struct {
+                /**
+                 * @brief Low 64-bits of the address packed into a `std::uint64_t`.
+                 */
+                std::uint64_t low64;
+
+                /**
+                 * @brief High 64-bits of the address packed into a `std::uint64_t`.
+                 */
+                std::uint64_t high64;
+            };
+
+            /**
+             * @brief Individual bytes of the address, in network order.
+             */
+            std::array<std::uint8_t, static_cast<std::size_t>(16)> bytes;
+        };
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Constructs `::`.
+         */
+        IPAddress() noexcept;
+
+        /**
+         * @brief Constructor with IPv4 address initializer.
+         * @param[in] address IPv4 address, which will be mapped into `::ffff:0:0/96`.
+         */
+        IPAddress(const IPv4Address &address) noexcept;
+
+        /**
+         * @brief Constructor with IPv6 address initializer.
+         * @param[in] address IPv6 address.
+         */
+        IPAddress(const IPv6Address &address) noexcept;
+
+        /**
+         * @brief Constructor with byte array initializer.
+         * @param[in] bytes Bytes of an IPv6 address.
+         */
+        IPAddress(const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the address.
+         * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
+         */
+        IPAddress(const char *str) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the address.
+         * @param[in] length Length of the string representation of the address.
+         * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
+         */
+        IPAddress(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the address.
+         * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
+         */
+        IPAddress(const std::string &str) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Instance-based utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const char *str) noexcept;
+
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @param[in] length Length of the string to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         * @remark Strings with a colon are parsed as IPv6 addresses, and the others as IPv4 addresses.
+         * @remark Upon failure, the value of the container is preserved.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const std::string &str) noexcept;
+
+        /**
+         * @brief Parses an address at the beginning of a character range, in the manner of `std::from_chars`.
+         * @param[in] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the parsed address and `std::errc()` upon success, otherwise, `first` and
+         * `std::errc::invalid_argument`.
+         * @remark An IPv4 address is tried first, so `192.0.2.1:80` yields `192.0.2.1` and a pointer to the colon.
+         * @remark Upon failure, the value of the container is preserved.
+         */
+        CRONZ_NODISCARD_L2 std::from_chars_result fromChars(const char *first, const char *last) noexcept;
+
+        /**
+         * @brief Writes the address into a character range, in the manner of `std::to_chars`.
+         * @tparam Compress Whether to compress IPv6 addresses. If false, zero fields will be printed as well.
+         * @param[out] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+         * `std::errc::value_too_large`.
+         * @remark IPv4-mapped addresses are written in the dotted form, e.g. `192.0.2.1`.
+         * @remark At most `MaxLength` characters are written, without a terminating null character. Characters in
+         * `[ptr, last)` may be overwritten as well.
+         */
+        template <bool Compress = true>
+        CRONZ_NODISCARD_L2 std::to_chars_result toChars(char *first, char *last) const noexcept;
+
+        /**
+         * @brief Stringifies the address.
+         * @tparam Compress Whether to compress IPv6 addresses. If false, zero fields will be printed as well.
+         * @return Stringification result. Upon failure, this will be empty.
+         */
+        template <bool Compress = true>
+        CRONZ_NODISCARD_L1 std::string stringify() const noexcept;
+
+        /**
+         * @brief Stringifies the address.
+         * @tparam Compress Whether to compress IPv6 addresses. If false, zero fields will be printed as well.
+         * @param[out] str Stringification result.
+         * @return `true` if the stringification is successful, otherwise, `false`.
+         */
+        template <bool Compress = true>
+        CRONZ_NODISCARD_L2 bool stringify(std::string &str) const noexcept;
+
+        /**
+         * @brief Returns the stringified length of the address.
+         * @tparam Compress Whether to compress IPv6 addresses. If false, zero fields will be printed as well.
+         * @return The stringified length of the address.
+         */
+        template <bool Compress = true>
+        CRONZ_NODISCARD_L1 std::size_t length() const noexcept;
+
+        /**
+         * @brief Tells if the address is an IPv4-mapped address.
+         * @return `true` if the address is within `::ffff:0:0/96`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool isIPv4() const noexcept;
+
+        /**
+         * @brief Tells if the address is not an IPv4-mapped address.
+         * @return `true` if the address is outside `::ffff:0:0/96`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool isIPv6() const noexcept;
+
+        /**
+         * @brief Extracts the IPv4 address of an IPv4-mapped address.
+         * @param[out] address IPv4 address. Not altered upon failure.
+         * @return `true` if the address is an IPv4-mapped address, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool toIPv4(IPv4Address &address) const noexcept;
+
+        /**
+         * @brief Returns the address as an IPv6 address.
+         * @return IPv6 address. IPv4 addresses are returned in their mapped form.
+         */
+        CRONZ_NODISCARD_L1 IPv6Address toIPv6() const noexcept;
+
+        /**
+         * @brief Hashes the address.
+         * @param[in] seed Seed. A random seed keeps attacker-chosen addresses from colliding on purpose.
+         * @return 64-bit hash of the address.
+         * @remark The hash is the XXH3 hash of the 16 bytes, as `Crypto::Hash64` of the `IPv6Address`, which takes two
+         * 128-bit multiplications so that every address bit affects every hash bit.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t hash(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) const noexcept;
+
+        /**
+         * @brief Resets the container.
+         * @remark Sets all values to `0`.
+         */
+        void reset() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells whether the container contains a valid address.
+         * @return `true` if the container contains a valid address, otherwise, `false`.
+         * @remark Valid address refers to any non-`::` address.
+         */
+        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+
+        /**
+         * @brief Assigns an address string.
+         * @param[in] str String representation of the address.
+         * @return Reference to the current container.
+         * @remark Upon failure during the parsing of `str`, the value is set to `0`.
+         */
+        IPAddress& operator=(const char *str) noexcept;
+
+        /**
+         * @brief Assigns an address string.
+         * @param[in] str String representation of the address.
+         * @return Reference to the current container.
+         * @remark Upon failure during the parsing of `str`, the value is set to `0`.
+         */
+        IPAddress& operator=(const std::string &str) noexcept;
+
+        /**
+         * @brief Tells if the container has the same value as another container.
+         * @param[in] address Container to be compared with.
+         * @return `true` if the container has the same value as the other container.
+         */
+        CRONZ_NODISCARD_L1 bool operator==(const IPAddress &address) const noexcept;
+
+        /**
+         * @brief Tells if the container does not have the same value as another container.
+         * @param[in] address Container to be compared with.
+         * @return `true` if the container does not have the same value as the other container.
+         */
+        CRONZ_NODISCARD_L1 bool operator!=(const IPAddress &address) const noexcept;
+
+        /**
+         * @brief Compares the container with another container.
+         * @param[in] address Container to be compared with.
+         * @return Ordering of the container relative to the other container.
+         * @remark Addresses are ordered as 128-bit big-endian numbers, so IPv4 addresses keep their order and come
+         * after `::ffff:0:0`. Both halves are compared at once, without branching on the first one.
+         */
+        CRONZ_NODISCARD_L1 std::strong_ordering operator<=>(const IPAddress &address) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Static utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @return `IPAddress` container with the parsed result.
+         * @remark Upon failure, the returned container's content will be empty (equals to `0`).
+         */
+        CRONZ_NODISCARD_L1 static IPAddress Parse(const char *str) noexcept;
+
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @param[in] length Length of the string to be parsed.
+         * @return `IPAddress` container with the parsed result.
+         * @remark Upon failure, the returned container's content will be empty (equals to `0`).
+         */
+        CRONZ_NODISCARD_L1 static IPAddress Parse(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Parses an ipv4 or ipv6 string.
+         * @param[in] str String to be parsed.
+         * @return `IPAddress` container with the parsed result.
+         * @remark Upon failure, the returned container's content will be empty (equals to `0`).
+         */
+        CRONZ_NODISCARD_L1 static IPAddress Parse(const std::string &str) noexcept;
+
+        /** @} */
+    };
+
+    static_assert(std::is_trivially_copyable_v<IPAddress> && sizeof(IPAddress) == static_cast<std::size_t>(16),
+                  "IPAddress must stay a trivially copyable 16-byte container.");
+
+CRONZ_END_MODULE_NAMESPACE
+
+/**
+ * @brief `std::hash` specialization, so that `IPAddress` can be used as a key of unordered containers.
+ */
+template <>
+struct std::hash<Cronz::IP::IPAddress> {
+    CRONZ_NODISCARD_L1 std::size_t operator()(const Cronz::IP::IPAddress &address) const noexcept {
+        return static_cast<std::size_t>(address.hash());
+    }
+};
+
+#include "cronz/ip/address/impl/ip.ipp"
+
+#endif // CRONZ_IP_ADDRESS_IP_HPP
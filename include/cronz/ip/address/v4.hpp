@@ -15,6 +15,8 @@
 
 #include <array>
 #include <bitset>
+#include <charconv>
+#include <compare>
 #include <cstdint>
 #include <string>
 
@@ -23,12 +25,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
      * @ingroup cronz_ip_address
      * @brief IPv4 address container.
      * @struct IPv4Address
+     * @remark Parsing, construction and comparison are `constexpr`. The `constexpr` functions only ever make `bytes`
+     * the active member, and read the other members through `std::bit_cast`, so they work in constant expressions.
      */
     struct IPv4Address {
         /**
          * @name Properties.
          */
         /** @{ */
+        /**
+         * @brief Maximum length of the string representation of an address.
+         */
+        inline static constexpr std::size_t MaxLength = static_cast<std::size_t>(15);
+
         union {
             /**
              * @brief Address bytes packed in a `std::int32_t`.
@@ -44,11 +53,6 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
              * @brief Individual bytes of the address.
              */
             std::array<std::uint8_t, static_cast<std::size_t>(4)> bytes;
-
-            /**
-             * @brief Individual bits of the address.
-             */
-            std::bitset<static_cast<std::size_t>(32)> bits;
         };
 
         /** @} */
@@ -60,19 +64,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /**
          * @brief Default constructor. Does nothing.
          */
-        IPv4Address() noexcept;
+        constexpr IPv4Address() noexcept;
 
         /**
          * @brief Constructor with an initializer.
          * @param[in] int32 Packed `std::int32_t` value.
          */
-        IPv4Address(const std::int32_t &int32) noexcept;
+        constexpr IPv4Address(const std::int32_t &int32) noexcept;
 
         /**
          * @brief Constructor with an initializer.
          * @param[in] uint32 Packed `std::uint32_t` value.
          */
-        IPv4Address(const std::uint32_t &uint32) noexcept;
+        constexpr IPv4Address(const std::uint32_t &uint32) noexcept;
 
         /**
          * @brief Constructor with byte initializers.
@@ -81,18 +85,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] byte3 Third byte.
          * @param[in] byte4 Fourth byte.
          */
-        IPv4Address(const std::uint8_t &byte1, const std::uint8_t &byte2, const std::uint8_t &byte3,
-                    const std::uint8_t &byte4) noexcept;
+        constexpr IPv4Address(const std::uint8_t &byte1, const std::uint8_t &byte2, const std::uint8_t &byte3,
+                              const std::uint8_t &byte4) noexcept;
 
         /**
          * @brief Constructor with byte array initializer.
          * @param[in] bytes Bytes.
          */
-        IPv4Address(const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes) noexcept;
+        constexpr IPv4Address(const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes) noexcept;
 
         /**
          * @brief Constructor with bitset initializer.
-         * @param[in] bits Bit set.
+         * @param[in] bits Bit set, bit `i` being bit `i` of `uint32`.
          */
         IPv4Address(const std::bitset<static_cast<std::size_t>(32)> &bits) noexcept;
 
@@ -101,7 +105,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] str String representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv4Address(const char *str) noexcept;
+        constexpr IPv4Address(const char *str) noexcept;
 
         /**
          * @brief Constructor with string initializer.
@@ -109,14 +113,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] length Length of the string representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv4Address(const char *str, const std::size_t &length) noexcept;
+        constexpr IPv4Address(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Constructor with string initializer.
          * @param[in] str String representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv4Address(const std::string &str) noexcept;
+        constexpr IPv4Address(const std::string &str) noexcept;
 
         /** @} */
 
@@ -129,22 +133,47 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] str String to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 bool parse(const char *str) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const char *str) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
          * @param[in] str String to be parsed.
          * @param[in] length Length of the string to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
+         * @remark Octets may have leading zeros, and a single trailing dot is accepted.
+         * @remark Upon failure, the address is not altered.
+         * @remark During constant evaluation, a scalar parser accepting the same strings is used instead.
          */
-        CRONZ_NODISCARD_L2 bool parse(const char *str, const std::size_t &length) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
          * @param[in] str String to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 bool parse(const std::string &str) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const std::string &str) noexcept;
+
+        /**
+         * @brief Parses an ipv4 string at the beginning of a character range, in the manner of `std::from_chars`.
+         * @param[in] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the parsed address and `std::errc()` upon success, otherwise, `first` and
+         * `std::errc::invalid_argument`.
+         * @remark The longest run of digits and dots is parsed, so the address may be followed by any other character.
+         * @remark Upon failure, the address is not altered.
+         */
+        CRONZ_NODISCARD_L2 std::from_chars_result fromChars(const char *first, const char *last) noexcept;
+
+        /**
+         * @brief Writes the address into a character range, in the manner of `std::to_chars`.
+         * @param[out] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+         * `std::errc::value_too_large`.
+         * @remark At most `MaxLength` characters are written, without a terminating null character. Characters in
+         * `[ptr, last)` may be overwritten as well.
+         */
+        CRONZ_NODISCARD_L2 std::to_chars_result toChars(char *first, char *last) const noexcept;
 
         /**
          * @brief Stringifies the address.
@@ -165,11 +194,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          */
         CRONZ_NODISCARD_L1 std::size_t length() const noexcept;
 
+        /**
+         * @brief Returns the bits of the address.
+         * @return Bit set, bit `i` being bit `i` of `uint32`.
+         */
+        CRONZ_NODISCARD_L1 std::bitset<static_cast<std::size_t>(32)> bits() const noexcept;
+
         /**
          * @brief Resets the container.
          * @remark Sets all values to `0`.
          */
-        void reset() noexcept;
+        constexpr void reset() noexcept;
 
         /** @} */
 
@@ -178,69 +213,78 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          */
         /** @{ */
         /**
-         * @brief @brief Tells whether the container contains a valid IPv4 address.
+         * @brief Tells whether the container contains a valid IPv4 address.
          * @return `true` if the container contains a valid IPv4 address, otherwise, `false`.
          * @remark Valid address refers to any non-`0.0.0.0` address.
          */
-        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+        CRONZ_NODISCARD_L1 constexpr operator bool() const noexcept;
 
         /**
          * @brief Assigns a packed `std::int32_t` value as the address.
          * @param[in] int32 Packed `std::int32_t` value.
          * @return Reference to the current container.
          */
-        IPv4Address& operator=(const std::int32_t &int32) noexcept;
+        constexpr IPv4Address& operator=(const std::int32_t &int32) noexcept;
 
         /**
          * @brief Assigns a packed `std::uint32_t` value as the address.
          * @param[in] uint32 Packed `std::uint32_t` value.
          * @return Reference to the current container.
          */
-        IPv4Address& operator=(const std::uint32_t &uint32) noexcept;
+        constexpr IPv4Address& operator=(const std::uint32_t &uint32) noexcept;
 
         /**
          * @brief Assigns a byte array as the address.
          * @param[in] bytes Byte array.
          * @return Reference to the current container.
          */
-        IPv4Address& operator=(const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes) noexcept;
+        constexpr IPv4Address& operator=(const std::array<std::uint8_t, static_cast<std::size_t>(4)> &bytes)
+            noexcept;
 
         /**
          * @brief Assigns a bit set as the address.
-         * @param[in] bits Bit set.
+         * @param[in] bits Bit set, bit `i` being bit `i` of `uint32`.
          * @return Reference to the current container.
          */
         IPv4Address& operator=(const std::bitset<static_cast<std::size_t>(32)> &bits) noexcept;
 
         /**
-         * @brief Assigns a bit set as the address.
+         * @brief Assigns an address string.
          * @param[in] str String representation of the address.
          * @return Reference to the current container.
          * @remark Upon failure during the parsing of `str`, the value is set to `0`.
          */
-        IPv4Address& operator=(const char *str) noexcept;
+        constexpr IPv4Address& operator=(const char *str) noexcept;
 
         /**
-         * @brief Assigns a bit set as the address.
+         * @brief Assigns an address string.
          * @param[in] str String representation of the address.
          * @return Reference to the current container.
          * @remark Upon failure during the parsing of `str`, the value is set to `0`.
          */
-        IPv4Address& operator=(const std::string &str) noexcept;
+        constexpr IPv4Address& operator=(const std::string &str) noexcept;
 
         /**
          * @brief Tells if the container has the same value as another container.
          * @param[in] address Container to be compared with.
          * @return `true` if the container has the same value as the other container.
          */
-        CRONZ_NODISCARD_L1 bool operator==(const IPv4Address &address) const noexcept;
+        CRONZ_NODISCARD_L1 constexpr bool operator==(const IPv4Address &address) const noexcept;
 
         /**
          * @brief Tells if the container does not have the same value as another container.
          * @param[in] address Container to be compared with.
          * @return `true` if the container does not have the same value as the other container.
          */
-        CRONZ_NODISCARD_L1 bool operator!=(const IPv4Address &address) const noexcept;
+        CRONZ_NODISCARD_L1 constexpr bool operator!=(const IPv4Address &address) const noexcept;
+
+        /**
+         * @brief Compares the container with another container.
+         * @param[in] address Container to be compared with.
+         * @return Ordering of the container relative to the other container.
+         * @remark Addresses are ordered as big-endian numbers, e.g. `9.0.0.0` comes before `10.0.0.0`.
+         */
+        CRONZ_NODISCARD_L1 constexpr std::strong_ordering operator<=>(const IPv4Address &address) const noexcept;
 
         /** @} */
 
@@ -251,7 +295,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /**
          * @brief Default destructor. Does nothing.
          */
-        ~IPv4Address() noexcept;
+        ~IPv4Address() noexcept = default;
 
         /** @} */
 
@@ -265,7 +309,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv4Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv4Address Parse(const char *str) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv4Address Parse(const char *str) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
@@ -274,7 +318,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv4Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv4Address Parse(const char *str, const std::size_t &length) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv4Address Parse(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
@@ -282,7 +326,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv4Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv4Address Parse(const std::string &str) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv4Address Parse(const std::string &str) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
@@ -290,7 +334,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[out] address `IPv4Address` container to be overwritten with the parsed result.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const char *str, IPv4Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const char *str, IPv4Address &address) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
@@ -300,7 +344,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `true` if parsing is done successfully, otherwise, `false`.
          * @remark Upon failure, the value of `address` is preserved.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const char *str, const std::size_t &length, IPv4Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const char *str, const std::size_t &length,
+                                                  IPv4Address &address) noexcept;
 
         /**
          * @brief Parses an ipv4 string.
@@ -308,7 +353,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[out] address `IPv4Address` container to be overwritten with the parsed result.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const std::string &str, IPv4Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const std::string &str, IPv4Address &address) noexcept;
 
         /**
          * @brief Stringifies the address.
@@ -328,6 +373,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /** @} */
     };
 
+    inline namespace Literals {
+        /**
+         * @ingroup cronz_ip_address
+         * @brief Parses an IPv4 address literal at compile time, e.g. `"192.0.2.1"_ipv4`.
+         * @param[in] str String representation of the address.
+         * @param[in] length Length of the string representation of the address.
+         * @return Parsed address.
+         * @remark An invalid address fails to compile.
+         */
+        consteval IPv4Address operator""_ipv4(const char *str, std::size_t length) noexcept;
+    }
+
 CRONZ_END_MODULE_NAMESPACE
 
 #include "cronz/ip/address/impl/v4.ipp"
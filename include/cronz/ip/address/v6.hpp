@@ -20,12 +20,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
      * @struct IPv6Address
      * @remark IPv6 parsing and stringification process follows the specifications stated by
      * [RFC5952](https://datatracker.ietf.org/doc/html/rfc5952).
+     * @remark Parsing, construction and comparison are `constexpr`. The `constexpr` functions only ever make `bytes`
+     * the active member, and read the other members through `std::bit_cast`, so they work in constant expressions.
      */
     struct IPv6Address {
         /**
          * @name Properties.
          */
         /** @{ */
+        /**
+         * @brief Maximum length of the string representation of an address.
+         */
+        inline static constexpr std::size_t MaxLength = static_cast<std::size_t>(39);
+
         /**
          * @brief IPv6 address group.
          * @struct IPv6AddressGroup
@@ -120,11 +127,6 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
              * @brief Individual bytes of the address.
              */
             std::array<uint8_t, static_cast<std::size_t>(16)> bytes;
-
-            /**
-             * @brief Individual bits of the address.
-             */
-            std::bitset<static_cast<std::size_t>(128)> bits;
         };
 
         /** @} */
@@ -136,23 +138,23 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /**
          * @brief Default constructor. Does nothing.
          */
-        IPv6Address() noexcept;
+        constexpr IPv6Address() noexcept;
 
         /**
          * @brief Constructor with group array initializer.
          * @param[in] groups Groups.
          */
-        IPv6Address(const std::array<std::uint16_t, static_cast<std::size_t>(8)> &groups) noexcept;
+        constexpr IPv6Address(const std::array<std::uint16_t, static_cast<std::size_t>(8)> &groups) noexcept;
 
         /**
          * @brief Constructor with byte array initializer.
          * @param[in] bytes Bytes.
          */
-        IPv6Address(const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept;
+        constexpr IPv6Address(const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept;
 
         /**
          * @brief Constructor with bitset initializer.
-         * @param[in] bits Bit set.
+         * @param[in] bits Bit set, bits `0`-`63` being the bits of `low64` and bits `64`-`127` the bits of `high64`.
          */
         IPv6Address(const std::bitset<static_cast<std::size_t>(128)> &bits) noexcept;
 
@@ -161,7 +163,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] str String representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv6Address(const char *str) noexcept;
+        constexpr IPv6Address(const char *str) noexcept;
 
         /**
          * @brief Constructor with string initializer.
@@ -169,14 +171,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] length Length of the string representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv6Address(const char *str, const std::size_t &length) noexcept;
+        constexpr IPv6Address(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Constructor with string initializer.
          * @param[in] str String representation of the address.
          * @remark This will internally call `parse` and depending on the output the container might have a `0` value.
          */
-        IPv6Address(const std::string &str) noexcept;
+        constexpr IPv6Address(const std::string &str) noexcept;
 
         /** @} */
 
@@ -209,22 +211,51 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[in] str String to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 bool parse(const char *str) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const char *str) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
          * @param[in] str String to be parsed.
          * @param[in] length Length of the string to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
+         * @remark An embedded IPv4 address is accepted in place of the last two groups (e.g. `::ffff:192.0.2.1`).
+         * @remark A `::` stands for at least one group, and may appear once.
+         * @remark Upon failure, the value of the container is preserved.
+         * @remark During constant evaluation, a scalar parser accepting the same strings is used instead.
          */
-        CRONZ_NODISCARD_L2 bool parse(const char *str, const std::size_t &length) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
          * @param[in] str String to be parsed.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 bool parse(const std::string &str) noexcept;
+        CRONZ_NODISCARD_L2 constexpr bool parse(const std::string &str) noexcept;
+
+        /**
+         * @brief Parses an ipv6 string at the beginning of a character range, in the manner of `std::from_chars`.
+         * @param[in] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the parsed address and `std::errc()` upon success, otherwise, `first` and
+         * `std::errc::invalid_argument`.
+         * @remark The longest run of hexadecimal digits, colons and dots is parsed, so the address may be followed by
+         * any other character.
+         * @remark Upon failure, the value of the container is preserved.
+         */
+        CRONZ_NODISCARD_L2 std::from_chars_result fromChars(const char *first, const char *last) noexcept;
+
+        /**
+         * @brief Writes the address into a character range, in the manner of `std::to_chars`.
+         * @tparam Compress Whether to compress the output. If false, zero fields will be printed as well.
+         * @param[out] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+         * `std::errc::value_too_large`.
+         * @remark At most `MaxLength` characters are written, without a terminating null character. Characters in
+         * `[ptr, last)` may be overwritten as well.
+         */
+        template <bool Compress = true>
+        CRONZ_NODISCARD_L2 std::to_chars_result toChars(char *first, char *last) const noexcept;
 
         /**
          * @brief Stringifies the address.
@@ -251,11 +282,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         template <bool Compress>
         CRONZ_NODISCARD_L1 std::size_t length() const noexcept;
 
+        /**
+         * @brief Returns the bits of the address.
+         * @return Bit set, bits `0`-`63` being the bits of `low64` and bits `64`-`127` the bits of `high64`.
+         */
+        CRONZ_NODISCARD_L1 std::bitset<static_cast<std::size_t>(128)> bits() const noexcept;
+
         /**
          * @brief Resets the container.
          * @remark Sets all values to `0`.
          */
-        void reset() noexcept;
+        constexpr void reset() noexcept;
 
         /** @} */
 
@@ -264,55 +301,63 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          */
         /** @{ */
         /**
-         * @brief @brief Tells whether the container contains a valid IPv6 address.
+         * @brief Tells whether the container contains a valid IPv6 address.
          * @return `true` if the container contains a valid IPv6 address, otherwise, `false`.
-         * @remark Valid address refers to any non-`0.0.0.0` address.
+         * @remark Valid address refers to any non-`::` address.
          */
-        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+        CRONZ_NODISCARD_L1 constexpr operator bool() const noexcept;
 
         /**
          * @brief Assigns a byte array as the address.
          * @param[in] bytes Byte array.
          * @return Reference to the current container.
          */
-        IPv6Address& operator=(const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept;
+        constexpr IPv6Address& operator=(const std::array<std::uint8_t, static_cast<std::size_t>(16)> &bytes) noexcept;
 
         /**
          * @brief Assigns a bit set as the address.
-         * @param[in] bits Bit set.
+         * @param[in] bits Bit set, bits `0`-`63` being the bits of `low64` and bits `64`-`127` the bits of `high64`.
          * @return Reference to the current container.
          */
         IPv6Address& operator=(const std::bitset<static_cast<std::size_t>(128)> &bits) noexcept;
 
         /**
-         * @brief Assigns a bit set as the address.
+         * @brief Assigns an address string.
          * @param[in] str String representation of the address.
          * @return Reference to the current container.
          * @remark Upon failure during the parsing of `str`, the value is set to `0`.
          */
-        IPv6Address& operator=(const char *str) noexcept;
+        constexpr IPv6Address& operator=(const char *str) noexcept;
 
         /**
-         * @brief Assigns a bit set as the address.
+         * @brief Assigns an address string.
          * @param[in] str String representation of the address.
          * @return Reference to the current container.
          * @remark Upon failure during the parsing of `str`, the value is set to `0`.
          */
-        IPv6Address& operator=(const std::string &str) noexcept;
+        constexpr IPv6Address& operator=(const std::string &str) noexcept;
 
         /**
          * @brief Tells if the container has the same value as another container.
          * @param[in] address Container to be compared with.
          * @return `true` if the container has the same value as the other container.
          */
-        CRONZ_NODISCARD_L1 bool operator==(const IPv6Address &address) const noexcept;
+        CRONZ_NODISCARD_L1 constexpr bool operator==(const IPv6Address &address) const noexcept;
 
         /**
          * @brief Tells if the container does not have the same value as another container.
          * @param[in] address Container to be compared with.
          * @return `true` if the container does not have the same value as the other container.
          */
-        CRONZ_NODISCARD_L1 bool operator!=(const IPv6Address &address) const noexcept;
+        CRONZ_NODISCARD_L1 constexpr bool operator!=(const IPv6Address &address) const noexcept;
+
+        /**
+         * @brief Compares the container with another container.
+         * @param[in] address Container to be compared with.
+         * @return Ordering of the container relative to the other container.
+         * @remark Addresses are ordered as big-endian numbers, e.g. `9::` comes before `10::`.
+         */
+        CRONZ_NODISCARD_L1 constexpr std::strong_ordering operator<=>(const IPv6Address &address) const noexcept;
 
         /** @} */
 
@@ -323,7 +368,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /**
          * @brief Default destructor. Does nothing.
          */
-        ~IPv6Address() noexcept;
+        ~IPv6Address() noexcept = default;
 
         /** @} */
 
@@ -337,7 +382,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv6Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv6Address Parse(const char *str) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv6Address Parse(const char *str) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
@@ -346,7 +391,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv6Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv6Address Parse(const char *str, const std::size_t &length) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv6Address Parse(const char *str, const std::size_t &length) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
@@ -354,7 +399,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `IPv6Address` container with the parsed result.
          * @remark Upon failure, the returned container's content will be empty (equals to `0`).
          */
-        CRONZ_NODISCARD_L1 static IPv6Address Parse(const std::string &str) noexcept;
+        CRONZ_NODISCARD_L1 static constexpr IPv6Address Parse(const std::string &str) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
@@ -362,7 +407,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[out] address `IPv6Address` container to be overwritten with the parsed result.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const char *str, IPv6Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const char *str, IPv6Address &address) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
@@ -372,7 +417,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @return `true` if parsing is done successfully, otherwise, `false`.
          * @remark Upon failure, the value of `address` is preserved.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const char *str, const std::size_t &length, IPv6Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const char *str, const std::size_t &length,
+                                                  IPv6Address &address) noexcept;
 
         /**
          * @brief Parses an ipv6 string.
@@ -380,7 +426,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
          * @param[out] address `IPv6Address` container to be overwritten with the parsed result.
          * @return `true` if parsing is done successfully, otherwise, `false`.
          */
-        CRONZ_NODISCARD_L2 static bool Parse(const std::string &str, IPv6Address &address) noexcept;
+        CRONZ_NODISCARD_L2 static constexpr bool Parse(const std::string &str, IPv6Address &address) noexcept;
 
         /**
          * @brief Stringifies the address.
@@ -404,6 +450,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(IP)
         /** @} */
     };
 
+    inline namespace Literals {
+        /**
+         * @ingroup cronz_ip_address
+         * @brief Parses an IPv6 address literal at compile time, e.g. `"2001:db8::1"_ipv6`.
+         * @param[in] str String representation of the address.
+         * @param[in] length Length of the string representation of the address.
+         * @return Parsed address.
+         * @remark An invalid address fails to compile.
+         */
+        consteval IPv6Address operator""_ipv6(const char *str, std::size_t length) noexcept;
+    }
+
 CRONZ_END_MODULE_NAMESPACE
 
 #include "cronz/ip/address/impl/v6.ipp"
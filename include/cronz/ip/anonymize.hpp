@@ -0,0 +1,123 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_ANONYMIZE_HPP
+#define CRONZ_IP_ANONYMIZE_HPP 1
+
+/**
+ * @defgroup cronz_ip_anonymize Anonymization
+ * @ingroup cronz_ip
+ */
+
+#include "cronz/ip/network/v4.hpp"
+#include "cronz/ip/network/v6.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_anonymize
+     * @brief Clears the host bits of addresses, e.g. `192.0.2.55` becomes `192.0.2.0` with a `/24` prefix.
+     * @param[in,out] addresses Addresses to be truncated in place.
+     * @param[in] prefix Number of leading bits to be kept. Limited by `IPv4Network::MaxPrefix`.
+     */
+    void TruncateAddresses(const std::span<IPv4Address> &addresses, const std::uint8_t &prefix) noexcept;
+
+    /**
+     * @ingroup cronz_ip_anonymize
+     * @brief Clears the host bits of addresses, e.g. `2001:db8:1:2::3` becomes `2001:db8:1::` with a `/48` prefix.
+     * @param[in,out] addresses Addresses to be truncated in place.
+     * @param[in] prefix Number of leading bits to be kept. Limited by `IPv6Network::MaxPrefix`.
+     */
+    void TruncateAddresses(const std::span<IPv6Address> &addresses, const std::uint8_t &prefix) noexcept;
+
+    /**
+     * @ingroup cronz_ip_anonymize
+     * @brief Keyed, prefix-preserving address pseudonymization in the manner of Crypto-PAn.
+     * @class IPPseudonymizer
+     * @remark Bit `i` of an address is flipped by a pseudorandom bit derived from its first `i` bits, so two addresses
+     * sharing their first `n` bits are mapped to two addresses sharing exactly their first `n` bits. The mapping is a
+     * permutation of each family, and the results are plain addresses that can be written with `FormatAddresses`.
+     * @remark The pseudorandom bits are taken from SipHash-1-3 under the key, instead of the AES of Crypto-PAn. A hash
+     * yields the bits of six consecutive prefixes, and the hashes of an address are computed in lockstep.
+     * @remark The prefixes of the first 64 bits are hashed as one 64-bit word and those of the last 64 bits of an IPv6
+     * address as two, the first 64 bits then the prefix. A word holds the leading `6k` bits of the prefix, in host
+     * order, followed by a set bit and zeros, and it is hashed as its 8 little-endian bytes. Bit `2^j - 1 + s` of the
+     * hash is the flip bit of the prefix extended by the `j` bits `s`.
+     * @remark The same key gives the same mapping everywhere, so it should be kept secret and rotated as needed.
+     */
+    class IPPseudonymizer {
+        // Properties.
+        std::array<std::uint64_t, static_cast<std::size_t>(4)> state_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Key type.
+         */
+        using Key = std::array<std::uint8_t, static_cast<std::size_t>(16)>;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with key initializer.
+         * @param[in] key Secret key, which should be random.
+         */
+        IPPseudonymizer(const Key &key) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Pseudonymization.
+         */
+        /** @{ */
+        /**
+         * @brief Pseudonymizes an address.
+         * @param[in] address Address to be pseudonymized.
+         * @return Pseudonymized address.
+         */
+        CRONZ_NODISCARD_L1 IPv4Address pseudonymize(const IPv4Address &address) const noexcept;
+
+        /**
+         * @brief Pseudonymizes an address.
+         * @param[in] address Address to be pseudonymized.
+         * @return Pseudonymized address.
+         */
+        CRONZ_NODISCARD_L1 IPv6Address pseudonymize(const IPv6Address &address) const noexcept;
+
+        /**
+         * @brief Pseudonymizes addresses.
+         * @param[in,out] addresses Addresses to be pseudonymized in place.
+         */
+        void pseudonymize(const std::span<IPv4Address> &addresses) const noexcept;
+
+        /**
+         * @brief Pseudonymizes addresses.
+         * @param[in,out] addresses Addresses to be pseudonymized in place.
+         */
+        void pseudonymize(const std::span<IPv6Address> &addresses) const noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/impl/anonymize.ipp"
+
+#endif // CRONZ_IP_ANONYMIZE_HPP
@@ -0,0 +1,198 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_IMPL_ANONYMIZE_IPP
+#define CRONZ_IP_IMPL_ANONYMIZE_IPP 1
+
+#include "cronz/ip/anonymize.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/simd.hpp"
+
+#include <algorithm>
+#include <bit>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Applies a SipHash round to a state.
+     * @param[in,out] v0 First word of the state.
+     * @param[in,out] v1 Second word of the state.
+     * @param[in,out] v2 Third word of the state.
+     * @param[in,out] v3 Fourth word of the state.
+     */
+    inline constexpr void SipRound(std::uint64_t &v0, std::uint64_t &v1, std::uint64_t &v2,
+                                   std::uint64_t &v3) noexcept {
+        v0 += v1;
+        v1 = std::rotl(v1, 13);
+        v1 ^= v0;
+        v0 = std::rotl(v0, 32);
+        v2 += v3;
+        v3 = std::rotl(v3, 16);
+        v3 ^= v2;
+        v0 += v3;
+        v3 = std::rotl(v3, 21);
+        v3 ^= v0;
+        v2 += v1;
+        v1 = std::rotl(v1, 17);
+        v1 ^= v2;
+        v2 = std::rotl(v2, 32);
+    }
+
+    /**
+     * @brief Absorbs a message word into a SipHash-1-3 state.
+     * @param[in,out] state State.
+     * @param[in] word Message word.
+     */
+    inline constexpr void SipAbsorb(std::array<std::uint64_t, 4> &state, const std::uint64_t &word) noexcept {
+        state[3] ^= word;
+        SipRound(state[0], state[1], state[2], state[3]);
+        state[0] ^= word;
+    }
+
+    /**
+     * @brief Returns the Crypto-PAn flip bits of the prefixes of a word.
+     * @tparam Levels Number of prefixes, which is the number of leading bits to be pseudonymized.
+     * @param[in] state SipHash-1-3 state that precedes the word.
+     * @param[in] word Word, in host byte order.
+     * @param[in] length Byte length of the message that ends with the word.
+     * @return Flip bits, bit `63 - i` being the one of the first `i` bits of `word`.
+     * @remark Every 64-bit hash serves six levels. The first `6k` bits are hashed, followed by a marker bit that keeps
+     * the prefixes of different lengths apart, and bit `2^j - 1 + s` of the hash is the flip bit of that prefix
+     * extended by the `j` bits `s`. The hashes are independent, so they are computed in lockstep.
+     * @remark The message is a multiple of 8 bytes, so the final SipHash block only holds its length.
+     */
+    template <std::size_t Levels>
+    CRONZ_NODISCARD_L1 inline std::uint64_t PseudonymizationBits(const std::array<std::uint64_t, 4> &state,
+                                                                 const std::uint64_t &word,
+                                                                 const std::size_t &length) noexcept {
+        constexpr std::size_t chunks = (Levels + static_cast<std::size_t>(5)) / static_cast<std::size_t>(6);
+        const std::uint64_t last = static_cast<std::uint64_t>(length) << 56;
+
+        std::uint64_t hashes[chunks];
+        for (auto c = static_cast<std::size_t>(0); c < chunks; ++c) {
+            const std::size_t start = c * static_cast<std::size_t>(6);
+            const std::uint64_t message = (word & ~(~static_cast<std::uint64_t>(0) >> start)) |
+                                          (static_cast<std::uint64_t>(1) << (63 - start));
+
+            std::uint64_t v0 = state[0];
+            std::uint64_t v1 = state[1];
+            std::uint64_t v2 = state[2];
+            std::uint64_t v3 = state[3] ^ message;
+
+            SipRound(v0, v1, v2, v3);
+            v0 ^= message;
+
+            v3 ^= last;
+            SipRound(v0, v1, v2, v3);
+            v0 ^= last;
+
+            v2 ^= static_cast<std::uint64_t>(0xFF);
+
+            SipRound(v0, v1, v2, v3);
+            SipRound(v0, v1, v2, v3);
+            SipRound(v0, v1, v2, v3);
+
+            hashes[c] = v0 ^ v1 ^ v2 ^ v3;
+        }
+
+        // The hash bits form a binary tree, which is walked along the bits following each hashed prefix.
+        auto bits = static_cast<std::uint64_t>(0);
+        for (auto c = static_cast<std::size_t>(0); c < chunks; ++c) {
+            const std::size_t start = c * static_cast<std::size_t>(6);
+            std::uint64_t rest = word << start;
+            auto node = static_cast<std::uint64_t>(0);
+
+            for (std::size_t i = start; i < std::min(start + static_cast<std::size_t>(6), Levels); ++i) {
+                bits |= ((hashes[c] >> node) & static_cast<std::uint64_t>(1)) << (63 - i);
+                node = node * static_cast<std::uint64_t>(2) + static_cast<std::uint64_t>(1) + (rest >> 63);
+                rest <<= 1;
+            }
+        }
+
+        return bits;
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    inline void TruncateAddresses(const std::span<IPv4Address> &addresses, const std::uint8_t &prefix) noexcept {
+        const std::uint32_t mask = Internal::NetworkToHost32(Internal::IPv4PrefixMask(std::min(prefix,
+                                                                 IPv4Network::MaxPrefix)));
+
+        for (IPv4Address &address : addresses)
+            address.uint32 &= mask;
+    }
+
+    inline void TruncateAddresses(const std::span<IPv6Address> &addresses, const std::uint8_t &prefix) noexcept {
+        std::uint64_t high;
+        std::uint64_t low;
+        Internal::IPv6PrefixMask(std::min(prefix, IPv6Network::MaxPrefix), high, low);
+
+        // `low64` holds the first 8 bytes of the address, thus the high half.
+        high = Internal::NetworkToHost64(high);
+        low = Internal::NetworkToHost64(low);
+
+        for (IPv6Address &address : addresses) {
+            address.low64 &= high;
+            address.high64 &= low;
+        }
+    }
+
+    // Constructors.
+    inline IPPseudonymizer::IPPseudonymizer(const Key &key) noexcept {
+        const std::uint64_t k0 = Internal::LoadLE64(key.data());
+        const std::uint64_t k1 = Internal::LoadLE64(key.data() + 8);
+
+        state_ = {
+            k0 ^ static_cast<std::uint64_t>(0x736F6D6570736575ull),
+            k1 ^ static_cast<std::uint64_t>(0x646F72616E646F6Dull),
+            k0 ^ static_cast<std::uint64_t>(0x6C7967656E657261ull),
+            k1 ^ static_cast<std::uint64_t>(0x7465646279746573ull)
+        };
+    }
+
+    // Pseudonymization.
+    inline IPv4Address IPPseudonymizer::pseudonymize(const IPv4Address &address) const noexcept {
+        const auto word = static_cast<std::uint64_t>(Internal::NetworkToHost32(address.uint32)) << 32;
+        const std::uint64_t bits = Internal::PseudonymizationBits<32>(state_, word, static_cast<std::size_t>(8));
+
+        return IPv4Address(Internal::NetworkToHost32(static_cast<std::uint32_t>((word ^ bits) >> 32)));
+    }
+
+    inline IPv6Address IPPseudonymizer::pseudonymize(const IPv6Address &address) const noexcept {
+        // `low64` holds the first 8 bytes of the address, thus the high half.
+        const std::uint64_t high = Internal::NetworkToHost64(address.low64);
+        const std::uint64_t low = Internal::NetworkToHost64(address.high64);
+
+        // The prefixes longer than 64 bits share the high half, which is absorbed once.
+        std::array<std::uint64_t, 4> state = state_;
+        Internal::SipAbsorb(state, high);
+
+        const std::uint64_t first = Internal::PseudonymizationBits<64>(state_, high, static_cast<std::size_t>(8));
+        const std::uint64_t second = Internal::PseudonymizationBits<64>(state, low, static_cast<std::size_t>(16));
+
+        IPv6Address result;
+        result.low64 = Internal::NetworkToHost64(high ^ first);
+        result.high64 = Internal::NetworkToHost64(low ^ second);
+        return result;
+    }
+
+    inline void IPPseudonymizer::pseudonymize(const std::span<IPv4Address> &addresses) const noexcept {
+        for (IPv4Address &address : addresses)
+            address = pseudonymize(address);
+    }
+
+    inline void IPPseudonymizer::pseudonymize(const std::span<IPv6Address> &addresses) const noexcept {
+        for (IPv6Address &address : addresses)
+            address = pseudonymize(address);
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_IMPL_ANONYMIZE_IPP
@@ -0,0 +1,406 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_IMPL_RANGE_IPP
+#define CRONZ_IP_IMPL_RANGE_IPP 1
+
+#include "cronz/ip/address/v4.hpp"
+#include "cronz/ip/address/v6.hpp"
+#include "cronz/internal/endian.hpp"
+#include "cronz/internal/uint128.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    CRONZ_NODISCARD_L1 inline constexpr int CountTrailingZeros(const std::uint32_t &a) noexcept {
+        return std::countr_zero(a);
+    }
+
+    /**
+     * @brief Returns an address as a word in host byte order, so that words compare like addresses.
+     */
+    CRONZ_NODISCARD_L1 inline std::uint32_t RangeWord(const IP::IPv4Address &address) noexcept {
+        return NetworkToHost32(address.uint32);
+    }
+
+    CRONZ_NODISCARD_L1 inline UInt128 RangeWord(const IP::IPv6Address &address) noexcept {
+        // `low64` holds the first 8 bytes of the address, thus the high half.
+        return {NetworkToHost64(address.low64), NetworkToHost64(address.high64)};
+    }
+
+    /**
+     * @brief Returns the address of a word in host byte order.
+     */
+    CRONZ_NODISCARD_L1 inline IP::IPv4Address RangeAddress(const std::uint32_t &word) noexcept {
+        return IP::IPv4Address(NetworkToHost32(word));
+    }
+
+    CRONZ_NODISCARD_L1 inline IP::IPv6Address RangeAddress(const UInt128 &word) noexcept {
+        IP::IPv6Address address;
+        address.low64 = NetworkToHost64(word.high);
+        address.high64 = NetworkToHost64(word.low);
+        return address;
+    }
+
+    /**
+     * @brief Set of words kept as sorted, disjoint and non-adjacent inclusive ranges.
+     * @tparam Word `std::uint32_t` or `UInt128`.
+     * @remark Next to the sorted ranges, their last words are kept in the Eytzinger (breadth-first) layout: the first
+     * levels of the search share a few cache lines, and the search runs a fixed number of branch-free steps. The
+     * layout is padded to a complete tree with `Max`, and the sorted position of a node follows from its index.
+     */
+    template <typename Word>
+    class RangeSet {
+    public:
+        struct Range {
+            Word first;
+            Word last;
+
+            CRONZ_NODISCARD_L1 friend constexpr bool operator==(const Range &a, const Range &b) noexcept = default;
+        };
+
+        inline static constexpr Word Max = ~Word{};
+        inline static constexpr std::uint32_t Bits = static_cast<std::uint32_t>(sizeof(Word) * 8);
+
+    private:
+        inline static constexpr std::size_t Lanes = static_cast<std::size_t>(8);
+
+        std::vector<Range> ranges_;
+        std::vector<Word> tree_;
+        std::uint32_t depth_ = static_cast<std::uint32_t>(0);
+
+        static void coalesce_(std::vector<Range> &ranges) noexcept {
+            if (ranges.empty())
+                return;
+
+            auto last = ranges.begin();
+            for (auto range = ranges.begin() + 1; range != ranges.end(); ++range) {
+                if (Max == last->last || range->first <= last->last + 1)
+                    last->last = std::max(last->last, range->last);
+                else
+                    *++last = *range;
+            }
+
+            ranges.erase(last + 1, ranges.end());
+        }
+
+        static void layout_(std::vector<Word> &tree, const std::vector<Range> &ranges, const std::size_t &node,
+                            std::size_t &index) noexcept {
+            if (node >= tree.size())
+                return;
+
+            layout_(tree, ranges, node * 2, index);
+            tree[node] = (index < ranges.size()) ? ranges[index].last : Max;
+            ++index;
+            layout_(tree, ranges, node * 2 + 1, index);
+        }
+
+        CRONZ_NODISCARD_L1 bool assign_(std::vector<Range> &ranges) noexcept {
+            const auto depth = static_cast<std::uint32_t>(std::bit_width(ranges.size()));
+
+            std::vector<Word> tree;
+            try {
+                tree.resize(static_cast<std::size_t>(1) << depth);
+            }
+            catch (...) {
+                return false;
+            }
+
+            auto index = static_cast<std::size_t>(0);
+            layout_(tree, ranges, static_cast<std::size_t>(1), index);
+
+            ranges_.swap(ranges);
+            tree_.swap(tree);
+            depth_ = depth;
+            return true;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t search_(const Word &word) const noexcept {
+            auto node = static_cast<std::size_t>(1);
+            for (auto level = static_cast<std::uint32_t>(0); level < depth_; ++level)
+                node = node * 2 + static_cast<std::size_t>(tree_[node] < word);
+
+            return node;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t rank_(std::size_t node) const noexcept {
+            // The node is the last one the search went left at, i.e. the first range not ending before the word.
+            node >>= std::countr_one(node) + 1;
+            if (static_cast<std::size_t>(0) == node)
+                return ranges_.size();
+
+            const auto level = static_cast<std::uint32_t>(std::bit_width(node) - 1);
+            return (((node - (static_cast<std::size_t>(1) << level)) * 2 + 1) << (depth_ - level - 1)) - 1;
+        }
+
+        CRONZ_NODISCARD_L1 bool find_(const std::size_t &node, const Word &word) const noexcept {
+            const std::size_t rank = rank_(node);
+            return rank < ranges_.size() && ranges_[rank].first <= word;
+        }
+
+    public:
+        RangeSet() noexcept = default;
+
+        RangeSet(const RangeSet &set) = delete;
+
+        RangeSet(RangeSet &&set) noexcept : ranges_(std::move(set.ranges_)), tree_(std::move(set.tree_)),
+                                            depth_(set.depth_) {
+            set.clear();
+        }
+
+        CRONZ_NODISCARD_L2 bool assign(const RangeSet &set) noexcept {
+            std::vector<Range> ranges;
+            try {
+                ranges = set.ranges_;
+            }
+            catch (...) {
+                return false;
+            }
+
+            return assign_(ranges);
+        }
+
+        CRONZ_NODISCARD_L2 bool insert(const Range &range) noexcept {
+            if (range.last < range.first)
+                return false;
+
+            // Ranges ending before the word preceding `range` and starting after the word following it stay apart.
+            const auto low = std::ranges::partition_point(ranges_, [&range](const Range &r) {
+                return Word{} != range.first && r.last < range.first - 1;
+            });
+            const auto high = std::partition_point(low, ranges_.end(), [&range](const Range &r) {
+                return Max == range.last || r.first <= range.last + 1;
+            });
+
+            std::vector<Range> ranges;
+            try {
+                ranges.reserve(ranges_.size() + 1);
+            }
+            catch (...) {
+                return false;
+            }
+
+            ranges.insert(ranges.end(), ranges_.begin(), low);
+            if (low == high)
+                ranges.push_back(range);
+            else
+                ranges.push_back({std::min(range.first, low->first), std::max(range.last, (high - 1)->last)});
+
+            ranges.insert(ranges.end(), high, ranges_.end());
+            return assign_(ranges);
+        }
+
+        CRONZ_NODISCARD_L2 bool insert(std::vector<Range> &ranges) noexcept {
+            if (std::ranges::any_of(ranges, [](const Range &range) { return range.last < range.first; }))
+                return false;
+
+            std::vector<Range> merged;
+            try {
+                std::ranges::sort(ranges, {}, &Range::first);
+
+                merged.resize(ranges_.size() + ranges.size());
+            }
+            catch (...) {
+                return false;
+            }
+
+            std::ranges::merge(ranges_, ranges, merged.begin(), {}, &Range::first, &Range::first);
+            coalesce_(merged);
+            return assign_(merged);
+        }
+
+        CRONZ_NODISCARD_L2 bool assignUnion(const RangeSet &a, const RangeSet &b) noexcept {
+            std::vector<Range> merged;
+            try {
+                merged.resize(a.ranges_.size() + b.ranges_.size());
+            }
+            catch (...) {
+                return false;
+            }
+
+            std::ranges::merge(a.ranges_, b.ranges_, merged.begin(), {}, &Range::first, &Range::first);
+            coalesce_(merged);
+            return assign_(merged);
+        }
+
+        CRONZ_NODISCARD_L2 bool assignIntersection(const RangeSet &a, const RangeSet &b) noexcept {
+            std::vector<Range> ranges;
+            try {
+                // Every range of the result ends where one of the operands' does.
+                ranges.reserve(a.ranges_.size() + b.ranges_.size());
+            }
+            catch (...) {
+                return false;
+            }
+
+            auto i = a.ranges_.cbegin();
+            auto j = b.ranges_.cbegin();
+            while (i != a.ranges_.cend() && j != b.ranges_.cend()) {
+                const Word first = std::max(i->first, j->first);
+                const Word last = std::min(i->last, j->last);
+                if (first <= last)
+                    ranges.push_back({first, last});
+
+                if (i->last < j->last)
+                    ++i;
+                else
+                    ++j;
+            }
+
+            return assign_(ranges);
+        }
+
+        CRONZ_NODISCARD_L2 bool assignDifference(const RangeSet &a, const RangeSet &b) noexcept {
+            std::vector<Range> ranges;
+            try {
+                // Every range of the second operand splits at most one range in two.
+                ranges.reserve(a.ranges_.size() + b.ranges_.size());
+            }
+            catch (...) {
+                return false;
+            }
+
+            auto j = b.ranges_.cbegin();
+            for (const Range &range : a.ranges_) {
+                while (j != b.ranges_.cend() && j->last < range.first)
+                    ++j;
+
+                Word first = range.first;
+                bool covered = false;
+                for (auto k = j; k != b.ranges_.cend() && k->first <= range.last; ++k) {
+                    if (first < k->first)
+                        ranges.push_back({first, k->first - 1});
+
+                    if (range.last <= k->last) {
+                        covered = true;
+                        break;
+                    }
+
+                    first = k->last + 1;
+                }
+
+                if (!covered)
+                    ranges.push_back({first, range.last});
+            }
+
+            return assign_(ranges);
+        }
+
+        void clear() noexcept {
+            ranges_.clear();
+            ranges_.shrink_to_fit();
+            tree_.clear();
+            tree_.shrink_to_fit();
+            depth_ = static_cast<std::uint32_t>(0);
+        }
+
+        CRONZ_NODISCARD_L1 bool contains(const Word &word) const noexcept {
+            return find_(search_(word), word);
+        }
+
+        CRONZ_NODISCARD_L1 bool contains(const Range &range) const noexcept {
+            const std::size_t rank = rank_(search_(range.first));
+            return rank < ranges_.size() && ranges_[rank].first <= range.first && range.last <= ranges_[rank].last;
+        }
+
+        template <typename Address>
+        std::size_t contains(const std::span<const Address> &addresses,
+                             const std::span<bool> &results) const noexcept {
+            const std::size_t count = std::min(addresses.size(), results.size());
+
+            auto found = static_cast<std::size_t>(0);
+            auto i = static_cast<std::size_t>(0);
+
+            // Searches run in lockstep, so that the memory accesses of a level overlap.
+            for (; i + Lanes <= count; i += Lanes) {
+                Word words[Lanes];
+                std::size_t nodes[Lanes];
+                for (auto lane = static_cast<std::size_t>(0); lane < Lanes; ++lane) {
+                    words[lane] = RangeWord(addresses[i + lane]);
+                    nodes[lane] = static_cast<std::size_t>(1);
+                }
+
+                for (auto level = static_cast<std::uint32_t>(0); level < depth_; ++level) {
+                    for (auto lane = static_cast<std::size_t>(0); lane < Lanes; ++lane) {
+                        nodes[lane] = nodes[lane] * 2 + static_cast<std::size_t>(tree_[nodes[lane]] < words[lane]);
+                    }
+                }
+
+                for (auto lane = static_cast<std::size_t>(0); lane < Lanes; ++lane) {
+                    results[i + lane] = find_(nodes[lane], words[lane]);
+                    found += static_cast<std::size_t>(results[i + lane]);
+                }
+            }
+
+            for (; i < count; ++i) {
+                results[i] = contains(RangeWord(addresses[i]));
+                found += static_cast<std::size_t>(results[i]);
+            }
+
+            return found;
+        }
+
+        template <typename Network>
+        CRONZ_NODISCARD_L2 bool summarize(std::vector<Network> &networks) const noexcept {
+            try {
+                networks.clear();
+
+                for (const Range &range : ranges_) {
+                    for (Word first = range.first;;) {
+                        // The largest block aligned at `first` and ending within the range.
+                        auto bits = static_cast<std::uint32_t>(
+                            (Word{} == first) ? static_cast<int>(Bits) : CountTrailingZeros(first));
+                        while (static_cast<std::uint32_t>(0) != bits && range.last < (first | (Max >> (Bits - bits))))
+                            --bits;
+
+                        networks.push_back(Network(RangeAddress(first), static_cast<std::uint8_t>(Bits - bits)));
+
+                        const Word last = (static_cast<std::uint32_t>(0) == bits) ? first : first | (Max >> (Bits -
+                            bits));
+                        if (range.last == last)
+                            break;
+
+                        first = last + 1;
+                    }
+                }
+            }
+            catch (...) {
+                networks.clear();
+                return false;
+            }
+
+            return true;
+        }
+
+        CRONZ_NODISCARD_L1 const std::vector<Range>& ranges() const noexcept {
+            return ranges_;
+        }
+
+        RangeSet& operator=(const RangeSet &set) = delete;
+
+        RangeSet& operator=(RangeSet &&set) noexcept {
+            if (this != &set) {
+                ranges_ = std::move(set.ranges_);
+                tree_ = std::move(set.tree_);
+                depth_ = set.depth_;
+                set.clear();
+            }
+
+            return *this;
+        }
+    };
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_IP_IMPL_RANGE_IPP
@@ -0,0 +1,252 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_IMPL_SET_IPP
+#define CRONZ_IP_IMPL_SET_IPP 1
+
+#include "cronz/ip/set.hpp"
+
+#include <utility>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPSet::IPSet() noexcept = default;
+
+    inline IPSet::IPSet(IPSet &&set) noexcept = default;
+
+    // Modification.
+    inline bool IPSet::assign(const IPSet &set) noexcept {
+        Internal::RangeSet<std::uint32_t> ipv4;
+        Internal::RangeSet<Internal::UInt128> ipv6;
+        if (!ipv4.assign(set.ipv4_) || !ipv6.assign(set.ipv6_))
+            return false;
+
+        ipv4_ = std::move(ipv4);
+        ipv6_ = std::move(ipv6);
+        return true;
+    }
+
+    inline bool IPSet::insert(const IPv4Address &address) noexcept {
+        const std::uint32_t word = Internal::RangeWord(address);
+        return ipv4_.insert({word, word});
+    }
+
+    inline bool IPSet::insert(const IPv6Address &address) noexcept {
+        const Internal::UInt128 word = Internal::RangeWord(address);
+        return ipv6_.insert({word, word});
+    }
+
+    inline bool IPSet::insert(const IPv4Network &network) noexcept {
+        return ipv4_.insert({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+    }
+
+    inline bool IPSet::insert(const IPv6Network &network) noexcept {
+        return ipv6_.insert({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+    }
+
+    inline bool IPSet::insert(const IPv4Range &range) noexcept {
+        return ipv4_.insert({Internal::RangeWord(range.first), Internal::RangeWord(range.last)});
+    }
+
+    inline bool IPSet::insert(const IPv6Range &range) noexcept {
+        return ipv6_.insert({Internal::RangeWord(range.first), Internal::RangeWord(range.last)});
+    }
+
+    inline bool IPSet::insert(const std::span<const IPv4Range> &ranges) noexcept {
+        std::vector<Internal::RangeSet<std::uint32_t>::Range> words;
+        try {
+            words.reserve(ranges.size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const IPv4Range &range : ranges)
+            words.push_back({Internal::RangeWord(range.first), Internal::RangeWord(range.last)});
+
+        return ipv4_.insert(words);
+    }
+
+    inline bool IPSet::insert(const std::span<const IPv6Range> &ranges) noexcept {
+        std::vector<Internal::RangeSet<Internal::UInt128>::Range> words;
+        try {
+            words.reserve(ranges.size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const IPv6Range &range : ranges)
+            words.push_back({Internal::RangeWord(range.first), Internal::RangeWord(range.last)});
+
+        return ipv6_.insert(words);
+    }
+
+    inline bool IPSet::insert(const std::span<const IPv4Network> &networks) noexcept {
+        std::vector<Internal::RangeSet<std::uint32_t>::Range> words;
+        try {
+            words.reserve(networks.size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const IPv4Network &network : networks)
+            words.push_back({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+
+        return ipv4_.insert(words);
+    }
+
+    inline bool IPSet::insert(const std::span<const IPv6Network> &networks) noexcept {
+        std::vector<Internal::RangeSet<Internal::UInt128>::Range> words;
+        try {
+            words.reserve(networks.size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const IPv6Network &network : networks)
+            words.push_back({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+
+        return ipv6_.insert(words);
+    }
+
+    inline void IPSet::clear() noexcept {
+        ipv4_.clear();
+        ipv6_.clear();
+    }
+
+    // Set operations.
+    inline bool IPSet::unite(const IPSet &set) noexcept {
+        Internal::RangeSet<std::uint32_t> ipv4;
+        Internal::RangeSet<Internal::UInt128> ipv6;
+        if (!ipv4.assignUnion(ipv4_, set.ipv4_) || !ipv6.assignUnion(ipv6_, set.ipv6_))
+            return false;
+
+        ipv4_ = std::move(ipv4);
+        ipv6_ = std::move(ipv6);
+        return true;
+    }
+
+    inline bool IPSet::intersect(const IPSet &set) noexcept {
+        Internal::RangeSet<std::uint32_t> ipv4;
+        Internal::RangeSet<Internal::UInt128> ipv6;
+        if (!ipv4.assignIntersection(ipv4_, set.ipv4_) || !ipv6.assignIntersection(ipv6_, set.ipv6_))
+            return false;
+
+        ipv4_ = std::move(ipv4);
+        ipv6_ = std::move(ipv6);
+        return true;
+    }
+
+    inline bool IPSet::subtract(const IPSet &set) noexcept {
+        Internal::RangeSet<std::uint32_t> ipv4;
+        Internal::RangeSet<Internal::UInt128> ipv6;
+        if (!ipv4.assignDifference(ipv4_, set.ipv4_) || !ipv6.assignDifference(ipv6_, set.ipv6_))
+            return false;
+
+        ipv4_ = std::move(ipv4);
+        ipv6_ = std::move(ipv6);
+        return true;
+    }
+
+    // Membership.
+    inline bool IPSet::contains(const IPv4Address &address) const noexcept {
+        return ipv4_.contains(Internal::RangeWord(address));
+    }
+
+    inline bool IPSet::contains(const IPv6Address &address) const noexcept {
+        return ipv6_.contains(Internal::RangeWord(address));
+    }
+
+    inline bool IPSet::contains(const IPv4Network &network) const noexcept {
+        return ipv4_.contains({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+    }
+
+    inline bool IPSet::contains(const IPv6Network &network) const noexcept {
+        return ipv6_.contains({Internal::RangeWord(network.first()), Internal::RangeWord(network.last())});
+    }
+
+    inline std::size_t IPSet::contains(const std::span<const IPv4Address> &addresses,
+                                       const std::span<bool> &results) const noexcept {
+        return ipv4_.contains(addresses, results);
+    }
+
+    inline std::size_t IPSet::contains(const std::span<const IPv6Address> &addresses,
+                                       const std::span<bool> &results) const noexcept {
+        return ipv6_.contains(addresses, results);
+    }
+
+    // Conversion.
+    inline bool IPSet::ranges(std::vector<IPv4Range> &ranges) const noexcept {
+        try {
+            ranges.clear();
+            ranges.reserve(ipv4_.ranges().size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const auto &range : ipv4_.ranges())
+            ranges.push_back({Internal::RangeAddress(range.first), Internal::RangeAddress(range.last)});
+
+        return true;
+    }
+
+    inline bool IPSet::ranges(std::vector<IPv6Range> &ranges) const noexcept {
+        try {
+            ranges.clear();
+            ranges.reserve(ipv6_.ranges().size());
+        }
+        catch (...) {
+            return false;
+        }
+
+        for (const auto &range : ipv6_.ranges())
+            ranges.push_back({Internal::RangeAddress(range.first), Internal::RangeAddress(range.last)});
+
+        return true;
+    }
+
+    inline bool IPSet::summarize(std::vector<IPv4Network> &networks) const noexcept {
+        return ipv4_.summarize(networks);
+    }
+
+    inline bool IPSet::summarize(std::vector<IPv6Network> &networks) const noexcept {
+        return ipv6_.summarize(networks);
+    }
+
+    // Properties.
+    inline std::size_t IPSet::size() const noexcept {
+        return ipv4_.ranges().size() + ipv6_.ranges().size();
+    }
+
+    inline bool IPSet::empty() const noexcept {
+        return ipv4_.ranges().empty() && ipv6_.ranges().empty();
+    }
+
+    // Operators.
+    inline bool IPSet::operator==(const IPSet &set) const noexcept {
+        return ipv4_.ranges() == set.ipv4_.ranges() && ipv6_.ranges() == set.ipv6_.ranges();
+    }
+
+    inline bool IPSet::operator!=(const IPSet &set) const noexcept {
+        return !operator==(set);
+    }
+
+    inline IPSet& IPSet::operator=(IPSet &&set) noexcept = default;
+
+    // Destructors.
+    inline IPSet::~IPSet() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_IMPL_SET_IPP
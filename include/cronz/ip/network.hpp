@@ -0,0 +1,22 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_NETWORK_HPP
+#define CRONZ_IP_NETWORK_HPP 1
+
+/**
+ * @defgroup cronz_ip_network Network
+ * @ingroup cronz_ip
+ */
+
+#include "cronz/ip/network/v4.hpp"
+#include "cronz/ip/network/v6.hpp"
+
+#endif // CRONZ_IP_NETWORK_HPP
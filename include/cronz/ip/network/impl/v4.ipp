@@ -0,0 +1,245 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_NETWORK_IMPL_V4_IPP
+#define CRONZ_IP_NETWORK_IMPL_V4_IPP 1
+
+#include "cronz/ip/network/v4.hpp"
+#include "cronz/internal/endian.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Parses the decimal prefix length of a network.
+     * @param[in] str String to be parsed.
+     * @param[in] length Length of the string to be parsed.
+     * @param[in] max Maximum prefix length.
+     * @param[out] prefix Prefix length. Not altered upon failure.
+     * @return `true` if parsing is done successfully, otherwise, `false`.
+     * @remark Leading zeros are rejected, so every prefix length has a single representation.
+     */
+    CRONZ_NODISCARD_L1 inline bool ParsePrefixLength(const char *str, const std::size_t &length,
+                                                     const std::uint8_t &max, std::uint8_t &prefix) noexcept {
+        if (static_cast<std::size_t>(0) == length || length > static_cast<std::size_t>(3) ||
+            ('0' == str[0] && static_cast<std::size_t>(1) != length))
+            return false;
+
+        auto value = static_cast<std::uint32_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < length; ++i) {
+            const auto digit = static_cast<std::uint32_t>(static_cast<unsigned char>(str[i]) - '0');
+            if (static_cast<std::uint32_t>(9) < digit)
+                return false;
+
+            value = value * static_cast<std::uint32_t>(10) + digit;
+        }
+
+        if (value > max)
+            return false;
+
+        prefix = static_cast<std::uint8_t>(value);
+        return true;
+    }
+
+    /**
+     * @brief Returns the mask of an IPv4 prefix length.
+     * @param[in] prefix Prefix length, within `0`-`32`.
+     * @return Mask in host byte order.
+     * @remark A 64-bit word is shifted, since shifting a 32-bit word by 32 for `/0` is undefined.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint32_t IPv4PrefixMask(const std::uint8_t &prefix) noexcept {
+        return static_cast<std::uint32_t>(static_cast<std::uint64_t>(0xFFFFFFFF00000000ull) >> prefix);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPv4Network::IPv4Network() noexcept : address(static_cast<std::uint32_t>(0)),
+                                                 prefix(static_cast<std::uint8_t>(0)) {
+    }
+
+    inline IPv4Network::IPv4Network(const IPv4Address &address, const std::uint8_t &prefix) noexcept
+        : prefix(std::min(prefix, MaxPrefix)) {
+        this->address.uint32 = address.uint32 & Internal::NetworkToHost32(Internal::IPv4PrefixMask(this->prefix));
+    }
+
+    inline IPv4Network::IPv4Network(const char *str) noexcept : IPv4Network(Parse(str)) {
+    }
+
+    inline IPv4Network::IPv4Network(const char *str, const std::size_t &length) noexcept : IPv4Network(
+            Parse(str, length)) {
+    }
+
+    inline IPv4Network::IPv4Network(const std::string &str) noexcept : IPv4Network(Parse(str)) {
+    }
+
+    // Instance-based utility functions.
+    inline bool IPv4Network::parse(const char *str) noexcept {
+        return parse(str, std::strlen(str));
+    }
+
+    inline bool IPv4Network::parse(const char *str, const std::size_t &length) noexcept {
+        const char *const separator = std::ranges::find(str, str + length, '/');
+        const std::size_t addressLength = separator - str;
+
+        std::uint8_t p = MaxPrefix;
+        if (addressLength != length && !Internal::ParsePrefixLength(
+                separator + 1, length - addressLength - static_cast<std::size_t>(1), MaxPrefix, p))
+            return false;
+
+        IPv4Address a;
+        if (!Internal::ParseIPv4(str, addressLength, a.bytes))
+            return false;
+
+        *this = IPv4Network(a, p);
+        return true;
+    }
+
+    inline bool IPv4Network::parse(const std::string &str) noexcept {
+        return parse(str.c_str(), str.length());
+    }
+
+    inline std::to_chars_result IPv4Network::toChars(char *first, char *last) const noexcept {
+        // Room for the 4-byte copy of the prefix length.
+        char buffer[MaxLength + 4];
+
+        std::size_t len = Internal::FormatIPv4(address.bytes, buffer);
+        buffer[len++] = '/';
+
+        const std::array<char, 4> &entry = Internal::IPv4Octets[prefix];
+        std::memcpy(buffer + len, entry.data(), entry.size());
+        len += static_cast<std::size_t>(entry[3]);
+
+        if (static_cast<std::ptrdiff_t>(len) > last - first)
+            return {last, std::errc::value_too_large};
+
+        std::memcpy(first, buffer, len);
+        return {first + len, std::errc()};
+    }
+
+    inline std::string IPv4Network::stringify() const noexcept {
+        std::string str;
+        if (!stringify(str))
+            str.clear();
+
+        return str;
+    }
+
+    inline bool IPv4Network::stringify(std::string &str) const noexcept {
+        char buffer[MaxLength];
+        const std::to_chars_result result = toChars(buffer, buffer + MaxLength);
+
+        try {
+            str.assign(buffer, result.ptr);
+        }
+        catch (...) {
+            return false;
+        }
+
+        return true;
+    }
+
+    inline std::size_t IPv4Network::length() const noexcept {
+        return address.length() + static_cast<std::size_t>(1) + static_cast<std::size_t>(Internal::IPv4Octets[prefix][
+            3]);
+    }
+
+    inline IPv4Address IPv4Network::mask() const noexcept {
+        return IPv4Address(Internal::NetworkToHost32(Internal::IPv4PrefixMask(prefix)));
+    }
+
+    inline IPv4Address IPv4Network::first() const noexcept {
+        return address;
+    }
+
+    inline IPv4Address IPv4Network::last() const noexcept {
+        return IPv4Address(address.uint32 | ~Internal::NetworkToHost32(Internal::IPv4PrefixMask(prefix)));
+    }
+
+    inline bool IPv4Network::contains(const IPv4Address &address) const noexcept {
+        return static_cast<std::uint32_t>(0) == ((address.uint32 ^ this->address.uint32) & Internal::NetworkToHost32(
+                                                     Internal::IPv4PrefixMask(prefix)));
+    }
+
+    inline bool IPv4Network::contains(const IPv4Network &network) const noexcept {
+        return (network.prefix >= prefix) & contains(network.address);
+    }
+
+    inline bool IPv4Network::subnet(const std::uint8_t &prefix, const std::uint64_t &index,
+                                    IPv4Network &network) const noexcept {
+        if (prefix < this->prefix || prefix > MaxPrefix)
+            return false;
+
+        // The index fills the bits between the two prefix lengths.
+        const auto bits = static_cast<std::uint32_t>(prefix - this->prefix);
+        if (static_cast<std::uint32_t>(64) > bits && static_cast<std::uint64_t>(0) != (index >> bits))
+            return false;
+
+        const auto host = static_cast<std::uint32_t>(
+            static_cast<std::uint64_t>(Internal::NetworkToHost32(address.uint32)) | (index << (MaxPrefix - prefix)));
+
+        network.address.uint32 = Internal::NetworkToHost32(host);
+        network.prefix = prefix;
+        return true;
+    }
+
+    inline bool IPv4Network::split(IPv4Network &lower, IPv4Network &upper) const noexcept {
+        if (MaxPrefix == prefix)
+            return false;
+
+        const auto p = static_cast<std::uint8_t>(prefix + 1);
+        return subnet(p, static_cast<std::uint64_t>(0), lower) && subnet(p, static_cast<std::uint64_t>(1), upper);
+    }
+
+    inline IPv4Network IPv4Network::supernet(const std::uint8_t &prefix) const noexcept {
+        return {address, std::min(prefix, this->prefix)};
+    }
+
+    inline IPv4Network IPv4Network::supernet() const noexcept {
+        return {address, static_cast<std::uint8_t>(prefix - static_cast<std::uint8_t>(0 != prefix))};
+    }
+
+    // Operators.
+    inline bool IPv4Network::operator==(const IPv4Network &network) const noexcept {
+        return address == network.address && prefix == network.prefix;
+    }
+
+    inline bool IPv4Network::operator!=(const IPv4Network &network) const noexcept {
+        return !operator==(network);
+    }
+
+    // Static utility functions.
+    inline IPv4Network IPv4Network::Parse(const char *str) noexcept {
+        return Parse(str, std::strlen(str));
+    }
+
+    inline IPv4Network IPv4Network::Parse(const char *str, const std::size_t &length) noexcept {
+        IPv4Network network;
+        [[maybe_unused]] const bool _ = network.parse(str, length);
+        return network;
+    }
+
+    inline IPv4Network IPv4Network::Parse(const std::string &str) noexcept {
+        return Parse(str.c_str(), str.length());
+    }
+
+    inline IPv4Network IPv4Network::Supernet(const IPv4Network &network1, const IPv4Network &network2) noexcept {
+        const auto common = static_cast<std::uint8_t>(std::countl_zero(
+            Internal::NetworkToHost32(network1.address.uint32 ^ network2.address.uint32)));
+
+        return {network1.address, std::min({network1.prefix, network2.prefix, common})};
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_NETWORK_IMPL_V4_IPP
@@ -0,0 +1,272 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_NETWORK_IMPL_V6_IPP
+#define CRONZ_IP_NETWORK_IMPL_V6_IPP 1
+
+#include "cronz/ip/network/v6.hpp"
+#include "cronz/internal/endian.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Returns the mask of a 64-bit half of an IPv6 prefix.
+     * @param[in] prefix Prefix length within the half, within `0`-`64`.
+     * @return Mask in host byte order.
+     * @remark The shift count is wrapped for `/64`, and the result cleared for `/0`, without branches.
+     */
+    CRONZ_NODISCARD_L1 inline constexpr std::uint64_t IPv6HalfMask(const std::uint32_t &prefix) noexcept {
+        return (static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(0 != prefix)) &
+               (~static_cast<std::uint64_t>(0) << ((static_cast<std::uint32_t>(64) - prefix) &
+                                                   static_cast<std::uint32_t>(63)));
+    }
+
+    /**
+     * @brief Returns the mask of an IPv6 prefix length.
+     * @param[in] prefix Prefix length, within `0`-`128`.
+     * @param[out] high Mask of the first 64 bits, in host byte order.
+     * @param[out] low Mask of the last 64 bits, in host byte order.
+     */
+    inline constexpr void IPv6PrefixMask(const std::uint8_t &prefix, std::uint64_t &high,
+                                         std::uint64_t &low) noexcept {
+        const std::uint32_t p = std::min(static_cast<std::uint32_t>(prefix), static_cast<std::uint32_t>(64));
+
+        high = IPv6HalfMask(p);
+        low = IPv6HalfMask(static_cast<std::uint32_t>(prefix) - p);
+    }
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPv6Network::IPv6Network() noexcept : prefix(static_cast<std::uint8_t>(0)) {
+    }
+
+    inline IPv6Network::IPv6Network(const IPv6Address &address, const std::uint8_t &prefix) noexcept
+        : prefix(std::min(prefix, MaxPrefix)) {
+        std::uint64_t high;
+        std::uint64_t low;
+        Internal::IPv6PrefixMask(this->prefix, high, low);
+
+        // `low64` holds the first 8 bytes of the address, thus the high half.
+        this->address.low64 = address.low64 & Internal::NetworkToHost64(high);
+        this->address.high64 = address.high64 & Internal::NetworkToHost64(low);
+    }
+
+    inline IPv6Network::IPv6Network(const char *str) noexcept : IPv6Network(Parse(str)) {
+    }
+
+    inline IPv6Network::IPv6Network(const char *str, const std::size_t &length) noexcept : IPv6Network(
+            Parse(str, length)) {
+    }
+
+    inline IPv6Network::IPv6Network(const std::string &str) noexcept : IPv6Network(Parse(str)) {
+    }
+
+    // Instance-based utility functions.
+    inline bool IPv6Network::parse(const char *str) noexcept {
+        return parse(str, std::strlen(str));
+    }
+
+    inline bool IPv6Network::parse(const char *str, const std::size_t &length) noexcept {
+        const char *const separator = std::ranges::find(str, str + length, '/');
+        const std::size_t addressLength = separator - str;
+
+        std::uint8_t p = MaxPrefix;
+        if (addressLength != length && !Internal::ParsePrefixLength(
+                separator + 1, length - addressLength - static_cast<std::size_t>(1), MaxPrefix, p))
+            return false;
+
+        IPv6Address a;
+        if (!Internal::ParseIPv6(str, addressLength, a.bytes))
+            return false;
+
+        *this = IPv6Network(a, p);
+        return true;
+    }
+
+    inline bool IPv6Network::parse(const std::string &str) noexcept {
+        return parse(str.c_str(), str.length());
+    }
+
+    template <bool Compress>
+    inline std::to_chars_result IPv6Network::toChars(char *first, char *last) const noexcept {
+        // Room for the 4-byte copy of the prefix length.
+        char buffer[MaxLength + 4];
+
+        std::size_t len = Internal::FormatIPv6<Compress>(address.bytes, buffer);
+        buffer[len++] = '/';
+
+        const std::array<char, 4> &entry = Internal::IPv4Octets[prefix];
+        std::memcpy(buffer + len, entry.data(), entry.size());
+        len += static_cast<std::size_t>(entry[3]);
+
+        if (static_cast<std::ptrdiff_t>(len) > last - first)
+            return {last, std::errc::value_too_large};
+
+        std::memcpy(first, buffer, len);
+        return {first + len, std::errc()};
+    }
+
+    template <bool Compress>
+    inline std::string IPv6Network::stringify() const noexcept {
+        std::string str;
+        if (!stringify<Compress>(str))
+            str.clear();
+
+        return str;
+    }
+
+    template <bool Compress>
+    inline bool IPv6Network::stringify(std::string &str) const noexcept {
+        char buffer[MaxLength];
+        const std::to_chars_result result = toChars<Compress>(buffer, buffer + MaxLength);
+
+        try {
+            str.assign(buffer, result.ptr);
+        }
+        catch (...) {
+            return false;
+        }
+
+        return true;
+    }
+
+    template <bool Compress>
+    inline std::size_t IPv6Network::length() const noexcept {
+        return address.length<Compress>() + static_cast<std::size_t>(1) + static_cast<std::size_t>(
+                   Internal::IPv4Octets[prefix][3]);
+    }
+
+    inline IPv6Address IPv6Network::mask() const noexcept {
+        std::uint64_t high;
+        std::uint64_t low;
+        Internal::IPv6PrefixMask(prefix, high, low);
+
+        IPv6Address m;
+        m.low64 = Internal::NetworkToHost64(high);
+        m.high64 = Internal::NetworkToHost64(low);
+        return m;
+    }
+
+    inline IPv6Address IPv6Network::first() const noexcept {
+        return address;
+    }
+
+    inline IPv6Address IPv6Network::last() const noexcept {
+        const IPv6Address m = mask();
+
+        IPv6Address l;
+        l.low64 = address.low64 | ~m.low64;
+        l.high64 = address.high64 | ~m.high64;
+        return l;
+    }
+
+    inline bool IPv6Network::contains(const IPv6Address &address) const noexcept {
+        std::uint64_t high;
+        std::uint64_t low;
+        Internal::IPv6PrefixMask(prefix, high, low);
+
+        return static_cast<std::uint64_t>(0) == (((address.low64 ^ this->address.low64) & Internal::NetworkToHost64(
+                                                      high)) | ((address.high64 ^ this->address.high64) &
+                                                                Internal::NetworkToHost64(low)));
+    }
+
+    inline bool IPv6Network::contains(const IPv6Network &network) const noexcept {
+        return (network.prefix >= prefix) & contains(network.address);
+    }
+
+    inline bool IPv6Network::subnet(const std::uint8_t &prefix, const std::uint64_t &index,
+                                    IPv6Network &network) const noexcept {
+        if (prefix < this->prefix || prefix > MaxPrefix)
+            return false;
+
+        // The index fills the bits between the two prefix lengths.
+        const auto bits = static_cast<std::uint32_t>(prefix - this->prefix);
+        if (static_cast<std::uint32_t>(64) > bits && static_cast<std::uint64_t>(0) != (index >> bits))
+            return false;
+
+        std::uint64_t high = Internal::NetworkToHost64(address.low64);
+        std::uint64_t low = Internal::NetworkToHost64(address.high64);
+
+        // Position of the lowest index bit, counted from the least significant bit of the address.
+        const auto shift = static_cast<std::uint32_t>(MaxPrefix - prefix);
+        if (static_cast<std::uint32_t>(64) <= shift) {
+            if (static_cast<std::uint32_t>(128) != shift)
+                high |= index << (shift - static_cast<std::uint32_t>(64));
+        }
+        else {
+            low |= index << shift;
+            if (static_cast<std::uint32_t>(0) != shift)
+                high |= index >> (static_cast<std::uint32_t>(64) - shift);
+        }
+
+        network.address.low64 = Internal::NetworkToHost64(high);
+        network.address.high64 = Internal::NetworkToHost64(low);
+        network.prefix = prefix;
+        return true;
+    }
+
+    inline bool IPv6Network::split(IPv6Network &lower, IPv6Network &upper) const noexcept {
+        if (MaxPrefix == prefix)
+            return false;
+
+        const auto p = static_cast<std::uint8_t>(prefix + 1);
+        return subnet(p, static_cast<std::uint64_t>(0), lower) && subnet(p, static_cast<std::uint64_t>(1), upper);
+    }
+
+    inline IPv6Network IPv6Network::supernet(const std::uint8_t &prefix) const noexcept {
+        return {address, std::min(prefix, this->prefix)};
+    }
+
+    inline IPv6Network IPv6Network::supernet() const noexcept {
+        return {address, static_cast<std::uint8_t>(prefix - static_cast<std::uint8_t>(0 != prefix))};
+    }
+
+    // Operators.
+    inline bool IPv6Network::operator==(const IPv6Network &network) const noexcept {
+        return address == network.address && prefix == network.prefix;
+    }
+
+    inline bool IPv6Network::operator!=(const IPv6Network &network) const noexcept {
+        return !operator==(network);
+    }
+
+    // Static utility functions.
+    inline IPv6Network IPv6Network::Parse(const char *str) noexcept {
+        return Parse(str, std::strlen(str));
+    }
+
+    inline IPv6Network IPv6Network::Parse(const char *str, const std::size_t &length) noexcept {
+        IPv6Network network;
+        [[maybe_unused]] const bool _ = network.parse(str, length);
+        return network;
+    }
+
+    inline IPv6Network IPv6Network::Parse(const std::string &str) noexcept {
+        return Parse(str.c_str(), str.length());
+    }
+
+    inline IPv6Network IPv6Network::Supernet(const IPv6Network &network1, const IPv6Network &network2) noexcept {
+        const std::uint64_t high = Internal::NetworkToHost64(network1.address.low64 ^ network2.address.low64);
+        const std::uint64_t low = Internal::NetworkToHost64(network1.address.high64 ^ network2.address.high64);
+
+        const auto common = static_cast<std::uint8_t>(
+            (static_cast<std::uint64_t>(0) != high) ? std::countl_zero(high) : (64 + std::countl_zero(low)));
+
+        return {network1.address, std::min({network1.prefix, network2.prefix, common})};
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_NETWORK_IMPL_V6_IPP
@@ -0,0 +1,283 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_NETWORK_V4_HPP
+#define CRONZ_IP_NETWORK_V4_HPP 1
+
+#include "cronz/ip/address/v4.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_network
+     * @brief IPv4 network (CIDR block) container.
+     * @struct IPv4Network
+     * @remark The network address is kept with its host bits cleared by every constructor and parsing function.
+     */
+    struct IPv4Network {
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Maximum prefix length.
+         */
+        inline static constexpr std::uint8_t MaxPrefix = static_cast<std::uint8_t>(32);
+
+        /**
+         * @brief Maximum length of the string representation of a network.
+         */
+        inline static constexpr std::size_t MaxLength = static_cast<std::size_t>(18);
+
+        /**
+         * @brief Network address.
+         */
+        IPv4Address address;
+
+        /**
+         * @brief Prefix length, within `0`-`MaxPrefix`.
+         */
+        std::uint8_t prefix;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Constructs `0.0.0.0/0`.
+         */
+        IPv4Network() noexcept;
+
+        /**
+         * @brief Constructor with initializers.
+         * @param[in] address Any address within the network.
+         * @param[in] prefix Prefix length. Limited by `MaxPrefix`.
+         */
+        IPv4Network(const IPv4Address &address, const std::uint8_t &prefix) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the network.
+         * @remark This will internally call `parse` and depending on the output the container might be `0.0.0.0/0`.
+         */
+        IPv4Network(const char *str) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the network.
+         * @param[in] length Length of the string representation of the network.
+         * @remark This will internally call `parse` and depending on the output the container might be `0.0.0.0/0`.
+         */
+        IPv4Network(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Constructor with string initializer.
+         * @param[in] str String representation of the network.
+         * @remark This will internally call `parse` and depending on the output the container might be `0.0.0.0/0`.
+         */
+        IPv4Network(const std::string &str) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Instance-based utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Parses a network string in the `a.b.c.d/len` form.
+         * @param[in] str String to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const char *str) noexcept;
+
+        /**
+         * @brief Parses a network string in the `a.b.c.d/len` form.
+         * @param[in] str String to be parsed.
+         * @param[in] length Length of the string to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         * @remark A missing `/len` stands for `/32`. The prefix length has no leading zeros.
+         * @remark Host bits of the address are cleared, e.g. `10.1.2.3/8` is parsed as `10.0.0.0/8`.
+         * @remark Upon failure, the network is not altered.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Parses a network string in the `a.b.c.d/len` form.
+         * @param[in] str String to be parsed.
+         * @return `true` if parsing is done successfully, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const std::string &str) noexcept;
+
+        /**
+         * @brief Writes the network into a character range, in the manner of `std::to_chars`.
+         * @param[out] first Beginning of the range.
+         * @param[in] last End of the range.
+         * @return Pointer past the written characters and `std::errc()` upon success, otherwise, `last` and
+         * `std::errc::value_too_large`.
+         * @remark At most `MaxLength` characters are written, without a terminating null character.
+         */
+        CRONZ_NODISCARD_L2 std::to_chars_result toChars(char *first, char *last) const noexcept;
+
+        /**
+         * @brief Stringifies the network.
+         * @return Stringification result. Upon failure, this will be empty.
+         */
+        CRONZ_NODISCARD_L1 std::string stringify() const noexcept;
+
+        /**
+         * @brief Stringifies the network.
+         * @param[out] str Stringification result.
+         * @return `true` if the stringification is successful, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool stringify(std::string &str) const noexcept;
+
+        /**
+         * @brief Returns the stringified length of the network.
+         * @return The stringified length of the network.
+         */
+        CRONZ_NODISCARD_L1 std::size_t length() const noexcept;
+
+        /**
+         * @brief Returns the network mask.
+         * @return Network mask, e.g. `255.255.255.0` for `/24`.
+         */
+        CRONZ_NODISCARD_L1 IPv4Address mask() const noexcept;
+
+        /**
+         * @brief Returns the first address of the network.
+         * @return First address, which is the network address.
+         */
+        CRONZ_NODISCARD_L1 IPv4Address first() const noexcept;
+
+        /**
+         * @brief Returns the last address of the network.
+         * @return Last address, e.g. `10.255.255.255` for `10.0.0.0/8`.
+         */
+        CRONZ_NODISCARD_L1 IPv4Address last() const noexcept;
+
+        /**
+         * @brief Tells if the network contains an address.
+         * @param[in] address Address to be tested.
+         * @return `true` if the network contains `address`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv4Address &address) const noexcept;
+
+        /**
+         * @brief Tells if the network contains another network.
+         * @param[in] network Network to be tested.
+         * @return `true` if every address of `network` is within the network, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv4Network &network) const noexcept;
+
+        /**
+         * @brief Returns one of the subnets of the network.
+         * @param[in] prefix Prefix length of the subnet. Must be within the prefix length of the network and
+         * `MaxPrefix`.
+         * @param[in] index Zero-based index of the subnet, in address order.
+         * @param[out] network Subnet.
+         * @return `true` if the subnet exists, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool subnet(const std::uint8_t &prefix, const std::uint64_t &index,
+                                       IPv4Network &network) const noexcept;
+
+        /**
+         * @brief Splits the network into its two halves.
+         * @param[out] lower Lower half.
+         * @param[out] upper Upper half.
+         * @return `true` if the network is split, otherwise (for `/32` networks), `false`.
+         */
+        CRONZ_NODISCARD_L2 bool split(IPv4Network &lower, IPv4Network &upper) const noexcept;
+
+        /**
+         * @brief Returns the enclosing network with a shorter prefix.
+         * @param[in] prefix Prefix length of the supernet. Limited by the prefix length of the network.
+         * @return Supernet.
+         */
+        CRONZ_NODISCARD_L1 IPv4Network supernet(const std::uint8_t &prefix) const noexcept;
+
+        /**
+         * @brief Returns the enclosing network with a one bit shorter prefix.
+         * @return Supernet. `0.0.0.0/0` is its own supernet.
+         */
+        CRONZ_NODISCARD_L1 IPv4Network supernet() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the container has the same value as another container.
+         * @param[in] network Container to be compared with.
+         * @return `true` if the container has the same value as the other container.
+         */
+        CRONZ_NODISCARD_L1 bool operator==(const IPv4Network &network) const noexcept;
+
+        /**
+         * @brief Tells if the container does not have the same value as another container.
+         * @param[in] network Container to be compared with.
+         * @return `true` if the container does not have the same value as the other container.
+         */
+        CRONZ_NODISCARD_L1 bool operator!=(const IPv4Network &network) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Static utility functions.
+         */
+        /** @{ */
+        /**
+         * @brief Parses a network string.
+         * @param[in] str String to be parsed.
+         * @return `IPv4Network` container with the parsed result.
+         * @remark Upon failure, the returned container will be `0.0.0.0/0`.
+         */
+        CRONZ_NODISCARD_L1 static IPv4Network Parse(const char *str) noexcept;
+
+        /**
+         * @brief Parses a network string.
+         * @param[in] str String to be parsed.
+         * @param[in] length Length of the string to be parsed.
+         * @return `IPv4Network` container with the parsed result.
+         * @remark Upon failure, the returned container will be `0.0.0.0/0`.
+         */
+        CRONZ_NODISCARD_L1 static IPv4Network Parse(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Parses a network string.
+         * @param[in] str String to be parsed.
+         * @return `IPv4Network` container with the parsed result.
+         * @remark Upon failure, the returned container will be `0.0.0.0/0`.
+         */
+        CRONZ_NODISCARD_L1 static IPv4Network Parse(const std::string &str) noexcept;
+
+        /**
+         * @brief Returns the smallest network containing two networks.
+         * @param[in] network1 First network.
+         * @param[in] network2 Second network.
+         * @return Common supernet.
+         */
+        CRONZ_NODISCARD_L1 static IPv4Network Supernet(const IPv4Network &network1,
+                                                       const IPv4Network &network2) noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/network/impl/v4.ipp"
+
+#endif // CRONZ_IP_NETWORK_V4_HPP
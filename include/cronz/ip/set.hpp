@@ -0,0 +1,368 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_SET_HPP
+#define CRONZ_IP_SET_HPP 1
+
+/**
+ * @defgroup cronz_ip_set Set
+ * @ingroup cronz_ip
+ */
+
+#include "cronz/ip/network/v4.hpp"
+#include "cronz/ip/network/v6.hpp"
+#include "cronz/ip/impl/range.ipp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_set
+     * @brief Inclusive range of IPv4 addresses.
+     * @struct IPv4Range
+     */
+    struct IPv4Range {
+        /**
+         * @brief First address of the range.
+         */
+        IPv4Address first;
+
+        /**
+         * @brief Last address of the range. Must not be less than `first`.
+         */
+        IPv4Address last;
+    };
+
+    /**
+     * @ingroup cronz_ip_set
+     * @brief Inclusive range of IPv6 addresses.
+     * @struct IPv6Range
+     */
+    struct IPv6Range {
+        /**
+         * @brief First address of the range.
+         */
+        IPv6Address first;
+
+        /**
+         * @brief Last address of the range. Must not be less than `first`.
+         */
+        IPv6Address last;
+    };
+
+    /**
+     * @ingroup cronz_ip_set
+     * @brief Set of IPv4 and IPv6 addresses (e.g., an allow or deny list).
+     * @class IPSet
+     * @remark Addresses of each family are kept as sorted ranges, with overlapping and adjacent ones merged, so every
+     * set has a single representation no matter how it was built.
+     * @remark Lookups search a copy of the ranges in the Eytzinger layout, which is rebuilt by every modification.
+     * Modifying a set takes linear time, so many ranges are better inserted at once.
+     * @remark Lookups can be called concurrently from multiple threads. Modifications are not thread-safe.
+     */
+    class IPSet {
+        // Properties.
+        Internal::RangeSet<std::uint32_t> ipv4_;
+        Internal::RangeSet<Internal::UInt128> ipv6_;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Constructs an empty set.
+         */
+        IPSet() noexcept;
+
+        IPSet(const IPSet &set) = delete;
+
+        /**
+         * @brief Move constructor.
+         * @param[in] set Set to be moved. It will be empty afterward.
+         */
+        IPSet(IPSet &&set) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Modification.
+         */
+        /** @{ */
+        /**
+         * @brief Copies another set.
+         * @param[in] set Set to be copied.
+         * @return `true` if the set is copied, otherwise (upon memory allocation failure), `false`.
+         * @remark Upon failure of this or any other modification, the set is not altered.
+         */
+        CRONZ_NODISCARD_L2 bool assign(const IPSet &set) noexcept;
+
+        /**
+         * @brief Inserts an address.
+         * @param[in] address Address to be inserted.
+         * @return `true` if the address is inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv4Address &address) noexcept;
+
+        /**
+         * @brief Inserts an address.
+         * @param[in] address Address to be inserted.
+         * @return `true` if the address is inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv6Address &address) noexcept;
+
+        /**
+         * @brief Inserts the addresses of a network.
+         * @param[in] network Network to be inserted.
+         * @return `true` if the network is inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv4Network &network) noexcept;
+
+        /**
+         * @brief Inserts the addresses of a network.
+         * @param[in] network Network to be inserted.
+         * @return `true` if the network is inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv6Network &network) noexcept;
+
+        /**
+         * @brief Inserts a range of addresses.
+         * @param[in] range Range to be inserted.
+         * @return `true` if the range is inserted, otherwise (also if `range.last` is less than `range.first`),
+         * `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv4Range &range) noexcept;
+
+        /**
+         * @brief Inserts a range of addresses.
+         * @param[in] range Range to be inserted.
+         * @return `true` if the range is inserted, otherwise (also if `range.last` is less than `range.first`),
+         * `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const IPv6Range &range) noexcept;
+
+        /**
+         * @brief Inserts many ranges of addresses at once.
+         * @param[in] ranges Ranges to be inserted, in any order.
+         * @return `true` if the ranges are inserted, otherwise (also if any of them is reversed), `false`.
+         * @remark This takes `O(m log m + n)` time for `m` new and `n` existing ranges.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const std::span<const IPv4Range> &ranges) noexcept;
+
+        /**
+         * @brief Inserts many ranges of addresses at once.
+         * @param[in] ranges Ranges to be inserted, in any order.
+         * @return `true` if the ranges are inserted, otherwise (also if any of them is reversed), `false`.
+         * @remark This takes `O(m log m + n)` time for `m` new and `n` existing ranges.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const std::span<const IPv6Range> &ranges) noexcept;
+
+        /**
+         * @brief Inserts many networks at once.
+         * @param[in] networks Networks to be inserted, in any order.
+         * @return `true` if the networks are inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const std::span<const IPv4Network> &networks) noexcept;
+
+        /**
+         * @brief Inserts many networks at once.
+         * @param[in] networks Networks to be inserted, in any order.
+         * @return `true` if the networks are inserted, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool insert(const std::span<const IPv6Network> &networks) noexcept;
+
+        /**
+         * @brief Removes all the addresses.
+         */
+        void clear() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Set operations.
+         */
+        /** @{ */
+        /**
+         * @brief Adds the addresses of another set (union).
+         * @param[in] set Other set.
+         * @return `true` if the operation is successful, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool unite(const IPSet &set) noexcept;
+
+        /**
+         * @brief Keeps only the addresses also in another set (intersection).
+         * @param[in] set Other set.
+         * @return `true` if the operation is successful, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool intersect(const IPSet &set) noexcept;
+
+        /**
+         * @brief Removes the addresses of another set (difference).
+         * @param[in] set Other set.
+         * @return `true` if the operation is successful, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool subtract(const IPSet &set) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Membership.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the set contains an address.
+         * @param[in] address Address to be tested.
+         * @return `true` if the set contains `address`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv4Address &address) const noexcept;
+
+        /**
+         * @brief Tells if the set contains an address.
+         * @param[in] address Address to be tested.
+         * @return `true` if the set contains `address`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv6Address &address) const noexcept;
+
+        /**
+         * @brief Tells if the set contains every address of a network.
+         * @param[in] network Network to be tested.
+         * @return `true` if the set contains `network`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv4Network &network) const noexcept;
+
+        /**
+         * @brief Tells if the set contains every address of a network.
+         * @param[in] network Network to be tested.
+         * @return `true` if the set contains `network`, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const IPv6Network &network) const noexcept;
+
+        /**
+         * @brief Tells which of many addresses the set contains.
+         * @param[in] addresses Addresses to be tested.
+         * @param[out] results Whether the set contains each address. Must be at least as long as `addresses`.
+         * @return Number of addresses the set contains.
+         * @remark Addresses are searched eight at a time in lockstep, so that their memory accesses overlap.
+         */
+        std::size_t contains(const std::span<const IPv4Address> &addresses,
+                             const std::span<bool> &results) const noexcept;
+
+        /**
+         * @brief Tells which of many addresses the set contains.
+         * @param[in] addresses Addresses to be tested.
+         * @param[out] results Whether the set contains each address. Must be at least as long as `addresses`.
+         * @return Number of addresses the set contains.
+         * @remark Addresses are searched eight at a time in lockstep, so that their memory accesses overlap.
+         */
+        std::size_t contains(const std::span<const IPv6Address> &addresses,
+                             const std::span<bool> &results) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Conversion.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the IPv4 addresses as ranges.
+         * @param[out] ranges Sorted, disjoint and non-adjacent ranges.
+         * @return `true` if the ranges are returned, otherwise (upon memory allocation failure), `false`.
+         */
+        CRONZ_NODISCARD_L2 bool ranges(std::vector<IPv4Range> &ranges) const noexcept;
+
+        /**
+         * @brief Returns the IPv6 addresses as ranges.
+         * @param[out] ranges Sorted, disjoint and non-adjacent ranges.
+         * @return `true` if the ranges are returned, otherwise (upon memory allocation failure), `false`.
+         */
+        CRONZ_NODISCARD_L2 bool ranges(std::vector<IPv6Range> &ranges) const noexcept;
+
+        /**
+         * @brief Returns the IPv4 addresses as the shortest sorted list of networks.
+         * @param[out] networks Networks covering exactly the addresses of the set.
+         * @return `true` if the networks are returned, otherwise (upon memory allocation failure), `false`.
+         */
+        CRONZ_NODISCARD_L2 bool summarize(std::vector<IPv4Network> &networks) const noexcept;
+
+        /**
+         * @brief Returns the IPv6 addresses as the shortest sorted list of networks.
+         * @param[out] networks Networks covering exactly the addresses of the set.
+         * @return `true` if the networks are returned, otherwise (upon memory allocation failure), `false`.
+         */
+        CRONZ_NODISCARD_L2 bool summarize(std::vector<IPv6Network> &networks) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of ranges of both families.
+         * @return Number of ranges.
+         */
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept;
+
+        /**
+         * @brief Tells if the set has no addresses.
+         * @return `true` if the set has no addresses, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the set has the same addresses as another set.
+         * @param[in] set Set to be compared with.
+         * @return `true` if the sets have the same addresses, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool operator==(const IPSet &set) const noexcept;
+
+        /**
+         * @brief Tells if the set does not have the same addresses as another set.
+         * @param[in] set Set to be compared with.
+         * @return `true` if the sets do not have the same addresses, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool operator!=(const IPSet &set) const noexcept;
+
+        IPSet& operator=(const IPSet &set) = delete;
+
+        /**
+         * @brief Move assignment.
+         * @param[in] set Set to be moved. It will be empty afterward.
+         * @return Reference to the current set.
+         */
+        IPSet& operator=(IPSet &&set) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Does nothing.
+         */
+        ~IPSet() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/impl/set.ipp"
+
+#endif // CRONZ_IP_SET_HPP
@@ -0,0 +1,23 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_HPP
+#define CRONZ_IP_TABLE_HPP 1
+
+/**
+ * @defgroup cronz_ip_table Table
+ * @ingroup cronz_ip
+ */
+
+#include "cronz/ip/table/v4.hpp"
+#include "cronz/ip/table/v6.hpp"
+#include "cronz/ip/table/shared.hpp"
+
+#endif // CRONZ_IP_TABLE_HPP
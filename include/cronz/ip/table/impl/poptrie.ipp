@@ -0,0 +1,297 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_IMPL_POPTRIE_IPP
+#define CRONZ_IP_TABLE_IMPL_POPTRIE_IPP 1
+
+#include "cronz/ip/table/impl/trie.ipp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Node of a poptrie, covering 6 bits of the key.
+     */
+    struct PoptrieNode {
+        /**
+         * @brief Slots holding a child node.
+         */
+        std::uint64_t vector;
+
+        /**
+         * @brief Slots starting a run of identical leaves. Child slots are skipped, so runs extend over them.
+         */
+        std::uint64_t leafvec;
+
+        /**
+         * @brief Index of the first leaf of the node.
+         */
+        std::uint32_t base0;
+
+        /**
+         * @brief Index of the first child of the node.
+         */
+        std::uint32_t base1;
+    };
+
+    /**
+     * @brief Poptrie: a direct root table indexed by the first 16 bits of the key, followed by 64-slot nodes whose
+     * children and leaves are stored contiguously and indexed by the population count of their bitmaps.
+     * @remark Leaves are `0` for no route or the value plus one, and root entries are leaves or `Extended` with the
+     * index of a node. Runs of identical leaves are stored once, so a node takes 24 bytes plus 4 bytes per run.
+     * @remark Keys are 128-bit, made of two 64-bit halves. The last node covers bits 124-127 and 2 bits of padding.
+     */
+    class Poptrie {
+    public:
+        inline static constexpr std::uint32_t Extended = static_cast<std::uint32_t>(0x80000000u);
+        inline static constexpr std::uint32_t MaxValue = static_cast<std::uint32_t>(0x7FFFFFFEu);
+
+    private:
+        inline static constexpr std::uint32_t RootBits = static_cast<std::uint32_t>(16);
+        inline static constexpr std::uint32_t Stride = static_cast<std::uint32_t>(6);
+        inline static constexpr std::size_t RootLength = static_cast<std::size_t>(1) << RootBits;
+        inline static constexpr std::size_t NodeLength = static_cast<std::size_t>(1) << Stride;
+
+        std::vector<std::uint32_t> root_;
+        std::vector<PoptrieNode> nodes_;
+        std::vector<std::uint32_t> leaves_;
+        std::size_t count_ = static_cast<std::size_t>(0);
+
+        CRONZ_NODISCARD_L1 static std::uint32_t chunk_(const std::uint64_t &high, const std::uint64_t &low,
+                                                       const std::uint32_t &offset) noexcept {
+            // Offsets are `16 + 6k`, so a chunk straddles the halves never, and the end of the key only at 124.
+            if (static_cast<std::uint32_t>(64) > offset)
+                return static_cast<std::uint32_t>(high >> (static_cast<std::uint32_t>(58) - offset)) &
+                       static_cast<std::uint32_t>(63);
+
+            if (static_cast<std::uint32_t>(122) >= offset)
+                return static_cast<std::uint32_t>(low >> (static_cast<std::uint32_t>(122) - offset)) &
+                       static_cast<std::uint32_t>(63);
+
+            return static_cast<std::uint32_t>(low << (offset - static_cast<std::uint32_t>(122))) &
+                   static_cast<std::uint32_t>(63);
+        }
+
+        CRONZ_NODISCARD_L1 bool node_(const std::span<PrefixTrieRoute> &routes, const std::uint32_t &offset,
+                                      const std::uint32_t &inherited, const std::size_t &index) {
+            // Routes are sorted by prefix length, so the ones ending within the node come first, shortest first.
+            const auto deeper = std::ranges::find_if(routes, [&offset](const PrefixTrieRoute &route) {
+                return route.prefix > offset + Stride;
+            });
+
+            std::uint32_t slots[NodeLength];
+            std::fill_n(slots, NodeLength, inherited);
+
+            for (auto route = routes.begin(); route != deeper; ++route) {
+                const std::size_t span = static_cast<std::size_t>(1) << (offset + Stride - route->prefix);
+                std::fill_n(slots + (chunk_(route->high, route->low, offset) & ~(span - 1)), span,
+                            route->value + static_cast<std::uint32_t>(1));
+            }
+
+            // The remaining routes are grouped by slot, keeping their order within a group.
+            const std::span<PrefixTrieRoute> children(deeper, routes.end());
+            std::ranges::stable_sort(children, {}, [&offset](const PrefixTrieRoute &route) {
+                return chunk_(route.high, route.low, offset);
+            });
+
+            PoptrieNode node = {static_cast<std::uint64_t>(0), static_cast<std::uint64_t>(0),
+                                static_cast<std::uint32_t>(leaves_.size()), static_cast<std::uint32_t>(nodes_.size())};
+
+            for (const PrefixTrieRoute &route : children)
+                node.vector |= static_cast<std::uint64_t>(1) << chunk_(route.high, route.low, offset);
+
+            bool leading = true;
+            for (auto slot = static_cast<std::size_t>(0); slot < NodeLength; ++slot) {
+                if (static_cast<std::uint64_t>(0) != ((node.vector >> slot) & static_cast<std::uint64_t>(1)))
+                    continue;
+
+                if (leading || slots[slot] != leaves_.back()) {
+                    node.leafvec |= static_cast<std::uint64_t>(1) << slot;
+                    leaves_.push_back(slots[slot]);
+                    leading = false;
+                }
+            }
+
+            const auto childCount = static_cast<std::size_t>(std::popcount(node.vector));
+            if (nodes_.size() + childCount > static_cast<std::size_t>(Extended) ||
+                leaves_.size() > static_cast<std::size_t>(Extended))
+                return false;
+
+            nodes_[index] = node;
+            nodes_.resize(nodes_.size() + childCount);
+
+            auto child = static_cast<std::size_t>(node.base1);
+            for (auto first = children.begin(); first != children.end(); ++child) {
+                const std::uint32_t slot = chunk_(first->high, first->low, offset);
+                const auto last = std::find_if(first, children.end(), [&](const PrefixTrieRoute &route) {
+                    return chunk_(route.high, route.low, offset) != slot;
+                });
+
+                if (!node_(std::span<PrefixTrieRoute>(first, last), offset + Stride, slots[slot], child))
+                    return false;
+
+                first = last;
+            }
+
+            return true;
+        }
+
+    public:
+        Poptrie() noexcept = default;
+
+        Poptrie(const Poptrie &trie) = delete;
+
+        Poptrie(Poptrie &&trie) noexcept : root_(std::move(trie.root_)), nodes_(std::move(trie.nodes_)),
+                                           leaves_(std::move(trie.leaves_)), count_(trie.count_) {
+            trie.clear();
+        }
+
+        /**
+         * @brief Builds the trie from scratch.
+         * @param[in,out] routes Routes to be inserted. They are reordered.
+         * @return `true` if the trie is built, otherwise (upon memory allocation failure or an out of range value),
+         * `false`, leaving the trie empty.
+         */
+        CRONZ_NODISCARD_L2 bool build(std::vector<PrefixTrieRoute> &routes) noexcept {
+            clear();
+
+            try {
+                std::ranges::stable_sort(routes, {}, &PrefixTrieRoute::prefix);
+
+                root_.assign(RootLength, static_cast<std::uint32_t>(0));
+
+                auto deeper = routes.begin();
+                for (; deeper != routes.end() && RootBits >= deeper->prefix; ++deeper) {
+                    if (deeper->value > MaxValue)
+                        goto bad;
+
+                    const std::size_t span = static_cast<std::size_t>(1) << (RootBits - deeper->prefix);
+                    std::fill_n(root_.begin() + static_cast<std::ptrdiff_t>((deeper->high >> 48) & ~(span - 1)), span,
+                                deeper->value + static_cast<std::uint32_t>(1));
+                }
+
+                for (auto route = deeper; route != routes.end(); ++route) {
+                    if (route->value > MaxValue)
+                        goto bad;
+                }
+
+                // Longer routes are grouped by root entry, keeping their order within a group.
+                const std::span<PrefixTrieRoute> children(deeper, routes.end());
+                std::ranges::stable_sort(children, {}, [](const PrefixTrieRoute &route) {
+                    return route.high >> 48;
+                });
+
+                for (auto first = children.begin(); first != children.end();) {
+                    const std::uint64_t entry = first->high >> 48;
+                    const auto last = std::find_if(first, children.end(), [&entry](const PrefixTrieRoute &route) {
+                        return (route.high >> 48) != entry;
+                    });
+
+                    const std::size_t index = nodes_.size();
+                    nodes_.emplace_back();
+
+                    if (!node_(std::span<PrefixTrieRoute>(first, last), RootBits, root_[entry], index))
+                        goto bad;
+
+                    root_[entry] = Extended | static_cast<std::uint32_t>(index);
+                    first = last;
+                }
+
+                nodes_.shrink_to_fit();
+                leaves_.shrink_to_fit();
+            }
+            catch (...) {
+                goto bad;
+            }
+
+            count_ = routes.size();
+            return true;
+
+        bad:
+            clear();
+            return false;
+        }
+
+        void clear() noexcept {
+            root_.clear();
+            root_.shrink_to_fit();
+            nodes_.clear();
+            nodes_.shrink_to_fit();
+            leaves_.clear();
+            leaves_.shrink_to_fit();
+            count_ = static_cast<std::size_t>(0);
+        }
+
+        CRONZ_NODISCARD_L1 bool lookup(const std::uint64_t &high, const std::uint64_t &low,
+                                       std::uint32_t &value) const noexcept {
+            if (root_.empty())
+                return false;
+
+            std::uint32_t leaf = root_[high >> 48];
+            if (static_cast<std::uint32_t>(0) != (leaf & Extended)) {
+                const PoptrieNode *node = nodes_.data() + (leaf & ~Extended);
+
+                for (std::uint32_t offset = RootBits;; offset += Stride) {
+                    const std::uint32_t slot = chunk_(high, low, offset);
+
+                    // Bitmap of the slots up to and including `slot`.
+                    const std::uint64_t mask = (static_cast<std::uint64_t>(2) << slot) - static_cast<std::uint64_t>(1);
+                    if (static_cast<std::uint64_t>(0) == ((node->vector >> slot) & static_cast<std::uint64_t>(1))) {
+                        leaf = leaves_[node->base0 + static_cast<std::uint32_t>(std::popcount(node->leafvec & mask)) -
+                                       static_cast<std::uint32_t>(1)];
+                        break;
+                    }
+
+                    node = nodes_.data() + node->base1 + std::popcount(node->vector & mask) - 1;
+                }
+            }
+
+            if (static_cast<std::uint32_t>(0) == leaf)
+                return false;
+
+            value = leaf - static_cast<std::uint32_t>(1);
+            return true;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept {
+            return count_;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t memoryUsage() const noexcept {
+            return root_.capacity() * sizeof(std::uint32_t) + nodes_.capacity() * sizeof(PoptrieNode) +
+                   leaves_.capacity() * sizeof(std::uint32_t);
+        }
+
+        CRONZ_NODISCARD_L1 bool empty() const noexcept {
+            return root_.empty();
+        }
+
+        Poptrie& operator=(const Poptrie &trie) = delete;
+
+        Poptrie& operator=(Poptrie &&trie) noexcept {
+            if (this != &trie) {
+                root_ = std::move(trie.root_);
+                nodes_ = std::move(trie.nodes_);
+                leaves_ = std::move(trie.leaves_);
+                count_ = trie.count_;
+                trie.clear();
+            }
+
+            return *this;
+        }
+    };
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_IP_TABLE_IMPL_POPTRIE_IPP
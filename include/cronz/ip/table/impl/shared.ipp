@@ -0,0 +1,46 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_IMPL_SHARED_IPP
+#define CRONZ_IP_TABLE_IMPL_SHARED_IPP 1
+
+#include "cronz/ip/table/shared.hpp"
+
+#include <utility>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    template <typename Table>
+    inline SharedRouteTable<Table>::SharedRouteTable() noexcept = default;
+
+    template <typename Table>
+    inline SharedRouteTable<Table>::SharedRouteTable(std::shared_ptr<const Table> table) noexcept
+        : table_(std::move(table)) {
+    }
+
+    // Publication.
+    template <typename Table>
+    inline std::shared_ptr<const Table> SharedRouteTable<Table>::load() const noexcept {
+        return table_.load(std::memory_order_acquire);
+    }
+
+    template <typename Table>
+    inline void SharedRouteTable<Table>::store(std::shared_ptr<const Table> table) noexcept {
+        table_.store(std::move(table), std::memory_order_release);
+    }
+
+    template <typename Table>
+    inline std::shared_ptr<const Table> SharedRouteTable<Table>::exchange(std::shared_ptr<const Table> table) noexcept {
+        return table_.exchange(std::move(table), std::memory_order_acq_rel);
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_TABLE_IMPL_SHARED_IPP
@@ -0,0 +1,193 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_IMPL_TRIE_IPP
+#define CRONZ_IP_TABLE_IMPL_TRIE_IPP 1
+
+#include "cronz/internal/config.hpp"
+#include "cronz/internal/namespace.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Route of a prefix trie, with its key in host byte order.
+     */
+    struct PrefixTrieRoute {
+        std::uint64_t high;
+        std::uint64_t low;
+        std::uint32_t value;
+        std::uint8_t prefix;
+    };
+
+    /**
+     * @brief Leaf-pushed multibit trie: a direct root table indexed by the first `RootBits` bits of the key, and
+     * 256-entry nodes for every following byte.
+     * @tparam RootBits Stride of the root table. Must be a multiple of 8.
+     * @remark Entries are 32-bit: `0` for no route, the value plus one, or `Extended` with the index of a node.
+     * Every entry already holds the longest match of its range, so a lookup stops at the first entry that is not
+     * extended, after `1 + ceil((prefix - RootBits) / 8)` memory accesses at most.
+     * @remark Keys are 128-bit, made of two 64-bit halves. Strides never straddle them.
+     */
+    template <std::uint32_t RootBits>
+    class PrefixTrie {
+        static_assert(static_cast<std::uint32_t>(0) == RootBits % static_cast<std::uint32_t>(8) &&
+                      static_cast<std::uint32_t>(24) >= RootBits);
+
+    public:
+        inline static constexpr std::uint32_t Extended = static_cast<std::uint32_t>(0x80000000u);
+        inline static constexpr std::uint32_t MaxValue = static_cast<std::uint32_t>(0x7FFFFFFEu);
+
+    private:
+        inline static constexpr std::size_t RootLength = static_cast<std::size_t>(1) << RootBits;
+        inline static constexpr std::size_t NodeLength = static_cast<std::size_t>(256);
+
+        std::vector<std::uint32_t> entries_;
+        std::size_t count_ = static_cast<std::size_t>(0);
+
+        CRONZ_NODISCARD_L1 static std::uint32_t chunk_(const std::uint64_t &high, const std::uint64_t &low,
+                                                       const std::uint32_t &offset,
+                                                       const std::uint32_t &width) noexcept {
+            const std::uint64_t word = (static_cast<std::uint32_t>(64) > offset) ? high : low;
+            return static_cast<std::uint32_t>(word >> (static_cast<std::uint32_t>(64) - (offset & static_cast<
+                std::uint32_t>(63)) - width)) & ((static_cast<std::uint32_t>(1) << width) - static_cast<
+                std::uint32_t>(1));
+        }
+
+        CRONZ_NODISCARD_L1 bool insert_(const PrefixTrieRoute &route) {
+            std::size_t base = static_cast<std::size_t>(0);
+            std::uint32_t offset = static_cast<std::uint32_t>(0);
+            std::uint32_t width = RootBits;
+
+            // Descends to the level holding the last bit of the prefix, pushing the covering entries into new nodes.
+            while (route.prefix > offset + width) {
+                const std::size_t index = base + chunk_(route.high, route.low, offset, width);
+                if (static_cast<std::uint32_t>(0) == (entries_[index] & Extended)) {
+                    const std::size_t node = (entries_.size() - RootLength) / NodeLength;
+                    if (node >= static_cast<std::size_t>(Extended))
+                        return false;
+
+                    const std::uint32_t entry = entries_[index];
+                    entries_.resize(entries_.size() + NodeLength, entry);
+                    entries_[index] = Extended | static_cast<std::uint32_t>(node);
+                }
+
+                base = RootLength + static_cast<std::size_t>(entries_[index] & ~Extended) * NodeLength;
+                offset += width;
+                width = static_cast<std::uint32_t>(8);
+            }
+
+            // Routes are inserted shortest first, so longer ones overwrite the range and no node is covered.
+            const std::size_t span = static_cast<std::size_t>(1) << (offset + width - route.prefix);
+            const std::size_t first = base + (chunk_(route.high, route.low, offset, width) & ~(span - 1));
+            std::fill_n(entries_.begin() + static_cast<std::ptrdiff_t>(first), span,
+                        route.value + static_cast<std::uint32_t>(1));
+
+            return true;
+        }
+
+    public:
+        PrefixTrie() noexcept = default;
+
+        PrefixTrie(const PrefixTrie &trie) = delete;
+
+        PrefixTrie(PrefixTrie &&trie) noexcept : entries_(std::move(trie.entries_)), count_(trie.count_) {
+            trie.clear();
+        }
+
+        /**
+         * @brief Builds the trie from scratch.
+         * @param[in,out] routes Routes to be inserted. They are sorted by prefix length.
+         * @return `true` if the trie is built, otherwise (upon memory allocation failure or an out of range value),
+         * `false`, leaving the trie empty.
+         */
+        CRONZ_NODISCARD_L2 bool build(std::vector<PrefixTrieRoute> &routes) noexcept {
+            clear();
+
+            try {
+                std::ranges::stable_sort(routes, {}, &PrefixTrieRoute::prefix);
+
+                entries_.assign(RootLength, static_cast<std::uint32_t>(0));
+                for (const PrefixTrieRoute &route : routes) {
+                    if (route.value > MaxValue || !insert_(route))
+                        goto bad;
+                }
+
+                entries_.shrink_to_fit();
+            }
+            catch (...) {
+                goto bad;
+            }
+
+            count_ = routes.size();
+            return true;
+
+        bad:
+            clear();
+            return false;
+        }
+
+        void clear() noexcept {
+            entries_.clear();
+            entries_.shrink_to_fit();
+            count_ = static_cast<std::size_t>(0);
+        }
+
+        CRONZ_NODISCARD_L1 bool lookup(const std::uint64_t &high, const std::uint64_t &low,
+                                       std::uint32_t &value) const noexcept {
+            if (entries_.empty())
+                return false;
+
+            const std::uint32_t *const entries = entries_.data();
+
+            std::uint32_t entry = entries[chunk_(high, low, static_cast<std::uint32_t>(0), RootBits)];
+            for (std::uint32_t offset = RootBits; static_cast<std::uint32_t>(0) != (entry & Extended);
+                 offset += static_cast<std::uint32_t>(8)) {
+                entry = entries[RootLength + static_cast<std::size_t>(entry & ~Extended) * NodeLength +
+                                chunk_(high, low, offset, static_cast<std::uint32_t>(8))];
+            }
+
+            if (static_cast<std::uint32_t>(0) == entry)
+                return false;
+
+            value = entry - static_cast<std::uint32_t>(1);
+            return true;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept {
+            return count_;
+        }
+
+        CRONZ_NODISCARD_L1 std::size_t memoryUsage() const noexcept {
+            return entries_.capacity() * sizeof(std::uint32_t);
+        }
+
+        CRONZ_NODISCARD_L1 bool empty() const noexcept {
+            return entries_.empty();
+        }
+
+        PrefixTrie& operator=(const PrefixTrie &trie) = delete;
+
+        PrefixTrie& operator=(PrefixTrie &&trie) noexcept {
+            if (this != &trie) {
+                entries_ = std::move(trie.entries_);
+                count_ = trie.count_;
+                trie.clear();
+            }
+
+            return *this;
+        }
+    };
+
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+#endif // CRONZ_IP_TABLE_IMPL_TRIE_IPP
@@ -0,0 +1,99 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_IMPL_V4_IPP
+#define CRONZ_IP_TABLE_IMPL_V4_IPP 1
+
+#include "cronz/ip/table/v4.hpp"
+#include "cronz/internal/endian.hpp"
+
+#include <algorithm>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPv4RouteTable::IPv4RouteTable() noexcept = default;
+
+    inline IPv4RouteTable::IPv4RouteTable(const std::span<const IPv4Route> &routes) noexcept {
+        [[maybe_unused]] const bool _ = build(routes);
+    }
+
+    inline IPv4RouteTable::IPv4RouteTable(IPv4RouteTable &&table) noexcept = default;
+
+    // Initialization.
+    inline bool IPv4RouteTable::build(const std::span<const IPv4Route> &routes) noexcept {
+        std::vector<Internal::PrefixTrieRoute> prefixes;
+
+        try {
+            prefixes.reserve(routes.size());
+        }
+        catch (...) {
+            clear();
+            return false;
+        }
+
+        for (const IPv4Route &route : routes) {
+            prefixes.push_back({static_cast<std::uint64_t>(Internal::NetworkToHost32(route.network.address.uint32))
+                                << 32, static_cast<std::uint64_t>(0), route.value, route.network.prefix});
+        }
+
+        return trie_.build(prefixes);
+    }
+
+    inline void IPv4RouteTable::clear() noexcept {
+        trie_.clear();
+    }
+
+    // Lookup.
+    inline bool IPv4RouteTable::lookup(const IPv4Address &address, std::uint32_t &value) const noexcept {
+        return trie_.lookup(static_cast<std::uint64_t>(Internal::NetworkToHost32(address.uint32)) << 32,
+                            static_cast<std::uint64_t>(0), value);
+    }
+
+    inline std::size_t IPv4RouteTable::lookup(const std::span<const IPv4Address> &addresses,
+                                              const std::span<std::uint32_t> &values,
+                                              const std::uint32_t &missing) const noexcept {
+        const std::size_t count = std::min(addresses.size(), values.size());
+
+        auto found = static_cast<std::size_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            values[i] = missing;
+            found += static_cast<std::size_t>(lookup(addresses[i], values[i]));
+        }
+
+        return found;
+    }
+
+    // Properties.
+    inline std::size_t IPv4RouteTable::size() const noexcept {
+        return trie_.size();
+    }
+
+    inline std::size_t IPv4RouteTable::memoryUsage() const noexcept {
+        return trie_.memoryUsage();
+    }
+
+    inline bool IPv4RouteTable::empty() const noexcept {
+        return trie_.empty();
+    }
+
+    // Operators.
+    inline IPv4RouteTable::operator bool() const noexcept {
+        return !trie_.empty();
+    }
+
+    inline IPv4RouteTable& IPv4RouteTable::operator=(IPv4RouteTable &&table) noexcept = default;
+
+    // Destructors.
+    inline IPv4RouteTable::~IPv4RouteTable() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_TABLE_IMPL_V4_IPP
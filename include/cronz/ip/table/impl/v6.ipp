@@ -0,0 +1,101 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_IMPL_V6_IPP
+#define CRONZ_IP_TABLE_IMPL_V6_IPP 1
+
+#include "cronz/ip/table/v6.hpp"
+#include "cronz/internal/endian.hpp"
+
+#include <algorithm>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    // Constructors.
+    inline IPv6RouteTable::IPv6RouteTable() noexcept = default;
+
+    inline IPv6RouteTable::IPv6RouteTable(const std::span<const IPv6Route> &routes) noexcept {
+        [[maybe_unused]] const bool _ = build(routes);
+    }
+
+    inline IPv6RouteTable::IPv6RouteTable(IPv6RouteTable &&table) noexcept = default;
+
+    // Initialization.
+    inline bool IPv6RouteTable::build(const std::span<const IPv6Route> &routes) noexcept {
+        std::vector<Internal::PrefixTrieRoute> prefixes;
+
+        try {
+            prefixes.reserve(routes.size());
+        }
+        catch (...) {
+            clear();
+            return false;
+        }
+
+        for (const IPv6Route &route : routes) {
+            prefixes.push_back({Internal::NetworkToHost64(route.network.address.low64),
+                                Internal::NetworkToHost64(route.network.address.high64), route.value,
+                                route.network.prefix});
+        }
+
+        return trie_.build(prefixes);
+    }
+
+    inline void IPv6RouteTable::clear() noexcept {
+        trie_.clear();
+    }
+
+    // Lookup.
+    inline bool IPv6RouteTable::lookup(const IPv6Address &address, std::uint32_t &value) const noexcept {
+        // `low64` holds the first 8 bytes of the address, thus the high half of the key.
+        return trie_.lookup(Internal::NetworkToHost64(address.low64), Internal::NetworkToHost64(address.high64),
+                            value);
+    }
+
+    inline std::size_t IPv6RouteTable::lookup(const std::span<const IPv6Address> &addresses,
+                                              const std::span<std::uint32_t> &values,
+                                              const std::uint32_t &missing) const noexcept {
+        const std::size_t count = std::min(addresses.size(), values.size());
+
+        auto found = static_cast<std::size_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < count; ++i) {
+            values[i] = missing;
+            found += static_cast<std::size_t>(lookup(addresses[i], values[i]));
+        }
+
+        return found;
+    }
+
+    // Properties.
+    inline std::size_t IPv6RouteTable::size() const noexcept {
+        return trie_.size();
+    }
+
+    inline std::size_t IPv6RouteTable::memoryUsage() const noexcept {
+        return trie_.memoryUsage();
+    }
+
+    inline bool IPv6RouteTable::empty() const noexcept {
+        return trie_.empty();
+    }
+
+    // Operators.
+    inline IPv6RouteTable::operator bool() const noexcept {
+        return !trie_.empty();
+    }
+
+    inline IPv6RouteTable& IPv6RouteTable::operator=(IPv6RouteTable &&table) noexcept = default;
+
+    // Destructors.
+    inline IPv6RouteTable::~IPv6RouteTable() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_IP_TABLE_IMPL_V6_IPP
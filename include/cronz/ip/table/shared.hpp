@@ -0,0 +1,94 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_SHARED_HPP
+#define CRONZ_IP_TABLE_SHARED_HPP 1
+
+#include "cronz/internal/config.hpp"
+#include "cronz/internal/namespace.hpp"
+
+#include <atomic>
+#include <memory>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_table
+     * @brief Publication point of a routing table, for swapping in rebuilt tables while it is being read (RCU style).
+     * @tparam Table Routing table type (`IPv4RouteTable` or `IPv6RouteTable`).
+     * @class SharedRouteTable
+     * @remark Readers take a snapshot with `load` and look up through it, ideally once per batch of addresses rather
+     * than once per address. A writer builds a new table aside and publishes it with `store`. Readers holding the
+     * previous snapshot keep using it, and it is destroyed once the last of them releases it.
+     * @remark All the functions can be called concurrently from multiple threads.
+     */
+    template <typename Table>
+    class SharedRouteTable {
+        // Properties.
+        std::atomic<std::shared_ptr<const Table>> table_;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Publishes no table.
+         */
+        SharedRouteTable() noexcept;
+
+        /**
+         * @brief Constructor with initializer.
+         * @param[in] table Table to be published.
+         */
+        explicit SharedRouteTable(std::shared_ptr<const Table> table) noexcept;
+
+        SharedRouteTable(const SharedRouteTable &table) = delete;
+
+        /** @} */
+
+        /**
+         * @name Publication.
+         */
+        /** @{ */
+        /**
+         * @brief Takes a snapshot of the published table.
+         * @return Published table, or `nullptr` if there is none.
+         */
+        CRONZ_NODISCARD_L1 std::shared_ptr<const Table> load() const noexcept;
+
+        /**
+         * @brief Publishes a table, replacing the previous one.
+         * @param[in] table Table to be published.
+         */
+        void store(std::shared_ptr<const Table> table) noexcept;
+
+        /**
+         * @brief Publishes a table, returning the previous one.
+         * @param[in] table Table to be published.
+         * @return Previously published table.
+         */
+        CRONZ_NODISCARD_L2 std::shared_ptr<const Table> exchange(std::shared_ptr<const Table> table) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        SharedRouteTable& operator=(const SharedRouteTable &table) = delete;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/table/impl/shared.ipp"
+
+#endif // CRONZ_IP_TABLE_SHARED_HPP
@@ -0,0 +1,196 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_IP_TABLE_V4_HPP
+#define CRONZ_IP_TABLE_V4_HPP 1
+
+#include "cronz/ip/network/v4.hpp"
+#include "cronz/ip/table/impl/trie.ipp"
+
+#include <cstdint>
+#include <span>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(IP)
+    /**
+     * @ingroup cronz_ip_table
+     * @brief Route of an IPv4 routing table.
+     * @struct IPv4Route
+     */
+    struct IPv4Route {
+        /**
+         * @brief Destination network.
+         */
+        IPv4Network network;
+
+        /**
+         * @brief Value of the route (e.g., an index into the caller's next hops), within `0`-`MaxValue`.
+         */
+        std::uint32_t value;
+    };
+
+    /**
+     * @ingroup cronz_ip_table
+     * @brief Longest-prefix-match routing table for IPv4 addresses, in the DIR-24-8 layout.
+     * @class IPv4RouteTable
+     * @remark A 2^24-entry table is indexed by the first 24 bits of an address, and prefixes longer than `/24` are
+     * expanded into 256-entry groups, so a lookup takes at most two memory accesses. The first table takes 64 MiB.
+     * @remark The table is immutable once built, so `lookup` can be called concurrently from multiple threads
+     * without locks. To update it, build a new table and publish it through `SharedRouteTable`.
+     */
+    class IPv4RouteTable {
+        // Properties.
+        Internal::PrefixTrie<static_cast<std::uint32_t>(24)> trie_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Maximum value of a route.
+         */
+        inline static constexpr std::uint32_t MaxValue = Internal::PrefixTrie<
+            static_cast<std::uint32_t>(24)>::MaxValue;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Constructs an empty table, which has no routes.
+         */
+        IPv4RouteTable() noexcept;
+
+        /**
+         * @brief Constructor with initializer.
+         * @param[in] routes Routes of the table.
+         * @remark This function internally calls `build`. Upon failure, the table will be empty.
+         */
+        explicit IPv4RouteTable(const std::span<const IPv4Route> &routes) noexcept;
+
+        IPv4RouteTable(const IPv4RouteTable &table) = delete;
+
+        /**
+         * @brief Move constructor.
+         * @param[in] table Table to be moved. It will be empty afterward.
+         */
+        IPv4RouteTable(IPv4RouteTable &&table) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Initialization.
+         */
+        /** @{ */
+        /**
+         * @brief Builds the table from scratch.
+         * @param[in] routes Routes of the table, in any order.
+         * @return `true` if the table is built, otherwise, `false`.
+         * @remark If a network appears more than once, the last route wins.
+         * @remark Upon failure (memory allocation failure or a value above `MaxValue`), the table will be empty.
+         */
+        CRONZ_NODISCARD_L2 bool build(const std::span<const IPv4Route> &routes) noexcept;
+
+        /**
+         * @brief Removes all the routes, releasing the memory.
+         */
+        void clear() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Lookup.
+         */
+        /** @{ */
+        /**
+         * @brief Finds the route with the longest prefix containing an address.
+         * @param[in] address Address to be looked up.
+         * @param[out] value Value of the route. Not altered if there is no route.
+         * @return `true` if a route is found, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool lookup(const IPv4Address &address, std::uint32_t &value) const noexcept;
+
+        /**
+         * @brief Finds the routes of many addresses.
+         * @param[in] addresses Addresses to be looked up.
+         * @param[out] values Values of the routes. Must be at least as long as `addresses`.
+         * @param[in] missing Value written for the addresses without a route.
+         * @return Number of addresses with a route.
+         * @remark Lookups are independent of each other, so their memory accesses overlap.
+         */
+        std::size_t lookup(const std::span<const IPv4Address> &addresses, const std::span<std::uint32_t> &values,
+                           const std::uint32_t &missing) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of routes the table is built from.
+         * @return Number of routes.
+         */
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept;
+
+        /**
+         * @brief Returns the memory taken by the table.
+         * @return Byte length of the table.
+         */
+        CRONZ_NODISCARD_L1 std::size_t memoryUsage() const noexcept;
+
+        /**
+         * @brief Tells if the table is not built.
+         * @return `true` if the table is not built, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the table is built.
+         * @return `true` if the table is built, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 explicit operator bool() const noexcept;
+
+        IPv4RouteTable& operator=(const IPv4RouteTable &table) = delete;
+
+        /**
+         * @brief Move assignment.
+         * @param[in] table Table to be moved. It will be empty afterward.
+         * @return Reference to the current table.
+         */
+        IPv4RouteTable& operator=(IPv4RouteTable &&table) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Does nothing.
+         */
+        ~IPv4RouteTable() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/ip/table/impl/v4.ipp"
+
+#endif // CRONZ_IP_TABLE_V4_HPP
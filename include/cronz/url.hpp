@@ -17,13 +17,18 @@
  */
 
 #include "cronz/url/authority.hpp"
+#include "cronz/url/dataset.hpp"
 #include "cronz/url/encode.hpp"
 #include "cronz/url/decode.hpp"
+#include "cronz/url/filter.hpp"
 #include "cronz/url/fragment.hpp"
 #include "cronz/url/path.hpp"
+#include "cronz/url/pool.hpp"
 #include "cronz/url/query.hpp"
 #include "cronz/url/scheme.hpp"
+#include "cronz/url/sign.hpp"
 #include "cronz/url/types.hpp"
 #include "cronz/url/url.hpp"
+#include "cronz/url/view.hpp"
 
 #endif // CRONZ_URL_HPP
@@ -12,6 +12,7 @@
 #define CRONZ_URL_AUTHORITY_HOST_HPP 1
 
 #include "cronz/url/types.hpp"
+#include "cronz/internal/hash.hpp"
 #include "cronz/ip/address/v4.hpp"
 #include "cronz/ip/address/v6.hpp"
 
@@ -44,6 +45,9 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         // Assignment & Parsing.
         [[nodiscard]] static bool validateLabel_(const char *label, const std::size_t &length) noexcept;
 
+        // Friends.
+        friend class URL;
+
     public:
         /**
          * @brief Constructors.
@@ -234,6 +238,15 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         void clear() noexcept;
 
+        /**
+         * @brief Hashes the host.
+         * @param[in] seed Seed.
+         * @return 64-bit hash of the host.
+         * @remark The parsed (case-folded) value is hashed directly, so two hosts that differ only in letter case
+         * produce the same hash.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t hash(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) const noexcept;
+
         /** @} */
 
         /**
@@ -19,7 +19,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
     // Properties.
     inline std::size_t Authority::length() const noexcept {
-        std::size_t len = host.length();
+        auto len = static_cast<std::size_t>(0);
 
         if (userInformation) {
             len += userInformation.length();
@@ -65,7 +65,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         previous = next + static_cast<std::size_t>(1);
 
-        if (previous < end && !ParsePort(previous, end - previous))
+        if (previous < end && !ParsePort(previous, end - previous, port))
             goto bad;
 
         return true;
@@ -195,6 +195,10 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         type_ = None;
     }
 
+    inline std::uint64_t Host::hash(const std::uint64_t &seed) const noexcept {
+        return Internal::HashBytes(value_.data(), value_.length(), seed ^ static_cast<std::uint64_t>(type_));
+    }
+
     // Operators.
     inline Host::operator bool() const noexcept {
         return !empty();
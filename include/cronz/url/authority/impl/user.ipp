@@ -14,6 +14,9 @@
 #include <cronz/url/decode.hpp>
 #include <cronz/url/encode.hpp>
 
+#include <cstring>
+#include <utility>
+
 #include "cronz/url/authority/user.hpp"
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
@@ -44,6 +47,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
     }
 
+    inline bool UserInformation::setUser(const char *user) noexcept {
+        return setUser(user, std::strlen(user));
+    }
+
+    inline bool UserInformation::setUser(const std::string_view &user) noexcept {
+        return setUser(user.data(), user.length());
+    }
+
+    inline bool UserInformation::setUser(std::string &&user) noexcept {
+        user_ = std::move(user);
+        return true;
+    }
+
     inline void UserInformation::clearUser() noexcept {
         user_.clear();
     }
@@ -72,6 +88,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
     }
 
+    inline bool UserInformation::setPassword(const char *password) noexcept {
+        return setPassword(password, std::strlen(password));
+    }
+
+    inline bool UserInformation::setPassword(const std::string_view &password) noexcept {
+        return setPassword(password.data(), password.length());
+    }
+
+    inline bool UserInformation::setPassword(std::string &&password) noexcept {
+        password_ = std::move(password);
+        return true;
+    }
+
     inline void UserInformation::clearPassword() noexcept {
         password_.clear();
     }
@@ -83,26 +112,25 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
     inline bool UserInformation::parse(const char *str, const std::size_t &length) noexcept {
         const char *const end = str + length;
-
-        std::string user;
-        std::string password;
-
         const char *separator = std::ranges::find(str, end, ':');
+        const char *password = (end == separator) ? end : (separator + static_cast<std::size_t>(1));
 
-        if (!Decode(str, separator - str, user))
+        // Decoding can only fail while reserving once the lengths are known, so the values are decoded in place.
+        const std::size_t userLength = CalculateDecodedLength(str, separator - str);
+        const std::size_t passwordLength = CalculateDecodedLength(password, end - password);
+        if (std::numeric_limits<std::size_t>::max() == userLength ||
+            std::numeric_limits<std::size_t>::max() == passwordLength)
             return false;
 
-        if (end != separator) {
-            ++separator;
-
-            if (!Decode(separator, end - separator, password))
-                return false;
+        try {
+            user_.reserve(userLength);
+            password_.reserve(passwordLength);
+        }
+        catch (...) {
+            return false;
         }
 
-        user_.swap(user);
-        password_.swap(password);
-
-        return true;
+        return Decode(str, separator - str, user_) && Decode(password, end - password, password_);
     }
 
     // Properties.
@@ -13,6 +13,9 @@
 
 #include "cronz/crypto/hex.hpp"
 
+#include <string>
+#include <string_view>
+
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     class UserInformation {
         // Properties.
@@ -62,6 +65,27 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool setUser(const char *user, const std::size_t &length) noexcept;
 
+        /**
+         * @brief Sets the user field.
+         * @param[in] user New user value, null-terminated.
+         * @return `true` if assignment is successfully done, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool setUser(const char *user) noexcept;
+
+        /**
+         * @brief Sets the user field.
+         * @param[in] user New user value.
+         * @return `true` if assignment is successfully done, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool setUser(const std::string_view &user) noexcept;
+
+        /**
+         * @brief Sets the user field by taking over the storage of the given string.
+         * @param[in,out] user New user value.
+         * @return Always `true`.
+         */
+        CRONZ_NODISCARD_L2 bool setUser(std::string &&user) noexcept;
+
         /**
          * @brief Clears the user field.
          */
@@ -100,6 +124,27 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool setPassword(const char *password, const std::size_t &length) noexcept;
 
+        /**
+         * @brief Sets the password field.
+         * @param[in] password New password value, null-terminated.
+         * @return `true` if assignment is successfully done, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool setPassword(const char *password) noexcept;
+
+        /**
+         * @brief Sets the password field.
+         * @param[in] password New password value.
+         * @return `true` if assignment is successfully done, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool setPassword(const std::string_view &password) noexcept;
+
+        /**
+         * @brief Sets the password field by taking over the storage of the given string.
+         * @param[in,out] password New password value.
+         * @return Always `true`.
+         */
+        CRONZ_NODISCARD_L2 bool setPassword(std::string &&password) noexcept;
+
         /**
          * @brief Clears the password field.
          */
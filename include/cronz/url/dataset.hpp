@@ -0,0 +1,411 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_DATASET_HPP
+#define CRONZ_URL_DATASET_HPP 1
+
+/**
+ * @defgroup cronz_url_dataset Dataset
+ * @ingroup cronz_url
+ */
+
+#include "cronz/internal/hash.hpp"
+#include "cronz/url/url.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    /**
+     * @ingroup cronz_url_dataset
+     * @brief Columnar URL dataset layout, shared by `DatasetWriter` and `DatasetReader`.
+     * @class Dataset
+     * @remark A dataset is a 64-byte header, a column directory and the columns, each column starting at an 8-byte
+     * aligned offset. All integers are in host byte order.
+     * @remark Scheme and host columns are dictionary-encoded: a `std::uint32_t` id per URL, and a dictionary made of
+     * `std::uint64_t` offsets and the bytes. Path, query and fragment columns are `std::uint64_t` offsets (one more
+     * than the URL count) and the bytes. Ports are stored as a `Port` per URL.
+     * @remark Paths and queries are stored percent-encoded, as stringified by `PathManager` and `QueryManager`. User
+     * information is not stored.
+     */
+    class Dataset {
+    public:
+        /**
+         * @brief Column identifiers, in file order.
+         */
+        enum Column : std::uint32_t {
+            SchemeDictionaryOffsets = 0,
+            SchemeDictionaryBytes,
+            SchemeIds,
+            HostDictionaryOffsets,
+            HostDictionaryBytes,
+            HostTypes,
+            HostIds,
+            Ports,
+            PathOffsets,
+            PathBytes,
+            QueryOffsets,
+            QueryBytes,
+            FragmentOffsets,
+            FragmentBytes,
+            ColumnCount
+        };
+
+        /**
+         * @brief File signature.
+         */
+        inline static constexpr char Magic[8] = {'C', 'R', 'Z', 'U', 'R', 'L', 'D', 'S'};
+
+        /**
+         * @brief Format version.
+         */
+        inline static constexpr std::uint32_t Version = static_cast<std::uint32_t>(1);
+
+        /**
+         * @brief Byte length of the header.
+         * @remark The header holds the signature, the version, the column count, the URL count, the scheme dictionary
+         * size and the host dictionary size, in this order, and is zero-padded.
+         */
+        inline static constexpr std::size_t HeaderLength = static_cast<std::size_t>(64);
+
+        /**
+         * @brief Byte length of the column directory, which holds an `std::uint64_t` offset and length per column.
+         */
+        inline static constexpr std::size_t DirectoryLength = static_cast<std::size_t>(ColumnCount) * static_cast<
+            std::size_t>(16);
+    };
+
+    /**
+     * @ingroup cronz_url_dataset
+     * @brief Builds a columnar URL dataset in memory.
+     * @class DatasetWriter
+     * @sa Dataset
+     */
+    class DatasetWriter {
+        // Properties.
+        std::vector<std::string> schemes_;
+        Internal::StringMap<std::uint32_t> schemeIds_;
+
+        std::vector<std::string> hosts_;
+        std::vector<char> hostTypes_;
+        Internal::StringMap<std::uint32_t> hostIds_;
+
+        std::vector<std::uint32_t> schemeColumn_;
+        std::vector<std::uint32_t> hostColumn_;
+        std::vector<Port> portColumn_;
+
+        std::vector<std::uint64_t> pathOffsets_{static_cast<std::uint64_t>(0)};
+        std::string pathBytes_;
+
+        std::vector<std::uint64_t> queryOffsets_{static_cast<std::uint64_t>(0)};
+        std::string queryBytes_;
+
+        std::vector<std::uint64_t> fragmentOffsets_{static_cast<std::uint64_t>(0)};
+        std::string fragmentBytes_;
+
+        std::string key_;
+
+        // Utilities.
+        CRONZ_NODISCARD_L1 static bool intern_(const std::string_view &key, std::vector<std::string> &values,
+                                               Internal::StringMap<std::uint32_t> &ids, std::uint32_t &id) noexcept;
+
+        void columnLengths_(std::uint64_t (&lengths)[Dataset::ColumnCount]) const noexcept;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Does nothing.
+         */
+        DatasetWriter() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Building.
+         */
+        /** @{ */
+        /**
+         * @brief Appends a URL.
+         * @param[in] url URL to be appended.
+         * @return `true` if the URL is successfully appended, otherwise, `false`.
+         * @remark Upon failure, the dataset is left unchanged.
+         */
+        CRONZ_NODISCARD_L2 bool add(const URL &url) noexcept;
+
+        /**
+         * @brief Appends a URL from its components.
+         * @param[in] scheme Scheme.
+         * @param[in] host Host.
+         * @param[in] port Port.
+         * @param[in] path Path.
+         * @param[in] query Query.
+         * @param[in] fragment Fragment.
+         * @return `true` if the URL is successfully appended, otherwise, `false`.
+         * @remark Upon failure, the dataset is left unchanged.
+         */
+        CRONZ_NODISCARD_L2 bool add(const Scheme &scheme, const Host &host, const Port &port, const PathManager &path,
+                                    const QueryManager &query, const Fragment &fragment) noexcept;
+
+        /**
+         * @brief Removes all the URLs.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns the number of URLs.
+         * @return Number of URLs.
+         */
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept;
+
+        /**
+         * @brief Tells if no URL has been added.
+         * @return `true` if no URL has been added, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Serialization.
+         */
+        /** @{ */
+        /**
+         * @brief Tells the byte length of the serialized dataset.
+         * @return Byte length of the serialized dataset.
+         */
+        CRONZ_NODISCARD_L1 std::size_t serializedLength() const noexcept;
+
+        /**
+         * @brief Serializes the dataset into a caller-provided buffer.
+         * @param[out] data Output buffer (e.g., a writable memory-mapped file).
+         * @param[in] length Byte length of `data`. Must be at least `serializedLength()`.
+         * @return `true` if the dataset is successfully serialized, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool serialize(void *data, const std::size_t &length) const noexcept;
+
+        /**
+         * @brief Serializes the dataset into a file.
+         * @param[in] path File path.
+         * @return `true` if the file is successfully written, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool save(const char *path) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Does nothing.
+         */
+        ~DatasetWriter() noexcept;
+
+        /** @} */
+    };
+
+    /**
+     * @ingroup cronz_url_dataset
+     * @brief Reads a columnar URL dataset in place.
+     * @class DatasetReader
+     * @remark Only the header and the column directory are validated upon opening, so that scanning a column does not
+     * touch the others (e.g., iterating `hostIds` with `hostAt` never pages in paths). Row accessors validate the
+     * offsets they read and return empty values for malformed rows.
+     * @sa Dataset
+     */
+    class DatasetReader {
+        // Properties.
+        const unsigned char *data_ = nullptr;
+        std::size_t length_ = static_cast<std::size_t>(0);
+
+        void *mapping_ = nullptr;
+        std::vector<std::uint64_t> storage_;
+
+        std::size_t rowCount_ = static_cast<std::size_t>(0);
+        std::size_t schemeCount_ = static_cast<std::size_t>(0);
+        std::size_t hostCount_ = static_cast<std::size_t>(0);
+
+        const unsigned char *columns_[Dataset::ColumnCount] = {};
+        std::size_t columnLengths_[Dataset::ColumnCount] = {};
+
+        // Utilities.
+        void reset_() noexcept;
+
+        CRONZ_NODISCARD_L1 bool attach_(const void *data, const std::size_t &length) noexcept;
+
+        template <typename ElementType>
+        CRONZ_NODISCARD_L1 const ElementType* column_(const Dataset::Column &column) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view string_(const Dataset::Column &offsets, const Dataset::Column &bytes,
+                                                    const std::size_t &position, const std::size_t &count)
+        const noexcept;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Does nothing.
+         */
+        DatasetReader() noexcept;
+
+        DatasetReader(const DatasetReader &reader) = delete;
+
+        /**
+         * @brief Move constructor.
+         * @param[in] reader Reader to be moved.
+         */
+        DatasetReader(DatasetReader &&reader) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Opening.
+         */
+        /** @{ */
+        /**
+         * @brief Memory-maps a dataset file.
+         * @param[in] path File path.
+         * @return `true` if the file holds a valid dataset, otherwise, `false`.
+         * @remark On platforms without `mmap`, the file is read into memory instead.
+         */
+        CRONZ_NODISCARD_L2 bool open(const char *path) noexcept;
+
+        /**
+         * @brief Uses a serialized dataset in place, without copying it.
+         * @param[in] data Serialized dataset. Must be 8-byte aligned.
+         * @param[in] length Byte length of `data`.
+         * @return `true` if `data` holds a valid dataset, otherwise, `false`.
+         * @remark `data` must outlive the reader.
+         */
+        CRONZ_NODISCARD_L2 bool attach(const void *data, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Releases the dataset.
+         */
+        void close() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Rows.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of URLs.
+         * @return Number of URLs.
+         */
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept;
+
+        /**
+         * @brief Tells if no dataset is open.
+         * @return `true` if no dataset is open, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view scheme(const std::size_t &position) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view host(const std::size_t &position) const noexcept;
+
+        CRONZ_NODISCARD_L1 Port port(const std::size_t &position) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view path(const std::size_t &position) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view query(const std::size_t &position) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view fragment(const std::size_t &position) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Columns.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the scheme dictionary ids, one per URL.
+         * @return Scheme ids. See `schemeAt`.
+         */
+        CRONZ_NODISCARD_L1 std::span<const std::uint32_t> schemeIds() const noexcept;
+
+        /**
+         * @brief Returns the host dictionary ids, one per URL.
+         * @return Host ids. See `hostAt`.
+         */
+        CRONZ_NODISCARD_L1 std::span<const std::uint32_t> hostIds() const noexcept;
+
+        /**
+         * @brief Returns the ports, one per URL.
+         * @return Ports. `0` means no port.
+         */
+        CRONZ_NODISCARD_L1 std::span<const Port> ports() const noexcept;
+
+        CRONZ_NODISCARD_L1 std::size_t schemeCount() const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view schemeAt(const std::size_t &id) const noexcept;
+
+        CRONZ_NODISCARD_L1 std::size_t hostCount() const noexcept;
+
+        CRONZ_NODISCARD_L1 std::string_view hostAt(const std::size_t &id) const noexcept;
+
+        /**
+         * @brief Tells the type of a host in the dictionary.
+         * @param[in] id Host id.
+         * @return `'4'` for IPv4 addresses, `'6'` for IPv6 addresses, `'n'` for registered names, `'\0'` if there is
+         * no host or `id` is out of range.
+         */
+        CRONZ_NODISCARD_L1 char hostTypeAt(const std::size_t &id) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if a dataset is open.
+         * @return `true` if a dataset is open, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+
+        DatasetReader& operator=(const DatasetReader &reader) = delete;
+
+        /**
+         * @brief Move assignment.
+         * @param[in] reader Reader to be moved.
+         * @return Reference to the current reader.
+         */
+        DatasetReader& operator=(DatasetReader &&reader) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Destructor. Releases the dataset.
+         */
+        ~DatasetReader() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/url/impl/dataset.ipp"
+
+#endif // CRONZ_URL_DATASET_HPP
@@ -27,6 +27,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
      * @param[in] encoded Encoded string.
      * @return The number of characters in the encoded version of the string. Upon failure, this function returns
      * `std::numeric_limits<std::size_t>::max()`.
+     * @remark Fails if a `%` is not followed by two hexadecimal digits, thus a successful result guarantees that
+     * decoding cannot fail except for memory allocation.
      */
     CRONZ_NODISCARD_L1 std::size_t CalculateDecodedLength(const std::string &encoded) noexcept;
 
@@ -37,6 +39,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
      * @param[in] length Length of the encoded string.
      * @return The number of characters in the encoded version of the string. Upon failure, this function returns
      * `std::numeric_limits<std::size_t>::max()`.
+     * @remark Fails if a `%` is not followed by two hexadecimal digits, thus a successful result guarantees that
+     * decoding cannot fail except for memory allocation.
      */
     CRONZ_NODISCARD_L1 std::size_t CalculateDecodedLength(const char *encoded, const std::size_t &length) noexcept;
 
@@ -0,0 +1,267 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_FILTER_HPP
+#define CRONZ_URL_FILTER_HPP 1
+
+/**
+ * @defgroup cronz_url_filter Filter
+ * @ingroup cronz_url
+ */
+
+#include "cronz/url/url.hpp"
+
+#include <cstdint>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    /**
+     * @ingroup cronz_url_filter
+     * @brief Blocked Bloom filter for approximate URL membership ("have we seen this URL?").
+     * @class BloomFilter
+     * @remark Every key sets its bits within a single 512-bit (cache line sized) block, so an insertion or a lookup
+     * touches exactly one cache line.
+     * @remark Keys are hashed from the parsed components (see `URL::hash` and `Host::hash`), so URLs are never
+     * stringified.
+     * @remark `insert` and `contains` are lock-free and can be called concurrently from multiple threads. `create`,
+     * `attach`, `clear` and assignments are not thread-safe.
+     * @remark The serialized layout is a 64-byte header followed by the blocks, so a serialized filter can be
+     * memory-mapped and used in place via `attach`.
+     */
+    class BloomFilter {
+        // Properties.
+        inline static constexpr std::size_t BlockBits = static_cast<std::size_t>(512);
+        inline static constexpr std::size_t BlockWords = BlockBits / static_cast<std::size_t>(64);
+
+        inline static constexpr std::size_t HeaderLength = static_cast<std::size_t>(64);
+        inline static constexpr char Magic[8] = {'C', 'R', 'Z', 'B', 'L', 'O', 'O', 'M'};
+        inline static constexpr std::uint32_t Version = static_cast<std::uint32_t>(1);
+
+        std::vector<std::uint64_t> storage_;
+        std::uint64_t *words_ = nullptr;
+
+        std::size_t blockCount_ = static_cast<std::size_t>(0);
+        std::uint32_t hashCount_ = static_cast<std::uint32_t>(0);
+        std::uint64_t seed_ = static_cast<std::uint64_t>(0);
+
+        // Utilities.
+        void reset_() noexcept;
+
+        CRONZ_NODISCARD_L1 std::uint64_t* block_(const std::uint64_t &hash) const noexcept;
+
+        void masks_(const std::uint64_t &hash, std::uint64_t (&masks)[BlockWords]) const noexcept;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Does nothing.
+         * @remark The filter must be initialized with `create` or `attach` before use.
+         */
+        BloomFilter() noexcept;
+
+        /**
+         * @brief Constructor with initializers.
+         * @param[in] expectedCount Expected number of keys.
+         * @param[in] falsePositiveRate Target false-positive rate, in `(0, 1)`.
+         * @param[in] seed Hash seed.
+         * @remark This function internally calls `create`. Upon failure, the filter will be empty.
+         */
+        BloomFilter(const std::size_t &expectedCount, const double &falsePositiveRate,
+                    const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+        BloomFilter(const BloomFilter &filter) = delete;
+
+        /**
+         * @brief Move constructor.
+         * @param[in] filter Filter to be moved.
+         */
+        BloomFilter(BloomFilter &&filter) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Initialization.
+         */
+        /** @{ */
+        /**
+         * @brief Allocates an empty filter sized for the given key count and false-positive rate.
+         * @param[in] expectedCount Expected number of keys.
+         * @param[in] falsePositiveRate Target false-positive rate, in `(0, 1)`.
+         * @param[in] seed Hash seed.
+         * @return `true` if the filter is successfully allocated, otherwise, `false`.
+         * @remark Upon failure, the filter will be empty.
+         */
+        CRONZ_NODISCARD_L2 bool create(const std::size_t &expectedCount, const double &falsePositiveRate,
+                                       const std::uint64_t &seed = static_cast<std::uint64_t>(0)) noexcept;
+
+        /**
+         * @brief Uses a serialized filter in place, without copying it.
+         * @param[in] data Serialized filter (e.g., a memory-mapped file). Must be 8-byte aligned.
+         * @param[in] length Byte length of `data`.
+         * @return `true` if `data` holds a valid filter, otherwise, `false`.
+         * @remark `data` must outlive the filter. Insertions modify `data` directly, so a writable shared mapping
+         * persists them.
+         */
+        CRONZ_NODISCARD_L2 bool attach(void *data, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Clears all the bits in the filter.
+         */
+        void clear() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Membership.
+         */
+        /** @{ */
+        /**
+         * @brief Inserts a precomputed key hash.
+         * @param[in] hash Key hash.
+         * @return `true` if the key was possibly present before, `false` if it was definitely not.
+         */
+        bool insert(const std::uint64_t &hash) noexcept;
+
+        /**
+         * @brief Inserts a URL.
+         * @param[in] url URL to be inserted.
+         * @return `true` if the URL was possibly present before, `false` if it was definitely not.
+         */
+        bool insert(const URL &url) noexcept;
+
+        /**
+         * @brief Inserts a host.
+         * @param[in] host Host to be inserted.
+         * @return `true` if the host was possibly present before, `false` if it was definitely not.
+         */
+        bool insert(const Host &host) noexcept;
+
+        /**
+         * @brief Tells whether a precomputed key hash might be present.
+         * @param[in] hash Key hash.
+         * @return `true` if the key is possibly present, `false` if it is definitely not.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const std::uint64_t &hash) const noexcept;
+
+        /**
+         * @brief Tells whether a URL might be present.
+         * @param[in] url URL to be tested.
+         * @return `true` if the URL is possibly present, `false` if it is definitely not.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const URL &url) const noexcept;
+
+        /**
+         * @brief Tells whether a host might be present.
+         * @param[in] host Host to be tested.
+         * @return `true` if the host is possibly present, `false` if it is definitely not.
+         */
+        CRONZ_NODISCARD_L1 bool contains(const Host &host) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Serialization.
+         */
+        /** @{ */
+        /**
+         * @brief Tells the byte length of the serialized filter.
+         * @return Byte length of the serialized filter. `0` if the filter is empty.
+         */
+        CRONZ_NODISCARD_L1 std::size_t serializedLength() const noexcept;
+
+        /**
+         * @brief Serializes the filter into a caller-provided buffer.
+         * @param[out] data Output buffer (e.g., a writable memory-mapped file).
+         * @param[in] length Byte length of `data`.
+         * @return `true` if the filter is successfully serialized, otherwise, `false`.
+         * @remark `length` must be at least `serializedLength()`.
+         */
+        CRONZ_NODISCARD_L2 bool serialize(void *data, const std::size_t &length) const noexcept;
+
+        /**
+         * @brief Serializes the filter into a file.
+         * @param[in] path File path.
+         * @return `true` if the file is successfully written, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool save(const char *path) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of 512-bit blocks.
+         * @return Number of blocks.
+         */
+        CRONZ_NODISCARD_L1 std::size_t blockCount() const noexcept;
+
+        /**
+         * @brief Returns the number of bits set per key.
+         * @return Number of bits set per key.
+         */
+        CRONZ_NODISCARD_L1 std::uint32_t hashCount() const noexcept;
+
+        /**
+         * @brief Returns the hash seed.
+         * @return Hash seed.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t seed() const noexcept;
+
+        /**
+         * @brief Tells if the filter is not initialized.
+         * @return `true` if the filter is not initialized, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the filter is initialized.
+         * @return `true` if the filter is initialized, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+
+        BloomFilter& operator=(const BloomFilter &filter) = delete;
+
+        /**
+         * @brief Move assignment.
+         * @param[in] filter Filter to be moved.
+         * @return Reference to the current filter.
+         */
+        BloomFilter& operator=(BloomFilter &&filter) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Does nothing.
+         */
+        ~BloomFilter() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/url/impl/filter.ipp"
+
+#endif // CRONZ_URL_FILTER_HPP
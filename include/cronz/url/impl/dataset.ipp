@@ -0,0 +1,584 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_IMPL_DATASET_IPP
+#define CRONZ_URL_IMPL_DATASET_IPP 1
+
+#include "cronz/url/dataset.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CRONZ_URL_DATASET_MMAP 1
+#endif
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // DatasetWriter.
+    // Utilities.
+    inline bool DatasetWriter::intern_(const std::string_view &key, std::vector<std::string> &values,
+                                       Internal::StringMap<std::uint32_t> &ids, std::uint32_t &id) noexcept {
+        if (const auto it = ids.find(key); ids.end() != it) {
+            id = it->second;
+            return true;
+        }
+
+        if (static_cast<std::size_t>(UINT32_MAX) <= values.size())
+            return false;
+
+        try {
+            values.emplace_back(key);
+        }
+        catch (...) {
+            return false;
+        }
+
+        try {
+            id = static_cast<std::uint32_t>(values.size() - static_cast<std::size_t>(1));
+            ids.emplace(values.back(), id);
+        }
+        catch (...) {
+            values.pop_back();
+            return false;
+        }
+
+        return true;
+    }
+
+    inline void DatasetWriter::columnLengths_(std::uint64_t (&lengths)[Dataset::ColumnCount]) const noexcept {
+        const auto rows = static_cast<std::uint64_t>(schemeColumn_.size());
+
+        const auto dictionaryLength = [](const std::vector<std::string> &values) -> std::uint64_t {
+            auto length = static_cast<std::uint64_t>(0);
+            for (const std::string &value : values)
+                length += value.length();
+
+            return length;
+        };
+
+        lengths[Dataset::SchemeDictionaryOffsets] = (schemes_.size() + static_cast<std::uint64_t>(1)) * sizeof(
+            std::uint64_t);
+        lengths[Dataset::SchemeDictionaryBytes] = dictionaryLength(schemes_);
+        lengths[Dataset::SchemeIds] = rows * sizeof(std::uint32_t);
+        lengths[Dataset::HostDictionaryOffsets] = (hosts_.size() + static_cast<std::uint64_t>(1)) * sizeof(
+            std::uint64_t);
+        lengths[Dataset::HostDictionaryBytes] = dictionaryLength(hosts_);
+        lengths[Dataset::HostTypes] = hostTypes_.size();
+        lengths[Dataset::HostIds] = rows * sizeof(std::uint32_t);
+        lengths[Dataset::Ports] = rows * sizeof(Port);
+        lengths[Dataset::PathOffsets] = pathOffsets_.size() * sizeof(std::uint64_t);
+        lengths[Dataset::PathBytes] = pathBytes_.length();
+        lengths[Dataset::QueryOffsets] = queryOffsets_.size() * sizeof(std::uint64_t);
+        lengths[Dataset::QueryBytes] = queryBytes_.length();
+        lengths[Dataset::FragmentOffsets] = fragmentOffsets_.size() * sizeof(std::uint64_t);
+        lengths[Dataset::FragmentBytes] = fragmentBytes_.length();
+    }
+
+    // Constructors.
+    inline DatasetWriter::DatasetWriter() noexcept = default;
+
+    // Building.
+    inline bool DatasetWriter::add(const URL &url) noexcept {
+        return add(url.scheme, url.authority.host, url.authority.port, url.path, url.query, url.fragment);
+    }
+
+    inline bool DatasetWriter::add(const Scheme &scheme, const Host &host, const Port &port, const PathManager &path,
+                                   const QueryManager &query, const Fragment &fragment) noexcept {
+        const std::size_t rows = schemeColumn_.size();
+        const std::size_t pathLength = pathBytes_.length();
+        const std::size_t queryLength = queryBytes_.length();
+        const std::size_t fragmentLength = fragmentBytes_.length();
+
+        std::uint32_t schemeId;
+        std::uint32_t hostId;
+
+        if (!intern_(scheme.getValue(), schemes_, schemeIds_, schemeId) || !host.stringify(key_) ||
+            !intern_(key_, hosts_, hostIds_, hostId))
+            goto bad;
+
+        try {
+            if (hostTypes_.size() < hosts_.size())
+                hostTypes_.push_back(host.isIPv4() ? '4' : host.isIPv6() ? '6' : host.isRegisteredName() ? 'n' : '\0');
+
+            schemeColumn_.push_back(schemeId);
+            hostColumn_.push_back(hostId);
+            portColumn_.push_back(port);
+
+            if (!path.stringify(pathBytes_, pathLength))
+                goto bad;
+
+            pathOffsets_.push_back(pathBytes_.length());
+
+            if (query && !query.stringify(queryBytes_, queryLength))
+                goto bad;
+
+            queryOffsets_.push_back(queryBytes_.length());
+
+            fragmentBytes_.append(fragment);
+            fragmentOffsets_.push_back(fragmentBytes_.length());
+        }
+        catch (...) {
+            goto bad;
+        }
+
+        return true;
+
+    bad:
+        while (hostTypes_.size() < hosts_.size()) {
+            hostIds_.erase(hosts_.back());
+            hosts_.pop_back();
+        }
+
+        schemeColumn_.resize(rows);
+        hostColumn_.resize(rows);
+        portColumn_.resize(rows);
+
+        pathOffsets_.resize(rows + static_cast<std::size_t>(1));
+        pathBytes_.resize(pathLength);
+
+        queryOffsets_.resize(rows + static_cast<std::size_t>(1));
+        queryBytes_.resize(queryLength);
+
+        fragmentOffsets_.resize(rows + static_cast<std::size_t>(1));
+        fragmentBytes_.resize(fragmentLength);
+
+        return false;
+    }
+
+    inline void DatasetWriter::clear() noexcept {
+        schemes_.clear();
+        schemeIds_.clear();
+
+        hosts_.clear();
+        hostTypes_.clear();
+        hostIds_.clear();
+
+        schemeColumn_.clear();
+        hostColumn_.clear();
+        portColumn_.clear();
+
+        pathOffsets_.resize(static_cast<std::size_t>(1));
+        pathBytes_.clear();
+
+        queryOffsets_.resize(static_cast<std::size_t>(1));
+        queryBytes_.clear();
+
+        fragmentOffsets_.resize(static_cast<std::size_t>(1));
+        fragmentBytes_.clear();
+    }
+
+    inline std::size_t DatasetWriter::size() const noexcept {
+        return schemeColumn_.size();
+    }
+
+    inline bool DatasetWriter::empty() const noexcept {
+        return schemeColumn_.empty();
+    }
+
+    // Serialization.
+    inline std::size_t DatasetWriter::serializedLength() const noexcept {
+        std::uint64_t lengths[Dataset::ColumnCount];
+        columnLengths_(lengths);
+
+        std::size_t length = Dataset::HeaderLength + Dataset::DirectoryLength;
+        for (const std::uint64_t &l : lengths)
+            length += static_cast<std::size_t>((l + static_cast<std::uint64_t>(7)) & ~static_cast<std::uint64_t>(7));
+
+        return length;
+    }
+
+    inline bool DatasetWriter::serialize(void *data, const std::size_t &length) const noexcept {
+        if (nullptr == data || length < serializedLength())
+            return false;
+
+        std::uint64_t lengths[Dataset::ColumnCount];
+        columnLengths_(lengths);
+
+        const auto out = static_cast<unsigned char*>(data);
+
+        const auto columnCount = static_cast<std::uint32_t>(Dataset::ColumnCount);
+        const auto rowCount = static_cast<std::uint64_t>(size());
+        const auto schemeCount = static_cast<std::uint64_t>(schemes_.size());
+        const auto hostCount = static_cast<std::uint64_t>(hosts_.size());
+
+        std::memset(out, 0, Dataset::HeaderLength);
+        std::memcpy(out, Dataset::Magic, sizeof(Dataset::Magic));
+        std::memcpy(out + 8, &Dataset::Version, sizeof(Dataset::Version));
+        std::memcpy(out + 12, &columnCount, sizeof(columnCount));
+        std::memcpy(out + 16, &rowCount, sizeof(rowCount));
+        std::memcpy(out + 24, &schemeCount, sizeof(schemeCount));
+        std::memcpy(out + 32, &hostCount, sizeof(hostCount));
+
+        const auto writeDictionary = [](unsigned char *offsets, unsigned char *bytes,
+                                        const std::vector<std::string> &values) -> void {
+            auto offset = static_cast<std::uint64_t>(0);
+            std::memcpy(offsets, &offset, sizeof(offset));
+
+            for (const std::string &value : values) {
+                std::memcpy(bytes + offset, value.data(), value.length());
+                offset += value.length();
+
+                offsets += sizeof(offset);
+                std::memcpy(offsets, &offset, sizeof(offset));
+            }
+        };
+
+        unsigned char *columns[Dataset::ColumnCount];
+
+        auto offset = static_cast<std::uint64_t>(Dataset::HeaderLength + Dataset::DirectoryLength);
+        for (auto c = static_cast<std::size_t>(0); c < Dataset::ColumnCount; ++c) {
+            unsigned char *entry = out + Dataset::HeaderLength + c * static_cast<std::size_t>(16);
+            std::memcpy(entry, &offset, sizeof(offset));
+            std::memcpy(entry + 8, &lengths[c], sizeof(lengths[c]));
+
+            const std::uint64_t padded = (lengths[c] + static_cast<std::uint64_t>(7)) & ~static_cast<std::uint64_t>(7);
+            std::memset(out + offset + lengths[c], 0, static_cast<std::size_t>(padded - lengths[c]));
+
+            columns[c] = out + offset;
+            offset += padded;
+        }
+
+        writeDictionary(columns[Dataset::SchemeDictionaryOffsets], columns[Dataset::SchemeDictionaryBytes], schemes_);
+        std::memcpy(columns[Dataset::SchemeIds], schemeColumn_.data(), lengths[Dataset::SchemeIds]);
+
+        writeDictionary(columns[Dataset::HostDictionaryOffsets], columns[Dataset::HostDictionaryBytes], hosts_);
+        std::memcpy(columns[Dataset::HostTypes], hostTypes_.data(), lengths[Dataset::HostTypes]);
+        std::memcpy(columns[Dataset::HostIds], hostColumn_.data(), lengths[Dataset::HostIds]);
+
+        std::memcpy(columns[Dataset::Ports], portColumn_.data(), lengths[Dataset::Ports]);
+
+        std::memcpy(columns[Dataset::PathOffsets], pathOffsets_.data(), lengths[Dataset::PathOffsets]);
+        std::memcpy(columns[Dataset::PathBytes], pathBytes_.data(), lengths[Dataset::PathBytes]);
+
+        std::memcpy(columns[Dataset::QueryOffsets], queryOffsets_.data(), lengths[Dataset::QueryOffsets]);
+        std::memcpy(columns[Dataset::QueryBytes], queryBytes_.data(), lengths[Dataset::QueryBytes]);
+
+        std::memcpy(columns[Dataset::FragmentOffsets], fragmentOffsets_.data(), lengths[Dataset::FragmentOffsets]);
+        std::memcpy(columns[Dataset::FragmentBytes], fragmentBytes_.data(), lengths[Dataset::FragmentBytes]);
+
+        return true;
+    }
+
+    inline bool DatasetWriter::save(const char *path) const noexcept {
+        try {
+            std::vector<char> data(serializedLength());
+            if (!serialize(data.data(), data.size()))
+                return false;
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+            return static_cast<bool>(file);
+        }
+        catch (...) {
+            return false;
+        }
+    }
+
+    // Destructors.
+    inline DatasetWriter::~DatasetWriter() noexcept = default;
+
+    // DatasetReader.
+    // Utilities.
+    inline void DatasetReader::reset_() noexcept {
+        data_ = nullptr;
+        length_ = static_cast<std::size_t>(0);
+
+        mapping_ = nullptr;
+        storage_.clear();
+        storage_.shrink_to_fit();
+
+        rowCount_ = static_cast<std::size_t>(0);
+        schemeCount_ = static_cast<std::size_t>(0);
+        hostCount_ = static_cast<std::size_t>(0);
+
+        std::fill_n(columns_, Dataset::ColumnCount, nullptr);
+        std::fill_n(columnLengths_, Dataset::ColumnCount, static_cast<std::size_t>(0));
+    }
+
+    inline bool DatasetReader::attach_(const void *data, const std::size_t &length) noexcept {
+        if (nullptr == data || length < (Dataset::HeaderLength + Dataset::DirectoryLength) ||
+            static_cast<std::uintptr_t>(0) != (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t)))
+            return false;
+
+        const auto bytes = static_cast<const unsigned char*>(data);
+        if (0 != std::memcmp(bytes, Dataset::Magic, sizeof(Dataset::Magic)))
+            return false;
+
+        std::uint32_t version;
+        std::uint32_t columnCount;
+        std::uint64_t rowCount;
+        std::uint64_t schemeCount;
+        std::uint64_t hostCount;
+
+        std::memcpy(&version, bytes + 8, sizeof(version));
+        std::memcpy(&columnCount, bytes + 12, sizeof(columnCount));
+        std::memcpy(&rowCount, bytes + 16, sizeof(rowCount));
+        std::memcpy(&schemeCount, bytes + 24, sizeof(schemeCount));
+        std::memcpy(&hostCount, bytes + 32, sizeof(hostCount));
+
+        // Counts are bounded by the length, so that the expected column lengths below cannot overflow.
+        if (Dataset::Version != version || static_cast<std::uint32_t>(Dataset::ColumnCount) != columnCount ||
+            static_cast<std::uint64_t>(length) < rowCount || static_cast<std::uint64_t>(length) < schemeCount ||
+            static_cast<std::uint64_t>(length) < hostCount)
+            return false;
+
+        std::uint64_t expected[Dataset::ColumnCount] = {};
+        expected[Dataset::SchemeDictionaryOffsets] = (schemeCount + static_cast<std::uint64_t>(1)) * sizeof(
+            std::uint64_t);
+        expected[Dataset::SchemeIds] = rowCount * sizeof(std::uint32_t);
+        expected[Dataset::HostDictionaryOffsets] = (hostCount + static_cast<std::uint64_t>(1)) * sizeof(
+            std::uint64_t);
+        expected[Dataset::HostTypes] = hostCount;
+        expected[Dataset::HostIds] = rowCount * sizeof(std::uint32_t);
+        expected[Dataset::Ports] = rowCount * sizeof(Port);
+        expected[Dataset::PathOffsets] = (rowCount + static_cast<std::uint64_t>(1)) * sizeof(std::uint64_t);
+        expected[Dataset::QueryOffsets] = expected[Dataset::PathOffsets];
+        expected[Dataset::FragmentOffsets] = expected[Dataset::PathOffsets];
+
+        for (auto c = static_cast<std::size_t>(0); c < Dataset::ColumnCount; ++c) {
+            std::uint64_t offset;
+            std::uint64_t columnLength;
+
+            const unsigned char *entry = bytes + Dataset::HeaderLength + c * static_cast<std::size_t>(16);
+            std::memcpy(&offset, entry, sizeof(offset));
+            std::memcpy(&columnLength, entry + 8, sizeof(columnLength));
+
+            if (static_cast<std::uint64_t>(0) != (offset % sizeof(std::uint64_t)) ||
+                static_cast<std::uint64_t>(length) < offset ||
+                (static_cast<std::uint64_t>(length) - offset) < columnLength ||
+                (static_cast<std::uint64_t>(0) != expected[c] && expected[c] != columnLength))
+                return false;
+
+            columns_[c] = bytes + offset;
+            columnLengths_[c] = static_cast<std::size_t>(columnLength);
+        }
+
+        data_ = bytes;
+        length_ = length;
+        rowCount_ = static_cast<std::size_t>(rowCount);
+        schemeCount_ = static_cast<std::size_t>(schemeCount);
+        hostCount_ = static_cast<std::size_t>(hostCount);
+
+        return true;
+    }
+
+    template <typename ElementType>
+    inline const ElementType* DatasetReader::column_(const Dataset::Column &column) const noexcept {
+        return reinterpret_cast<const ElementType*>(columns_[column]);
+    }
+
+    inline std::string_view DatasetReader::string_(const Dataset::Column &offsets, const Dataset::Column &bytes,
+                                                   const std::size_t &position,
+                                                   const std::size_t &count) const noexcept {
+        if (position >= count)
+            return {};
+
+        const std::uint64_t beg = column_<std::uint64_t>(offsets)[position];
+        const std::uint64_t end = column_<std::uint64_t>(offsets)[position + static_cast<std::size_t>(1)];
+
+        if (beg > end || static_cast<std::uint64_t>(columnLengths_[bytes]) < end)
+            return {};
+
+        return {reinterpret_cast<const char*>(columns_[bytes]) + beg, static_cast<std::size_t>(end - beg)};
+    }
+
+    // Constructors.
+    inline DatasetReader::DatasetReader() noexcept = default;
+
+    inline DatasetReader::DatasetReader(DatasetReader &&reader) noexcept {
+        *this = std::move(reader);
+    }
+
+    // Opening.
+    inline bool DatasetReader::open(const char *path) noexcept {
+        close();
+
+#ifdef CRONZ_URL_DATASET_MMAP
+        const int fd = ::open(path, O_RDONLY);
+        if (0 > fd)
+            return false;
+
+        struct stat status{};
+        if (0 != ::fstat(fd, &status) || static_cast<off_t>(0) >= status.st_size) {
+            ::close(fd);
+            return false;
+        }
+
+        const auto length = static_cast<std::size_t>(status.st_size);
+        void *mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (MAP_FAILED == mapping)
+            return false;
+
+        if (!attach_(mapping, length)) {
+            ::munmap(mapping, length);
+            reset_();
+            return false;
+        }
+
+        mapping_ = mapping;
+        return true;
+#else // CRONZ_URL_DATASET_MMAP
+        try {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file)
+                return false;
+
+            const auto length = static_cast<std::size_t>(file.tellg());
+            storage_.resize((length + sizeof(std::uint64_t) - static_cast<std::size_t>(1)) / sizeof(std::uint64_t));
+
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(storage_.data()), static_cast<std::streamsize>(length));
+
+            if (!file || !attach_(storage_.data(), length)) {
+                reset_();
+                return false;
+            }
+        }
+        catch (...) {
+            reset_();
+            return false;
+        }
+
+        return true;
+#endif // CRONZ_URL_DATASET_MMAP
+    }
+
+    inline bool DatasetReader::attach(const void *data, const std::size_t &length) noexcept {
+        close();
+
+        if (attach_(data, length))
+            return true;
+
+        reset_();
+        return false;
+    }
+
+    inline void DatasetReader::close() noexcept {
+#ifdef CRONZ_URL_DATASET_MMAP
+        if (nullptr != mapping_)
+            ::munmap(mapping_, length_);
+#endif // CRONZ_URL_DATASET_MMAP
+
+        reset_();
+    }
+
+    // Rows.
+    inline std::size_t DatasetReader::size() const noexcept {
+        return rowCount_;
+    }
+
+    inline bool DatasetReader::empty() const noexcept {
+        return nullptr == data_;
+    }
+
+    inline std::string_view DatasetReader::scheme(const std::size_t &position) const noexcept {
+        if (position >= rowCount_)
+            return {};
+
+        return schemeAt(column_<std::uint32_t>(Dataset::SchemeIds)[position]);
+    }
+
+    inline std::string_view DatasetReader::host(const std::size_t &position) const noexcept {
+        if (position >= rowCount_)
+            return {};
+
+        return hostAt(column_<std::uint32_t>(Dataset::HostIds)[position]);
+    }
+
+    inline Port DatasetReader::port(const std::size_t &position) const noexcept {
+        return (position < rowCount_) ? column_<Port>(Dataset::Ports)[position] : static_cast<Port>(0);
+    }
+
+    inline std::string_view DatasetReader::path(const std::size_t &position) const noexcept {
+        return string_(Dataset::PathOffsets, Dataset::PathBytes, position, rowCount_);
+    }
+
+    inline std::string_view DatasetReader::query(const std::size_t &position) const noexcept {
+        return string_(Dataset::QueryOffsets, Dataset::QueryBytes, position, rowCount_);
+    }
+
+    inline std::string_view DatasetReader::fragment(const std::size_t &position) const noexcept {
+        return string_(Dataset::FragmentOffsets, Dataset::FragmentBytes, position, rowCount_);
+    }
+
+    // Columns.
+    inline std::span<const std::uint32_t> DatasetReader::schemeIds() const noexcept {
+        return {column_<std::uint32_t>(Dataset::SchemeIds), rowCount_};
+    }
+
+    inline std::span<const std::uint32_t> DatasetReader::hostIds() const noexcept {
+        return {column_<std::uint32_t>(Dataset::HostIds), rowCount_};
+    }
+
+    inline std::span<const Port> DatasetReader::ports() const noexcept {
+        return {column_<Port>(Dataset::Ports), rowCount_};
+    }
+
+    inline std::size_t DatasetReader::schemeCount() const noexcept {
+        return schemeCount_;
+    }
+
+    inline std::string_view DatasetReader::schemeAt(const std::size_t &id) const noexcept {
+        return string_(Dataset::SchemeDictionaryOffsets, Dataset::SchemeDictionaryBytes, id, schemeCount_);
+    }
+
+    inline std::size_t DatasetReader::hostCount() const noexcept {
+        return hostCount_;
+    }
+
+    inline std::string_view DatasetReader::hostAt(const std::size_t &id) const noexcept {
+        return string_(Dataset::HostDictionaryOffsets, Dataset::HostDictionaryBytes, id, hostCount_);
+    }
+
+    inline char DatasetReader::hostTypeAt(const std::size_t &id) const noexcept {
+        return (id < hostCount_) ? static_cast<char>(columns_[Dataset::HostTypes][id]) : '\0';
+    }
+
+    // Operators.
+    inline DatasetReader::operator bool() const noexcept {
+        return !empty();
+    }
+
+    inline DatasetReader& DatasetReader::operator=(DatasetReader &&reader) noexcept {
+        if (this != &reader) {
+            close();
+
+            data_ = reader.data_;
+            length_ = reader.length_;
+            mapping_ = reader.mapping_;
+            storage_ = std::move(reader.storage_);
+            rowCount_ = reader.rowCount_;
+            schemeCount_ = reader.schemeCount_;
+            hostCount_ = reader.hostCount_;
+            std::copy_n(reader.columns_, Dataset::ColumnCount, columns_);
+            std::copy_n(reader.columnLengths_, Dataset::ColumnCount, columnLengths_);
+
+            reader.reset_();
+        }
+
+        return *this;
+    }
+
+    // Destructors.
+    inline DatasetReader::~DatasetReader() noexcept {
+        close();
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_URL_IMPL_DATASET_IPP
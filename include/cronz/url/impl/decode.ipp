@@ -25,15 +25,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         auto l = static_cast<std::size_t>(0);
         auto i = static_cast<std::size_t>(0);
         for (; i < length; ++i) {
-            if ('%' == encoded[i])
+            if ('%' == encoded[i]) {
+                if ((i + static_cast<std::size_t>(2)) >= length ||
+                    !Crypto::IsHexDigit(encoded[i + static_cast<std::size_t>(1)]) ||
+                    !Crypto::IsHexDigit(encoded[i + static_cast<std::size_t>(2)]))
+                    return std::numeric_limits<std::size_t>::max();
+
                 i += static_cast<std::size_t>(2);
+            }
 
             ++l;
         }
 
-        if (i > length)
-            return std::numeric_limits<std::size_t>::max();
-
         return l;
     }
 
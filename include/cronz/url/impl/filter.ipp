@@ -0,0 +1,285 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_IMPL_FILTER_IPP
+#define CRONZ_URL_IMPL_FILTER_IPP 1
+
+#include "cronz/url/filter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Utilities.
+    inline void BloomFilter::reset_() noexcept {
+        storage_.clear();
+        storage_.shrink_to_fit();
+
+        words_ = nullptr;
+        blockCount_ = static_cast<std::size_t>(0);
+        hashCount_ = static_cast<std::uint32_t>(0);
+        seed_ = static_cast<std::uint64_t>(0);
+    }
+
+    inline std::uint64_t* BloomFilter::block_(const std::uint64_t &hash) const noexcept {
+        // Multiply-shift range reduction of the upper half, so that the lower half stays for the bit positions.
+        const std::uint64_t index = ((hash >> 32) * static_cast<std::uint64_t>(blockCount_)) >> 32;
+        return words_ + (index * BlockWords);
+    }
+
+    inline void BloomFilter::masks_(const std::uint64_t &hash, std::uint64_t (&masks)[BlockWords]) const noexcept {
+        std::fill_n(masks, BlockWords, static_cast<std::uint64_t>(0));
+
+        // Double hashing over the lower half; positions are taken from the upper 9 bits of each 32-bit step.
+        const auto h1 = static_cast<std::uint32_t>(hash);
+        const auto h2 = static_cast<std::uint32_t>(Internal::HashMix(hash)) | static_cast<std::uint32_t>(1);
+        for (auto i = static_cast<std::uint32_t>(0); i < hashCount_; ++i) {
+            const std::uint32_t bit = (h1 + i * h2) >> 23;
+            masks[bit >> 6] |= static_cast<std::uint64_t>(1) << (bit & static_cast<std::uint32_t>(63));
+        }
+    }
+
+    // Constructors.
+    inline BloomFilter::BloomFilter() noexcept = default;
+
+    inline BloomFilter::BloomFilter(const std::size_t &expectedCount, const double &falsePositiveRate,
+                                    const std::uint64_t &seed) noexcept {
+        [[maybe_unused]] const bool _ = create(expectedCount, falsePositiveRate, seed);
+    }
+
+    inline BloomFilter::BloomFilter(BloomFilter &&filter) noexcept : storage_(std::move(filter.storage_)),
+                                                                     words_(filter.words_),
+                                                                     blockCount_(filter.blockCount_),
+                                                                     hashCount_(filter.hashCount_),
+                                                                     seed_(filter.seed_) {
+        filter.reset_();
+    }
+
+    // Initialization.
+    inline bool BloomFilter::create(const std::size_t &expectedCount, const double &falsePositiveRate,
+                                    const std::uint64_t &seed) noexcept {
+        reset_();
+
+        if (static_cast<std::size_t>(0) == expectedCount || !(0.0 < falsePositiveRate && falsePositiveRate < 1.0))
+            return false;
+
+        static const double ln2 = std::log(2.0);
+
+        const double bits = std::ceil(-static_cast<double>(expectedCount) * std::log(falsePositiveRate) / (ln2 * ln2));
+        const double blocks = std::ceil(bits / static_cast<double>(BlockBits));
+
+        // Block indices are reduced from 32 bits.
+        if (blocks > static_cast<double>(UINT32_MAX))
+            return false;
+
+        const auto blockCount = std::max(static_cast<std::size_t>(blocks), static_cast<std::size_t>(1));
+        const double hashes = std::round(ln2 * static_cast<double>(blockCount * BlockBits) / static_cast<double>(
+            expectedCount));
+
+        try {
+            storage_.assign(blockCount * BlockWords, static_cast<std::uint64_t>(0));
+        }
+        catch (...) {
+            reset_();
+            return false;
+        }
+
+        words_ = storage_.data();
+        blockCount_ = blockCount;
+        hashCount_ = static_cast<std::uint32_t>(std::clamp(hashes, 1.0, 16.0));
+        seed_ = seed;
+
+        return true;
+    }
+
+    inline bool BloomFilter::attach(void *data, const std::size_t &length) noexcept {
+        reset_();
+
+        if (nullptr == data || length < HeaderLength ||
+            static_cast<std::uintptr_t>(0) != (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t)))
+            return false;
+
+        const auto header = static_cast<const unsigned char*>(data);
+        if (0 != std::memcmp(header, Magic, sizeof(Magic)))
+            return false;
+
+        std::uint32_t version;
+        std::uint32_t hashCount;
+        std::uint64_t blockCount;
+        std::uint64_t seed;
+
+        std::memcpy(&version, header + 8, sizeof(version));
+        std::memcpy(&hashCount, header + 12, sizeof(hashCount));
+        std::memcpy(&blockCount, header + 16, sizeof(blockCount));
+        std::memcpy(&seed, header + 24, sizeof(seed));
+
+        if (Version != version || static_cast<std::uint32_t>(0) == hashCount ||
+            static_cast<std::uint32_t>(16) < hashCount || static_cast<std::uint64_t>(0) == blockCount ||
+            static_cast<std::uint64_t>(UINT32_MAX) < blockCount ||
+            ((length - HeaderLength) / (BlockWords * sizeof(std::uint64_t))) < blockCount)
+            return false;
+
+        words_ = reinterpret_cast<std::uint64_t*>(static_cast<unsigned char*>(data) + HeaderLength);
+        blockCount_ = static_cast<std::size_t>(blockCount);
+        hashCount_ = hashCount;
+        seed_ = seed;
+
+        return true;
+    }
+
+    inline void BloomFilter::clear() noexcept {
+        if (nullptr != words_)
+            std::fill_n(words_, blockCount_ * BlockWords, static_cast<std::uint64_t>(0));
+    }
+
+    // Membership.
+    inline bool BloomFilter::insert(const std::uint64_t &hash) noexcept {
+        if (nullptr == words_)
+            return false;
+
+        std::uint64_t masks[BlockWords];
+        masks_(hash, masks);
+
+        std::uint64_t *block = block_(hash);
+
+        bool present = true;
+        for (auto i = static_cast<std::size_t>(0); i < BlockWords; ++i) {
+            if (static_cast<std::uint64_t>(0) == masks[i])
+                continue;
+
+            std::atomic_ref word(block[i]);
+            if (masks[i] != (word.load(std::memory_order_relaxed) & masks[i]))
+                present = (masks[i] == (word.fetch_or(masks[i], std::memory_order_relaxed) & masks[i])) && present;
+        }
+
+        return present;
+    }
+
+    inline bool BloomFilter::insert(const URL &url) noexcept {
+        return insert(url.hash(seed_));
+    }
+
+    inline bool BloomFilter::insert(const Host &host) noexcept {
+        return insert(host.hash(seed_));
+    }
+
+    inline bool BloomFilter::contains(const std::uint64_t &hash) const noexcept {
+        if (nullptr == words_)
+            return false;
+
+        std::uint64_t masks[BlockWords];
+        masks_(hash, masks);
+
+        std::uint64_t *block = block_(hash);
+
+        auto missing = static_cast<std::uint64_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < BlockWords; ++i)
+            missing |= masks[i] & ~std::atomic_ref(block[i]).load(std::memory_order_relaxed);
+
+        return static_cast<std::uint64_t>(0) == missing;
+    }
+
+    inline bool BloomFilter::contains(const URL &url) const noexcept {
+        return contains(url.hash(seed_));
+    }
+
+    inline bool BloomFilter::contains(const Host &host) const noexcept {
+        return contains(host.hash(seed_));
+    }
+
+    // Serialization.
+    inline std::size_t BloomFilter::serializedLength() const noexcept {
+        if (nullptr == words_)
+            return static_cast<std::size_t>(0);
+
+        return HeaderLength + (blockCount_ * BlockWords * sizeof(std::uint64_t));
+    }
+
+    inline bool BloomFilter::serialize(void *data, const std::size_t &length) const noexcept {
+        const std::size_t len = serializedLength();
+        if (nullptr == data || static_cast<std::size_t>(0) == len || length < len)
+            return false;
+
+        const auto blockCount = static_cast<std::uint64_t>(blockCount_);
+
+        const auto header = static_cast<unsigned char*>(data);
+        std::memset(header, 0, HeaderLength);
+        std::memcpy(header, Magic, sizeof(Magic));
+        std::memcpy(header + 8, &Version, sizeof(Version));
+        std::memcpy(header + 12, &hashCount_, sizeof(hashCount_));
+        std::memcpy(header + 16, &blockCount, sizeof(blockCount));
+        std::memcpy(header + 24, &seed_, sizeof(seed_));
+
+        std::memcpy(header + HeaderLength, words_, len - HeaderLength);
+
+        return true;
+    }
+
+    inline bool BloomFilter::save(const char *path) const noexcept {
+        try {
+            std::vector<char> data(serializedLength());
+            if (!serialize(data.data(), data.size()))
+                return false;
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+            return static_cast<bool>(file);
+        }
+        catch (...) {
+            return false;
+        }
+    }
+
+    // Properties.
+    inline std::size_t BloomFilter::blockCount() const noexcept {
+        return blockCount_;
+    }
+
+    inline std::uint32_t BloomFilter::hashCount() const noexcept {
+        return hashCount_;
+    }
+
+    inline std::uint64_t BloomFilter::seed() const noexcept {
+        return seed_;
+    }
+
+    inline bool BloomFilter::empty() const noexcept {
+        return nullptr == words_;
+    }
+
+    // Operators.
+    inline BloomFilter::operator bool() const noexcept {
+        return !empty();
+    }
+
+    inline BloomFilter& BloomFilter::operator=(BloomFilter &&filter) noexcept {
+        if (this != &filter) {
+            storage_ = std::move(filter.storage_);
+            words_ = filter.words_;
+            blockCount_ = filter.blockCount_;
+            hashCount_ = filter.hashCount_;
+            seed_ = filter.seed_;
+
+            filter.reset_();
+        }
+
+        return *this;
+    }
+
+    // Destructors.
+    inline BloomFilter::~BloomFilter() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_URL_IMPL_FILTER_IPP
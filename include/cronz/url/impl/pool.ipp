@@ -0,0 +1,145 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_IMPL_POOL_IPP
+#define CRONZ_URL_IMPL_POOL_IPP 1
+
+#include "cronz/url/pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Handle.
+    inline URLPool::Handle::Handle(URLPool *pool, std::unique_ptr<URL> url) noexcept
+        : pool_(pool), url_(std::move(url)) {
+    }
+
+    inline URLPool::Handle::Handle() noexcept = default;
+
+    inline URLPool::Handle::Handle(Handle &&handle) noexcept
+        : pool_(std::exchange(handle.pool_, nullptr)), url_(std::move(handle.url_)) {
+    }
+
+    inline URL* URLPool::Handle::get() const noexcept {
+        return url_.get();
+    }
+
+    inline void URLPool::Handle::reset() noexcept {
+        if (nullptr != pool_ && nullptr != url_)
+            pool_->release_(std::move(url_));
+
+        url_.reset();
+        pool_ = nullptr;
+    }
+
+    inline URLPool::Handle& URLPool::Handle::operator=(Handle &&handle) noexcept {
+        if (this != &handle) {
+            reset();
+
+            pool_ = std::exchange(handle.pool_, nullptr);
+            url_ = std::move(handle.url_);
+        }
+
+        return *this;
+    }
+
+    inline URL& URLPool::Handle::operator*() const noexcept {
+        return *url_;
+    }
+
+    inline URL* URLPool::Handle::operator->() const noexcept {
+        return url_.get();
+    }
+
+    inline URLPool::Handle::operator bool() const noexcept {
+        return nullptr != url_;
+    }
+
+    inline URLPool::Handle::~Handle() noexcept {
+        reset();
+    }
+
+    // Utilities.
+    inline void URLPool::release_(std::unique_ptr<URL> url) noexcept {
+        if (urls_.size() >= capacity_)
+            return;
+
+        url->clear();
+
+        try {
+            urls_.push_back(std::move(url));
+        }
+        catch (...) {
+        }
+    }
+
+    // Constructors.
+    inline URLPool::URLPool(const std::size_t &capacity) noexcept
+        : capacity_(capacity) {
+    }
+
+    // Pooling.
+    inline URLPool::Handle URLPool::acquire() noexcept {
+        if (!urls_.empty()) {
+            std::unique_ptr<URL> url = std::move(urls_.back());
+            urls_.pop_back();
+
+            return {this, std::move(url)};
+        }
+
+        try {
+            return {this, std::make_unique<URL>()};
+        }
+        catch (...) {
+            return {};
+        }
+    }
+
+    inline bool URLPool::reserve(const std::size_t &count) noexcept {
+        const std::size_t target = std::min(count, capacity_);
+
+        try {
+            urls_.reserve(capacity_);
+
+            while (urls_.size() < target)
+                urls_.push_back(std::make_unique<URL>());
+        }
+        catch (...) {
+            return false;
+        }
+
+        return true;
+    }
+
+    inline void URLPool::clear() noexcept {
+        urls_.clear();
+    }
+
+    inline URLPool& URLPool::Local() noexcept {
+        thread_local URLPool pool;
+        return pool;
+    }
+
+    // Properties.
+    inline std::size_t URLPool::size() const noexcept {
+        return urls_.size();
+    }
+
+    inline std::size_t URLPool::capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Destructors.
+    inline URLPool::~URLPool() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_URL_IMPL_POOL_IPP
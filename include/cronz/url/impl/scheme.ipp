@@ -13,7 +13,29 @@
 
 #include "cronz/url/scheme.hpp"
 
+#include <cstring>
+#include <utility>
+
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Utilities.
+    inline bool Scheme::validate_(const char *value, const std::size_t &length) noexcept {
+        if (!(('a' <= value[0] && value[0] <= 'z') || ('A' <= value[0] && value[0] <= 'Z')))
+            return false;
+
+        for (auto i = static_cast<std::size_t>(1); i < length; ++i) {
+            if (const char c = value[i]; !(('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') ||
+                                           '+' == c || '-' == c || '.' == c))
+                return false;
+        }
+
+        return true;
+    }
+
+    inline void Scheme::lower_() noexcept {
+        for (char &c : value_)
+            c = ('A' <= c && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
     // Constructors.
     inline Scheme::Scheme() noexcept = default;
 
@@ -36,37 +58,45 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
             return true;
         }
 
-        std::string temp;
+        // Validated before assignment, so that the existing value (and its capacity) is kept upon failure.
+        if (!validate_(value, length))
+            return false;
+
         try {
-            temp.resize(length);
-            memcpy(temp.data(), value, length);
+            value_.assign(value, length);
         }
         catch (...) {
             return false;
         }
 
-        for (auto &c : temp) {
-            if (('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || '+' == c || '-' == c || '.' == c)
-                continue;
+        lower_();
 
-            if ('A' <= c && c <= 'Z')
-                c += ('a' - 'A');
-            else
-                return false;
+        return true;
+    }
+
+    inline bool Scheme::setValue(const std::string &value) noexcept {
+        return setValue(value.data(), value.length());
+    }
+
+    inline bool Scheme::setValue(const std::string_view &value) noexcept {
+        return setValue(value.data(), value.length());
+    }
+
+    inline bool Scheme::setValue(std::string &&value) noexcept {
+        if (value.empty()) {
+            clear();
+            return true;
         }
 
-        if (!('a' <= temp[0] && temp[0] <= 'z'))
+        if (!validate_(value.data(), value.length()))
             return false;
 
-        value_.swap(temp);
+        value_ = std::move(value);
+        lower_();
 
         return true;
     }
 
-    inline bool Scheme::setValue(const std::string &value) noexcept {
-        return setValue(value.data(), value.length());
-    }
-
     // Properties.
     inline std::size_t Scheme::length() const noexcept {
         return value_.length();
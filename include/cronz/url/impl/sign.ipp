@@ -0,0 +1,139 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_IMPL_SIGN_IPP
+#define CRONZ_URL_IMPL_SIGN_IPP 1
+
+#include "cronz/url/sign.hpp"
+#include "cronz/crypto/base64.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+CRONZ_BEGIN_MAIN_INTERNAL_NAMESPACE
+    /**
+     * @brief Appends a count or a length to a message, as a 32-bit big-endian integer.
+     * @param[in,out] hmac Message.
+     * @param[in] count Count or length.
+     */
+    inline void SignCount(Crypto::HMACSHA256 &hmac, const std::size_t &count) noexcept {
+        const auto value = static_cast<std::uint32_t>(count);
+        const std::array<std::byte, static_cast<std::size_t>(4)> bytes = {
+                static_cast<std::byte>(value >> 24), static_cast<std::byte>(value >> 16),
+                static_cast<std::byte>(value >> 8), static_cast<std::byte>(value)
+        };
+
+        hmac.update(bytes);
+    }
+
+    /**
+     * @brief Appends a length-prefixed byte sequence to a message.
+     * @param[in,out] hmac Message.
+     * @param[in] data Bytes.
+     * @param[in] length Byte length of `data`.
+     */
+    inline void SignBytes(Crypto::HMACSHA256 &hmac, const char *data, const std::size_t &length) noexcept {
+        SignCount(hmac, length);
+        hmac.update(std::as_bytes(std::span(data, length)));
+    }
+CRONZ_END_MAIN_INTERNAL_NAMESPACE
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    inline URLSigner::URLSigner(const std::span<const std::byte> &key, std::string parameter)
+        : hmac_(key), parameter_(std::move(parameter)) {
+    }
+
+    inline bool URLSigner::addField(const std::string_view &name) noexcept {
+        if (name == parameter_)
+            return false;
+
+        if (std::find(fields_.cbegin(), fields_.cend(), name) != fields_.cend())
+            return true;
+
+        try {
+            fields_.emplace_back(name);
+        }
+        catch (...) {
+            return false;
+        }
+
+        return true;
+    }
+
+    inline const std::vector<std::string>& URLSigner::fields() const noexcept {
+        return fields_;
+    }
+
+    inline const std::string& URLSigner::parameter() const noexcept {
+        return parameter_;
+    }
+
+    inline Crypto::HMACSHA256::Digest URLSigner::digest(const URL &url) const noexcept {
+        // The keyed states are copied, so that the signer is never modified.
+        Crypto::HMACSHA256 hmac = hmac_;
+
+        Internal::SignCount(hmac, url.path.count());
+        for (auto it = url.path.cbegin(); it != url.path.cend(); ++it)
+            Internal::SignBytes(hmac, it->data(), it->length());
+
+        for (const std::string &name : fields_) {
+            Internal::SignBytes(hmac, name.data(), name.length());
+
+            const QueryField<false> *field = url.query.get(name);
+            if (nullptr == field) {
+                Internal::SignCount(hmac, static_cast<std::size_t>(0));
+                continue;
+            }
+
+            Internal::SignCount(hmac, field->count());
+            for (auto i = static_cast<std::size_t>(0); i < field->count(); ++i) {
+                const char *value;
+                std::size_t length;
+                field->getValueAt(i, value, length);
+
+                Internal::SignBytes(hmac, value, length);
+            }
+        }
+
+        return hmac.finalize();
+    }
+
+    inline URLSigner::Signature URLSigner::signature(const URL &url) const noexcept {
+        const Crypto::HMACSHA256::Digest mac = digest(url);
+
+        Signature encoded;
+        std::size_t written;
+        [[maybe_unused]] const bool _ = Crypto::Base64Encode<Crypto::Base64AlphabetSafe, false>(
+            std::as_bytes(std::span(mac)), std::span(encoded), written);
+
+        return encoded;
+    }
+
+    inline bool URLSigner::sign(URL &url) const noexcept {
+        const Signature encoded = signature(url);
+
+        QueryField<false> *field = url.query.create(parameter_);
+        return (nullptr != field) && field->setValue(std::string_view(encoded.data(), encoded.size()));
+    }
+
+    inline bool URLSigner::verify(const URL &url) const noexcept {
+        const QueryField<false> *field = url.query.get(parameter_);
+        if ((nullptr == field) || field->isArray())
+            return false;
+
+        const Signature expected = signature(url);
+        return Crypto::ConstantTimeEqual(std::as_bytes(std::span(expected)),
+                                         std::as_bytes(std::span(field->value().data(), field->value().length())));
+    }
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_URL_IMPL_SIGN_IPP
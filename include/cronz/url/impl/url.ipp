@@ -12,6 +12,7 @@
 #define CRONZ_URL_IMPL_URL_IPP 1
 
 #include "cronz/url/url.hpp"
+#include "cronz/internal/varint.hpp"
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     // Constructors.
@@ -69,22 +70,26 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         if (!path.parse(beg, next - beg))
             return false;
 
-        beg = ((end == next) ? (end) : (next + static_cast<std::size_t>(1)));
+        // Separator is left in place, so that a fragment is not taken for a query.
+        beg = next;
         return true;
     }
 
     inline bool URL::parseQuery_(const char *&beg, const char *end) noexcept {
-        const char *next = std::ranges::find(beg, end, '#');
+        if (beg >= end || '?' != *beg)
+            return true;
+
+        const char *next = std::ranges::find(++beg, end, '#');
 
         if (!query.parse(beg, next - beg))
             return false;
 
-        beg = ((end == next) ? end : (next + static_cast<std::size_t>(1)));
+        beg = next;
         return true;
     }
 
     inline bool URL::parseFragment_(const char *&beg, const char *end) noexcept {
-        if (beg >= end)
+        if (beg >= end || '#' != *beg++)
             return true;
 
         try {
@@ -124,6 +129,15 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return parse(str.c_str(), str.length());
     }
 
+    inline bool URL::reparse(const char *str, const std::size_t &length) noexcept {
+        clear();
+        return parse(str, length);
+    }
+
+    inline bool URL::reparse(const std::string &str) noexcept {
+        return reparse(str.c_str(), str.length());
+    }
+
     inline std::string URL::stringify() const noexcept {
         std::string str;
         if (!stringify(str))
@@ -188,6 +202,184 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
     }
 
+    // Serialization.
+    inline void URL::measure_(std::size_t &entriesLength, std::size_t &bytesLength) const noexcept {
+        entriesLength = static_cast<std::size_t>(0);
+        bytesLength = static_cast<std::size_t>(0);
+
+        const auto add = [&](const std::size_t &length) -> void {
+            entriesLength += Internal::VarintLength(static_cast<std::uint64_t>(length) << 1);
+            bytesLength += length;
+        };
+
+        add(scheme.value_.length());
+        add(authority.userInformation.getUser().length());
+        add(authority.userInformation.getPassword().length());
+        add(authority.host.value_.length());
+        add(fragment.length());
+
+        entriesLength += Internal::VarintLength(path.paths_.size());
+        for (const std::string &segment : path.paths_)
+            add(segment.length());
+
+        entriesLength += Internal::VarintLength(query.fields_.size());
+        for (const auto &field : query.fields_) {
+            add(field.name_.length());
+
+            entriesLength += Internal::VarintLength(field.indices_.size());
+            bytesLength += field.indices_.size() - static_cast<std::size_t>(1);
+
+            std::size_t valueLength;
+            const char *value;
+            for (auto i = static_cast<std::size_t>(0); i < field.indices_.size(); ++i) {
+                field.getValueAt(i, value, valueLength);
+                add(valueLength);
+            }
+        }
+    }
+
+    inline std::size_t URL::serializedLength() const noexcept {
+        std::size_t entriesLength;
+        std::size_t bytesLength;
+        measure_(entriesLength, bytesLength);
+
+        return static_cast<std::size_t>(2) + Internal::VarintLength(authority.port) + Internal::VarintLength(
+            entriesLength) + entriesLength + bytesLength;
+    }
+
+    inline bool URL::serialize(void *data, const std::size_t &length) const noexcept {
+        std::size_t entriesLength;
+        std::size_t bytesLength;
+        measure_(entriesLength, bytesLength);
+
+        if (nullptr == data || length < (static_cast<std::size_t>(2) + Internal::VarintLength(authority.port) +
+                                         Internal::VarintLength(entriesLength) + entriesLength + bytesLength))
+            return false;
+
+        auto entry = static_cast<unsigned char*>(data);
+        *entry++ = URLView::Version;
+        *entry++ = static_cast<unsigned char>(authority.host.type_);
+        entry += Internal::EncodeVarint(authority.port, entry);
+        entry += Internal::EncodeVarint(entriesLength, entry);
+
+        auto bytes = reinterpret_cast<char*>(entry + entriesLength);
+
+        const auto add = [&](const char *str, const std::size_t &len, const bool &encodable) -> void {
+            const bool requiresEncoding = encodable && CalculateEncodedLength(str, len) != len;
+            entry += Internal::EncodeVarint((static_cast<std::uint64_t>(len) << 1) | requiresEncoding, entry);
+
+            memcpy(bytes, str, len);
+            bytes += len;
+        };
+
+        const std::string &user = authority.userInformation.getUser();
+        const std::string &password = authority.userInformation.getPassword();
+
+        add(scheme.value_.data(), scheme.value_.length(), false);
+        add(user.data(), user.length(), true);
+        add(password.data(), password.length(), true);
+        add(authority.host.value_.data(), authority.host.value_.length(), false);
+        add(fragment.data(), fragment.length(), false);
+
+        entry += Internal::EncodeVarint(path.paths_.size(), entry);
+        for (const std::string &segment : path.paths_)
+            add(segment.data(), segment.length(), true);
+
+        entry += Internal::EncodeVarint(query.fields_.size(), entry);
+        for (const auto &field : query.fields_) {
+            add(field.name_.data(), field.name_.length(), true);
+            entry += Internal::EncodeVarint(field.indices_.size(), entry);
+
+            std::size_t valueLength;
+            const char *value;
+            for (auto i = static_cast<std::size_t>(0); i < field.indices_.size(); ++i) {
+                if (static_cast<std::size_t>(0) != i)
+                    *bytes++ = ',';
+
+                field.getValueAt(i, value, valueLength);
+                add(value, valueLength, true);
+            }
+        }
+
+        return true;
+    }
+
+    inline bool URL::serialize(std::string &str) const noexcept {
+        try {
+            str.resize(serializedLength());
+        }
+        catch (...) {
+            return false;
+        }
+
+        return serialize(str.data(), str.length());
+    }
+
+    inline bool URL::deserialize(const void *data, const std::size_t &length) noexcept {
+        if (URLView view; view.parse(data, length))
+            return deserialize(view);
+
+        clear();
+        return false;
+    }
+
+    inline bool URL::deserialize(const URLView &view) noexcept {
+        if (view.empty()) {
+            clear();
+            return false;
+        }
+
+        try {
+            scheme.value_.assign(view.scheme().value);
+
+            if (!authority.userInformation.setUser(view.user().value.data(), view.user().value.length()) ||
+                !authority.userInformation.setPassword(view.password().value.data(), view.password().value.length()))
+                goto bad;
+
+            authority.host.value_.assign(view.host().value);
+            authority.host.type_ = view.hostType_;
+            authority.port = view.port_;
+
+            path.paths_.resize(view.pathCount());
+            for (auto i = static_cast<std::size_t>(0); i < view.pathCount(); ++i)
+                path.paths_[i].assign(view.pathAt(i).value);
+
+            const std::size_t fieldCount = view.queryCount();
+            while (query.fields_.size() > fieldCount) {
+                query.release_(query.fields_.back());
+                query.fields_.pop_back();
+            }
+
+            for (auto i = static_cast<std::size_t>(0); i < fieldCount; ++i) {
+                if (i < query.fields_.size())
+                    query.fields_[i].name_.assign(view.queryNameAt(i).value);
+                else
+                    query.fields_.emplace_back(std::string(view.queryNameAt(i).value));
+
+                auto &field = query.fields_[i];
+                field.value_.assign(view.queryValue(i));
+
+                const std::size_t valueCount = view.queryValueCount(i);
+                field.indices_.resize(valueCount);
+                field.indices_[0] = static_cast<std::size_t>(0);
+                for (auto j = static_cast<std::size_t>(1); j < valueCount; ++j)
+                    field.indices_[j] = field.indices_[j - static_cast<std::size_t>(1)] + view.queryValueAt(
+                        i, j - static_cast<std::size_t>(1)).value.length() + static_cast<std::size_t>(1);
+            }
+
+            fragment.assign(view.fragment().value);
+        }
+        catch (...) {
+            goto bad;
+        }
+
+        return true;
+
+    bad:
+        clear();
+        return false;
+    }
+
     // Instance-based utility functions.
     inline std::size_t URL::length() const noexcept {
         auto len = static_cast<std::size_t>(0);
@@ -227,6 +419,23 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         fragment.clear();
     }
 
+    inline std::uint64_t URL::hash(const std::uint64_t &seed) const noexcept {
+        const std::string &s = scheme.getValue();
+        const std::string &user = authority.userInformation.getUser();
+        const std::string &password = authority.userInformation.getPassword();
+        const Port port = (GetSchemePort(scheme) == authority.port) ? static_cast<Port>(0) : authority.port;
+
+        std::uint64_t h = Internal::HashBytes(s.data(), s.length(), seed);
+        h = Internal::HashCombine(h, Internal::HashBytes(user.data(), user.length(), seed));
+        h = Internal::HashCombine(h, Internal::HashBytes(password.data(), password.length(), seed));
+        h = Internal::HashCombine(h, authority.host.hash(seed));
+        h = Internal::HashCombine(h, static_cast<std::uint64_t>(port));
+        h = Internal::HashCombine(h, path.hash(seed));
+        h = Internal::HashCombine(h, query.hash(seed));
+
+        return h;
+    }
+
     // Destructors.
     inline URL::~URL() noexcept = default;
 
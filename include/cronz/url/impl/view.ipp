@@ -0,0 +1,247 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_IMPL_VIEW_IPP
+#define CRONZ_URL_IMPL_VIEW_IPP 1
+
+#include "cronz/url/view.hpp"
+#include "cronz/internal/varint.hpp"
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Utilities.
+    inline const URLView::Segment& URLView::segment_(const std::size_t &slot) const noexcept {
+        return (slot < segments_.size()) ? segments_[slot] : EmptySegment;
+    }
+
+    // Constructors.
+    inline URLView::URLView() noexcept = default;
+
+    inline URLView::URLView(const void *data, const std::size_t &length) noexcept {
+        [[maybe_unused]] const bool _ = parse(data, length);
+    }
+
+    // Parsing.
+    inline bool URLView::parse(const void *data, const std::size_t &length) noexcept {
+        clear();
+
+        if (nullptr == data || static_cast<std::size_t>(2) > length)
+            return false;
+
+        const auto bytes = static_cast<const unsigned char*>(data);
+        const unsigned char *const end = bytes + length;
+        const unsigned char *beg = bytes;
+
+        std::uint64_t value;
+        const unsigned char *entriesEnd = end;
+        auto cursor = reinterpret_cast<const char*>(end);
+
+        // Reads an entry and takes its bytes from the cursor.
+        const auto readSegment = [&]() -> bool {
+            if (!Internal::DecodeVarint(beg, entriesEnd, value) || (value >> 1) > static_cast<std::uint64_t>(
+                    reinterpret_cast<const char*>(end) - cursor))
+                return false;
+
+            const auto segmentLength = static_cast<std::size_t>(value >> 1);
+            segments_.push_back(Segment{std::string_view(cursor, segmentLength),
+                                        static_cast<std::uint64_t>(0) != (value & static_cast<std::uint64_t>(1))});
+            cursor += segmentLength;
+
+            return true;
+        };
+
+        if (Version != *beg++)
+            goto bad;
+
+        hostType_ = static_cast<char>(*beg++);
+        if ('\0' != hostType_ && '4' != hostType_ && '6' != hostType_ && 'n' != hostType_)
+            goto bad;
+
+        if (!Internal::DecodeVarint(beg, end, value) || static_cast<std::uint64_t>(UINT16_MAX) < value)
+            goto bad;
+
+        port_ = static_cast<Port>(value);
+
+        if (!Internal::DecodeVarint(beg, end, value) || static_cast<std::uint64_t>(end - beg) < value)
+            goto bad;
+
+        entriesEnd = beg + value;
+        cursor = reinterpret_cast<const char*>(entriesEnd);
+
+        try {
+            // Every entry takes at least a byte.
+            segments_.reserve(static_cast<std::size_t>(entriesEnd - beg));
+
+            for (auto i = static_cast<std::size_t>(0); i < PathSlot; ++i) {
+                if (!readSegment())
+                    goto bad;
+            }
+
+            if (!Internal::DecodeVarint(beg, entriesEnd, value) || static_cast<std::uint64_t>(entriesEnd - beg) <
+                value)
+                goto bad;
+
+            pathCount_ = static_cast<std::size_t>(value);
+            for (auto i = static_cast<std::size_t>(0); i < pathCount_; ++i) {
+                if (!readSegment())
+                    goto bad;
+            }
+
+            std::uint64_t fieldCount;
+            if (!Internal::DecodeVarint(beg, entriesEnd, fieldCount) || static_cast<std::uint64_t>(entriesEnd - beg) <
+                fieldCount)
+                goto bad;
+
+            fields_.reserve(static_cast<std::size_t>(fieldCount));
+            for (auto i = static_cast<std::uint64_t>(0); i < fieldCount; ++i) {
+                fields_.push_back(segments_.size());
+                if (!readSegment())
+                    goto bad;
+
+                std::uint64_t valueCount;
+                if (!Internal::DecodeVarint(beg, entriesEnd, valueCount) || static_cast<std::uint64_t>(0) ==
+                    valueCount || static_cast<std::uint64_t>(entriesEnd - beg) < valueCount)
+                    goto bad;
+
+                for (auto j = static_cast<std::uint64_t>(0); j < valueCount; ++j) {
+                    if (static_cast<std::uint64_t>(0) != j) {
+                        if (reinterpret_cast<const char*>(end) == cursor || ',' != *cursor)
+                            goto bad;
+
+                        ++cursor;
+                    }
+
+                    if (!readSegment())
+                        goto bad;
+                }
+            }
+        }
+        catch (...) {
+            goto bad;
+        }
+
+        if (entriesEnd != beg || reinterpret_cast<const char*>(end) != cursor)
+            goto bad;
+
+        return true;
+
+    bad:
+        clear();
+        return false;
+    }
+
+    inline void URLView::clear() noexcept {
+        segments_.clear();
+        fields_.clear();
+
+        pathCount_ = static_cast<std::size_t>(0);
+        port_ = static_cast<Port>(0);
+        hostType_ = '\0';
+    }
+
+    inline bool URLView::empty() const noexcept {
+        return segments_.empty();
+    }
+
+    // Components.
+    inline const URLView::Segment& URLView::scheme() const noexcept {
+        return segment_(SchemeSlot);
+    }
+
+    inline const URLView::Segment& URLView::user() const noexcept {
+        return segment_(UserSlot);
+    }
+
+    inline const URLView::Segment& URLView::password() const noexcept {
+        return segment_(PasswordSlot);
+    }
+
+    inline const URLView::Segment& URLView::host() const noexcept {
+        return segment_(HostSlot);
+    }
+
+    inline bool URLView::isIPv4() const noexcept {
+        return '4' == hostType_;
+    }
+
+    inline bool URLView::isIPv6() const noexcept {
+        return '6' == hostType_;
+    }
+
+    inline bool URLView::isRegisteredName() const noexcept {
+        return 'n' == hostType_;
+    }
+
+    inline Port URLView::port() const noexcept {
+        return port_;
+    }
+
+    inline const URLView::Segment& URLView::fragment() const noexcept {
+        return segment_(FragmentSlot);
+    }
+
+    // Path.
+    inline std::size_t URLView::pathCount() const noexcept {
+        return pathCount_;
+    }
+
+    inline const URLView::Segment& URLView::pathAt(const std::size_t &position) const noexcept {
+        return (position < pathCount_) ? segments_[PathSlot + position] : EmptySegment;
+    }
+
+    // Query.
+    inline std::size_t URLView::queryCount() const noexcept {
+        return fields_.size();
+    }
+
+    inline const URLView::Segment& URLView::queryNameAt(const std::size_t &position) const noexcept {
+        return (position < fields_.size()) ? segments_[fields_[position]] : EmptySegment;
+    }
+
+    inline std::size_t URLView::queryValueCount(const std::size_t &position) const noexcept {
+        if (position >= fields_.size())
+            return static_cast<std::size_t>(0);
+
+        const std::size_t next = ((fields_.size() == (position + static_cast<std::size_t>(1)))
+                                      ? segments_.size()
+                                      : fields_[position + static_cast<std::size_t>(1)]);
+
+        return next - fields_[position] - static_cast<std::size_t>(1);
+    }
+
+    inline const URLView::Segment& URLView::queryValueAt(const std::size_t &position,
+                                                         const std::size_t &valuePosition) const noexcept {
+        if (valuePosition >= queryValueCount(position))
+            return EmptySegment;
+
+        return segments_[fields_[position] + static_cast<std::size_t>(1) + valuePosition];
+    }
+
+    inline std::string_view URLView::queryValue(const std::size_t &position) const noexcept {
+        const std::size_t count = queryValueCount(position);
+        if (static_cast<std::size_t>(0) == count)
+            return {};
+
+        const std::string_view first = queryValueAt(position).value;
+        const std::string_view last = queryValueAt(position, count - static_cast<std::size_t>(1)).value;
+
+        return {first.data(), static_cast<std::size_t>((last.data() + last.length()) - first.data())};
+    }
+
+    // Operators.
+    inline URLView::operator bool() const noexcept {
+        return !empty();
+    }
+
+    // Destructors.
+    inline URLView::~URLView() noexcept = default;
+
+CRONZ_END_MODULE_NAMESPACE
+
+#endif // CRONZ_URL_IMPL_VIEW_IPP
@@ -17,6 +17,32 @@
 #include <algorithm>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Utilities.
+    inline std::string* PathManager::take_() noexcept {
+        try {
+            if (spare_.empty())
+                paths_.emplace_back();
+            else {
+                paths_.push_back(std::move(spare_.back()));
+                spare_.pop_back();
+            }
+        }
+        catch (...) {
+            return nullptr;
+        }
+
+        return &paths_.back();
+    }
+
+    inline void PathManager::release_(std::string &path) noexcept {
+        try {
+            path.clear();
+            spare_.push_back(std::move(path));
+        }
+        catch (...) {
+        }
+    }
+
     // Constructors.
     inline PathManager::PathManager() noexcept = default;
 
@@ -55,11 +81,39 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
     // Path management.
     inline bool PathManager::addPath(const std::string &path) noexcept {
+        return addPath(std::string_view(path));
+    }
+
+    inline bool PathManager::addPath(const char *path) noexcept {
+        return addPath(std::string_view(path));
+    }
+
+    inline bool PathManager::addPath(const std::string_view &path) noexcept {
+        if (path.empty())
+            return true;
+
+        std::string *entry = take_();
+        if (nullptr == entry)
+            return false;
+
+        try {
+            entry->assign(path);
+        }
+        catch (...) {
+            release_(*entry);
+            paths_.pop_back();
+            return false;
+        }
+
+        return true;
+    }
+
+    inline bool PathManager::addPath(std::string &&path) noexcept {
         if (path.empty())
             return true;
 
         try {
-            paths_.push_back(path);
+            paths_.push_back(std::move(path));
         }
         catch (...) {
             return false;
@@ -69,8 +123,28 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     }
 
     inline bool PathManager::addEncodedPath(const std::string &path) noexcept {
-        std::string decoded;
-        return Decode(path, decoded) && addPath(decoded);
+        return addEncodedPath(std::string_view(path));
+    }
+
+    inline bool PathManager::addEncodedPath(const char *path) noexcept {
+        return addEncodedPath(std::string_view(path));
+    }
+
+    inline bool PathManager::addEncodedPath(const std::string_view &path) noexcept {
+        if (path.empty())
+            return true;
+
+        std::string *entry = take_();
+        if (nullptr == entry)
+            return false;
+
+        if (!Decode(path.data(), path.length(), *entry)) {
+            release_(*entry);
+            paths_.pop_back();
+            return false;
+        }
+
+        return true;
     }
 
     inline std::string& PathManager::at(const std::size_t &position) noexcept {
@@ -87,14 +161,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         auto it = paths_.begin();
         std::advance(it, position);
+        release_(*it);
         paths_.erase(it);
     }
 
     inline PathManager::Iterator PathManager::removeAt(const Iterator &position) noexcept {
+        release_(*position);
         return paths_.erase(position);
     }
 
     inline PathManager::ConstIterator PathManager::removeAt(const ConstIterator &position) noexcept {
+        release_(paths_[position - paths_.cbegin()]);
         return paths_.erase(position);
     }
 
@@ -112,18 +189,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
             const std::size_t currentLength = current - previous;
 
             if (static_cast<std::size_t>(0) != currentLength) {
-                std::string decoded;
-                if (!Decode(previous, currentLength, decoded))
+                std::string *entry = take_();
+                if (nullptr == entry)
                     goto bad;
 
-                try {
-                    paths_.push_back(std::move(decoded));
-                }
-                catch (...) {
-                    goto bad;
-                }
-
                 ++added;
+
+                if (!Decode(previous, currentLength, *entry))
+                    goto bad;
             }
 
             previous = current + static_cast<std::size_t>(1);
@@ -132,13 +205,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
 
     bad:
-        while (added--)
+        while (added--) {
+            release_(paths_.back());
             paths_.pop_back();
+        }
 
         return false;
     }
 
     inline void PathManager::clear() noexcept {
+        for (std::string &path : paths_)
+            release_(path);
+
         paths_.clear();
     }
 
@@ -164,6 +242,15 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return paths_.empty();
     }
 
+    inline std::uint64_t PathManager::hash(const std::uint64_t &seed) const noexcept {
+        std::uint64_t h = Internal::HashMix(seed ^ static_cast<std::uint64_t>(paths_.size()));
+
+        for (const std::string &path : paths_)
+            h = Internal::HashCombine(h, Internal::HashBytes(path.data(), path.length(), seed));
+
+        return h;
+    }
+
     // Conversion.
     inline std::string PathManager::stringify() const noexcept {
         std::string str;
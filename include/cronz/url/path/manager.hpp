@@ -12,7 +12,10 @@
 #define CRONZ_URL_PATH_MANAGER_HPP 1
 
 #include "cronz/url/types.hpp"
+#include "cronz/internal/hash.hpp"
 
+#include <string>
+#include <string_view>
 #include <vector>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
@@ -27,6 +30,17 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         ArrayType paths_;
 
+        // Removed entries, kept for their capacity.
+        ArrayType spare_;
+
+        // Utilities.
+        CRONZ_NODISCARD_L1 std::string* take_() noexcept;
+
+        void release_(std::string &path) noexcept;
+
+        // Friends.
+        friend class URL;
+
     public:
         /**
          * @name Constructors.
@@ -130,6 +144,30 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool addPath(const std::string &path) noexcept;
 
+        /**
+         * @brief Adds path to the end of the path list.
+         * @param[in] path Path to be added, null-terminated.
+         * @return `true` if operation is successful, otherwise, `false`.
+         * @remark `path` is expected to be decoded.
+         */
+        CRONZ_NODISCARD_L2 bool addPath(const char *path) noexcept;
+
+        /**
+         * @brief Adds path to the end of the path list.
+         * @param[in] path Path to be added.
+         * @return `true` if operation is successful, otherwise, `false`.
+         * @remark `path` is expected to be decoded.
+         */
+        CRONZ_NODISCARD_L2 bool addPath(const std::string_view &path) noexcept;
+
+        /**
+         * @brief Adds path to the end of the path list by taking over the storage of the given string.
+         * @param[in,out] path Path to be added.
+         * @return `true` if operation is successful, otherwise, `false`.
+         * @remark `path` is expected to be decoded.
+         */
+        CRONZ_NODISCARD_L2 bool addPath(std::string &&path) noexcept;
+
         /**
          * @brief Decodes and adds an encoded path to the end of the path list.
          * @param[in] path Path to be added.
@@ -139,6 +177,22 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool addEncodedPath(const std::string &path) noexcept;
 
+        /**
+         * @brief Decodes and adds an encoded path to the end of the path list.
+         * @param[in] path Path to be added, null-terminated.
+         * @return `true` if operation is successful, otherwise, `false`.
+         * @remark `path` is expected to be encoded.
+         */
+        CRONZ_NODISCARD_L2 bool addEncodedPath(const char *path) noexcept;
+
+        /**
+         * @brief Decodes and adds an encoded path to the end of the path list.
+         * @param[in] path Path to be added.
+         * @return `true` if operation is successful, otherwise, `false`.
+         * @remark `path` is expected to be encoded.
+         */
+        CRONZ_NODISCARD_L2 bool addEncodedPath(const std::string_view &path) noexcept;
+
         /**
          * @brief Returns mutable reference to the path at the given position.
          * @param[in] position Position of the path entry.
@@ -201,6 +255,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         /**
          * @brief Removes all paths in the container.
+         * @remark Removed entries keep their capacity and are reused by subsequent additions.
          */
         void clear() noexcept;
 
@@ -238,6 +293,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L1 bool empty() const noexcept;
 
+        /**
+         * @brief Hashes the stored (decoded) path entries.
+         * @param[in] seed Seed.
+         * @return 64-bit hash of the path entries.
+         * @remark Entries are hashed in order and without re-encoding them.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t hash(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) const noexcept;
+
         /** @} */
 
         /**
@@ -0,0 +1,221 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_POOL_HPP
+#define CRONZ_URL_POOL_HPP 1
+
+/**
+ * @defgroup cronz_url_pool Pool
+ * @ingroup cronz_url
+ */
+
+#include "cronz/url/url.hpp"
+
+#include <memory>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    /**
+     * @ingroup cronz_url_pool
+     * @brief Pool of reusable URL objects.
+     * @class URLPool
+     * @remark Returned URLs are cleared but keep the capacity of their components (see `URL::reparse`), so once the
+     * pool is warmed up, parsing URLs of similar shapes does not allocate memory.
+     * @remark The pool is not thread-safe. Use `Local` for a per-thread pool.
+     */
+    class URLPool {
+    public:
+        /**
+         * @brief Owning handle of a pooled URL. Returns the URL to its pool upon destruction.
+         * @class Handle
+         * @remark A handle must not outlive the pool it was acquired from.
+         */
+        class Handle {
+            // Properties.
+            URLPool *pool_ = nullptr;
+            std::unique_ptr<URL> url_;
+
+            // Friends.
+            friend class URLPool;
+
+            Handle(URLPool *pool, std::unique_ptr<URL> url) noexcept;
+
+        public:
+            /**
+             * @name Constructors.
+             */
+            /** @{ */
+            /**
+             * @brief Default constructor. Constructs an empty handle.
+             */
+            Handle() noexcept;
+
+            Handle(const Handle &handle) = delete;
+
+            /**
+             * @brief Move constructor.
+             * @param[in,out] handle Handle to be moved. It will be empty afterward.
+             */
+            Handle(Handle &&handle) noexcept;
+
+            /** @} */
+
+            /**
+             * @name Properties.
+             */
+            /** @{ */
+            /**
+             * @brief Returns the pooled URL.
+             * @return Pooled URL, or `nullptr` if the handle is empty.
+             */
+            CRONZ_NODISCARD_L1 URL* get() const noexcept;
+
+            /**
+             * @brief Returns the URL to its pool, leaving the handle empty.
+             */
+            void reset() noexcept;
+
+            /** @} */
+
+            /**
+             * @name Operators.
+             */
+            /** @{ */
+            Handle& operator=(const Handle &handle) = delete;
+
+            /**
+             * @brief Move assignment operator.
+             * @param[in,out] handle Handle to be moved. It will be empty afterward.
+             * @return Reference to this handle.
+             */
+            Handle& operator=(Handle &&handle) noexcept;
+
+            CRONZ_NODISCARD_L1 URL& operator*() const noexcept;
+
+            CRONZ_NODISCARD_L1 URL* operator->() const noexcept;
+
+            /**
+             * @brief Tells if the handle holds a URL.
+             * @return `true` if the handle holds a URL, otherwise, `false`.
+             */
+            CRONZ_NODISCARD_L1 explicit operator bool() const noexcept;
+
+            /** @} */
+
+            /**
+             * @name Destructors.
+             */
+            /** @{ */
+            /**
+             * @brief Destructor. Returns the URL to its pool.
+             */
+            ~Handle() noexcept;
+
+            /** @} */
+        };
+
+    private:
+        // Properties.
+        std::vector<std::unique_ptr<URL>> urls_;
+        std::size_t capacity_;
+
+        // Utilities.
+        void release_(std::unique_ptr<URL> url) noexcept;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with initializer.
+         * @param[in] capacity Maximum number of idle URLs kept by the pool. URLs returned to a full pool are
+         * destroyed.
+         */
+        explicit URLPool(const std::size_t &capacity = static_cast<std::size_t>(64)) noexcept;
+
+        URLPool(const URLPool &pool) = delete;
+
+        /** @} */
+
+        /**
+         * @name Pooling.
+         */
+        /** @{ */
+        /**
+         * @brief Acquires an empty URL, reusing an idle one if available.
+         * @return Handle of the acquired URL. Empty upon memory allocation failure.
+         */
+        CRONZ_NODISCARD_L1 Handle acquire() noexcept;
+
+        /**
+         * @brief Allocates idle URLs up front.
+         * @param[in] count Number of idle URLs to have. Limited by the capacity.
+         * @return `true` if the idle URLs are allocated, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool reserve(const std::size_t &count) noexcept;
+
+        /**
+         * @brief Destroys all the idle URLs.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns the pool of the calling thread.
+         * @return Thread-local pool.
+         * @remark Handles acquired from this pool must be destroyed on the same thread, before the thread exits.
+         */
+        CRONZ_NODISCARD_L1 static URLPool& Local() noexcept;
+
+        /** @} */
+
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of idle URLs.
+         * @return Number of idle URLs.
+         */
+        CRONZ_NODISCARD_L1 std::size_t size() const noexcept;
+
+        /**
+         * @brief Returns the maximum number of idle URLs kept by the pool.
+         * @return Maximum number of idle URLs.
+         */
+        CRONZ_NODISCARD_L1 std::size_t capacity() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        URLPool& operator=(const URLPool &pool) = delete;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Destroys all the idle URLs.
+         */
+        ~URLPool() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/url/impl/pool.ipp"
+
+#endif // CRONZ_URL_POOL_HPP
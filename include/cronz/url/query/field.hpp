@@ -14,6 +14,7 @@
 #include "cronz/url/types.hpp"
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
@@ -37,6 +38,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         // Friends.
         friend class QueryManager;
+        friend class URL;
 
     public:
         /**
@@ -57,6 +59,19 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         explicit QueryField(std::string name);
 
+        /**
+         * @brief Copy constructor.
+         * @param[in] field Field to be copied.
+         * @remark Upon failure, this might throw an exception.
+         */
+        QueryField(const QueryField &field);
+
+        /**
+         * @brief Move constructor.
+         * @param[in,out] field Field to be moved. Its storage is taken over.
+         */
+        QueryField(QueryField &&field) noexcept;
+
         /** @} */
 
         /**
@@ -102,6 +117,30 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool setName(const std::string &name) noexcept requires Renamable;
 
+        /**
+         * @brief Updates the field's name.
+         * @param[in] name New name, null-terminated.
+         * @return `true` if name is successfully assigned, otherwise, `false`.
+         * @remark This function requires the `Renamable` to be `true`.
+         */
+        CRONZ_NODISCARD_L2 bool setName(const char *name) noexcept requires Renamable;
+
+        /**
+         * @brief Updates the field's name.
+         * @param[in] name New name.
+         * @return `true` if name is successfully assigned, otherwise, `false`.
+         * @remark This function requires the `Renamable` to be `true`.
+         */
+        CRONZ_NODISCARD_L2 bool setName(const std::string_view &name) noexcept requires Renamable;
+
+        /**
+         * @brief Updates the field's name by taking over the storage of the given string.
+         * @param[in,out] name New name.
+         * @return Always `true`.
+         * @remark This function requires the `Renamable` to be `true`.
+         */
+        CRONZ_NODISCARD_L2 bool setName(std::string &&name) noexcept requires Renamable;
+
         /** @} */
 
         /**
@@ -407,6 +446,27 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         /** @} */
 
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Copy assignment operator.
+         * @param[in] field Field to be copied.
+         * @return Reference to this field.
+         * @remark Upon failure, this might throw an exception.
+         */
+        QueryField& operator=(const QueryField &field);
+
+        /**
+         * @brief Move assignment operator.
+         * @param[in,out] field Field to be moved. Its storage is taken over.
+         * @return Reference to this field.
+         */
+        QueryField& operator=(QueryField &&field) noexcept;
+
+        /** @} */
+
         /**
          * @name Destructors.
          */
@@ -25,6 +25,12 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     inline QueryField<Renamable>::QueryField(std::string name) : name_(std::move(name)) {
     }
 
+    template <bool Renamable>
+    inline QueryField<Renamable>::QueryField(const QueryField &field) = default;
+
+    template <bool Renamable>
+    inline QueryField<Renamable>::QueryField(QueryField &&field) noexcept = default;
+
     // Name.
     template <bool Renamable>
     inline std::string& QueryField<Renamable>::name() noexcept requires Renamable {
@@ -43,6 +49,16 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
     template <bool Renamable>
     inline bool QueryField<Renamable>::setName(const std::string &name) noexcept requires Renamable {
+        return setName(std::string_view(name));
+    }
+
+    template <bool Renamable>
+    inline bool QueryField<Renamable>::setName(const char *name) noexcept requires Renamable {
+        return setName(std::string_view(name));
+    }
+
+    template <bool Renamable>
+    inline bool QueryField<Renamable>::setName(const std::string_view &name) noexcept requires Renamable {
         try {
             name_.assign(name);
         }
@@ -53,6 +69,12 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
     }
 
+    template <bool Renamable>
+    inline bool QueryField<Renamable>::setName(std::string &&name) noexcept requires Renamable {
+        name_ = std::move(name);
+        return true;
+    }
+
     // Value.
     template <bool Renamable>
     inline const std::string& QueryField<Renamable>::value() const noexcept {
@@ -137,7 +159,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     template <bool Renamable>
     template <typename StringifiableType>
     inline bool QueryField<Renamable>::addValue(const StringifiableType &value) noexcept {
-        if constexpr (std::is_same_v<std::string, StringifiableType>) {
+        if constexpr (std::is_same_v<std::string, StringifiableType> ||
+                      std::is_same_v<std::string_view, StringifiableType>) {
             auto state = static_cast<std::uint8_t>(0);
 
             try {
@@ -170,7 +193,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     template <bool Renamable>
     template <typename StringifiableType>
     inline bool QueryField<Renamable>::setValue(const StringifiableType &value) noexcept {
-        if constexpr (std::is_same_v<std::string, StringifiableType>) {
+        if constexpr (std::is_same_v<std::string, StringifiableType> ||
+                      std::is_same_v<std::string_view, StringifiableType>) {
             try {
                 value_.assign(value);
             }
@@ -193,7 +217,8 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     template <typename StringifiableType>
     inline bool QueryField<
         Renamable>::setValueAt(const std::size_t &position, const StringifiableType &value) noexcept {
-        if constexpr (std::is_same_v<std::string, StringifiableType>) {
+        if constexpr (std::is_same_v<std::string, StringifiableType> ||
+                      std::is_same_v<std::string_view, StringifiableType>) {
             if (position >= indices_.size())
                 return addValue(value);
 
@@ -339,7 +364,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     template <bool Renamable>
     inline std::size_t QueryField<Renamable>::length() const noexcept {
         if (isArray()) {
-            std::size_t l = CalculateEncodedLength(name_);
+            std::size_t l = CalculateEncodedLength(name_) * count();
             l += count() * static_cast<std::size_t>(4) - static_cast<std::size_t>(1);
 
             std::size_t valueLength;
@@ -426,6 +451,13 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
     }
 
+    // Operators.
+    template <bool Renamable>
+    inline QueryField<Renamable>& QueryField<Renamable>::operator=(const QueryField &field) = default;
+
+    template <bool Renamable>
+    inline QueryField<Renamable>& QueryField<Renamable>::operator=(QueryField &&field) noexcept = default;
+
     // Destructors.
     template <bool Renamable>
     inline QueryField<Renamable>::~QueryField() noexcept = default;
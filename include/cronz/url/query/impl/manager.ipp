@@ -14,20 +14,72 @@
 #include "cronz/url/query/manager.hpp"
 
 #include <algorithm>
-#include <set>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    // Utilities.
+    inline QueryManager::QueryFieldType* QueryManager::emplace_() noexcept {
+        try {
+            if (spare_.empty())
+                fields_.emplace_back(std::string());
+            else {
+                fields_.push_back(std::move(spare_.back()));
+                spare_.pop_back();
+            }
+        }
+        catch (...) {
+            return nullptr;
+        }
+
+        QueryFieldType &field = fields_.back();
+        field.value_.clear();
+        field.indices_.assign(static_cast<std::size_t>(1), static_cast<std::size_t>(0));
+
+        return &field;
+    }
+
+    inline void QueryManager::release_(QueryFieldType &field) noexcept {
+        try {
+            spare_.push_back(std::move(field));
+        }
+        catch (...) {
+        }
+    }
+
+    inline bool QueryManager::backup_(const std::size_t &position, std::size_t &backupCount) noexcept {
+        const auto touchedEnd = touched_.begin() + static_cast<std::ptrdiff_t>(backupCount);
+        if (touchedEnd != std::find(touched_.begin(), touchedEnd, position))
+            return true;
+
+        try {
+            if (backups_.size() == backupCount)
+                backups_.emplace_back(std::string());
+
+            if (touched_.size() == backupCount)
+                touched_.push_back(position);
+            else
+                touched_[backupCount] = position;
+
+            const QueryFieldType &field = fields_[position];
+            backups_[backupCount].value_.assign(field.value_);
+            backups_[backupCount].indices_.assign(field.indices_.begin(), field.indices_.end());
+        }
+        catch (...) {
+            return false;
+        }
+
+        ++backupCount;
+        return true;
+    }
+
     // Constructors.
     inline QueryManager::QueryManager() noexcept = default;
 
     // Query fields.
-    inline bool QueryManager::contains(const std::string &name) const noexcept {
-        return std::ranges::any_of(fields_, [&name](const QueryField<false> &field) -> bool {
-            return name == field.name_;
-        });
+    inline bool QueryManager::contains(const std::string_view &name) const noexcept {
+        return nullptr != get(name);
     }
 
-    inline QueryManager::QueryFieldType* QueryManager::get(const std::string &name) noexcept {
+    inline QueryManager::QueryFieldType* QueryManager::get(const std::string_view &name) noexcept {
         for (auto &field : fields_) {
             if (name == field.name_)
                 return &field;
@@ -36,23 +88,60 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return nullptr;
     }
 
+    inline const QueryManager::QueryFieldType* QueryManager::get(const std::string_view &name) const noexcept {
+        for (const auto &field : fields_) {
+            if (name == field.name_)
+                return &field;
+        }
+
+        return nullptr;
+    }
+
     inline QueryManager::QueryFieldType* QueryManager::create(const std::string &name) noexcept {
+        return create(std::string_view(name));
+    }
+
+    inline QueryManager::QueryFieldType* QueryManager::create(const char *name) noexcept {
+        return create(std::string_view(name));
+    }
+
+    inline QueryManager::QueryFieldType* QueryManager::create(const std::string_view &name) noexcept {
         QueryFieldType *field = get(name);
         if (nullptr == field) {
+            field = emplace_();
+            if (nullptr == field)
+                return nullptr;
+
             try {
-                QueryFieldType &ref = fields_.emplace_back(name);
-                field = &ref;
+                field->name_.assign(name);
             }
             catch (...) {
+                release_(*field);
+                fields_.pop_back();
+                return nullptr;
             }
         }
 
         return field;
     }
 
-    inline bool QueryManager::remove(const std::string &name) noexcept {
+    inline QueryManager::QueryFieldType* QueryManager::create(std::string &&name) noexcept {
+        QueryFieldType *field = get(name);
+        if (nullptr == field) {
+            field = emplace_();
+            if (nullptr == field)
+                return nullptr;
+
+            field->name_ = std::move(name);
+        }
+
+        return field;
+    }
+
+    inline bool QueryManager::remove(const std::string_view &name) noexcept {
         for (auto it = fields_.begin(); it != fields_.end(); ++it) {
             if (name == it->name_) {
+                release_(*it);
                 fields_.erase(it);
                 return true;
             }
@@ -66,15 +155,13 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     }
 
     inline bool QueryManager::parse(const char *str, const std::size_t &length) noexcept {
-        ArrayType tempFields;
-        try {
-            tempFields.assign(fields_.begin(), fields_.end());
-        }
-        catch (...) {
-            return false;
-        }
+        // Rollback markers. Fields from `count` on are created by this call, and the first `backupCount` entries of
+        // `backups_` hold the original state of the pre-existing fields at positions `touched_`.
+        const std::size_t count = fields_.size();
+        auto backupCount = static_cast<std::size_t>(0);
 
-        std::set<std::string> arrayMarkings;
+        // Positions of the fields marked as arrays by this call.
+        markings_.clear();
 
         const char *const end = str + length;
         const char *previous = str;
@@ -92,51 +179,55 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
             if (isArray)
                 nameLength -= static_cast<std::size_t>(2);
 
-            std::string fieldName;
-            std::string fieldValue;
-            if (!Decode(previous, nameLength, fieldName) ||
-                !Decode(&valueSeparator[1], valueLength, fieldValue))
+            if (!Decode(previous, nameLength, name_) ||
+                !Decode(&valueSeparator[1], valueLength, value_))
                 goto bad;
 
-            if (QueryFieldType *field = get(fieldName); nullptr != field) {
-                const bool isMarkedAsArray = arrayMarkings.contains(fieldName);
+            if (QueryFieldType *field = get(name_); nullptr != field) {
+                const std::size_t position = field - fields_.data();
+                if (position < count && !backup_(position, backupCount))
+                    goto bad;
+
+                const auto marking = std::ranges::find(markings_, position);
+                const bool isMarkedAsArray = (markings_.end() != marking);
 
                 if (isArray) {
                     if (!isMarkedAsArray && !field->isArray()) {
                         try {
-                            arrayMarkings.insert(fieldName);
+                            markings_.push_back(position);
                         }
                         catch (...) {
                             goto bad;
                         }
 
-                        field->value_.swap(fieldValue);
+                        field->value_.swap(value_);
                     }
                     else {
-                        if (!field->addValue(fieldValue))
+                        if (!field->addValue(value_))
                             goto bad;
                     }
                 }
                 else {
                     if (isMarkedAsArray)
-                        arrayMarkings.erase(fieldName);
+                        markings_.erase(marking);
 
                     if (field->isArray())
                         field->clearValues();
 
-                    field->value_.swap(fieldValue);
+                    field->value_.swap(value_);
                 }
             }
             else {
-                field = create(fieldName);
+                field = emplace_();
                 if (nullptr == field)
                     goto bad;
 
-                field->value_.swap(fieldValue);
+                field->name_.swap(name_);
+                field->value_.swap(value_);
 
                 if (isArray) {
                     try {
-                        arrayMarkings.insert(fieldName);
+                        markings_.push_back(fields_.size() - static_cast<std::size_t>(1));
                     }
                     catch (...) {
                         goto bad;
@@ -150,15 +241,36 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return true;
 
     bad:
-        fields_.swap(tempFields);
+        while (fields_.size() > count) {
+            release_(fields_.back());
+            fields_.pop_back();
+        }
+
+        for (auto i = static_cast<std::size_t>(0); i < backupCount; ++i) {
+            QueryFieldType &field = fields_[touched_[i]];
+            field.value_.swap(backups_[i].value_);
+            field.indices_.swap(backups_[i].indices_);
+        }
+
         return false;
     }
 
     inline void QueryManager::clear() noexcept {
+        for (QueryFieldType &field : fields_)
+            release_(field);
+
         fields_.clear();
     }
 
     // Properties.
+    inline std::size_t QueryManager::count() const noexcept {
+        return fields_.size();
+    }
+
+    inline std::size_t QueryManager::size() const noexcept {
+        return count();
+    }
+
     inline std::size_t QueryManager::length() const noexcept {
         if (empty())
             return static_cast<std::size_t>(0);
@@ -175,6 +287,18 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         return fields_.empty();
     }
 
+    inline std::uint64_t QueryManager::hash(const std::uint64_t &seed) const noexcept {
+        std::uint64_t h = Internal::HashMix(seed ^ static_cast<std::uint64_t>(fields_.size()));
+
+        for (const QueryFieldType &field : fields_) {
+            h = Internal::HashCombine(h, Internal::HashBytes(field.name_.data(), field.name_.length(), seed));
+            h = Internal::HashCombine(h, Internal::HashBytes(field.value_.data(), field.value_.length(), seed));
+            h = Internal::HashCombine(h, static_cast<std::uint64_t>(field.indices_.size()));
+        }
+
+        return h;
+    }
+
     // Conversion.
     inline std::string QueryManager::stringify() const noexcept {
         std::string str;
@@ -197,7 +321,6 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
             }
         }
 
-        printf("qm => %llu => %c\n", offset, str[offset]);
         std::size_t o = offset;
         for (const QueryFieldType &field : fields_) {
             if (o != offset)
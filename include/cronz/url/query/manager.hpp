@@ -12,6 +12,9 @@
 #define CRONZ_URL_QUERY_MANAGER_HPP 1
 
 #include "cronz/url/query/field.hpp"
+#include "cronz/internal/hash.hpp"
+
+#include <string_view>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     /**
@@ -26,6 +29,26 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         using ArrayType = std::vector<QueryFieldType>;
         ArrayType fields_;
 
+        // Reuse. Removed fields are kept for their capacity, and parsing decodes into the scratch strings, which are
+        // then swapped into the fields. Pre-existing fields that are modified while parsing are backed up, so that
+        // they can be restored upon failure.
+        ArrayType spare_;
+        ArrayType backups_;
+        std::vector<std::size_t> touched_;
+        std::vector<std::size_t> markings_;
+        std::string name_;
+        std::string value_;
+
+        // Utilities.
+        CRONZ_NODISCARD_L1 QueryFieldType* emplace_() noexcept;
+
+        void release_(QueryFieldType &field) noexcept;
+
+        CRONZ_NODISCARD_L1 bool backup_(const std::size_t &position, std::size_t &backupCount) noexcept;
+
+        // Friends.
+        friend class URL;
+
     public:
         /**
          * @name Constructors.
@@ -47,8 +70,9 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          * @brief Tells whether a query field with the given name exists.
          * @param[in] name Field name.
          * @return `true` if a field with the given name exists, otherwise, `false`.
+         * @remark Names are looked up as views, so neither string literals nor views are copied into strings.
          */
-        CRONZ_NODISCARD_L1 bool contains(const std::string &name) const noexcept;
+        CRONZ_NODISCARD_L1 bool contains(const std::string_view &name) const noexcept;
 
         /**
          * @brief Returns reference to the field with the given name.
@@ -59,7 +83,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          * @sa parse
          * @sa clear
          */
-        CRONZ_NODISCARD_L1 QueryFieldType* get(const std::string &name) noexcept;
+        CRONZ_NODISCARD_L1 QueryFieldType* get(const std::string_view &name) noexcept;
+
+        /**
+         * @brief Returns read-only reference to the field with the given name.
+         * @param[in] name Name of the field.
+         * @return If found, read-only reference to the field with the given name, and if not, `nullptr`.
+         */
+        CRONZ_NODISCARD_L1 const QueryFieldType* get(const std::string_view &name) const noexcept;
 
         /**
          * @brief Creates a field with the given name and returns reference to it.
@@ -73,6 +104,30 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L1 QueryFieldType* create(const std::string &name) noexcept;
 
+        /**
+         * @brief Creates a field with the given name and returns reference to it.
+         * @param[in] name Name of the field, null-terminated.
+         * @return If created or found, reference to the field with the given name, and if not, `nullptr`.
+         * @remark If a field with the given name already exists, this function works identical to `get`.
+         */
+        CRONZ_NODISCARD_L1 QueryFieldType* create(const char *name) noexcept;
+
+        /**
+         * @brief Creates a field with the given name and returns reference to it.
+         * @param[in] name Name of the field.
+         * @return If created or found, reference to the field with the given name, and if not, `nullptr`.
+         * @remark If a field with the given name already exists, this function works identical to `get`.
+         */
+        CRONZ_NODISCARD_L1 QueryFieldType* create(const std::string_view &name) noexcept;
+
+        /**
+         * @brief Creates a field with the given name and returns reference to it.
+         * @param[in,out] name Name of the field. Its storage is taken over if the field is created.
+         * @return If created or found, reference to the field with the given name, and if not, `nullptr`.
+         * @remark If a field with the given name already exists, this function works identical to `get`.
+         */
+        CRONZ_NODISCARD_L1 QueryFieldType* create(std::string &&name) noexcept;
+
         /**
          * @brief Removes the field with the given name.
          * @param[in] name Name of the field to be removed.
@@ -82,7 +137,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          * @sa parse
          * @sa clear
          */
-        CRONZ_NODISCARD_L2 bool remove(const std::string &name) noexcept;
+        CRONZ_NODISCARD_L2 bool remove(const std::string_view &name) noexcept;
 
         /**
          * @brief Parses a query string.
@@ -135,6 +190,7 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         /**
          * @brief Removes all fields.
+         * @remark Removed fields keep their capacity and are reused by subsequent creations.
          * @sa get
          * @sa create
          * @sa remove
@@ -175,6 +231,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L1 bool empty() const noexcept;
 
+        /**
+         * @brief Hashes the stored (decoded) fields.
+         * @param[in] seed Seed.
+         * @return 64-bit hash of the fields.
+         * @remark Fields are hashed in order, including their names, values and array status.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t hash(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) const noexcept;
+
         /** @} */
 
         /**
@@ -19,6 +19,7 @@
 #include "cronz/url/types.hpp"
 
 #include <string>
+#include <string_view>
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     /**
@@ -32,6 +33,14 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
         // Properties.
         std::string value_{};
 
+        // Utilities.
+        CRONZ_NODISCARD_L1 static bool validate_(const char *value, const std::size_t &length) noexcept;
+
+        void lower_() noexcept;
+
+        // Friends.
+        friend class URL;
+
     public:
         /**
          * @name Predefined scheme values.
@@ -124,6 +133,24 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool setValue(const std::string &value) noexcept;
 
+        /**
+         * @brief Sets the scheme value.
+         * @param[in] value Scheme value.
+         * @return `true` if `value` is successfully assigned, otherwise, `false`.
+         * @remark This function validates the scheme format. If invalid, returns `false`.
+         * @remark If `value` is empty, this function internally calls `clear`.
+         */
+        CRONZ_NODISCARD_L2 bool setValue(const std::string_view &value) noexcept;
+
+        /**
+         * @brief Sets the scheme value by taking over the storage of the given string.
+         * @param[in,out] value Scheme value. Left untouched if invalid.
+         * @return `true` if `value` is successfully assigned, otherwise, `false`.
+         * @remark This function validates the scheme format. If invalid, returns `false`.
+         * @remark If `value` is empty, this function internally calls `clear`.
+         */
+        CRONZ_NODISCARD_L2 bool setValue(std::string &&value) noexcept;
+
         /** @} */
 
         /**
@@ -0,0 +1,155 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_SIGN_HPP
+#define CRONZ_URL_SIGN_HPP 1
+
+/**
+ * @defgroup cronz_url_sign Signing
+ * @ingroup cronz_url
+ */
+
+#include "cronz/crypto/hmac.hpp"
+#include "cronz/url/url.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    /**
+     * @ingroup cronz_url_sign
+     * @brief Signs URLs with an HMAC-SHA256 over their path and selected query fields, and verifies them.
+     * @class URLSigner
+     * @remark The signature is a query field holding the digest encoded with `Crypto::Base64AlphabetSafe`, unpadded.
+     * @remark The components are authenticated from the decoded `PathManager` and `QueryManager` storage, so URLs are
+     * never stringified, and equivalent encodings of a URL have the same signature. The authenticated message is the
+     * following, each count and length being a 32-bit big-endian integer:
+     * - The number of path entries, then the length and the bytes of each entry.
+     * - For each selected field, in the order they were added, the length and the bytes of its name, then the number
+     * of its values (`0` if it is missing), then the length and the bytes of each value.
+     * @remark `sign`, `signature` and `verify` do not allocate, except for `sign` creating the signature field, and
+     * they can be called concurrently on the same signer.
+     */
+    class URLSigner {
+        // Properties.
+        Crypto::HMACSHA256 hmac_;
+        std::string parameter_;
+        std::vector<std::string> fields_;
+
+    public:
+        /**
+         * @name Properties.
+         */
+        /** @{ */
+        /**
+         * @brief Default name of the signature field.
+         */
+        inline static constexpr auto DefaultParameter = "signature";
+
+        /**
+         * @brief Length of a signature, in characters.
+         */
+        inline static constexpr std::size_t SignatureLength = static_cast<std::size_t>(43);
+
+        /**
+         * @brief Signature type.
+         */
+        using Signature = std::array<char, SignatureLength>;
+
+        /** @} */
+
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Constructor with initializers.
+         * @param[in] key Key.
+         * @param[in] parameter Name of the signature field.
+         * @remark Upon failure, this might throw an exception.
+         */
+        explicit URLSigner(const std::span<const std::byte> &key, std::string parameter = DefaultParameter);
+
+        /** @} */
+
+        /**
+         * @name Fields.
+         */
+        /** @{ */
+        /**
+         * @brief Selects a query field to be signed along with the path.
+         * @param[in] name Name of the field.
+         * @return `true` if the field is selected, otherwise, `false`, which is when `name` is the name of the
+         * signature field or when memory cannot be allocated.
+         * @remark Selecting a field twice has no effect.
+         */
+        CRONZ_NODISCARD_L2 bool addField(const std::string_view &name) noexcept;
+
+        /**
+         * @brief Returns the selected query fields.
+         * @return Names of the selected fields, in the order they are signed.
+         */
+        CRONZ_NODISCARD_L1 const std::vector<std::string>& fields() const noexcept;
+
+        /**
+         * @brief Returns the name of the signature field.
+         * @return Name of the signature field.
+         */
+        CRONZ_NODISCARD_L1 const std::string& parameter() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Signing.
+         */
+        /** @{ */
+        /**
+         * @brief Authenticates the signed components of a URL.
+         * @param[in] url URL to be authenticated.
+         * @return HMAC-SHA256 digest of the signed components.
+         */
+        CRONZ_NODISCARD_L1 Crypto::HMACSHA256::Digest digest(const URL &url) const noexcept;
+
+        /**
+         * @brief Computes the signature of a URL.
+         * @param[in] url URL to be signed.
+         * @return Signature, which is the encoded digest.
+         */
+        CRONZ_NODISCARD_L1 Signature signature(const URL &url) const noexcept;
+
+        /**
+         * @brief Signs a URL, setting its signature field.
+         * @param[in,out] url URL to be signed.
+         * @return `true` if the URL is signed, otherwise, `false`, which is when memory cannot be allocated.
+         * @remark An existing signature field is overwritten.
+         */
+        CRONZ_NODISCARD_L2 bool sign(URL &url) const noexcept;
+
+        /**
+         * @brief Verifies the signature field of a URL.
+         * @param[in] url URL to be verified.
+         * @return `true` if the URL has a single-value signature field that matches its signed components,
+         * otherwise, `false`.
+         * @remark The signature is compared in constant time.
+         */
+        CRONZ_NODISCARD_L1 bool verify(const URL &url) const noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/url/impl/sign.ipp"
+
+#endif // CRONZ_URL_SIGN_HPP
@@ -16,6 +16,7 @@
 #include "cronz/url/path.hpp"
 #include "cronz/url/query.hpp"
 #include "cronz/url/scheme.hpp"
+#include "cronz/url/view.hpp"
 
 CRONZ_BEGIN_MODULE_NAMESPACE(URL)
     /**
@@ -40,6 +41,9 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         CRONZ_NODISCARD_L1 bool parseFragment_(const char *&beg, const char *end) noexcept;
 
+        // Serialization.
+        void measure_(std::size_t &entriesLength, std::size_t &bytesLength) const noexcept;
+
     public:
         /**
          * @name Components.
@@ -146,6 +150,25 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
          */
         CRONZ_NODISCARD_L2 bool parse(const std::string &str) noexcept;
 
+        /**
+         * @brief Clears the URL and parses a new one into it.
+         * @param[in] str URL string.
+         * @param[in] length Length of the URL string.
+         * @return `true` if `url` is successfully parsed, otherwise, `false`.
+         * @remark Unlike constructing a new URL, the capacity of the existing components is reused, so that parsing
+         * URLs of similar shapes over and over does not allocate memory once warmed up.
+         * @sa URLPool
+         */
+        CRONZ_NODISCARD_L2 bool reparse(const char *str, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Clears the URL and parses a new one into it.
+         * @param[in] str URL string.
+         * @return `true` if `url` is successfully parsed, otherwise, `false`.
+         * @remark Unlike constructing a new URL, the capacity of the existing components is reused.
+         */
+        CRONZ_NODISCARD_L2 bool reparse(const std::string &str) noexcept;
+
         /**
          * @brief Stringifies the URL.
          * @return Stringification result. Upon failure, this will be an empty string.
@@ -169,6 +192,54 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         /** @} */
 
+        /**
+         * @name Serialization.
+         */
+        /** @{ */
+        /**
+         * @brief Calculates the byte length of the binary representation of the URL.
+         * @return Byte length of the binary representation.
+         * @sa URLView
+         */
+        CRONZ_NODISCARD_L1 std::size_t serializedLength() const noexcept;
+
+        /**
+         * @brief Serializes the URL into its binary representation.
+         * @param[out] data Output buffer.
+         * @param[in] length Byte length of `data`. Must be at least `serializedLength()`.
+         * @return `true` if serialization is successful, otherwise, `false`.
+         * @remark The binary representation carries the already parsed and decoded components, so that it can be read
+         * back without parsing (see `URLView` and `deserialize`).
+         */
+        CRONZ_NODISCARD_L2 bool serialize(void *data, const std::size_t &length) const noexcept;
+
+        /**
+         * @brief Serializes the URL into its binary representation.
+         * @param[out] str Serialization result.
+         * @return `true` if serialization is successful, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L2 bool serialize(std::string &str) const noexcept;
+
+        /**
+         * @brief Assigns the URL from a binary representation.
+         * @param[in] data Binary representation produced by `serialize`.
+         * @param[in] length Byte length of `data`.
+         * @return `true` if `data` is well-formed and assignment is successful, otherwise, `false`.
+         * @remark Components are neither re-validated nor re-decoded. Upon failure, the URL will be cleared.
+         */
+        CRONZ_NODISCARD_L2 bool deserialize(const void *data, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Assigns the URL from a parsed binary representation.
+         * @param[in] view Parsed binary representation.
+         * @return `true` if assignment is successful, otherwise, `false`.
+         * @remark Components are neither re-validated nor re-decoded. Existing capacities are reused. Upon failure, the
+         * URL will be cleared.
+         */
+        CRONZ_NODISCARD_L2 bool deserialize(const URLView &view) noexcept;
+
+        /** @} */
+
         /**
          * @name Instance-based utility functions.
          */
@@ -188,9 +259,20 @@ CRONZ_BEGIN_MODULE_NAMESPACE(URL)
 
         /**
          * @brief Clears all the components of the URL.
+         * @remark Allocated capacity is retained for subsequent parses.
          */
         void clear() noexcept;
 
+        /**
+         * @brief Hashes the parsed components of the URL without stringifying them.
+         * @param[in] seed Seed.
+         * @return 64-bit hash of the URL.
+         * @remark The port is elided if it equals to the default port of the scheme (see `GetSchemePort`), thus
+         * `http://host:80/` and `http://host/` produce the same hash.
+         * @remark The fragment is not part of the hash, as it does not identify a different resource.
+         */
+        CRONZ_NODISCARD_L1 std::uint64_t hash(const std::uint64_t &seed = static_cast<std::uint64_t>(0)) const noexcept;
+
         /** @} */
 
         /**
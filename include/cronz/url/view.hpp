@@ -0,0 +1,283 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_URL_VIEW_HPP
+#define CRONZ_URL_VIEW_HPP 1
+
+/**
+ * @defgroup cronz_url_view View
+ * @ingroup cronz_url
+ */
+
+#include "cronz/url/authority/port.hpp"
+
+#include <string_view>
+#include <vector>
+
+CRONZ_BEGIN_MODULE_NAMESPACE(URL)
+    class URL;
+
+    /**
+     * @ingroup cronz_url_view
+     * @brief Zero-copy reader of the binary URL representation produced by `URL::serialize`.
+     * @class URLView
+     * @remark The binary representation is laid out as follows, all integers being LEB128 varints:
+     * - Version (1 byte), host type (1 byte), port, byte length of the entries.
+     * - Scheme, user, password, host and fragment entries.
+     * - Path segment count, followed by an entry per segment.
+     * - Query field count, followed by, per field, a name entry, a value count and an entry per value.
+     * - Component bytes, in the same order as the entries. The values of a query field are separated by `,`.
+     * @remark Each entry is `(length << 1) | requiresEncoding`, where `requiresEncoding` tells whether the (decoded)
+     * component contains characters that have to be percent-encoded upon stringification.
+     * @remark Only the framing is checked while parsing; the components are neither re-validated nor re-decoded.
+     * Components are views into the parsed data, which must outlive the view.
+     */
+    class URLView {
+    public:
+        /**
+         * @brief A component of the binary URL representation.
+         */
+        struct Segment {
+            /**
+             * @brief Decoded component.
+             */
+            std::string_view value;
+
+            /**
+             * @brief Tells whether the component contains characters that have to be percent-encoded.
+             */
+            bool requiresEncoding;
+        };
+
+    private:
+        // Properties.
+        inline static constexpr unsigned char Version = static_cast<unsigned char>(1);
+
+        inline static constexpr std::size_t SchemeSlot = static_cast<std::size_t>(0);
+        inline static constexpr std::size_t UserSlot = static_cast<std::size_t>(1);
+        inline static constexpr std::size_t PasswordSlot = static_cast<std::size_t>(2);
+        inline static constexpr std::size_t HostSlot = static_cast<std::size_t>(3);
+        inline static constexpr std::size_t FragmentSlot = static_cast<std::size_t>(4);
+        inline static constexpr std::size_t PathSlot = static_cast<std::size_t>(5);
+
+        inline static constexpr Segment EmptySegment{};
+
+        std::vector<Segment> segments_;
+        std::vector<std::size_t> fields_;
+
+        std::size_t pathCount_ = static_cast<std::size_t>(0);
+        Port port_ = static_cast<Port>(0);
+        char hostType_ = '\0';
+
+        // Utilities.
+        CRONZ_NODISCARD_L1 const Segment& segment_(const std::size_t &slot) const noexcept;
+
+        // Friends.
+        friend class URL;
+
+    public:
+        /**
+         * @name Constructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default constructor. Does nothing.
+         */
+        URLView() noexcept;
+
+        /**
+         * @brief Constructor with initializer.
+         * @param[in] data Binary URL representation.
+         * @param[in] length Byte length of `data`.
+         * @remark This function internally calls `parse`.
+         * @sa parse
+         */
+        URLView(const void *data, const std::size_t &length) noexcept;
+
+        /** @} */
+
+        /**
+         * @name Parsing.
+         */
+        /** @{ */
+        /**
+         * @brief Parses a binary URL representation.
+         * @param[in] data Binary URL representation.
+         * @param[in] length Byte length of `data`.
+         * @return `true` if `data` is a well-formed binary URL representation, otherwise, `false`.
+         * @remark Upon failure, the view will be empty.
+         */
+        CRONZ_NODISCARD_L2 bool parse(const void *data, const std::size_t &length) noexcept;
+
+        /**
+         * @brief Clears the view.
+         * @remark Allocated capacity is retained for subsequent parses.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Tells if the view holds no parsed data.
+         * @return `true` if the view holds no parsed data, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool empty() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Components.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the scheme.
+         * @return Scheme. Empty if the view is empty.
+         */
+        CRONZ_NODISCARD_L1 const Segment& scheme() const noexcept;
+
+        /**
+         * @brief Returns the user of the authority.
+         * @return User. Empty if there is none.
+         */
+        CRONZ_NODISCARD_L1 const Segment& user() const noexcept;
+
+        /**
+         * @brief Returns the password of the authority.
+         * @return Password. Empty if there is none.
+         */
+        CRONZ_NODISCARD_L1 const Segment& password() const noexcept;
+
+        /**
+         * @brief Returns the host of the authority.
+         * @return Host. Empty if there is none.
+         */
+        CRONZ_NODISCARD_L1 const Segment& host() const noexcept;
+
+        /**
+         * @brief Tells if the host is actually an IPv4 address.
+         * @return `true` if the host is actually an IPv4 address, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool isIPv4() const noexcept;
+
+        /**
+         * @brief Tells if the host is actually an IPv6 address.
+         * @return `true` if the host is actually an IPv6 address, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool isIPv6() const noexcept;
+
+        /**
+         * @brief Tells if the host is actually a registered name.
+         * @return `true` if the host is actually a registered name, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 bool isRegisteredName() const noexcept;
+
+        /**
+         * @brief Returns the port of the authority.
+         * @return Port number. `0` means no port.
+         */
+        CRONZ_NODISCARD_L1 Port port() const noexcept;
+
+        /**
+         * @brief Returns the fragment.
+         * @return Fragment. Empty if there is none.
+         */
+        CRONZ_NODISCARD_L1 const Segment& fragment() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Path.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of path segments.
+         * @return Number of path segments.
+         */
+        CRONZ_NODISCARD_L1 std::size_t pathCount() const noexcept;
+
+        /**
+         * @brief Returns a path segment.
+         * @param[in] position Position of the path segment.
+         * @return Path segment. Empty if `position` is out of range.
+         */
+        CRONZ_NODISCARD_L1 const Segment& pathAt(const std::size_t &position) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Query.
+         */
+        /** @{ */
+        /**
+         * @brief Returns the number of query fields.
+         * @return Number of query fields.
+         */
+        CRONZ_NODISCARD_L1 std::size_t queryCount() const noexcept;
+
+        /**
+         * @brief Returns the name of a query field.
+         * @param[in] position Position of the query field.
+         * @return Name of the query field. Empty if `position` is out of range.
+         */
+        CRONZ_NODISCARD_L1 const Segment& queryNameAt(const std::size_t &position) const noexcept;
+
+        /**
+         * @brief Returns the number of values of a query field.
+         * @param[in] position Position of the query field.
+         * @return Number of values. `0` if `position` is out of range.
+         */
+        CRONZ_NODISCARD_L1 std::size_t queryValueCount(const std::size_t &position) const noexcept;
+
+        /**
+         * @brief Returns a value of a query field.
+         * @param[in] position Position of the query field.
+         * @param[in] valuePosition Position of the value within the field.
+         * @return Value. Empty if either of the positions is out of range.
+         */
+        CRONZ_NODISCARD_L1 const Segment& queryValueAt(const std::size_t &position,
+                                                       const std::size_t &valuePosition = static_cast<std::size_t>(0))
+        const noexcept;
+
+        /**
+         * @brief Returns all the values of a query field, joined by `,` (see `QueryField::getValue`).
+         * @param[in] position Position of the query field.
+         * @return Joined values. Empty if `position` is out of range.
+         */
+        CRONZ_NODISCARD_L1 std::string_view queryValue(const std::size_t &position) const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Operators.
+         */
+        /** @{ */
+        /**
+         * @brief Tells if the view holds parsed data.
+         * @return `true` if the view holds parsed data, otherwise, `false`.
+         */
+        CRONZ_NODISCARD_L1 operator bool() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Destructors.
+         */
+        /** @{ */
+        /**
+         * @brief Default destructor. Does nothing.
+         */
+        ~URLView() noexcept;
+
+        /** @} */
+    };
+
+CRONZ_END_MODULE_NAMESPACE
+
+#include "cronz/url/impl/view.ipp"
+
+#endif // CRONZ_URL_VIEW_HPP
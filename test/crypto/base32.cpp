@@ -0,0 +1,207 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/crypto/base32.hpp>
+
+#include "simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::string ReferenceBase32Encode(const std::vector<unsigned char> &data,
+                                      const Cronz::Crypto::Base32AlphabetType &alphabet) {
+        std::string encoded;
+        for (std::size_t bit = 0; bit < data.size() * 8; bit += 5) {
+            unsigned quintet = 0;
+            for (std::size_t i = bit; i < bit + 5; ++i)
+                quintet = (quintet << 1) | ((i < data.size() * 8) ? ((data[i / 8] >> (7 - i % 8)) & 1u) : 0u);
+
+            encoded.push_back(alphabet[quintet]);
+        }
+
+        return encoded;
+    }
+}
+
+TEST(Crypto, Base32) {
+    // Data, Base32, Base32hex
+    const std::vector<std::tuple<std::string, std::string, std::string>> vectors = {
+            {"", "", ""},
+            {"f", "MY======", "CO======"},
+            {"fo", "MZXQ====", "CPNG===="},
+            {"foo", "MZXW6===", "CPNMU==="},
+            {"foob", "MZXW6YQ=", "CPNMUOG="},
+            {"fooba", "MZXW6YTB", "CPNMUOJ1"},
+            {"foobar", "MZXW6YTBOI======", "CPNMUOJ1E8======"}
+    };
+
+    for (const auto &[data, base32, base32hex] : vectors) {
+        EXPECT_EQ(Cronz::Crypto::Base32Encode(data), base32);
+        EXPECT_EQ(Cronz::Crypto::Base32Encode(data, Cronz::Crypto::Base32HexAlphabet), base32hex);
+
+        const std::string unpadded = base32.substr(0, base32.find('='));
+        EXPECT_EQ(Cronz::Crypto::Base32Encode<false>(data), unpadded);
+        EXPECT_EQ(Cronz::Crypto::CalculateBase32EncodedLength<false>(data.length()), unpadded.length());
+        EXPECT_EQ(Cronz::Crypto::CalculateBase32DecodedLength(base32.data(), base32.length()), data.length());
+
+        std::string decoded;
+        ASSERT_TRUE(Cronz::Crypto::Base32Decode(base32, decoded)) << base32;
+        EXPECT_EQ(decoded, data);
+        ASSERT_TRUE(Cronz::Crypto::Base32Decode(unpadded, decoded)) << unpadded;
+        EXPECT_EQ(decoded, data);
+        ASSERT_TRUE(Cronz::Crypto::Base32Decode(base32hex, decoded, Cronz::Crypto::Base32HexAlphabetIndicesMap));
+        EXPECT_EQ(decoded, data);
+
+        // Either case is accepted by the default indices maps.
+        std::string lowercase = base32hex;
+        for (char &c : lowercase)
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+        std::vector<unsigned char> bytes;
+        ASSERT_TRUE(Cronz::Crypto::Base32Decode(lowercase, bytes, Cronz::Crypto::Base32HexAlphabetIndicesMap));
+        EXPECT_EQ(std::string(bytes.begin(), bytes.end()), data);
+    }
+
+    const Cronz::Crypto::Base32IndicesMapType strict = Cronz::Crypto::GenerateBase32IndicesMap(
+        Cronz::Crypto::Base32Alphabet);
+    std::string decoded;
+    EXPECT_FALSE(Cronz::Crypto::Base32Decode("mzxw6ytb", decoded, strict));
+    EXPECT_TRUE(Cronz::Crypto::Base32Decode("MZXW6YTB", decoded, strict));
+
+    const std::vector<std::string> invalid = {
+            "M", "MZX", "MZXW6Y", "M=======", "MZX=====", "MZXW6Y==", "MY=", "MY======MY======", "MZXW6YT1",
+            "MZXW6YTB=", "MZXW6YTBM", "MZ XW6YTB", "MZXW6YTB\x80"
+    };
+
+    for (const std::string &encoded : invalid)
+        EXPECT_FALSE(Cronz::Crypto::Base32Decode(encoded, decoded)) << encoded;
+}
+
+TEST(Crypto, Base32_Spans) {
+    const std::string foobar = "foobar";
+    const auto bytes = std::as_bytes(std::span(foobar.data(), foobar.length()));
+
+    char encoded[16];
+    std::size_t written;
+    ASSERT_TRUE(Cronz::Crypto::Base32Encode<true>(bytes, std::span(encoded), written));
+    EXPECT_EQ(std::string(encoded, written), "MZXW6YTBOI======");
+    ASSERT_TRUE(Cronz::Crypto::Base32Encode(bytes, std::span(encoded).first(10), written, false));
+    EXPECT_EQ(std::string(encoded, written), "MZXW6YTBOI");
+    EXPECT_FALSE(Cronz::Crypto::Base32Encode<true>(bytes, std::span(encoded).first(15), written));
+    EXPECT_EQ(written, 0u);
+
+    std::byte decoded[6];
+    ASSERT_TRUE(Cronz::Crypto::Base32Decode(std::span<const char>(encoded, 10), std::span(decoded), written));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(decoded), written), foobar);
+    EXPECT_FALSE(Cronz::Crypto::Base32Decode(std::span<const char>(encoded, 10), std::span(decoded).first(5),
+                                             written));
+
+    // Lengths are computed with integers only, so they stay exact for sizes a float cannot hold.
+    const std::size_t large = (static_cast<std::size_t>(1) << 60) + static_cast<std::size_t>(1);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase32EncodedLength<true>(large), (large / 5 + 1) * 8);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase32DecodedLength(Cronz::Crypto::CalculateBase32EncodedLength<false>(large)),
+              large);
+}
+
+TEST(Crypto, Base32_Vectorized) {
+    std::mt19937 random(32);
+
+    for (const auto level : AvailableLevels()) {
+        for (std::size_t length = 0; length < 300; ++length) {
+            std::vector<unsigned char> data(length);
+            for (unsigned char &byte : data)
+                byte = static_cast<unsigned char>(random());
+
+            for (const auto &alphabet : {Cronz::Crypto::Base32Alphabet, Cronz::Crypto::Base32HexAlphabet}) {
+                const std::string expected = ReferenceBase32Encode(data, alphabet);
+
+                // The kernels alone, which only take whole steps.
+                std::string characters(expected.length(), '\0');
+                const std::size_t encodedLength = Cronz::Internal::Base32EncodeBlocks(level, data.data(), length,
+                                                                                      characters.data(), alphabet);
+                ASSERT_EQ(encodedLength % 5, 0u);
+                ASSERT_EQ(characters.substr(0, encodedLength / 5 * 8), expected.substr(0, encodedLength / 5 * 8));
+
+                // The default indices maps are classified by ranges, in either case, and the others are looked up.
+                std::string mixed = expected;
+                for (std::size_t i = 0; i < mixed.length(); i += 3)
+                    mixed[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(mixed[i])));
+
+                const Cronz::Crypto::Base32IndicesMapType &map = (Cronz::Crypto::Base32Alphabet == alphabet)
+                                                                     ? Cronz::Crypto::Base32AlphabetIndicesMap
+                                                                     : Cronz::Crypto::Base32HexAlphabetIndicesMap;
+                const Cronz::Crypto::Base32IndicesMapType strict = Cronz::Crypto::GenerateBase32IndicesMap(alphabet);
+
+                for (const auto &[characters, indices] : {std::tie(expected, strict),
+                                                          std::tie(std::as_const(mixed), map)}) {
+                    std::vector<unsigned char> bytes(length + 16);
+                    const std::size_t decodedLength = Cronz::Internal::Base32DecodeBlocks(
+                        level, reinterpret_cast<const unsigned char*>(characters.data()), characters.length(),
+                        bytes.data(), indices);
+                    ASSERT_EQ(decodedLength,
+                              (Cronz::Internal::SIMDLevel::None == level) ? 0 : characters.length() / 16 * 16);
+                    ASSERT_TRUE(std::equal(bytes.begin(), bytes.begin() + decodedLength / 8 * 5, data.begin()));
+
+                    // A fault stops the kernels before its step.
+                    if (!characters.empty()) {
+                        // Control characters 0x10-0x19 are brought into the digit ranges by setting bit 5.
+                        for (const char fault : {'=', '1', '{', '@', '\x80', '\x10', '\x11', '\x12', '\x13', '\x14',
+                                                 '\x15', '\x16', '\x17', '\x18', '\x19'}) {
+                            std::string faulty = characters;
+                            const std::size_t at = random() % faulty.length();
+                            faulty[at] = fault;
+                            if (Cronz::Crypto::Base32InvalidIndex == indices[static_cast<unsigned char>(fault)]) {
+                                ASSERT_LE(Cronz::Internal::Base32DecodeBlocks(
+                                              level, reinterpret_cast<const unsigned char*>(faulty.data()),
+                                              faulty.length(), bytes.data(), indices), at) << static_cast<int>(fault);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Through the public functions, which dispatch on the detected level.
+    for (std::size_t length = 0; length < 1000; length += 7) {
+        std::string data(length, '\0');
+        for (char &c : data)
+            c = static_cast<char>(random());
+
+        const std::string encoded = Cronz::Crypto::Base32Encode<false>(data, Cronz::Crypto::Base32HexAlphabet);
+        EXPECT_EQ(encoded, ReferenceBase32Encode(std::vector<unsigned char>(data.begin(), data.end()),
+                                                 Cronz::Crypto::Base32HexAlphabet));
+
+        std::string decoded;
+        ASSERT_TRUE(Cronz::Crypto::Base32Decode(encoded, decoded, Cronz::Crypto::Base32HexAlphabetIndicesMap));
+        EXPECT_EQ(decoded, data);
+
+        if (!encoded.empty()) {
+            std::string faulty = encoded;
+            faulty[random() % faulty.length()] = 'W';
+            EXPECT_FALSE(Cronz::Crypto::Base32Decode(faulty, decoded, Cronz::Crypto::Base32HexAlphabetIndicesMap));
+        }
+    }
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -10,8 +10,37 @@
 
 #include <cronz/crypto/base64.hpp>
 
+#include "simd.hpp"
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace {
+    std::string ReferenceBase64Encode(const std::vector<unsigned char> &data,
+                                      const Cronz::Crypto::Base64AlphabetType &alphabet) {
+        std::string encoded;
+        for (std::size_t bit = 0; bit < data.size() * 8; bit += 6) {
+            unsigned sextet = 0;
+            for (std::size_t i = bit; i < bit + 6; ++i)
+                sextet = (sextet << 1) | ((i < data.size() * 8) ? ((data[i / 8] >> (7 - i % 8)) & 1u) : 0u);
+
+            encoded.push_back(alphabet[sextet]);
+        }
+
+        return encoded;
+    }
+}
+
 TEST(Crypto, Base64) {
     // String to be encoded, Base64 encoded string, Base64 encoded string (padded)
     // https://datatracker.ietf.org/doc/html/rfc4648#section-10
@@ -50,6 +79,366 @@ TEST(Crypto, Base64) {
     }
 }
 
+TEST(Crypto, Base64_Vectorized) {
+    Cronz::Crypto::Base64AlphabetType custom = Cronz::Crypto::Base64Alphabet;
+    std::mt19937 random(41);
+    std::shuffle(custom.begin(), custom.end(), random);
+
+    const std::vector<Cronz::Crypto::Base64AlphabetType> alphabets = {
+            Cronz::Crypto::Base64Alphabet, Cronz::Crypto::Base64AlphabetSafe, custom
+    };
+
+    for (const Cronz::Internal::SIMDLevel level : AvailableLevels()) {
+        for (const Cronz::Crypto::Base64AlphabetType &alphabet : alphabets) {
+            const Cronz::Internal::Base64DecodingTable table = Cronz::Internal::GenerateBase64DecodingTable(
+                Cronz::Crypto::GenerateBase64IndicesMap(alphabet));
+
+            for (std::size_t length = 0; length < 300; ++length) {
+                std::vector<unsigned char> data(length);
+                for (unsigned char &byte : data)
+                    byte = static_cast<unsigned char>(random());
+
+                const std::string expected = ReferenceBase64Encode(data, alphabet);
+
+                std::string encoded(expected.length(), '#');
+                const std::size_t processed = Cronz::Internal::Base64EncodeBlocks(level, data.data(), length,
+                                                                                  encoded.data(), alphabet);
+                ASSERT_EQ(processed % 3, 0u);
+                ASSERT_LE(processed, length);
+                ASSERT_EQ(encoded.substr(0, processed / 3 * 4), expected.substr(0, processed / 3 * 4));
+
+                if (Cronz::Internal::SIMDLevel::None == level) {
+                    ASSERT_EQ(processed, 0u);
+                }
+                else {
+                    ASSERT_GE(processed + 16, length);
+                }
+
+                std::string characters(length / 4 * 4, '\0');
+                for (char &character : characters)
+                    character = alphabet[random() % 64];
+
+                std::string decoded(characters.length(), '\0');
+                const std::size_t consumed = Cronz::Internal::Base64DecodeBlocks(
+                    level, reinterpret_cast<const unsigned char*>(characters.data()), characters.length(),
+                    reinterpret_cast<unsigned char*>(decoded.data()), table);
+                ASSERT_EQ(consumed % 4, 0u);
+                ASSERT_EQ(ReferenceBase64Encode(std::vector<unsigned char>(decoded.begin(), decoded.begin() +
+                                                    static_cast<std::ptrdiff_t>(consumed / 4 * 3)), alphabet),
+                          characters.substr(0, consumed));
+
+                if (Cronz::Internal::SIMDLevel::None != level) {
+                    ASSERT_GE(consumed + 16, characters.length());
+                }
+
+                // No invalid character is ever decoded.
+                if (!characters.empty()) {
+                    const std::size_t invalid = random() % characters.length();
+                    characters[invalid] = static_cast<char>((0 == random() % 2) ? '=' : 0x80 + random() % 128);
+
+                    ASSERT_LE(Cronz::Internal::Base64DecodeBlocks(
+                                  level, reinterpret_cast<const unsigned char*>(characters.data()),
+                                  characters.length(), reinterpret_cast<unsigned char*>(decoded.data()), table),
+                              invalid);
+                }
+            }
+        }
+    }
+
+    // Through the public interface, with whatever level is detected.
+    std::string data(100000, '\0');
+    for (char &byte : data)
+        byte = static_cast<char>(random());
+
+    for (const Cronz::Crypto::Base64AlphabetType &alphabet : alphabets) {
+        const std::string encoded = Cronz::Crypto::Base64Encode<true>(data, alphabet);
+        EXPECT_EQ(encoded, ReferenceBase64Encode(std::vector<unsigned char>(data.begin(), data.end()), alphabet) +
+                           "==");
+        EXPECT_EQ(Cronz::Crypto::Base64Encode<false>(data, alphabet), encoded.substr(0, encoded.length() - 2));
+    }
+
+    std::string characters(100000, 'Z');
+    characters += "Zg==";
+
+    std::string decoded;
+    ASSERT_TRUE(Cronz::Crypto::Base64Decode<std::string>(characters, decoded));
+    ASSERT_EQ(decoded.length(), 75001u);
+    EXPECT_EQ(Cronz::Crypto::Base64Encode<true>(decoded), characters);
+
+    characters[50001] = '*';
+    EXPECT_FALSE(Cronz::Crypto::Base64Decode<std::string>(characters, decoded));
+}
+
+TEST(Crypto, Base64_Spans) {
+    // Lengths are computed with integers only, so they stay exact for sizes a float cannot hold.
+    const std::size_t large = (static_cast<std::size_t>(1) << 60) + static_cast<std::size_t>(1);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase64EncodedLength<true>(large), (large / 3 + 1) * 4);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase64EncodedLength<false>(large), large / 3 * 4 + 3);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase64DecodedLength(large / 3 * 4 + 3), large);
+
+    for (std::size_t length = 0; length < 10; ++length) {
+        EXPECT_EQ(Cronz::Crypto::CalculateBase64DecodedLength(
+                      Cronz::Crypto::CalculateBase64EncodedLength<false>(length)), length);
+    }
+
+    EXPECT_EQ(Cronz::Crypto::CalculateBase64DecodedLength("Zm9vYg==", 8), 4u);
+    EXPECT_EQ(Cronz::Crypto::CalculateBase64DecodedLength("Zm9vYmE=", 8), 5u);
+
+    // Into fixed buffers, with the exact lengths.
+    const std::string foobar = "foobar";
+    const auto bytes = std::as_bytes(std::span(foobar.data(), foobar.length()));
+
+    char encoded[8];
+    std::size_t written;
+    ASSERT_TRUE(Cronz::Crypto::Base64Encode<true>(bytes.first(4), std::span(encoded), written));
+    EXPECT_EQ(std::string(encoded, written), "Zm9vYg==");
+    ASSERT_TRUE(Cronz::Crypto::Base64Encode(bytes.first(5), std::span(encoded, 7), written, false));
+    EXPECT_EQ(std::string(encoded, written), "Zm9vYmE");
+    EXPECT_FALSE(Cronz::Crypto::Base64Encode<true>(bytes.first(4), std::span(encoded, 7), written));
+    EXPECT_EQ(written, 0u);
+
+    std::byte decoded[6];
+    ASSERT_TRUE(Cronz::Crypto::Base64Decode(std::span<const char>("Zm9vYmE=", 8), std::span(decoded, 5), written));
+    EXPECT_EQ(written, 5u);
+    EXPECT_EQ(std::memcmp(decoded, "fooba", 5), 0);
+    EXPECT_FALSE(Cronz::Crypto::Base64Decode(std::span<const char>("Zm9vYmFy", 8), std::span(decoded, 5), written));
+
+    // Invalid trailing groups.
+    for (const std::string invalid : {"Zm9vY", "Zm9vYmFy=", "Zm9vYm=y", "Zm9vYg=", "Zm9v====", "Zm9vYmF*"}) {
+        EXPECT_FALSE(Cronz::Crypto::Base64Decode(std::span(invalid.data(), invalid.length()), std::span(decoded),
+                                                 written)) << invalid;
+    }
+
+    // In place, across the vectorized kernels as well.
+    std::mt19937 random(43);
+    for (std::size_t length = 0; length < 200; ++length) {
+        std::string data(length, '\0');
+        for (char &byte : data)
+            byte = static_cast<char>(random());
+
+        for (const bool padded : {true, false}) {
+            std::string characters = Cronz::Crypto::Base64Encode(data, padded);
+            ASSERT_TRUE(Cronz::Crypto::Base64DecodeInPlace(std::span(characters), written)) << length;
+            ASSERT_EQ(characters.substr(0, written), data) << length;
+        }
+    }
+
+    // Every return type holds the decoded bytes.
+    EXPECT_EQ(Cronz::Crypto::Base64Decode<std::vector<unsigned char>>("Zm9vYmE"),
+              std::vector<unsigned char>({'f', 'o', 'o', 'b', 'a'}));
+    EXPECT_EQ(Cronz::Crypto::Base64Decode<std::vector<char>>(std::string("Zm8=")), std::vector<char>({'f', 'o'}));
+}
+
+TEST(Crypto, Base64_Validation) {
+    // Index 0 is told apart from the characters outside the alphabet.
+    EXPECT_TRUE(Cronz::Crypto::IsInBase64AlphabetIndicesMap('A', Cronz::Crypto::Base64AlphabetIndicesMap));
+    EXPECT_FALSE(Cronz::Crypto::IsInBase64AlphabetIndicesMap('*', Cronz::Crypto::Base64AlphabetIndicesMap));
+    EXPECT_FALSE(Cronz::Crypto::IsInBase64AlphabetIndicesMap('\xC3', Cronz::Crypto::Base64AlphabetIndicesMap));
+    EXPECT_EQ(Cronz::Crypto::Base64Decode<std::string>("AAAA"), std::string(3, '\0'));
+
+    // Base64 encoded string, valid when padded, valid when unpadded
+    const std::vector<std::tuple<std::string, bool, bool>> Cases = {
+            {"", true, true},
+            {"Zg==", true, false},
+            {"Zg", false, true},
+            {"Zm8=", true, false},
+            {"Zm8", false, true},
+            {"Zm9vYmFy", true, true},
+            {"AAAA", true, true},
+            {"Zh==", false, false},
+            {"Zm9=", false, false},
+            {"Z", false, false},
+            {"Z===", false, false},
+            {"Zm9vY", false, false},
+            {"Zg=", false, false},
+            {"Zg===", false, false},
+            {"Zm9v====", false, false},
+            {"Zg==Zm8=", false, false},
+            {"Zm=v", false, false},
+            {"Zm9v YmFy", false, false},
+            {"Zm9-", false, false},
+            {"Zm9v\x80mFy", false, false}
+    };
+
+    for (const auto &[encoded, padded, unpadded] : Cases) {
+        EXPECT_EQ(Cronz::Crypto::IsValidBase64<true>(encoded), padded) << encoded;
+        EXPECT_EQ(Cronz::Crypto::IsValidBase64<false>(encoded), unpadded) << encoded;
+
+        std::string decoded;
+        EXPECT_EQ(Cronz::Crypto::Base64DecodeStrict<true>(encoded, decoded), padded) << encoded;
+        if (padded) {
+            EXPECT_EQ(Cronz::Crypto::Base64Encode<true>(decoded), encoded);
+        }
+
+        std::vector<unsigned char> bytes;
+        EXPECT_EQ(Cronz::Crypto::Base64DecodeStrict<false>(encoded, bytes), unpadded) << encoded;
+    }
+
+    EXPECT_TRUE(Cronz::Crypto::IsValidBase64<false>("Zm9-_w", Cronz::Crypto::Base64AlphabetSafeIndicesMap));
+    EXPECT_FALSE(Cronz::Crypto::IsValidBase64<false>("Zm9+/w", Cronz::Crypto::Base64AlphabetSafeIndicesMap));
+
+    // Every level agrees with the indices map, for alphabets classified by ranges and by lookup.
+    Cronz::Crypto::Base64AlphabetType shuffled = Cronz::Crypto::Base64Alphabet;
+    std::mt19937 random(44);
+    std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+    for (const Cronz::Crypto::Base64AlphabetType &alphabet : {Cronz::Crypto::Base64Alphabet,
+                                                              Cronz::Crypto::Base64AlphabetSafe, shuffled}) {
+        const Cronz::Crypto::Base64IndicesMapType map = Cronz::Crypto::GenerateBase64IndicesMap(alphabet);
+
+        for (const auto level : AvailableLevels()) {
+            for (std::size_t length = 0; length < 300; ++length) {
+                std::string characters(length, '\0');
+                for (char &character : characters)
+                    character = alphabet[random() % 64];
+
+                ASSERT_EQ(Cronz::Internal::Base64ValidateBlocks(
+                              level, reinterpret_cast<const unsigned char*>(characters.data()), length, map),
+                          (Cronz::Internal::SIMDLevel::None == level)         ? 0
+                          : (Cronz::Internal::SIMDLevel::AVX512VBMI == level) ? length
+                                                                              : length / 16 * 16);
+
+                if (0 != length) {
+                    const std::size_t invalid = random() % length;
+                    characters[invalid] = static_cast<char>(random());
+                    if (Cronz::Crypto::IsInBase64AlphabetIndicesMap(characters[invalid], map))
+                        continue;
+
+                    ASSERT_LE(Cronz::Internal::Base64ValidateBlocks(
+                                  level, reinterpret_cast<const unsigned char*>(characters.data()), length, map),
+                              invalid) << length;
+                }
+            }
+        }
+    }
+
+    // Through the public interface, on round trips and single faults.
+    for (std::size_t length = 0; length < 200; ++length) {
+        std::string data(length, '\0');
+        for (char &byte : data)
+            byte = static_cast<char>(random());
+
+        const std::string encoded = Cronz::Crypto::Base64Encode<true>(data);
+        ASSERT_TRUE(Cronz::Crypto::IsValidBase64<true>(encoded)) << length;
+
+        std::byte decoded[200];
+        std::size_t written;
+        ASSERT_TRUE(Cronz::Crypto::Base64DecodeStrict<true>(std::span(encoded.data(), encoded.length()),
+                                                            std::span(decoded), written)) << length;
+        ASSERT_EQ(std::string(reinterpret_cast<const char*>(decoded), written), data);
+
+        if (!encoded.empty()) {
+            std::string faulty = encoded;
+            faulty[random() % faulty.length()] = '.';
+            EXPECT_FALSE(Cronz::Crypto::IsValidBase64<true>(faulty)) << faulty;
+            EXPECT_FALSE(Cronz::Crypto::Base64DecodeStrict<true>(std::span(faulty.data(), faulty.length()),
+                                                                 std::span(decoded), written)) << faulty;
+        }
+
+        // Setting an unused trailing bit keeps the bytes, but not the canonical form.
+        const std::size_t characters = Cronz::Crypto::CalculateBase64EncodedLength<false>(length);
+        if (0 != length % 3) {
+            std::string noncanonical = encoded;
+            noncanonical[characters - 1] = Cronz::Crypto::Base64Alphabet[
+                Cronz::Crypto::Base64AlphabetIndicesMap[static_cast<unsigned char>(encoded[characters - 1])] | 1];
+
+            EXPECT_EQ(Cronz::Crypto::Base64Decode<std::string>(noncanonical), data);
+            EXPECT_FALSE(Cronz::Crypto::IsValidBase64<true>(noncanonical)) << noncanonical;
+            EXPECT_FALSE(Cronz::Crypto::Base64DecodeStrict<true>(std::span(noncanonical.data(), characters + 1),
+                                                                 std::span(decoded), written)) << noncanonical;
+        }
+    }
+}
+
+namespace {
+    constexpr Cronz::Crypto::Base64AlphabetType ReversedBase64Alphabet = [] {
+        Cronz::Crypto::Base64AlphabetType alphabet = Cronz::Crypto::Base64Alphabet;
+        std::reverse(alphabet.begin(), alphabet.end());
+        return alphabet;
+    }();
+}
+
+TEST(Crypto, Base64_CompileTimeAlphabets) {
+    // Evaluated at compile time, through the arithmetic mapping.
+    static_assert([] {
+        constexpr std::array<std::byte, 2> data = {std::byte{0xFF}, std::byte{0xEF}};
+        std::array<char, 3> encoded{};
+        std::size_t written = 0;
+        return Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64AlphabetSafe, false>(std::span(data),
+                                                                                     std::span(encoded), written) &&
+               std::string_view(encoded.data(), written) == "_-8";
+    }());
+    static_assert([] {
+        constexpr std::string_view encoded = "Zm9vYmE=";
+        std::array<std::byte, 5> decoded{};
+        std::size_t written = 0;
+        return Cronz::Crypto::Base64Decode<Cronz::Crypto::Base64Alphabet>(std::span(encoded.data(), encoded.length()),
+                                                                          std::span(decoded), written) &&
+               5 == written && std::byte{'a'} == decoded[4];
+    }());
+    static_assert([] {
+        constexpr std::string_view encoded = "Zm9v.mE=";
+        std::array<std::byte, 5> decoded{};
+        std::size_t written = 0;
+        return !Cronz::Crypto::Base64Decode<Cronz::Crypto::Base64Alphabet>(std::span(encoded.data(), encoded.length()),
+                                                                           std::span(decoded), written);
+    }());
+
+    // The same results as the run-time alphabets, for every length, alphabet and padding, including custom alphabets.
+    std::mt19937 random(46);
+    for (std::size_t length = 0; length < 300; ++length) {
+        std::string data(length, '\0');
+        for (char &c : data)
+            c = static_cast<char>(random());
+
+        EXPECT_EQ((Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64Alphabet, true>(data)),
+                  Cronz::Crypto::Base64Encode<true>(data, Cronz::Crypto::Base64Alphabet));
+        EXPECT_EQ((Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64AlphabetSafe, false>(data)),
+                  Cronz::Crypto::Base64Encode<false>(data, Cronz::Crypto::Base64AlphabetSafe));
+
+        const std::string custom = Cronz::Crypto::Base64Encode<ReversedBase64Alphabet, true>(data);
+        ASSERT_EQ(custom, Cronz::Crypto::Base64Encode<true>(data, ReversedBase64Alphabet));
+
+        std::string decoded;
+        ASSERT_TRUE(Cronz::Crypto::Base64Decode<ReversedBase64Alphabet>(custom, decoded)) << custom;
+        EXPECT_EQ(decoded, data);
+
+        const std::string safe = Cronz::Crypto::Base64Encode<false>(data, Cronz::Crypto::Base64AlphabetSafe);
+        std::vector<unsigned char> bytes;
+        ASSERT_TRUE(Cronz::Crypto::Base64Decode<Cronz::Crypto::Base64AlphabetSafe>(safe, bytes)) << safe;
+        EXPECT_EQ(std::string(bytes.begin(), bytes.end()), data);
+
+        // Faults are rejected as by the indices maps, anywhere in the string.
+        if (!safe.empty()) {
+            std::string faulty = safe;
+            faulty[random() % faulty.length()] = '+';
+            EXPECT_FALSE(Cronz::Crypto::Base64Decode<Cronz::Crypto::Base64AlphabetSafe>(faulty, decoded)) << faulty;
+            EXPECT_FALSE(Cronz::Crypto::Base64Decode<std::string>(faulty, decoded,
+                                                                  Cronz::Crypto::Base64AlphabetSafeIndicesMap));
+        }
+    }
+
+    // Every character is mapped as by the indices maps.
+    for (int c = 0; c < 256; ++c) {
+        const std::string encoded = std::string("AA") + static_cast<char>(c) + 'A';
+        std::string expected;
+        std::string decoded;
+        EXPECT_EQ(Cronz::Crypto::Base64Decode<Cronz::Crypto::Base64AlphabetSafe>(encoded, decoded),
+                  Cronz::Crypto::Base64Decode<std::string>(encoded, expected,
+                                                           Cronz::Crypto::Base64AlphabetSafeIndicesMap)) << c;
+        EXPECT_EQ(decoded, expected) << c;
+    }
+
+    // Too small buffers.
+    std::array<char, 3> small;
+    std::size_t written;
+    EXPECT_FALSE((Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64Alphabet, true>(
+        std::as_bytes(std::span("ab", 2)), std::span(small), written)));
+    EXPECT_TRUE((Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64Alphabet, false>(
+        std::as_bytes(std::span("ab", 2)), std::span(small), written)));
+    EXPECT_EQ(std::string(small.data(), written), "YWI");
+}
+
 int main() {
     testing::InitGoogleTest();
     return RUN_ALL_TESTS();
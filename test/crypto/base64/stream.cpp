@@ -0,0 +1,172 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/crypto/base64/stream.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string RandomData(std::mt19937 &random, const std::size_t &length) {
+        std::string data(length, '\0');
+        for (char &byte : data)
+            byte = static_cast<char>(random());
+
+        return data;
+    }
+
+    // Splits `length` into chunks of random sizes.
+    std::vector<std::size_t> RandomChunks(std::mt19937 &random, const std::size_t &length) {
+        std::vector<std::size_t> chunks;
+        for (std::size_t pos = 0; pos < length;) {
+            const std::size_t chunk = std::min<std::size_t>(length - pos, random() % ((0 == random() % 4) ? 300 : 8));
+            chunks.push_back(chunk);
+            pos += chunk;
+        }
+
+        return chunks;
+    }
+}
+
+TEST(Base64Stream, Encoding) {
+    std::mt19937 random(42);
+
+    for (std::size_t length = 0; length < 1000; length += 1 + length / 10) {
+        const std::string data = RandomData(random, length);
+
+        for (const bool padded : {true, false}) {
+            const std::string expected = Cronz::Crypto::Base64Encode(data, padded);
+
+            for (const std::size_t lineLength : {static_cast<std::size_t>(0),
+                                                 Cronz::Crypto::Base64Encoder::LineLengthPEM,
+                                                 Cronz::Crypto::Base64Encoder::LineLengthMIME}) {
+                for (const bool crlf : {true, false}) {
+                    Cronz::Crypto::Base64Encoder encoder(Cronz::Crypto::Base64Alphabet, padded, lineLength, crlf);
+
+                    // Into fixed buffers of the advertised sizes.
+                    std::string encoded;
+                    std::size_t pos = 0;
+                    for (const std::size_t chunk : RandomChunks(random, length)) {
+                        std::vector<char> buffer(encoder.maxUpdateLength(chunk));
+                        const std::size_t written = encoder.update(data.data() + pos, chunk, buffer.data());
+                        ASSERT_LE(written, buffer.size());
+
+                        encoded.append(buffer.data(), written);
+                        pos += chunk;
+                    }
+
+                    std::vector<char> buffer(encoder.maxFinalLength());
+                    encoded.append(buffer.data(), encoder.finalize(buffer.data()));
+
+                    // Lines are full but the last one, and not terminated.
+                    std::string unwrapped;
+                    std::size_t column = 0;
+                    for (std::size_t i = 0; i < encoded.size(); ++i) {
+                        if ('\n' == encoded[i] || '\r' == encoded[i]) {
+                            ASSERT_NE(lineLength, 0u);
+                            ASSERT_EQ(column, lineLength);
+                            ASSERT_EQ(encoded.substr(i, crlf ? 2 : 1), crlf ? "\r\n" : "\n");
+                            ASSERT_LT(i + (crlf ? 2 : 1), encoded.size());
+
+                            i += crlf ? 1 : 0;
+                            column = 0;
+                            continue;
+                        }
+
+                        unwrapped.push_back(encoded[i]);
+                        ++column;
+                    }
+
+                    ASSERT_EQ(unwrapped, expected) << length;
+
+                    // Back, in chunks of random sizes as well.
+                    Cronz::Crypto::Base64Decoder decoder;
+                    std::string decoded;
+                    pos = 0;
+                    for (const std::size_t chunk : RandomChunks(random, encoded.length())) {
+                        ASSERT_TRUE(decoder.update(encoded.data() + pos, chunk, decoded));
+                        pos += chunk;
+                    }
+
+                    ASSERT_TRUE(decoder.finalize(decoded));
+                    ASSERT_EQ(decoded, data);
+                }
+            }
+        }
+    }
+
+    // The encoder can be reused once finalized.
+    Cronz::Crypto::Base64Encoder encoder(Cronz::Crypto::Base64AlphabetSafe, false);
+    std::string encoded;
+    ASSERT_TRUE(encoder.update("fo", 2, encoded));
+    ASSERT_TRUE(encoder.finalize(encoded));
+    ASSERT_TRUE(encoder.update("\xfb\xff", 2, encoded));
+    ASSERT_TRUE(encoder.finalize(encoded));
+    EXPECT_EQ(encoded, "Zm8-_8");
+}
+
+TEST(Base64Stream, Decoding) {
+    // Encoded, valid, decoded
+    const std::vector<std::tuple<std::string, bool, std::string>> cases = {
+            {"", true, ""},
+            {"Zg==", true, "f"},
+            {"Zg", true, "f"},
+            {"Zm8=", true, "fo"},
+            {"Zm9vYmFy", true, "foobar"},
+            {" Zm9v\r\nYmFy\n\t", true, "foobar"},
+            {"Zm\n9v Ym\r\nE =\n", true, "fooba"},
+            {"Zg==\r\n", true, "f"},
+            {"Z", false, ""},
+            {"Zm9vY", false, "foo"},
+            {"Zg=", false, ""},
+            {"Z===", false, ""},
+            {"Zm8==", false, "fo"},
+            {"Zg==Zm8=", false, "f"},
+            {"Zg==\nZ", false, "f"},
+            {"Zm9v*mFy", false, "foo"},
+            {"Zm9v\x80mFy", false, "foo"}
+    };
+
+    for (const auto &[encoded, valid, expected] : cases) {
+        // One character at a time, and at once.
+        for (const std::size_t chunk : {static_cast<std::size_t>(1), encoded.length() + 1}) {
+            Cronz::Crypto::Base64Decoder decoder;
+            std::vector<unsigned char> decoded;
+
+            bool result = true;
+            for (std::size_t pos = 0; result && pos < encoded.length(); pos += chunk)
+                result = decoder.update(encoded.data() + pos, std::min(chunk, encoded.length() - pos), decoded);
+
+            result = decoder.finalize(decoded) && result;
+            EXPECT_EQ(result, valid) << encoded;
+            EXPECT_EQ(std::string(decoded.begin(), decoded.end()), expected) << encoded;
+        }
+    }
+
+    // Whitespace is invalid unless skipped.
+    Cronz::Crypto::Base64Decoder decoder(Cronz::Crypto::Base64AlphabetIndicesMap, false);
+    std::string decoded;
+    EXPECT_FALSE(decoder.update("Zm9v\nYmFy", 9, decoded));
+    EXPECT_FALSE(decoder.update("Zm9v", 4, decoded));
+
+    decoder.reset();
+    decoded.clear();
+    EXPECT_TRUE(decoder.update("Zm9vYmFy", 8, decoded));
+    EXPECT_TRUE(decoder.finalize(decoded));
+    EXPECT_EQ(decoded, "foobar");
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,213 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/crypto/hash.hpp>
+#include <cronz/internal/hash.hpp>
+#include <cronz/ip/address/ip.hpp>
+
+#include "simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace {
+    // Bytes of the reference vectors, which were computed with xxHash 0.8.
+    std::string TestData() {
+        std::string data(static_cast<std::size_t>(6000), '\0');
+        for (std::size_t i = 0; i < data.length(); ++i)
+            data[i] = static_cast<char>(((i * static_cast<std::size_t>(2654435761)) & 0xFFFFFFFF) >> 24);
+
+        return data;
+    }
+}
+
+TEST(Crypto, Hash) {
+    const std::string data = TestData();
+    constexpr auto zero = static_cast<std::uint64_t>(0);
+    constexpr auto seed = static_cast<std::uint64_t>(0x9E3779B97F4A7C15ull);
+
+    // Length, seed, 64-bit hash, 128-bit hash
+    const std::vector<std::tuple<std::size_t, std::uint64_t, std::uint64_t, Cronz::Crypto::Hash128Type>> vectors = {
+            {static_cast<std::size_t>(0), zero, 0x2D06800538D394C2ull,
+             {0x6001C324468D497Full, 0x99AA06D3014798D8ull}},
+            {static_cast<std::size_t>(1), zero, 0xC44BDFF4074EECDBull,
+             {0xC44BDFF4074EECDBull, 0xA6CD5E9392000F6Aull}},
+            {static_cast<std::size_t>(3), zero, 0xE14090F554A5EA90ull,
+             {0xE14090F554A5EA90ull, 0x977FCBC0448B49F6ull}},
+            {static_cast<std::size_t>(4), zero, 0x2E8D078A566E9749ull,
+             {0x4EE6926F0426173Eull, 0x4E82B36688C5328Full}},
+            {static_cast<std::size_t>(8), zero, 0xCD1C7F88482FCAEFull,
+             {0x79D85ADAEEFD615Eull, 0x7B4966A681F18D57ull}},
+            {static_cast<std::size_t>(9), zero, 0xBFE43DEF699FA9E3ull,
+             {0xEE5940D4DF4715AEull, 0x200D098A7113E15Full}},
+            {static_cast<std::size_t>(16), zero, 0x81E9EB8634460BB9ull,
+             {0x37286A19CF622308ull, 0x78E8AB538D3ACAABull}},
+            {static_cast<std::size_t>(17), zero, 0x9998430FD0A655BEull,
+             {0x33BED349EC1C0CE7ull, 0x1EA709ADA2B9C32Eull}},
+            {static_cast<std::size_t>(64), zero, 0x22A06B30C4C72936ull,
+             {0xA6E3FFEEDC6985DDull, 0x5834551911DE3391ull}},
+            {static_cast<std::size_t>(128), zero, 0x75ECA5C5D5594884ull,
+             {0xE1F0636051CCD2BEull, 0x5AC741C59C95D36Aull}},
+            {static_cast<std::size_t>(129), zero, 0xA05DA42E7A4E4667ull,
+             {0xCFB3FED667226458ull, 0x1240F4D960139642ull}},
+            {static_cast<std::size_t>(240), zero, 0x5EB2467C8C9E3969ull,
+             {0xB2E6947C477A4AB0ull, 0x640A6149838A7599ull}},
+            {static_cast<std::size_t>(241), zero, 0x2D431E984C441F15ull,
+             {0x2D431E984C441F15ull, 0xE817E20E53E42A8Cull}},
+            {static_cast<std::size_t>(1024), zero, 0xE99DEF1145F12936ull,
+             {0xE99DEF1145F12936ull, 0xDF4C8B9FF9715101ull}},
+            {static_cast<std::size_t>(1025), zero, 0x83CBA9B371E4E7F4ull,
+             {0x83CBA9B371E4E7F4ull, 0x63E845AAB7EB695Full}},
+            {static_cast<std::size_t>(5000), zero, 0xB9DAEDE5F99F736Eull,
+             {0xB9DAEDE5F99F736Eull, 0xDF8BD4DDB16D1D1Cull}},
+            {static_cast<std::size_t>(0), seed, 0x602B0E2CD6662C8Bull,
+             {0x4CA5176998171787ull, 0xD142977A2CCA554Bull}},
+            {static_cast<std::size_t>(1), seed, 0x062B185E4E01441Aull,
+             {0x062B185E4E01441Aull, 0xE366B8C99A31DF50ull}},
+            {static_cast<std::size_t>(3), seed, 0xF5ABC7F9D1539843ull,
+             {0xF5ABC7F9D1539843ull, 0x6A2901C9EF1A55EAull}},
+            {static_cast<std::size_t>(4), seed, 0x80EB1FBA34AF62CCull,
+             {0x12D7850531015C1Bull, 0x336FF718AA9427AAull}},
+            {static_cast<std::size_t>(8), seed, 0x8813149E639DA876ull,
+             {0x588F3D76FE67DBCFull, 0x852D888E6BC40E50ull}},
+            {static_cast<std::size_t>(9), seed, 0x1D2C4851ECD580C9ull,
+             {0xAEB8F767389BCC1Cull, 0x2645BF905A2E794Dull}},
+            {static_cast<std::size_t>(16), seed, 0x7F7F704E06138A8Aull,
+             {0x226180D9A5FBB031ull, 0x704ACBA5A90B9C2Cull}},
+            {static_cast<std::size_t>(17), seed, 0x2D4B1D5B644B3FE6ull,
+             {0xDD85A15B60DAAFE1ull, 0x13EFC011DCC48BD8ull}},
+            {static_cast<std::size_t>(64), seed, 0x581BCDE3ABB84C27ull,
+             {0x2849369E414D07B8ull, 0xBF0F9B490286D533ull}},
+            {static_cast<std::size_t>(128), seed, 0x27EF5B319B50EA46ull,
+             {0x3CF84D6E198D5B3Bull, 0xCAF7AE1C4C9BF12Full}},
+            {static_cast<std::size_t>(129), seed, 0xB4F2C57C09E1E2E4ull,
+             {0xD727FE7F59374917ull, 0xD8CA44D4A35753FEull}},
+            {static_cast<std::size_t>(240), seed, 0x0329AA09C20D9CD6ull,
+             {0xB4B29EDB4B27E7ACull, 0x5E2A50919E2FEFDFull}},
+            {static_cast<std::size_t>(241), seed, 0x67E2CF13C7452CBCull,
+             {0x67E2CF13C7452CBCull, 0xAD9F5070239E35D0ull}},
+            {static_cast<std::size_t>(1024), seed, 0x709FA517CF5D6E00ull,
+             {0x709FA517CF5D6E00ull, 0xBBC91324C7092841ull}},
+            {static_cast<std::size_t>(1025), seed, 0x18C39AA411C5DEB2ull,
+             {0x18C39AA411C5DEB2ull, 0xDC9CA7D421A803C8ull}},
+            {static_cast<std::size_t>(5000), seed, 0x1CFFC12D6E9F2A6Full,
+             {0x1CFFC12D6E9F2A6Full, 0xC0AE79F0350F52D8ull}}
+    };
+
+    for (const auto &[length, s, hash64, hash128] : vectors) {
+        const std::string input = data.substr(0, length);
+        const auto bytes = std::as_bytes(std::span(input.data(), input.length()));
+
+        EXPECT_EQ(Cronz::Crypto::Hash64(input, s), hash64) << length << ' ' << s;
+        EXPECT_EQ(Cronz::Crypto::Hash64(bytes, s), hash64) << length << ' ' << s;
+        EXPECT_EQ(Cronz::Crypto::Hash128(input, s), hash128) << length << ' ' << s;
+        EXPECT_EQ(Cronz::Crypto::Hash128(bytes, s), hash128) << length << ' ' << s;
+        EXPECT_EQ(Cronz::Internal::HashBytes(input.data(), input.length(), s), hash64) << length << ' ' << s;
+
+        // Every instruction set level gives the same hashes.
+        for (const Cronz::Internal::SIMDLevel level : AvailableLevels()) {
+            const auto id = static_cast<int>(level);
+            const Cronz::Internal::UInt128 hash = Cronz::Internal::XXH3Hash128(level, input.data(), length, s);
+
+            EXPECT_EQ(Cronz::Internal::XXH3Hash64(level, input.data(), length, s), hash64) << length << ' ' << id;
+            EXPECT_EQ(hash.low, hash128.low) << length << ' ' << id;
+            EXPECT_EQ(hash.high, hash128.high) << length << ' ' << id;
+        }
+    }
+
+    EXPECT_EQ(Cronz::Crypto::Hash64(std::string("abc")), static_cast<std::uint64_t>(0x78AF5F94892F3950ull));
+    EXPECT_NE(Cronz::Crypto::Hash64(std::string("abc"), seed), Cronz::Crypto::Hash64(std::string("abc")));
+}
+
+TEST(Crypto, Hash_Address) {
+    const Cronz::IP::IPv4Address ipv4("192.168.1.1");
+    const Cronz::IP::IPv6Address ipv6("2001:db8::1");
+
+    // Network byte order, as the packed addresses of other implementations.
+    EXPECT_EQ(Cronz::Crypto::Hash64(ipv4), static_cast<std::uint64_t>(0x86729A2C178E9AA1ull));
+    EXPECT_EQ(Cronz::Crypto::Hash64(ipv6), static_cast<std::uint64_t>(0x275C8FA58C2D19A0ull));
+
+    for (const std::uint64_t seed : {static_cast<std::uint64_t>(0), static_cast<std::uint64_t>(42)}) {
+        EXPECT_EQ(Cronz::Crypto::Hash64(ipv4, seed), Cronz::Crypto::Hash64(std::as_bytes(std::span(ipv4.bytes)), seed));
+        EXPECT_EQ(Cronz::Crypto::Hash64(ipv6, seed), Cronz::Crypto::Hash64(std::as_bytes(std::span(ipv6.bytes)), seed));
+        EXPECT_EQ(Cronz::Crypto::Hash128(ipv4, seed),
+                  Cronz::Crypto::Hash128(std::as_bytes(std::span(ipv4.bytes)), seed));
+        EXPECT_EQ(Cronz::Crypto::Hash128(ipv6, seed),
+                  Cronz::Crypto::Hash128(std::as_bytes(std::span(ipv6.bytes)), seed));
+        EXPECT_EQ(Cronz::Crypto::Hash64(ipv6, seed), Cronz::IP::IPAddress(ipv6).hash(seed));
+    }
+}
+
+TEST(Crypto, Hash_Incremental) {
+    const std::string data = TestData();
+    std::mt19937 random(static_cast<std::mt19937::result_type>(49));
+
+    for (const std::uint64_t seed : {static_cast<std::uint64_t>(0),
+                                     static_cast<std::uint64_t>(0x9E3779B97F4A7C15ull)}) {
+        for (const std::size_t length : {static_cast<std::size_t>(0), static_cast<std::size_t>(100),
+                                         static_cast<std::size_t>(240), static_cast<std::size_t>(241),
+                                         static_cast<std::size_t>(256), static_cast<std::size_t>(257),
+                                         static_cast<std::size_t>(300), static_cast<std::size_t>(1024),
+                                         static_cast<std::size_t>(1087), static_cast<std::size_t>(6000)}) {
+            const std::string input = data.substr(0, length);
+
+            // Pieces of random sizes, crossing the stripes, the buffer and the blocks at every offset.
+            for (auto round = 0; round < 20; ++round) {
+                Cronz::Crypto::Hasher hasher(seed);
+
+                for (std::size_t pos = 0; pos < length;) {
+                    const std::size_t piece = std::min(static_cast<std::size_t>(random() % 700), length - pos);
+                    hasher.update(input.substr(pos, piece));
+                    pos += piece;
+
+                    // A digest does not end the data.
+                    EXPECT_EQ(hasher.digest64(), Cronz::Crypto::Hash64(input.substr(0, pos), seed)) << length;
+                }
+
+                EXPECT_EQ(hasher.digest64(), Cronz::Crypto::Hash64(input, seed)) << length << ' ' << seed;
+                EXPECT_EQ(hasher.digest128(), Cronz::Crypto::Hash128(input, seed)) << length << ' ' << seed;
+            }
+        }
+    }
+
+    Cronz::Crypto::Hasher hasher;
+    hasher.update(std::string("garbage"));
+    hasher.reset(static_cast<std::uint64_t>(7));
+    hasher.update(std::as_bytes(std::span(data.data(), data.length())));
+    EXPECT_EQ(hasher.digest64(), Cronz::Crypto::Hash64(data, static_cast<std::uint64_t>(7)));
+}
+
+TEST(Crypto, Hash_Tables) {
+    const std::string key = "example.com";
+    EXPECT_EQ(Cronz::Internal::StringHash()(key), static_cast<std::size_t>(Cronz::Crypto::Hash64(key)));
+
+    // Lookups do not need a `std::string`.
+    Cronz::Internal::StringMap<int> map;
+    map.emplace(key, 1);
+    map.emplace("example.org", 2);
+
+    EXPECT_EQ(map.find(std::string_view("example.com"))->second, 1);
+    EXPECT_EQ(map.find(std::string_view(key).substr(0, 7)), map.end());
+    EXPECT_EQ(map.count(std::string_view("example.org")), static_cast<std::size_t>(1));
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -10,8 +10,16 @@
 
 #include <cronz/crypto/hex.hpp>
 
+#include "simd.hpp"
+
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
 TEST(URL, Hex) {
     constexpr std::array<std::tuple<std::uint8_t, char, char>, static_cast<std::size_t>(256)> bnn = {
             std::make_tuple(static_cast<std::uint8_t>(0), '0', '0'),
@@ -296,6 +304,104 @@ TEST(URL, Hex) {
     }
 }
 
+TEST(Crypto, Hex_Spans) {
+    const std::string digest = "\x01\x23\x45\x67\x89\xAB\xCD\xEF";
+    const auto bytes = std::as_bytes(std::span(digest.data(), digest.length()));
+
+    char encoded[16];
+    std::size_t written;
+    ASSERT_TRUE(Cronz::Crypto::HexEncode(bytes, std::span(encoded), written));
+    EXPECT_EQ(std::string(encoded, written), "0123456789ABCDEF");
+    ASSERT_TRUE(Cronz::Crypto::HexEncode(bytes, std::span(encoded), written, true));
+    EXPECT_EQ(std::string(encoded, written), "0123456789abcdef");
+    EXPECT_FALSE(Cronz::Crypto::HexEncode(bytes, std::span(encoded, 15), written));
+    EXPECT_EQ(Cronz::Crypto::HexEncode<true>(bytes.first(2)), "0123");
+
+    std::byte decoded[8];
+    ASSERT_TRUE(Cronz::Crypto::HexDecode(std::span<const char>("0123456789abcDEF", 16), std::span(decoded), written));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(decoded), written), digest);
+    EXPECT_FALSE(Cronz::Crypto::HexDecode(std::span<const char>("0123456789abcDEF", 16), std::span(decoded, 7),
+                                          written));
+
+    for (const std::string invalid : {"0", "012", "0g", "G0", " 0", "0x12", "\xC3\xA9"}) {
+        EXPECT_FALSE(Cronz::Crypto::HexDecode(std::span(invalid.data(), invalid.length()), std::span(decoded),
+                                              written)) << invalid;
+    }
+
+    std::vector<unsigned char> vector;
+    ASSERT_TRUE(Cronz::Crypto::HexDecode(std::span<const char>("00ff7F", 6), vector));
+    EXPECT_EQ(vector, std::vector<unsigned char>({0x00, 0xFF, 0x7F}));
+
+    // Every level agrees with `ByteToHex` and `HexToByte`.
+    std::mt19937 random(45);
+    for (const auto level : AvailableLevels()) {
+        for (std::size_t length = 0; length < 200; ++length) {
+            std::vector<unsigned char> data(length);
+            for (unsigned char &byte : data)
+                byte = static_cast<unsigned char>(random());
+
+            for (const auto &digits : {Cronz::Crypto::HexDigitsLowercase, Cronz::Crypto::HexDigitsUppercase}) {
+                std::string characters(length * 2, '\0');
+                const std::size_t encodedLength = Cronz::Internal::HexEncodeBlocks(level, data.data(), length,
+                                                                                   characters.data(), digits.data());
+                ASSERT_EQ(encodedLength, (Cronz::Internal::SIMDLevel::None == level) ? 0 : length / 16 * 16);
+
+                for (std::size_t i = 0; i < encodedLength; ++i) {
+                    char high;
+                    char low;
+                    if (Cronz::Crypto::HexDigitsLowercase == digits)
+                        Cronz::Crypto::ByteToHex<true>(data[i], high, low);
+                    else
+                        Cronz::Crypto::ByteToHex<false>(data[i], high, low);
+
+                    ASSERT_EQ(characters.substr(i * 2, 2), std::string({high, low}));
+                }
+            }
+
+            // Mixed case, then a single character that is not a hex digit.
+            std::string characters(length * 2, '\0');
+            for (char &character : characters)
+                character = ((0 == random() % 2) ? Cronz::Crypto::HexDigitsLowercase
+                                                 : Cronz::Crypto::HexDigitsUppercase)[random() % 16];
+
+            std::vector<unsigned char> bytes(length);
+            const std::size_t decodedLength = Cronz::Internal::HexDecodeBlocks(
+                level, reinterpret_cast<const unsigned char*>(characters.data()), characters.length(), bytes.data());
+            ASSERT_EQ(decodedLength, (Cronz::Internal::SIMDLevel::None == level) ? 0 : length * 2 / 32 * 32);
+
+            for (std::size_t i = 0; i < decodedLength / 2; ++i) {
+                std::uint8_t byte;
+                ASSERT_TRUE(Cronz::Crypto::HexToByte(characters[i * 2], characters[i * 2 + 1], byte));
+                ASSERT_EQ(bytes[i], byte);
+            }
+
+            if (0 != length) {
+                const std::size_t invalid = random() % characters.length();
+                do {
+                    characters[invalid] = static_cast<char>(random());
+                } while (Cronz::Crypto::IsHexDigit(characters[invalid]));
+
+                ASSERT_LE(Cronz::Internal::HexDecodeBlocks(level,
+                                                           reinterpret_cast<const unsigned char*>(characters.data()),
+                                                           characters.length(), bytes.data()), invalid);
+            }
+        }
+    }
+
+    // Through the public interface, with whatever level is detected.
+    std::string data(10000, '\0');
+    for (char &byte : data)
+        byte = static_cast<char>(random());
+
+    const std::string characters = Cronz::Crypto::HexEncode<true>(std::as_bytes(std::span(data.data(),
+                                                                                          data.length())));
+    ASSERT_EQ(characters.length(), 20000u);
+
+    std::string roundtrip;
+    ASSERT_TRUE(Cronz::Crypto::HexDecode(characters, roundtrip));
+    EXPECT_EQ(roundtrip, data);
+}
+
 int main() {
     testing::InitGoogleTest();
     return RUN_ALL_TESTS();
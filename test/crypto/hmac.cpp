@@ -0,0 +1,88 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/crypto/hex.hpp>
+#include <cronz/crypto/hmac.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+    std::string ToHex(const Cronz::Crypto::HMACSHA256::Digest &digest) {
+        return Cronz::Crypto::HexEncode<true>(std::as_bytes(std::span(digest)));
+    }
+}
+
+TEST(Crypto, HMACSHA256) {
+    // Key, data, digest (RFC4231)
+    const std::vector<std::tuple<std::string, std::string, std::string>> vectors = {
+            {std::string(static_cast<std::size_t>(20), '\x0b'), "Hi There",
+             "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"},
+            {"Jefe", "what do ya want for nothing?",
+             "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+            {std::string(static_cast<std::size_t>(20), '\xaa'), std::string(static_cast<std::size_t>(50), '\xdd'),
+             "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe"},
+            {"\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19",
+             std::string(static_cast<std::size_t>(50), '\xcd'),
+             "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b"},
+            {std::string(static_cast<std::size_t>(131), '\xaa'),
+             "Test Using Larger Than Block-Size Key - Hash Key First",
+             "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"}
+    };
+
+    for (const auto &[key, data, digest] : vectors) {
+        EXPECT_EQ(ToHex(Cronz::Crypto::HMACSHA256::Hash(key, data)), digest) << key.length();
+
+        // A keyed context authenticates message after message.
+        Cronz::Crypto::HMACSHA256 hmac(std::as_bytes(std::span(key.data(), key.length())));
+        for (auto round = 0; round < 2; ++round) {
+            for (std::size_t pos = 0; pos < data.length(); pos += 7)
+                hmac.update(data.substr(pos, 7));
+
+            EXPECT_EQ(ToHex(hmac.finalize()), digest) << round;
+        }
+
+        hmac.update(std::string("garbage"));
+        hmac.reset();
+        hmac.update(data);
+        const Cronz::Crypto::HMACSHA256 copy = hmac;
+        EXPECT_EQ(ToHex(hmac.finalize()), digest);
+        EXPECT_EQ(ToHex(Cronz::Crypto::HMACSHA256(copy).finalize()), digest);
+    }
+}
+
+TEST(Crypto, ConstantTimeEqual) {
+    const std::string a = "0123456789abcdef";
+    std::string b = a;
+
+    const auto bytes = [](const std::string &str) {
+        return std::as_bytes(std::span(str.data(), str.length()));
+    };
+
+    EXPECT_TRUE(Cronz::Crypto::ConstantTimeEqual(bytes(a), bytes(b)));
+    EXPECT_TRUE(Cronz::Crypto::ConstantTimeEqual(std::span<const std::byte>(), std::span<const std::byte>()));
+    EXPECT_FALSE(Cronz::Crypto::ConstantTimeEqual(bytes(a), bytes(a.substr(0, 15))));
+
+    for (std::size_t i = 0; i < b.length(); ++i) {
+        b[i] ^= '\x01';
+        EXPECT_FALSE(Cronz::Crypto::ConstantTimeEqual(bytes(a), bytes(b))) << i;
+        b[i] ^= '\x01';
+    }
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/crypto/base64.hpp>
+#include <cronz/crypto/hex.hpp>
+#include <cronz/crypto/sha.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::vector<Cronz::Internal::SHAImplementation> AvailableImplementations() {
+        std::vector<Cronz::Internal::SHAImplementation> implementations = {
+                Cronz::Internal::SHAImplementation::Portable
+        };
+
+        if (Cronz::Internal::SIMDLevel::AVX2 <= Cronz::Internal::DetectSIMDLevel())
+            implementations.push_back(Cronz::Internal::SHAImplementation::AVX2);
+
+        if (Cronz::Internal::DetectSHAExtensions())
+            implementations.push_back(Cronz::Internal::SHAImplementation::Extensions);
+
+        return implementations;
+    }
+
+    template <std::size_t DigestSize>
+    std::string ToHex(const std::array<std::uint8_t, DigestSize> &digest) {
+        return Cronz::Crypto::HexEncode<true>(std::as_bytes(std::span(digest)));
+    }
+
+    // Messages of every length around the block and padding boundaries, and a few longer ones.
+    std::vector<std::string> RandomMessages() {
+        std::mt19937 random(static_cast<std::mt19937::result_type>(48));
+        std::vector<std::string> messages;
+
+        for (auto length = static_cast<std::size_t>(0); length < static_cast<std::size_t>(300); ++length) {
+            std::string message(length, '\0');
+            for (char &c : message)
+                c = static_cast<char>(random());
+
+            messages.push_back(std::move(message));
+        }
+
+        for (auto i = 0; i < 7; ++i)
+            messages.emplace_back(static_cast<std::size_t>(random() % 5000), static_cast<char>('a' + i));
+
+        return messages;
+    }
+}
+
+TEST(Crypto, SHA256) {
+    // Message, digest
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+            {"", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+            {"abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+            {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+             "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+            {"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrst"
+             "nopqrstu", "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1"},
+            {std::string(static_cast<std::size_t>(1000000), 'a'),
+             "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"}
+    };
+
+    for (const auto &[message, digest] : vectors) {
+        EXPECT_EQ(ToHex(Cronz::Crypto::SHA256::Hash(message)), digest) << message.length();
+        EXPECT_EQ(ToHex(Cronz::Crypto::SHA256::Hash(std::as_bytes(std::span(message.data(), message.length())))),
+                  digest) << message.length();
+
+        // Pieces of every size, crossing the blocks at every offset.
+        for (const std::size_t piece : {static_cast<std::size_t>(1), static_cast<std::size_t>(7),
+                                        static_cast<std::size_t>(63), static_cast<std::size_t>(64),
+                                        static_cast<std::size_t>(65), static_cast<std::size_t>(1000)}) {
+            if (message.length() > static_cast<std::size_t>(10000) && piece < static_cast<std::size_t>(63))
+                continue;
+
+            Cronz::Crypto::SHA256 sha;
+            for (std::size_t pos = 0; pos < message.length(); pos += piece)
+                sha.update(message.substr(pos, piece));
+
+            EXPECT_EQ(ToHex(sha.finalize()), digest) << message.length() << ' ' << piece;
+        }
+    }
+
+    // A finalized context starts a new message, and `reset` discards the current one.
+    Cronz::Crypto::SHA256 sha;
+    sha.update(std::string("abc"));
+    EXPECT_EQ(ToHex(sha.finalize()), vectors[1].second);
+    EXPECT_EQ(ToHex(sha.finalize()), vectors[0].second);
+    sha.update(std::string("garbage"));
+    sha.reset();
+    sha.update(std::span<const std::byte>());
+    EXPECT_EQ(ToHex(sha.finalize()), vectors[0].second);
+
+    // The digests are plain bytes, for the encodings.
+    const Cronz::Crypto::SHA256::Digest digest = Cronz::Crypto::SHA256::Hash("abc");
+    EXPECT_EQ(Cronz::Crypto::Base64Encode(digest.data(), digest.size()),
+              "ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=");
+}
+
+TEST(Crypto, SHA1) {
+    // Message, digest
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+            {"", "da39a3ee5e6b4b0d3255bfef95601890afd80709"},
+            {"abc", "a9993e364706816aba3e25717850c26c9cd0d89d"},
+            {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "84983e441c3bd26ebaae4aa1f95129e5e54670f1"},
+            {"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrst"
+             "nopqrstu", "a49b2446a02c645bf419f995b67091253a04a259"},
+            {std::string(static_cast<std::size_t>(1000000), 'a'), "34aa973cd4c4daa4f61eeb2bdbad27316534016f"}
+    };
+
+    for (const auto &[message, digest] : vectors) {
+        EXPECT_EQ(ToHex(Cronz::Crypto::SHA1::Hash(message)), digest) << message.length();
+
+        for (const std::size_t piece : {static_cast<std::size_t>(1), static_cast<std::size_t>(63),
+                                        static_cast<std::size_t>(65)}) {
+            if (message.length() > static_cast<std::size_t>(10000) && piece < static_cast<std::size_t>(63))
+                continue;
+
+            Cronz::Crypto::SHA1 sha;
+            for (std::size_t pos = 0; pos < message.length(); pos += piece)
+                sha.update(std::as_bytes(std::span(message.data() + pos, std::min(piece, message.length() - pos))));
+
+            EXPECT_EQ(ToHex(sha.finalize()), digest) << message.length() << ' ' << piece;
+        }
+    }
+
+    const Cronz::Crypto::SHA1::Digest digest = Cronz::Crypto::SHA1::Hash("abc");
+    char encoded[32];
+    std::size_t written;
+    ASSERT_TRUE((Cronz::Crypto::Base64Encode<Cronz::Crypto::Base64AlphabetSafe, false>(
+        std::as_bytes(std::span(digest)), encoded, written)));
+    EXPECT_EQ(std::string(encoded, written), "qZk-NkcGgWq6PiVxeFDCbJzQ2J0");
+}
+
+TEST(Crypto, SHA_MultiBuffer) {
+    const std::vector<std::string> messages = RandomMessages();
+
+    std::vector<Cronz::Crypto::SHA256::Digest> sha256(messages.size());
+    std::vector<Cronz::Crypto::SHA1::Digest> sha1(messages.size());
+    ASSERT_TRUE(Cronz::Crypto::SHA256::Hash(messages, sha256));
+    ASSERT_TRUE(Cronz::Crypto::SHA1::Hash(messages, sha1));
+
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(sha256[i], Cronz::Crypto::SHA256::Hash(messages[i])) << messages[i].length();
+        EXPECT_EQ(sha1[i], Cronz::Crypto::SHA1::Hash(messages[i])) << messages[i].length();
+    }
+
+    // Byte spans, and fewer messages than lanes.
+    std::vector<std::span<const std::byte>> spans;
+    for (const std::string &message : messages)
+        spans.push_back(std::as_bytes(std::span(message.data(), message.length())));
+
+    for (const std::size_t count : {static_cast<std::size_t>(0), static_cast<std::size_t>(1),
+                                    static_cast<std::size_t>(3), static_cast<std::size_t>(9)}) {
+        std::vector<Cronz::Crypto::SHA256::Digest> digests(count);
+        ASSERT_TRUE(Cronz::Crypto::SHA256::Hash(std::span(spans.data() + 250, count), digests));
+
+        for (std::size_t i = 0; i < count; ++i)
+            EXPECT_EQ(digests[i], sha256[250 + i]) << count;
+    }
+
+    EXPECT_FALSE(Cronz::Crypto::SHA256::Hash(messages, std::span(sha256.data(), sha256.size() - 1)));
+    EXPECT_FALSE(Cronz::Crypto::SHA1::Hash(spans, std::span(sha1.data(), sha1.size() - 1)));
+
+    // Every implementation, single and multi-buffer, gives the same digests.
+    const auto message = [&messages](const std::size_t &i) {
+        return std::as_bytes(std::span(messages[i].data(), messages[i].length()));
+    };
+
+    for (const Cronz::Internal::SHAImplementation implementation : AvailableImplementations()) {
+        const auto id = static_cast<int>(implementation);
+
+        std::vector<Cronz::Crypto::SHA256::Digest> digests256(messages.size());
+        std::vector<Cronz::Crypto::SHA1::Digest> digests1(messages.size());
+        Cronz::Internal::SHA256HashMessages(implementation, messages.size(), message, digests256.data());
+        Cronz::Internal::SHA1HashMessages(implementation, messages.size(), message, digests1.data());
+
+        EXPECT_EQ(digests256, sha256) << id;
+        EXPECT_EQ(digests1, sha1) << id;
+
+        for (std::size_t i = 0; i < messages.size(); i += 37) {
+            const auto data = reinterpret_cast<const unsigned char*>(messages[i].data());
+            const std::size_t whole = messages[i].length() / 64;
+
+            unsigned char padded[128];
+            const std::size_t blocks = Cronz::Internal::SHAPad(data + whole * 64, messages[i].length() % 64,
+                                                               messages[i].length(), padded);
+
+            std::array<std::uint32_t, 8> state256 = Cronz::Internal::SHA256InitialState;
+            Cronz::Internal::SHA256Blocks(implementation, state256.data(), data, whole);
+            Cronz::Internal::SHA256Blocks(implementation, state256.data(), padded, blocks);
+            EXPECT_EQ(Cronz::Internal::SHADigest<32>(state256.data()), sha256[i]) << id << ' ' << i;
+
+            std::array<std::uint32_t, 5> state1 = Cronz::Internal::SHA1InitialState;
+            Cronz::Internal::SHA1Blocks(implementation, state1.data(), data, whole);
+            Cronz::Internal::SHA1Blocks(implementation, state1.data(), padded, blocks);
+            EXPECT_EQ(Cronz::Internal::SHADigest<20>(state1.data()), sha1[i]) << id << ' ' << i;
+        }
+    }
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,32 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#ifndef CRONZ_TEST_CRYPTO_SIMD_HPP
+#define CRONZ_TEST_CRYPTO_SIMD_HPP 1
+
+#include <cronz/internal/simd.hpp>
+
+#include <vector>
+
+namespace {
+    // Instruction set levels supported by the processor, the portable implementation included.
+    std::vector<Cronz::Internal::SIMDLevel> AvailableLevels() {
+        std::vector<Cronz::Internal::SIMDLevel> levels = {Cronz::Internal::SIMDLevel::None};
+        for (const auto level : {Cronz::Internal::SIMDLevel::SSSE3, Cronz::Internal::SIMDLevel::AVX2,
+                                 Cronz::Internal::SIMDLevel::AVX512VBMI}) {
+            if (level <= Cronz::Internal::DetectSIMDLevel())
+                levels.push_back(level);
+        }
+
+        return levels;
+    }
+}
+
+#endif // CRONZ_TEST_CRYPTO_SIMD_HPP
@@ -0,0 +1,150 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/address.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(Batch, IPv4_Round_Trip) {
+    std::mt19937 random(7);
+
+    std::vector<Cronz::IP::IPv4Address> addresses(1000);
+    std::string expected;
+    for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+        addresses[i].uint32 = static_cast<std::uint32_t>(random()) >> (random() % 32);
+
+        if (static_cast<std::size_t>(0) != i)
+            expected += ",";
+
+        expected += addresses[i].stringify();
+    }
+
+    std::vector<char> buffer(addresses.size() * (Cronz::IP::IPv4Address::MaxLength + 1));
+    const std::to_chars_result result = Cronz::IP::FormatAddresses(addresses, buffer.data(),
+                                                                   buffer.data() + buffer.size(), ",");
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(std::string(buffer.data(), result.ptr), expected);
+
+    std::vector<Cronz::IP::IPv4Address> parsed(addresses.size());
+    std::size_t count;
+    const std::from_chars_result parsing = Cronz::IP::ParseAddresses(result.ptr - expected.length(), result.ptr,
+                                                                     parsed, count, ",");
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(parsing.ptr, result.ptr);
+    EXPECT_EQ(count, addresses.size());
+    EXPECT_EQ(parsed, addresses);
+}
+
+TEST(Batch, IPv6_Round_Trip) {
+    std::mt19937 random(11);
+
+    std::vector<Cronz::IP::IPv6Address> addresses(1000);
+    std::string compressed;
+    std::string canonical;
+    for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+        // Sparse groups, so that zero runs of all lengths show up.
+        for (auto &group : addresses[i].groups)
+            group = (0 == random() % 2) ? static_cast<std::uint16_t>(0) : static_cast<std::uint16_t>(random());
+
+        if (static_cast<std::size_t>(0) != i) {
+            compressed += "\", \"";
+            canonical += "\n";
+        }
+
+        compressed += addresses[i].stringify<true>();
+        canonical += addresses[i].stringify<false>();
+    }
+
+    std::vector<char> buffer(addresses.size() * (Cronz::IP::IPv6Address::MaxLength + 4));
+
+    std::to_chars_result result = Cronz::IP::FormatAddresses(addresses, buffer.data(), buffer.data() + buffer.size(),
+                                                             "\", \"");
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(std::string(buffer.data(), result.ptr), compressed);
+
+    std::vector<Cronz::IP::IPv6Address> parsed(addresses.size());
+    std::size_t count;
+    std::from_chars_result parsing = Cronz::IP::ParseAddresses(buffer.data(), result.ptr, parsed, count, "\", \"");
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(count, addresses.size());
+    EXPECT_EQ(parsed, addresses);
+
+    result = Cronz::IP::FormatAddresses<false>(addresses, buffer.data(), buffer.data() + buffer.size());
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(std::string(buffer.data(), result.ptr), canonical);
+
+    parsed.assign(addresses.size(), Cronz::IP::IPv6Address());
+    parsing = Cronz::IP::ParseAddresses(buffer.data(), result.ptr, parsed, count);
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(parsed, addresses);
+}
+
+TEST(Batch, Bounds) {
+    const std::vector<Cronz::IP::IPv4Address> addresses = {
+        Cronz::IP::IPv4Address(1, 2, 3, 4), Cronz::IP::IPv4Address(255, 255, 255, 255),
+        Cronz::IP::IPv4Address(10, 0, 0, 1)
+    };
+    const std::string expected = "1.2.3.4\n255.255.255.255\n10.0.0.1";
+
+    // Every size up to the exact fit fails, the exact fit succeeds.
+    char buffer[64];
+    for (auto size = static_cast<std::size_t>(0); size <= expected.length(); ++size) {
+        const std::to_chars_result result = Cronz::IP::FormatAddresses(addresses, buffer, buffer + size);
+
+        if (expected.length() == size) {
+            ASSERT_EQ(result.ec, std::errc());
+            EXPECT_EQ(std::string(buffer, result.ptr), expected);
+        }
+        else {
+            EXPECT_EQ(result.ec, std::errc::value_too_large) << size;
+            EXPECT_EQ(result.ptr, buffer + size);
+        }
+    }
+
+    std::to_chars_result empty = Cronz::IP::FormatAddresses(std::span<const Cronz::IP::IPv4Address>(), buffer, buffer);
+    EXPECT_EQ(empty.ec, std::errc());
+    EXPECT_EQ(empty.ptr, buffer);
+
+    // Trailing delimiter, exhausted output, invalid field.
+    const std::string input = "1.2.3.4\n::1\n5.6.7.8\n";
+    Cronz::IP::IPv4Address parsed[2];
+    std::size_t count;
+
+    std::from_chars_result parsing = Cronz::IP::ParseAddresses(input.data(), input.data() + 8, parsed, count);
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(count, static_cast<std::size_t>(1));
+    EXPECT_EQ(parsing.ptr, input.data() + 8);
+
+    parsing = Cronz::IP::ParseAddresses(input.data(), input.data() + input.length(), parsed, count);
+    EXPECT_EQ(parsing.ec, std::errc::invalid_argument);
+    EXPECT_EQ(count, static_cast<std::size_t>(1));
+    EXPECT_EQ(parsing.ptr, input.data() + 8);
+    EXPECT_EQ(parsed[0], Cronz::IP::IPv4Address(1, 2, 3, 4));
+
+    const std::string valid = "1.2.3.4,5.6.7.8,9.9.9.9";
+    parsing = Cronz::IP::ParseAddresses(valid.data(), valid.data() + valid.length(), parsed, count, ",");
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(count, static_cast<std::size_t>(2));
+    EXPECT_EQ(parsing.ptr, valid.data() + 16);
+    EXPECT_EQ(parsed[1], Cronz::IP::IPv4Address(5, 6, 7, 8));
+
+    parsing = Cronz::IP::ParseAddresses(valid.data(), valid.data() + valid.length(), parsed, count, "");
+    EXPECT_EQ(parsing.ec, std::errc::invalid_argument);
+    EXPECT_EQ(count, static_cast<std::size_t>(0));
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,199 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/address.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+TEST(IPAddress, Parsing_and_Stringification) {
+    // Representation, stringified, IPv4
+    const std::vector<std::tuple<std::string, std::string, bool>> addresses = {
+            {"192.0.2.1", "192.0.2.1", true},
+            {"0.0.0.0", "0.0.0.0", true},
+            {"255.255.255.255", "255.255.255.255", true},
+            {"::ffff:10.0.0.1", "10.0.0.1", true},
+            {"::FFFF:a00:1", "10.0.0.1", true},
+            {"::", "::", false},
+            {"::1", "::1", false},
+            {"::1.2.3.4", "::102:304", false},
+            {"::fffe:1.2.3.4", "::fffe:102:304", false},
+            {"1::ffff:1.2.3.4", "1::ffff:102:304", false},
+            {"2001:db8::ff00:42:8329", "2001:db8::ff00:42:8329", false}
+    };
+
+    for (const auto &[representation, stringified, ipv4] : addresses) {
+        Cronz::IP::IPAddress address;
+        ASSERT_TRUE(address.parse(representation)) << representation;
+        EXPECT_EQ(address.stringify(), stringified) << representation;
+        EXPECT_EQ(address.length(), stringified.length()) << representation;
+        EXPECT_EQ(address.isIPv4(), ipv4) << representation;
+        EXPECT_EQ(address.isIPv6(), !ipv4) << representation;
+        EXPECT_EQ(Cronz::IP::IPAddress::Parse(stringified), address) << representation;
+    }
+
+    EXPECT_EQ(Cronz::IP::IPAddress("2001:db8::1").stringify<false>(), "2001:0db8:0000:0000:0000:0000:0000:0001");
+    EXPECT_EQ(Cronz::IP::IPAddress("2001:db8::1").length<false>(), Cronz::IP::IPAddress::MaxLength);
+    EXPECT_EQ(Cronz::IP::IPAddress("10.0.0.1").stringify<false>(), "10.0.0.1");
+
+    const std::vector<std::string> invalid = {"", "1.2.3", "1.2.3.256", "1:::2", "::ffff:1.2.3.4.5", "g::", "1.2.3.4 "};
+
+    Cronz::IP::IPAddress address("1.2.3.4");
+    const Cronz::IP::IPAddress original = address;
+    for (const std::string &representation : invalid) {
+        EXPECT_FALSE(address.parse(representation)) << representation;
+        EXPECT_EQ(address, original) << representation;
+    }
+
+    address = "invalid";
+    EXPECT_FALSE(address);
+    address = std::string("::2");
+    EXPECT_EQ(address.stringify(), "::2");
+}
+
+TEST(IPAddress, Mapping) {
+    const Cronz::IP::IPv4Address ipv4("198.51.100.7");
+    const Cronz::IP::IPAddress mapped(ipv4);
+
+    EXPECT_TRUE(mapped.isIPv4());
+    EXPECT_EQ(mapped, Cronz::IP::IPAddress("::ffff:198.51.100.7"));
+    EXPECT_EQ(mapped.toIPv6(), Cronz::IP::IPv6Address("::ffff:198.51.100.7"));
+
+    Cronz::IP::IPv4Address extracted;
+    ASSERT_TRUE(mapped.toIPv4(extracted));
+    EXPECT_EQ(extracted, ipv4);
+
+    const Cronz::IP::IPAddress ipv6(Cronz::IP::IPv6Address("64:ff9b::198.51.100.7"));
+    EXPECT_FALSE(ipv6.toIPv4(extracted));
+    EXPECT_EQ(extracted, ipv4);
+    EXPECT_EQ(ipv6.toIPv6(), Cronz::IP::IPv6Address("64:ff9b::c633:6407"));
+
+    EXPECT_FALSE(Cronz::IP::IPAddress());
+    EXPECT_TRUE(Cronz::IP::IPAddress(Cronz::IP::IPv4Address("0.0.0.0")));
+}
+
+TEST(IPAddress, ToChars_and_FromChars) {
+    const std::string line = "192.0.2.1:80 [2001:db8::1]:443 ::ffff:10.1.1.1/8";
+    Cronz::IP::IPAddress parsed;
+
+    std::from_chars_result parsing = parsed.fromChars(line.data(), line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, ':');
+    EXPECT_EQ(parsed.stringify(), "192.0.2.1");
+
+    parsing = parsed.fromChars(line.data() + line.find('[') + 1, line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, ']');
+    EXPECT_EQ(parsed.stringify(), "2001:db8::1");
+
+    parsing = parsed.fromChars(line.data() + line.rfind(' ') + 1, line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, '/');
+    EXPECT_EQ(parsed.stringify(), "10.1.1.1");
+
+    const std::string invalid = "1:::2";
+    parsing = parsed.fromChars(invalid.data(), invalid.data() + invalid.length());
+    EXPECT_EQ(parsing.ec, std::errc::invalid_argument);
+    EXPECT_EQ(parsing.ptr, invalid.data());
+    EXPECT_EQ(parsed.stringify(), "10.1.1.1");
+
+    char buffer[64];
+    std::memset(buffer, '#', sizeof(buffer));
+
+    const Cronz::IP::IPAddress ipv4("203.0.113.255");
+    std::to_chars_result result = ipv4.toChars(buffer, buffer + 15);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "203.0.113.255");
+
+    result = ipv4.toChars(buffer, buffer + 12);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+
+    result = Cronz::IP::IPAddress("2001:db8::ff00:42:8329").toChars(buffer, buffer + 22);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "2001:db8::ff00:42:8329");
+}
+
+TEST(IPAddress, Ordering) {
+    EXPECT_LT(Cronz::IP::IPAddress("10.0.0.1"), Cronz::IP::IPAddress("10.0.0.2"));
+    EXPECT_LT(Cronz::IP::IPAddress("9.255.255.255"), Cronz::IP::IPAddress("10.0.0.0"));
+    EXPECT_LT(Cronz::IP::IPAddress("::ffff:ffff:ffff"), Cronz::IP::IPAddress("0:0:0:1::"));
+    EXPECT_LT(Cronz::IP::IPAddress("::1"), Cronz::IP::IPAddress("0.0.0.0"));
+    EXPECT_LT(Cronz::IP::IPAddress("255.255.255.255"), Cronz::IP::IPAddress("2001:db8::"));
+    EXPECT_GT(Cronz::IP::IPAddress("1::"), Cronz::IP::IPAddress("::ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(Cronz::IP::IPAddress("1.2.3.4") <=> Cronz::IP::IPAddress("::ffff:102:304"),
+              std::strong_ordering::equal);
+
+    // The ordering matches the one of `IPv6Address`.
+    std::mt19937_64 random(static_cast<std::uint64_t>(38));
+    std::vector<Cronz::IP::IPAddress> addresses(static_cast<std::size_t>(1024));
+    for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+        // Few distinct bits, so that equal halves are common.
+        addresses[i].low64 = random() & static_cast<std::uint64_t>(0x0300000000000003ull);
+        addresses[i].high64 = random() & static_cast<std::uint64_t>(0x0300000000000003ull);
+    }
+
+    for (auto i = static_cast<std::size_t>(1); i < addresses.size(); ++i)
+        EXPECT_EQ(addresses[i - 1] <=> addresses[i], addresses[i - 1].toIPv6() <=> addresses[i].toIPv6());
+}
+
+TEST(IPAddress, Hashing) {
+    static_assert(std::is_trivially_copyable_v<Cronz::IP::IPAddress>);
+
+    const Cronz::IP::IPAddress address("2001:db8::1");
+    EXPECT_EQ(address.hash(), Cronz::IP::IPAddress("2001:db8:0::1").hash());
+    EXPECT_EQ(std::hash<Cronz::IP::IPAddress>()(address), static_cast<std::size_t>(address.hash()));
+    EXPECT_NE(address.hash(), address.hash(static_cast<std::uint64_t>(1)));
+
+    // No collisions within sequential ranges of either family.
+    std::unordered_set<std::uint64_t> hashes;
+    for (auto i = static_cast<std::uint32_t>(0); i < static_cast<std::uint32_t>(65536); ++i) {
+        hashes.insert(Cronz::IP::IPAddress(Cronz::IP::IPv4Address(i)).hash());
+
+        Cronz::IP::IPAddress ipv6("2001:db8::");
+        ipv6.bytes[6] = static_cast<std::uint8_t>(i >> 8);
+        ipv6.bytes[15] = static_cast<std::uint8_t>(i);
+        hashes.insert(ipv6.hash());
+    }
+
+    EXPECT_EQ(hashes.size(), static_cast<std::size_t>(131072));
+
+    // Every input bit flips about half of the output bits.
+    std::mt19937_64 random(static_cast<std::uint64_t>(0));
+    std::size_t flips = static_cast<std::size_t>(0);
+    for (auto i = static_cast<std::size_t>(0); i < static_cast<std::size_t>(128); ++i) {
+        Cronz::IP::IPAddress a;
+        a.low64 = random();
+        a.high64 = random();
+
+        Cronz::IP::IPAddress b = a;
+        b.bytes[i / 8] ^= static_cast<std::uint8_t>(1u << (i % 8));
+        flips += static_cast<std::size_t>(std::popcount(a.hash() ^ b.hash()));
+    }
+
+    EXPECT_GT(flips, static_cast<std::size_t>(128 * 28));
+    EXPECT_LT(flips, static_cast<std::size_t>(128 * 36));
+
+    std::unordered_set<Cronz::IP::IPAddress> set = {Cronz::IP::IPAddress("10.0.0.1"), Cronz::IP::IPAddress("::1")};
+    EXPECT_TRUE(set.contains(Cronz::IP::IPAddress("::ffff:10.0.0.1")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPAddress("10.0.0.2")));
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 TEST(IPv4Address, Parsing_and_Stringification) {
     // Representation, bytes, validity
     const std::vector<std::tuple<std::string, std::array<std::uint8_t, static_cast<std::size_t>(4)>, bool>> addresses =
@@ -42,6 +49,231 @@ TEST(IPv4Address, Parsing_and_Stringification) {
     }
 }
 
+// Character-by-character parser the block parser replaced, kept as the reference behavior.
+static bool ReferenceParse(const char *str, const std::size_t length, std::array<std::uint8_t, 4> &bytes) {
+    if (7 > length || length > 15)
+        return false;
+
+    bytes = {0, 0, 0, 0};
+
+    const char *const end = str + length;
+    const char *previous = str;
+
+    std::size_t byteIndex = 0;
+    while (previous < end) {
+        if (3 < byteIndex)
+            return false;
+
+        const char *const current = std::find(previous, end, '.');
+        if (const auto byteLength = static_cast<std::size_t>(current - previous); 0 == byteLength || byteLength > 3)
+            return false;
+
+        unsigned value = 0;
+        for (; previous < current; ++previous) {
+            if ('0' > *previous || *previous > '9')
+                return false;
+
+            value = value * 10 + static_cast<unsigned>(*previous - '0');
+        }
+
+        if (255 < value)
+            return false;
+
+        bytes[byteIndex++] = static_cast<std::uint8_t>(value);
+        ++previous;
+    }
+
+    return 4 == byteIndex;
+}
+
+TEST(IPv4Address, Parsing_Edge_Cases) {
+    // Representation, bytes, validity
+    const std::vector<std::tuple<std::string, std::array<std::uint8_t, static_cast<std::size_t>(4)>, bool>> addresses =
+    {
+            {"001.002.003.004", {1, 2, 3, 4}, true},
+            {"1.2.3.4.", {1, 2, 3, 4}, true},
+            {"255.255.255.25.", {255, 255, 255, 25}, true},
+            {"1.2.3.4..", {}, false},
+            {".1.2.3.4", {}, false},
+            {"1..2.3.4", {}, false},
+            {"1.2.3.4.5", {}, false},
+            {"1.2.3.0004", {}, false},
+            {"256.1.1.1", {}, false},
+            {"1.2.3.4 ", {}, false},
+            {"1.2.3.-4", {}, false},
+            {"1.2.3", {}, false},
+    };
+
+    for (const auto &[str, bytes, isValid] : addresses) {
+        Cronz::IP::IPv4Address ipv4(static_cast<std::uint32_t>(0xDEADBEEF));
+
+        if (isValid) {
+            EXPECT_TRUE(ipv4.parse(str)) << str;
+            EXPECT_EQ(bytes, ipv4.bytes) << str;
+        }
+        else {
+            EXPECT_FALSE(ipv4.parse(str)) << str;
+            EXPECT_EQ(ipv4.uint32, static_cast<std::uint32_t>(0xDEADBEEF)) << str;
+        }
+    }
+}
+
+TEST(IPv4Address, Parsing_Matches_Reference) {
+    std::mt19937 random(42);
+
+    const std::string alphabet = "0123456789.......12520x/: ";
+    std::uniform_int_distribution<std::size_t> character(0, alphabet.length() - 1);
+    std::uniform_int_distribution<std::size_t> lengths(5, 17);
+    std::uniform_int_distribution<int> octet(0, 300);
+
+    for (auto i = 0; i < 200000; ++i) {
+        std::string str;
+
+        if (0 == i % 2) {
+            // Mostly well-formed addresses, with occasional out-of-range octets and padding.
+            for (auto j = 0; j < 4; ++j) {
+                if (0 != j)
+                    str += '.';
+
+                const int value = octet(random);
+                if (0 == value % 7)
+                    str += '0';
+
+                str += std::to_string(value);
+            }
+
+            if (0 == i % 10)
+                str += '.';
+        }
+        else {
+            const std::size_t length = lengths(random);
+            for (std::size_t j = 0; j < length; ++j)
+                str += alphabet[character(random)];
+        }
+
+        std::array<std::uint8_t, 4> expected{};
+        const bool isValid = ReferenceParse(str.data(), str.length(), expected);
+
+        Cronz::IP::IPv4Address ipv4;
+        ASSERT_EQ(ipv4.parse(str), isValid) << str;
+        if (isValid) {
+            ASSERT_EQ(ipv4.bytes, expected) << str;
+        }
+
+        // The parser of constant evaluation.
+        std::array<std::uint8_t, 4> constant{};
+        ASSERT_EQ(Cronz::Internal::ParseIPv4Constant(str.data(), str.length(), constant), isValid) << str;
+        if (isValid) {
+            ASSERT_EQ(constant, expected) << str;
+        }
+
+        // The portable implementation and the vectorized one, if supported.
+        for (const auto level : {Cronz::Internal::SIMDLevel::None, Cronz::Internal::DetectSIMDLevel()}) {
+            std::array<std::uint8_t, 4> bytes{};
+            ASSERT_EQ(Cronz::Internal::ParseIPv4(level, str.data(), str.length(), bytes), isValid) << str;
+            if (!isValid)
+                continue;
+
+            ASSERT_EQ(bytes, expected) << str;
+
+            char buffer[Cronz::IP::IPv4Address::MaxLength + 1];
+            const std::size_t length = Cronz::Internal::FormatIPv4(level, bytes, buffer);
+            ASSERT_EQ(std::string(buffer, length), std::to_string(bytes[0]) + '.' + std::to_string(bytes[1]) + '.' +
+                                                   std::to_string(bytes[2]) + '.' + std::to_string(bytes[3])) << str;
+        }
+    }
+}
+
+TEST(IPv4Address, Constant_Evaluation) {
+    using namespace Cronz::IP::Literals;
+
+    constexpr Cronz::IP::IPv4Address ipv4 = "192.0.2.1"_ipv4;
+    static_assert(ipv4 == Cronz::IP::IPv4Address(192, 0, 2, 1));
+    static_assert(ipv4 < "192.0.2.2"_ipv4 && ipv4 > "10.255.255.255"_ipv4);
+    static_assert("001.002.003.04."_ipv4 == Cronz::IP::IPv4Address(1, 2, 3, 4));
+    static_assert(!"0.0.0.0"_ipv4 && "0.0.0.1"_ipv4);
+
+    static_assert(Cronz::IP::IPv4Address("255.255.255.255").bytes[3] == static_cast<std::uint8_t>(255));
+    static_assert(!Cronz::IP::IPv4Address("1.2.3.256"));
+    static_assert(Cronz::IP::IPv4Address::Parse("1.2.3.4") == Cronz::IP::IPv4Address(
+        Cronz::IP::IPv4Address(1, 2, 3, 4).bytes));
+    static_assert(std::is_trivially_copyable_v<Cronz::IP::IPv4Address>);
+
+    constexpr auto parsed = []() constexpr {
+        Cronz::IP::IPv4Address address(static_cast<std::uint32_t>(0));
+        const bool valid = address.parse("1.2.3");
+        address = "10.0.0.1";
+        return std::pair(valid, address);
+    }();
+
+    static_assert(!parsed.first && parsed.second == "10.0.0.1"_ipv4);
+
+    EXPECT_EQ(ipv4.stringify(), "192.0.2.1");
+    EXPECT_EQ(ipv4.uint32, Cronz::IP::IPv4Address("192.0.2.1").uint32);
+    EXPECT_EQ(Cronz::IP::IPv4Address(static_cast<std::uint32_t>(0x01020304)).bits().to_ulong(), 0x01020304ul);
+    EXPECT_EQ(Cronz::IP::IPv4Address(std::bitset<32>(0x01020304ul)).uint32, static_cast<std::uint32_t>(0x01020304));
+}
+
+TEST(IPv4Address, ToChars_and_FromChars) {
+    for (auto value = 0; value < 256; ++value) {
+        const auto byte = static_cast<std::uint8_t>(value);
+        const Cronz::IP::IPv4Address ipv4(byte, static_cast<std::uint8_t>(255 - value), byte,
+                                          static_cast<std::uint8_t>(value / 16));
+
+        const std::string expected = std::to_string(value) + '.' + std::to_string(255 - value) + '.' +
+                                     std::to_string(value) + '.' + std::to_string(value / 16);
+        EXPECT_EQ(ipv4.stringify(), expected);
+        EXPECT_EQ(ipv4.length(), expected.length());
+
+        // Exact fit, which takes the copying path.
+        char buffer[32];
+        const std::to_chars_result result = ipv4.toChars(buffer, buffer + expected.length());
+        ASSERT_EQ(result.ec, std::errc());
+        EXPECT_EQ(std::string(buffer, result.ptr), expected);
+    }
+
+    char buffer[32];
+    std::memset(buffer, '#', sizeof(buffer));
+
+    const Cronz::IP::IPv4Address ipv4(192, 168, 100, 200);
+    std::to_chars_result result = ipv4.toChars(buffer, buffer + 16);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "192.168.100.200");
+    EXPECT_EQ(buffer[16], '#');
+
+    result = ipv4.toChars(buffer, buffer + 14);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + 14);
+
+    const std::string line = "10.0.0.1 - - [18/Oct/2026] 1.2.3.4.5.6";
+    Cronz::IP::IPv4Address parsed;
+
+    std::from_chars_result parsing = parsed.fromChars(line.data(), line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(parsing.ptr, line.data() + 8);
+    EXPECT_EQ(parsed, Cronz::IP::IPv4Address(10, 0, 0, 1));
+
+    const char *const invalid = line.data() + line.find("1.2.3.4.5");
+    parsing = parsed.fromChars(invalid, line.data() + line.length());
+    EXPECT_EQ(parsing.ec, std::errc::invalid_argument);
+    EXPECT_EQ(parsing.ptr, invalid);
+    EXPECT_EQ(parsed, Cronz::IP::IPv4Address(10, 0, 0, 1));
+
+    const std::string bounded = "1.2.3.45";
+    parsing = parsed.fromChars(bounded.data(), bounded.data() + 7);
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(parsing.ptr, bounded.data() + 7);
+    EXPECT_EQ(parsed, Cronz::IP::IPv4Address(1, 2, 3, 4));
+}
+
+TEST(IPv4Address, Ordering) {
+    EXPECT_LT(Cronz::IP::IPv4Address("9.255.255.255"), Cronz::IP::IPv4Address("10.0.0.0"));
+    EXPECT_LT(Cronz::IP::IPv4Address("10.0.0.255"), Cronz::IP::IPv4Address("10.0.1.0"));
+    EXPECT_GT(Cronz::IP::IPv4Address("255.255.255.255"), Cronz::IP::IPv4Address("0.0.0.0"));
+    EXPECT_LE(Cronz::IP::IPv4Address("1.2.3.4"), Cronz::IP::IPv4Address("1.2.3.4"));
+    EXPECT_EQ(Cronz::IP::IPv4Address("1.2.3.4") <=> Cronz::IP::IPv4Address("1.2.3.4"), std::strong_ordering::equal);
+}
+
 int main() {
     testing::InitGoogleTest();
     return RUN_ALL_TESTS();
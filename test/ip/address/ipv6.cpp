@@ -13,8 +13,14 @@
 #include <gtest/gtest.h>
 
 #include <bit>
+#include <charconv>
+#include <cstring>
+#include <random>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 TEST(IPv6Address, Parsing_and_Stringification_Valid) {
     // Representations, decimal, canonical, stringified
@@ -44,6 +50,47 @@ TEST(IPv6Address, Parsing_and_Stringification_Valid) {
                     {"1::1"}, {1, 0, 0, 0, 0, 0, 0, 1},
                     "0001:0000:0000:0000:0000:0000:0000:0001", "1::1"
             },
+            {
+                    {"FE80:0:0:0:0:0:0:ABCD", "fe80::abcd", "fE80:0::0:aBcD"}, {65152, 0, 0, 0, 0, 0, 0, 43981},
+                    "fe80:0000:0000:0000:0000:0000:0000:abcd", "fe80::abcd"
+            },
+            {
+                    {"1:2:3:4:5:6:7:8", "0001:0002:0003:0004:0005:0006:0007:0008"}, {1, 2, 3, 4, 5, 6, 7, 8},
+                    "0001:0002:0003:0004:0005:0006:0007:0008", "1:2:3:4:5:6:7:8"
+            },
+            {
+                    {"1:2:3:4:5:6:7::", "1:2:3:4:5:6:7:0"}, {1, 2, 3, 4, 5, 6, 7, 0},
+                    "0001:0002:0003:0004:0005:0006:0007:0000", "1:2:3:4:5:6:7:0"
+            },
+            {
+                    {"::2:3:4:5:6:7:8", "0:2:3:4:5:6:7:8"}, {0, 2, 3, 4, 5, 6, 7, 8},
+                    "0000:0002:0003:0004:0005:0006:0007:0008", "0:2:3:4:5:6:7:8"
+            },
+            {
+                    {"1:0:0:2:0:0:0:3", "1:0:0:2::3"}, {1, 0, 0, 2, 0, 0, 0, 3},
+                    "0001:0000:0000:0002:0000:0000:0000:0003", "1:0:0:2::3"
+            },
+            {
+                    {"1:0:0:2:3:0:0:4", "1::2:3:0:0:4"}, {1, 0, 0, 2, 3, 0, 0, 4},
+                    "0001:0000:0000:0002:0003:0000:0000:0004", "1::2:3:0:0:4"
+            },
+            {
+                    {"::ffff:1.2.3.4", "::ffff:0102:0304", "0:0:0:0:0:ffff:1.2.3.4"}, {0, 0, 0, 0, 0, 65535, 258, 772},
+                    "0000:0000:0000:0000:0000:ffff:0102:0304", "::ffff:102:304"
+            },
+            {
+                    {"::192.168.0.1", "::c0a8:1"}, {0, 0, 0, 0, 0, 0, 49320, 1},
+                    "0000:0000:0000:0000:0000:0000:c0a8:0001", "::c0a8:1"
+            },
+            {
+                    {"1::1.2.3.4", "1:0:0:0:0:0:1.2.3.4"}, {1, 0, 0, 0, 0, 0, 258, 772},
+                    "0001:0000:0000:0000:0000:0000:0102:0304", "1::102:304"
+            },
+            {
+                    {"ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255", "FFFF:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF"},
+                    {65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+                    "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"
+            },
     };
 
     for (const auto &address : addresses) {
@@ -81,14 +128,210 @@ TEST(IPv6Address, Parsing_and_Stringification_Valid) {
     }
 }
 
+TEST(IPv6Address, Parsing_Full_and_Embedded_IPv4_Forms) {
+    // Representations, canonical
+    const std::vector<std::pair<std::vector<std::string>, std::string>> addresses = {
+            {{"FE80:0:0:0:0:0:0:ABCD", "fe80::abcd", "fE80:0::0:aBcD"}, "fe80:0000:0000:0000:0000:0000:0000:abcd"},
+            {{"1:2:3:4:5:6:7:8", "0001:0002:0003:0004:0005:0006:0007:0008"}, "0001:0002:0003:0004:0005:0006:0007:0008"},
+            {{"1:2:3:4:5:6:7::", "1:2:3:4:5:6:7:0"}, "0001:0002:0003:0004:0005:0006:0007:0000"},
+            {{"::2:3:4:5:6:7:8", "0:2:3:4:5:6:7:8"}, "0000:0002:0003:0004:0005:0006:0007:0008"},
+            {
+                    {"::ffff:1.2.3.4", "::ffff:0102:0304", "0:0:0:0:0:ffff:1.2.3.4"},
+                    "0000:0000:0000:0000:0000:ffff:0102:0304"
+            },
+            {{"::192.168.0.1", "::c0a8:1"}, "0000:0000:0000:0000:0000:0000:c0a8:0001"},
+            {{"1:2:3:4:5:6:255.255.255.255", "1:2:3:4:5:6:ffff:ffff"}, "0001:0002:0003:0004:0005:0006:ffff:ffff"},
+            {{"1::1.2.3.4", "1:0:0:0:0:0:1.2.3.4"}, "0001:0000:0000:0000:0000:0000:0102:0304"},
+            {{"ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255"}, "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"},
+    };
+
+    for (const auto &[representations, canonical] : addresses) {
+        for (const std::string &representation : representations) {
+            Cronz::IP::IPv6Address ipv6;
+            EXPECT_TRUE(ipv6.parse(representation)) << representation;
+            EXPECT_EQ(ipv6.stringify<false>(), canonical) << representation;
+        }
+    }
+}
+
 TEST(IPv6Address, Parsing_and_Stringification_Invalid) {
-    const std::vector<std::string> representations = {"", ":", "0:1:2:3:"};
+    const std::vector<std::string> representations = {
+            "", ":", "0:1:2:3:", ":::", "1:::2", "::1::", "1::2::3", ":1::", "::1:", ":1:2:3:4:5:6:7:8",
+            "1:2:3:4:5:6:7:8:", "1:2:3:4:5:6:7", "1:2:3:4:5:6:7:8:9", "1:2:3:4::5:6:7:8", "12345::", "g::",
+            "1:2:3:4:5:6:7:8 ", "1::2%eth0", "1.2.3.4", "::1.2.3", "::1.2.3.4.", "::1.2.3.256", "::1.2.3.04x",
+            "1.2.3.4::", "::1.2.3.4:5", "1:2:3:4:5:6:7:1.2.3.4", "1:2:3:4:5:6::1.2.3.4", "::ffff:1.2.3.4abc",
+            ":1.2.3.4", "0000:0000:0000:0000:0000:0000:0000:0000:0000:0000"
+    };
 
-    Cronz::IP::IPv6Address ipv6;
+    Cronz::IP::IPv6Address ipv6("1::2");
+    const Cronz::IP::IPv6Address original = ipv6;
 
     for (const std::string &representation : representations) {
-        EXPECT_FALSE(ipv6.parse(representation));
+        EXPECT_FALSE(ipv6.parse(representation)) << representation;
+        EXPECT_EQ(ipv6, original) << representation;
+    }
+}
+
+TEST(IPv6Address, Parsing_Matches_Constant) {
+    std::mt19937 random(39);
+
+    const std::string alphabet = "0123456789abcdefABCDEF:::::....g ";
+    std::uniform_int_distribution<std::size_t> character(0, alphabet.length() - 1);
+    std::uniform_int_distribution<std::size_t> lengths(0, 46);
+    std::uniform_int_distribution<int> groups(0, 8);
+    std::uniform_int_distribution<int> group(0, 0x1FFFF);
+
+    for (auto i = 0; i < 200000; ++i) {
+        std::string str;
+
+        if (0 == i % 2) {
+            // Mostly well-formed addresses, with a `::` or an embedded IPv4 address every now and then.
+            const int count = groups(random);
+            for (auto j = 0; j < count; ++j) {
+                if (0 != j)
+                    str += (0 == group(random) % 9) ? "::" : ":";
+
+                char buffer[8];
+                str.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), group(random) >> (i % 3), 16).ptr);
+            }
+
+            if (0 == i % 6)
+                str += "::";
+
+            if (0 == i % 8)
+                str += std::to_string(group(random) % 300) + ".2.3.4";
+        }
+        else {
+            const std::size_t length = lengths(random);
+            for (std::size_t j = 0; j < length; ++j)
+                str += alphabet[character(random)];
+        }
+
+        std::array<std::uint8_t, 16> expected{};
+        const bool isValid = Cronz::Internal::ParseIPv6Constant(str.data(), str.length(), expected);
+
+        // The portable implementation and the vectorized one, if supported.
+        for (const auto level : {Cronz::Internal::SIMDLevel::None, Cronz::Internal::DetectSIMDLevel()}) {
+            std::array<std::uint8_t, 16> bytes{};
+            ASSERT_EQ(Cronz::Internal::ParseIPv6(level, str.data(), str.length(), bytes), isValid) << str;
+            if (!isValid)
+                continue;
+
+            ASSERT_EQ(bytes, expected) << str;
+
+            char buffer[Cronz::IP::IPv6Address::MaxLength + 1];
+            char portable[Cronz::IP::IPv6Address::MaxLength + 1];
+            std::size_t length = Cronz::Internal::FormatIPv6<true>(level, bytes, buffer);
+            ASSERT_EQ(std::string_view(buffer, length), std::string_view(portable, Cronz::Internal::FormatIPv6<true>(
+                Cronz::Internal::SIMDLevel::None, bytes, portable))) << str;
+
+            length = Cronz::Internal::FormatIPv6<false>(level, bytes, buffer);
+            ASSERT_EQ(std::string_view(buffer, length), std::string_view(portable, Cronz::Internal::FormatIPv6<false>(
+                Cronz::Internal::SIMDLevel::None, bytes, portable))) << str;
+        }
+    }
+}
+
+TEST(IPv6Address, ToChars_and_FromChars) {
+    const Cronz::IP::IPv6Address ipv6("2001:db8::ff00:42:8329");
+
+    char buffer[64];
+    std::memset(buffer, '#', sizeof(buffer));
+
+    std::to_chars_result result = ipv6.toChars(buffer, buffer + 48);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "2001:db8::ff00:42:8329");
+    EXPECT_EQ(buffer[48], '#');
+
+    // Exact fit, which takes the copying path.
+    result = ipv6.toChars<false>(buffer, buffer + Cronz::IP::IPv6Address::MaxLength);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "2001:0db8:0000:0000:0000:ff00:0042:8329");
+
+    result = ipv6.toChars(buffer, buffer + 21);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + 21);
+
+    const std::string line = "[::ffff:10.0.0.1]:8080 fe80::1%eth0 ::g";
+    Cronz::IP::IPv6Address parsed;
+
+    std::from_chars_result parsing = parsed.fromChars(line.data() + 1, line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, ']');
+    EXPECT_EQ(parsed.stringify<false>(), "0000:0000:0000:0000:0000:ffff:0a00:0001");
+
+    const char *const scoped = line.data() + line.find("fe80");
+    parsing = parsed.fromChars(scoped, line.data() + line.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, '%');
+    EXPECT_EQ(parsed.stringify(), "fe80::1");
+
+    // Hexadecimal digits after the address are taken as part of it.
+    const std::string portSuffixed = "1::2:8080x";
+    parsing = parsed.fromChars(portSuffixed.data(), portSuffixed.data() + portSuffixed.length());
+    ASSERT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, 'x');
+    EXPECT_EQ(parsed.stringify(), "1::2:8080");
+
+    parsing = parsed.fromChars(line.data() + line.length() - 3, line.data() + line.length());
+    EXPECT_EQ(parsing.ec, std::errc());
+    EXPECT_EQ(*parsing.ptr, 'g');
+    EXPECT_EQ(parsed.stringify(), "::");
+
+    const std::string invalid = "1:::2 rest";
+    parsing = parsed.fromChars(invalid.data(), invalid.data() + invalid.length());
+    EXPECT_EQ(parsing.ec, std::errc::invalid_argument);
+    EXPECT_EQ(parsing.ptr, invalid.data());
+    EXPECT_EQ(parsed.stringify(), "::");
+}
+
+TEST(IPv6Address, Ordering) {
+    EXPECT_LT(Cronz::IP::IPv6Address("9:ffff::"), Cronz::IP::IPv6Address("10::"));
+    EXPECT_LT(Cronz::IP::IPv6Address("::ff"), Cronz::IP::IPv6Address("::100"));
+    EXPECT_LT(Cronz::IP::IPv6Address("::ffff:ffff:ffff:ffff"), Cronz::IP::IPv6Address("0:0:0:1::"));
+    EXPECT_GT(Cronz::IP::IPv6Address("2001:db8::1"), Cronz::IP::IPv6Address("2001:db8::"));
+    EXPECT_EQ(Cronz::IP::IPv6Address("::1") <=> Cronz::IP::IPv6Address("::1"), std::strong_ordering::equal);
+}
+
+TEST(IPv6Address, Constant_Evaluation) {
+    using namespace Cronz::IP::Literals;
+
+    constexpr Cronz::IP::IPv6Address ipv6 = "2001:db8::ffff:192.0.2.1"_ipv6;
+    static_assert(ipv6.bytes[1] == static_cast<std::uint8_t>(0x01) && ipv6.bytes[15] == static_cast<std::uint8_t>(1));
+    static_assert(ipv6 == Cronz::IP::IPv6Address(std::array<std::uint8_t, 16>{
+        0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 192, 0, 2, 1}));
+    static_assert(ipv6 < "2001:db8::1:0:0:0"_ipv6 && ipv6 > "2001:db8::"_ipv6);
+    static_assert("::"_ipv6 == Cronz::IP::IPv6Address() && !"::"_ipv6 && "::1"_ipv6);
+    static_assert(!Cronz::IP::IPv6Address("1:::2") && Cronz::IP::IPv6Address::Parse("fe80::1"));
+    static_assert(std::is_trivially_copyable_v<Cronz::IP::IPv6Address>);
+
+    constexpr auto parsed = []() constexpr {
+        Cronz::IP::IPv6Address address("1::");
+        const bool valid = address.parse("::1.2.3.4.");
+        address = "1:2:3:4:5:6:7:8:9";
+        return std::pair(valid, address);
+    }();
+
+    static_assert(!parsed.first && !parsed.second);
+
+    EXPECT_EQ(ipv6.stringify(), "2001:db8::ffff:c000:201");
+    EXPECT_EQ(ipv6, Cronz::IP::IPv6Address("2001:db8::ffff:c000:201"));
+
+    Cronz::IP::IPv6Address assigned("1::");
+    assigned = "2001:db8::1";
+    EXPECT_EQ(assigned.stringify(), "2001:db8::1");
+    assigned = std::string("invalid");
+    EXPECT_FALSE(assigned);
+
+    const Cronz::IP::IPv6Address bits("8000::1");
+    // Bits follow the words in memory, e.g. the first byte is the least significant byte of `low64`.
+    if constexpr (std::endian::little == std::endian::native) {
+        EXPECT_TRUE(bits.bits().test(static_cast<std::size_t>(7)));
+        EXPECT_TRUE(bits.bits().test(static_cast<std::size_t>(120)));
     }
+
+    EXPECT_EQ(bits.bits().count(), static_cast<std::size_t>(2));
+    EXPECT_EQ(Cronz::IP::IPv6Address(bits.bits()), bits);
 }
 
 int main() {
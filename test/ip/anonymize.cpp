@@ -0,0 +1,247 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    const Cronz::IP::IPPseudonymizer::Key key = {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+    };
+
+    // Byte-wise SipHash-c-d, as in the reference implementation.
+    std::uint64_t ReferenceSipHash(const int &c, const int &d, const std::array<std::uint8_t, 16> &k,
+                                   const std::vector<std::uint8_t> &data) {
+        const auto load = [](const std::uint8_t *p, const std::size_t &n) {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            return value;
+        };
+
+        const std::uint64_t k0 = load(k.data(), 8);
+        const std::uint64_t k1 = load(k.data() + 8, 8);
+        std::uint64_t v0 = k0 ^ 0x736F6D6570736575ull;
+        std::uint64_t v1 = k1 ^ 0x646F72616E646F6Dull;
+        std::uint64_t v2 = k0 ^ 0x6C7967656E657261ull;
+        std::uint64_t v3 = k1 ^ 0x7465646279746573ull;
+
+        const auto compress = [&](const std::uint64_t &m, const int &rounds) {
+            v3 ^= m;
+            for (auto r = 0; r < rounds; ++r) {
+                v0 += v1; v1 = std::rotl(v1, 13); v1 ^= v0; v0 = std::rotl(v0, 32);
+                v2 += v3; v3 = std::rotl(v3, 16); v3 ^= v2;
+                v0 += v3; v3 = std::rotl(v3, 21); v3 ^= v0;
+                v2 += v1; v1 = std::rotl(v1, 17); v1 ^= v2; v2 = std::rotl(v2, 32);
+            }
+            v0 ^= m;
+        };
+
+        std::size_t i = 0;
+        for (; i + 8 <= data.size(); i += 8)
+            compress(load(data.data() + i, 8), c);
+        compress(load(data.data() + i, data.size() - i) | (static_cast<std::uint64_t>(data.size()) << 56), c);
+
+        v2 ^= 0xFF;
+        compress(0, d);
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
+    // Bit-by-bit Crypto-PAn over a 128-bit address, the flip bit of each prefix being looked up directly.
+    std::array<std::uint64_t, 2> ReferencePseudonymize(const std::array<std::uint64_t, 2> &words, const int &levels) {
+        const auto append = [](std::vector<std::uint8_t> &data, const std::uint64_t &word) {
+            for (auto i = 0; i < 8; ++i)
+                data.push_back(static_cast<std::uint8_t>(word >> (8 * i)));
+        };
+
+        std::array<std::uint64_t, 2> result = words;
+        for (auto i = 0; i < levels; ++i) {
+            const int half = i / 64;
+            const int bit = i % 64;
+            const int start = bit - bit % 6;
+
+            std::vector<std::uint8_t> data;
+            if (1 == half)
+                append(data, words[0]);
+
+            const std::uint64_t message = (0 == start ? 0 : (words[half] >> (64 - start)) << (64 - start)) |
+                                          (1ull << (63 - start));
+            append(data, message);
+
+            const std::uint64_t hash = ReferenceSipHash(1, 3, key, data);
+            const int j = bit - start;
+            const std::uint64_t extension = (0 == j) ? 0 : (words[half] << start) >> (64 - j);
+
+            if (0 != ((hash >> ((1ull << j) - 1 + extension)) & 1))
+                result[half] ^= 1ull << (63 - bit);
+        }
+
+        return result;
+    }
+}
+
+TEST(Anonymization, SipHashReference) {
+    // Vectors of the SipHash paper, for SipHash-2-4 and the messages 0, 1, ... n - 1.
+    std::vector<std::uint8_t> data;
+    EXPECT_EQ(ReferenceSipHash(2, 4, key, data), 0x726FDB47DD0E0E31ull);
+
+    for (auto i = 0; i < 15; ++i)
+        data.push_back(static_cast<std::uint8_t>(i));
+    EXPECT_EQ(ReferenceSipHash(2, 4, key, data), 0xA129CA6149BE45E5ull);
+}
+
+TEST(Anonymization, Truncation) {
+    std::vector<Cronz::IP::IPv4Address> ipv4 = {
+            Cronz::IP::IPv4Address("192.0.2.55"), Cronz::IP::IPv4Address("198.51.100.255"),
+            Cronz::IP::IPv4Address("10.1.2.3")
+    };
+
+    Cronz::IP::TruncateAddresses(ipv4, static_cast<std::uint8_t>(24));
+    EXPECT_EQ(ipv4[0], Cronz::IP::IPv4Address("192.0.2.0"));
+    EXPECT_EQ(ipv4[1], Cronz::IP::IPv4Address("198.51.100.0"));
+    EXPECT_EQ(ipv4[2], Cronz::IP::IPv4Address("10.1.2.0"));
+
+    Cronz::IP::TruncateAddresses(ipv4, static_cast<std::uint8_t>(9));
+    EXPECT_EQ(ipv4[0], Cronz::IP::IPv4Address("192.0.0.0"));
+    EXPECT_EQ(ipv4[1], Cronz::IP::IPv4Address("198.0.0.0"));
+
+    std::vector<Cronz::IP::IPv4Address> unchanged = {Cronz::IP::IPv4Address("1.2.3.4")};
+    Cronz::IP::TruncateAddresses(unchanged, static_cast<std::uint8_t>(200));
+    EXPECT_EQ(unchanged[0], Cronz::IP::IPv4Address("1.2.3.4"));
+    Cronz::IP::TruncateAddresses(unchanged, static_cast<std::uint8_t>(0));
+    EXPECT_FALSE(unchanged[0]);
+
+    std::vector<Cronz::IP::IPv6Address> ipv6 = {
+            Cronz::IP::IPv6Address("2001:db8:1:2::3"), Cronz::IP::IPv6Address("2001:db8:ffff:ffff:ffff::1"),
+            Cronz::IP::IPv6Address("::ffff:192.0.2.55")
+    };
+
+    Cronz::IP::TruncateAddresses(ipv6, static_cast<std::uint8_t>(48));
+    EXPECT_EQ(ipv6[0], Cronz::IP::IPv6Address("2001:db8:1::"));
+    EXPECT_EQ(ipv6[1], Cronz::IP::IPv6Address("2001:db8:ffff::"));
+    EXPECT_FALSE(ipv6[2]);
+
+    ipv6 = {Cronz::IP::IPv6Address("::ffff:192.0.2.55"), Cronz::IP::IPv6Address("1:2:3:4:5:6:7:8")};
+    Cronz::IP::TruncateAddresses(ipv6, static_cast<std::uint8_t>(120));
+    EXPECT_EQ(ipv6[0], Cronz::IP::IPv6Address("::ffff:192.0.2.0"));
+    EXPECT_EQ(ipv6[1], Cronz::IP::IPv6Address("1:2:3:4:5:6:7:0"));
+
+    Cronz::IP::TruncateAddresses(ipv6, static_cast<std::uint8_t>(72));
+    EXPECT_EQ(ipv6[1], Cronz::IP::IPv6Address("1:2:3:4::"));
+}
+
+TEST(Anonymization, Pseudonymization_IPv4) {
+    const Cronz::IP::IPPseudonymizer pseudonymizer(key);
+
+    std::mt19937 random(40);
+    for (auto i = 0; i < 10000; ++i) {
+        const Cronz::IP::IPv4Address a(static_cast<std::uint32_t>(random()));
+
+        // A second address sharing a random number of leading bits.
+        const int common = static_cast<int>(random() % 33);
+        const std::uint32_t host = Cronz::Internal::NetworkToHost32(a.uint32);
+        const std::uint32_t other = (32 == common) ? host : (host ^ (0x80000000u >> common)) ^
+                                    static_cast<std::uint32_t>(static_cast<std::uint64_t>(random()) >> (common + 1));
+        const Cronz::IP::IPv4Address b(Cronz::Internal::NetworkToHost32(other));
+
+        const Cronz::IP::IPv4Address pa = pseudonymizer.pseudonymize(a);
+        const Cronz::IP::IPv4Address pb = pseudonymizer.pseudonymize(b);
+        const std::uint32_t difference = Cronz::Internal::NetworkToHost32(pa.uint32 ^ pb.uint32);
+        ASSERT_EQ(std::countl_zero(difference), common) << a.stringify() << " " << b.stringify();
+
+        const std::array<std::uint64_t, 2> expected = ReferencePseudonymize({static_cast<std::uint64_t>(host) << 32, 0},
+                                                                            32);
+        ASSERT_EQ(Cronz::Internal::NetworkToHost32(pa.uint32), static_cast<std::uint32_t>(expected[0] >> 32));
+    }
+
+    // A permutation of every network, e.g. of a `/16`.
+    std::vector<Cronz::IP::IPv4Address> block;
+    for (auto i = 0; i < 65536; ++i)
+        block.emplace_back(static_cast<std::uint8_t>(172), static_cast<std::uint8_t>(16),
+                           static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i));
+
+    const Cronz::IP::IPv4Address first = pseudonymizer.pseudonymize(block[0]);
+    pseudonymizer.pseudonymize(block);
+
+    std::unordered_set<std::uint32_t> seen;
+    for (const Cronz::IP::IPv4Address &address : block) {
+        EXPECT_TRUE(Cronz::IP::IPv4Network(first, static_cast<std::uint8_t>(16)).contains(address));
+        seen.insert(address.uint32);
+    }
+
+    EXPECT_EQ(seen.size(), block.size());
+    EXPECT_EQ(block[0], first);
+
+    // Another key, another mapping.
+    Cronz::IP::IPPseudonymizer::Key other = key;
+    other[0] ^= static_cast<std::uint8_t>(1);
+    EXPECT_NE(Cronz::IP::IPPseudonymizer(other).pseudonymize(Cronz::IP::IPv4Address("198.51.100.7")),
+              pseudonymizer.pseudonymize(Cronz::IP::IPv4Address("198.51.100.7")));
+}
+
+TEST(Anonymization, Pseudonymization_IPv6) {
+    const Cronz::IP::IPPseudonymizer pseudonymizer(key);
+
+    std::mt19937_64 random(40);
+    std::vector<Cronz::IP::IPv6Address> addresses;
+    std::vector<Cronz::IP::IPv6Address> expected;
+
+    for (auto i = 0; i < 2000; ++i) {
+        Cronz::IP::IPv6Address a;
+        a.low64 = random();
+        a.high64 = random();
+
+        // A second address sharing a random number of leading bits.
+        const auto common = static_cast<int>(random() % 129);
+        Cronz::IP::IPv6Address b = a;
+        if (128 != common) {
+            b.bytes[common / 8] ^= static_cast<std::uint8_t>(0x80u >> (common % 8));
+            for (auto bit = common + 1; bit < 128; ++bit) {
+                if (0 != (random() & 1))
+                    b.bytes[bit / 8] ^= static_cast<std::uint8_t>(0x80u >> (bit % 8));
+            }
+        }
+
+        const Cronz::IP::IPv6Address pa = pseudonymizer.pseudonymize(a);
+        const Cronz::IP::IPv6Address pb = pseudonymizer.pseudonymize(b);
+
+        auto shared = 0;
+        while (shared < 128 && 0 == ((pa.bytes[shared / 8] ^ pb.bytes[shared / 8]) & (0x80u >> (shared % 8))))
+            ++shared;
+
+        ASSERT_EQ(shared, common) << a.stringify() << " " << b.stringify();
+
+        const std::array<std::uint64_t, 2> reference = ReferencePseudonymize(
+            {Cronz::Internal::NetworkToHost64(a.low64), Cronz::Internal::NetworkToHost64(a.high64)}, 128);
+        ASSERT_EQ(Cronz::Internal::NetworkToHost64(pa.low64), reference[0]);
+        ASSERT_EQ(Cronz::Internal::NetworkToHost64(pa.high64), reference[1]);
+
+        addresses.push_back(a);
+        expected.push_back(pa);
+    }
+
+    pseudonymizer.pseudonymize(addresses);
+    EXPECT_EQ(addresses, expected);
+
+    // The results are plain addresses.
+    const Cronz::IP::IPv6Address pseudonym = pseudonymizer.pseudonymize(Cronz::IP::IPv6Address("2001:db8::1"));
+    EXPECT_EQ(Cronz::IP::IPv6Address(pseudonym.stringify()), pseudonym);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
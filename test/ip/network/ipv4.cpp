@@ -0,0 +1,171 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/network.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(IPv4Network, Valid) {
+    const std::vector<std::pair<std::string, std::string>> list = {
+        {"0.0.0.0/0", "0.0.0.0/0"},
+        {"10.0.0.0/8", "10.0.0.0/8"},
+        {"10.1.2.3/8", "10.0.0.0/8"},
+        {"192.168.1.77/24", "192.168.1.0/24"},
+        {"192.168.1.77/32", "192.168.1.77/32"},
+        {"192.168.1.77", "192.168.1.77/32"},
+        {"255.255.255.255/1", "128.0.0.0/1"},
+        {"172.31.255.255/12", "172.16.0.0/12"},
+        {"100.64.0.1/10", "100.64.0.0/10"},
+        {"203.0.113.9/31", "203.0.113.8/31"},
+    };
+
+    for (const auto &[input, expected] : list) {
+        Cronz::IP::IPv4Network network;
+        ASSERT_TRUE(network.parse(input)) << input;
+        EXPECT_EQ(network.stringify(), expected);
+        EXPECT_EQ(network.length(), expected.length());
+        EXPECT_EQ(Cronz::IP::IPv4Network(input), network);
+    }
+}
+
+TEST(IPv4Network, Invalid) {
+    const std::vector<std::string> list = {
+        "",
+        "/",
+        "/8",
+        "10.0.0.0/",
+        "10.0.0.0/33",
+        "10.0.0.0/08",
+        "10.0.0.0/00",
+        "10.0.0.0/1000",
+        "10.0.0.0/8/8",
+        "10.0.0.0/-8",
+        "10.0.0.0/+8",
+        "10.0.0.0/ 8",
+        "10.0.0.0 /8",
+        "10.0.0/8",
+        "10.0.0.256/8",
+        "10.0.0.0/8a",
+        "::/0",
+    };
+
+    const Cronz::IP::IPv4Network original("192.0.2.0/24");
+    for (const auto &str : list) {
+        Cronz::IP::IPv4Network network = original;
+        EXPECT_FALSE(network.parse(str)) << str;
+        EXPECT_EQ(network, original) << str;
+    }
+
+    EXPECT_EQ(Cronz::IP::IPv4Network("10.0.0.0/33"), Cronz::IP::IPv4Network());
+}
+
+TEST(IPv4Network, ToChars_Buffer_Bounds) {
+    const Cronz::IP::IPv4Network network("255.255.255.255/32");
+
+    char buffer[32];
+    buffer[Cronz::IP::IPv4Network::MaxLength] = '#';
+
+    std::to_chars_result result = network.toChars(buffer, buffer + Cronz::IP::IPv4Network::MaxLength);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "255.255.255.255/32");
+    EXPECT_EQ(buffer[Cronz::IP::IPv4Network::MaxLength], '#');
+
+    result = network.toChars(buffer, buffer + Cronz::IP::IPv4Network::MaxLength - 1);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + Cronz::IP::IPv4Network::MaxLength - 1);
+}
+
+TEST(IPv4Network, Bounds) {
+    const Cronz::IP::IPv4Network network("172.16.0.0/12");
+    EXPECT_EQ(network.mask(), Cronz::IP::IPv4Address("255.240.0.0"));
+    EXPECT_EQ(network.first(), Cronz::IP::IPv4Address("172.16.0.0"));
+    EXPECT_EQ(network.last(), Cronz::IP::IPv4Address("172.31.255.255"));
+
+    EXPECT_EQ(Cronz::IP::IPv4Network().mask(), Cronz::IP::IPv4Address("0.0.0.0"));
+    EXPECT_EQ(Cronz::IP::IPv4Network().last(), Cronz::IP::IPv4Address("255.255.255.255"));
+    EXPECT_EQ(Cronz::IP::IPv4Network("1.2.3.4").mask(), Cronz::IP::IPv4Address("255.255.255.255"));
+    EXPECT_EQ(Cronz::IP::IPv4Network("1.2.3.4").last(), Cronz::IP::IPv4Address("1.2.3.4"));
+}
+
+TEST(IPv4Network, Contains) {
+    const Cronz::IP::IPv4Network network("10.0.0.0/8");
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv4Address("10.0.0.0")));
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv4Address("10.255.255.255")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv4Address("11.0.0.0")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv4Address("9.255.255.255")));
+
+    EXPECT_TRUE(network.contains(network));
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv4Network("10.20.0.0/16")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv4Network("10.0.0.0/7")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv4Network("11.0.0.0/16")));
+
+    EXPECT_TRUE(Cronz::IP::IPv4Network().contains(Cronz::IP::IPv4Address("203.0.113.1")));
+    EXPECT_TRUE(Cronz::IP::IPv4Network().contains(network));
+    EXPECT_TRUE(Cronz::IP::IPv4Network("1.2.3.4").contains(Cronz::IP::IPv4Address("1.2.3.4")));
+    EXPECT_FALSE(Cronz::IP::IPv4Network("1.2.3.4").contains(Cronz::IP::IPv4Address("1.2.3.5")));
+}
+
+TEST(IPv4Network, Subnets) {
+    const Cronz::IP::IPv4Network network("192.168.0.0/16");
+
+    Cronz::IP::IPv4Network subnet;
+    ASSERT_TRUE(network.subnet(24, 0, subnet));
+    EXPECT_EQ(subnet.stringify(), "192.168.0.0/24");
+    ASSERT_TRUE(network.subnet(24, 255, subnet));
+    EXPECT_EQ(subnet.stringify(), "192.168.255.0/24");
+    ASSERT_TRUE(network.subnet(32, 65535, subnet));
+    EXPECT_EQ(subnet.stringify(), "192.168.255.255/32");
+    ASSERT_TRUE(network.subnet(16, 0, subnet));
+    EXPECT_EQ(subnet, network);
+
+    EXPECT_FALSE(network.subnet(24, 256, subnet));
+    EXPECT_FALSE(network.subnet(15, 0, subnet));
+    EXPECT_FALSE(network.subnet(33, 0, subnet));
+    EXPECT_FALSE(network.subnet(16, 1, subnet));
+    EXPECT_EQ(subnet.stringify(), "192.168.0.0/16");
+
+    ASSERT_TRUE(Cronz::IP::IPv4Network().subnet(32, 0xFFFFFFFFull, subnet));
+    EXPECT_EQ(subnet.stringify(), "255.255.255.255/32");
+    EXPECT_FALSE(Cronz::IP::IPv4Network().subnet(32, 0x100000000ull, subnet));
+
+    Cronz::IP::IPv4Network lower;
+    Cronz::IP::IPv4Network upper;
+    ASSERT_TRUE(network.split(lower, upper));
+    EXPECT_EQ(lower.stringify(), "192.168.0.0/17");
+    EXPECT_EQ(upper.stringify(), "192.168.128.0/17");
+    EXPECT_FALSE(Cronz::IP::IPv4Network("1.2.3.4").split(lower, upper));
+}
+
+TEST(IPv4Network, Supernets) {
+    const Cronz::IP::IPv4Network network("192.168.1.0/24");
+    EXPECT_EQ(network.supernet().stringify(), "192.168.0.0/23");
+    EXPECT_EQ(network.supernet(16).stringify(), "192.168.0.0/16");
+    EXPECT_EQ(network.supernet(30), network);
+    EXPECT_EQ(Cronz::IP::IPv4Network().supernet(), Cronz::IP::IPv4Network());
+
+    EXPECT_EQ(Cronz::IP::IPv4Network::Supernet(Cronz::IP::IPv4Network("192.168.1.0/24"),
+                                               Cronz::IP::IPv4Network("192.168.2.0/24")).stringify(),
+              "192.168.0.0/22");
+    EXPECT_EQ(Cronz::IP::IPv4Network::Supernet(Cronz::IP::IPv4Network("10.1.0.0/16"),
+                                               Cronz::IP::IPv4Network("10.0.0.0/8")).stringify(), "10.0.0.0/8");
+    EXPECT_EQ(Cronz::IP::IPv4Network::Supernet(Cronz::IP::IPv4Network("1.2.3.4"),
+                                               Cronz::IP::IPv4Network("1.2.3.4")).stringify(), "1.2.3.4/32");
+    EXPECT_EQ(Cronz::IP::IPv4Network::Supernet(Cronz::IP::IPv4Network("0.0.0.1"),
+                                               Cronz::IP::IPv4Network("128.0.0.1")).stringify(), "0.0.0.0/0");
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
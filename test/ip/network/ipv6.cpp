@@ -0,0 +1,195 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/network.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(IPv6Network, Valid) {
+    const std::vector<std::pair<std::string, std::string>> list = {
+        {"::/0", "::/0"},
+        {"2001:db8::/32", "2001:db8::/32"},
+        {"2001:db8:1:2:3:4:5:6/32", "2001:db8::/32"},
+        {"2001:db8:1:2:3:4:5:6/64", "2001:db8:1:2::/64"},
+        {"2001:db8:1:2:3:4:5:6/65", "2001:db8:1:2::/65"},
+        {"2001:db8:1:2:8000::/65", "2001:db8:1:2:8000::/65"},
+        {"2001:db8:1:2:3:4:5:6/127", "2001:db8:1:2:3:4:5:6/127"},
+        {"2001:db8:1:2:3:4:5:7/127", "2001:db8:1:2:3:4:5:6/127"},
+        {"2001:db8:1:2:3:4:5:6/128", "2001:db8:1:2:3:4:5:6/128"},
+        {"2001:db8:1:2:3:4:5:6", "2001:db8:1:2:3:4:5:6/128"},
+        {"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/1", "8000::/1"},
+        {"fe80::1%/10", ""},
+        {"::ffff:192.0.2.1/120", "::ffff:c000:200/120"},
+    };
+
+    for (const auto &[input, expected] : list) {
+        Cronz::IP::IPv6Network network;
+        if (expected.empty()) {
+            EXPECT_FALSE(network.parse(input)) << input;
+            continue;
+        }
+
+        ASSERT_TRUE(network.parse(input)) << input;
+        EXPECT_EQ(network.stringify(), expected);
+        EXPECT_EQ(network.length(), expected.length());
+        EXPECT_EQ(Cronz::IP::IPv6Network(input), network);
+    }
+
+    const Cronz::IP::IPv6Network network("2001:db8::/48");
+    EXPECT_EQ(network.stringify<false>(), "2001:0db8:0000:0000:0000:0000:0000:0000/48");
+    EXPECT_EQ(network.length<false>(), network.stringify<false>().length());
+}
+
+TEST(IPv6Network, Invalid) {
+    const std::vector<std::string> list = {
+        "",
+        "/",
+        "/64",
+        "::/",
+        "::/129",
+        "::/064",
+        "::/00",
+        "::/1000",
+        "::/64/64",
+        "::/-1",
+        "::/ 64",
+        ":: /64",
+        ":/64",
+        "2001:db8::1::/64",
+        "10.0.0.0/8",
+    };
+
+    const Cronz::IP::IPv6Network original("2001:db8::/32");
+    for (const auto &str : list) {
+        Cronz::IP::IPv6Network network = original;
+        EXPECT_FALSE(network.parse(str)) << str;
+        EXPECT_EQ(network, original) << str;
+    }
+
+    EXPECT_EQ(Cronz::IP::IPv6Network("::/129"), Cronz::IP::IPv6Network());
+}
+
+TEST(IPv6Network, ToChars_Buffer_Bounds) {
+    const Cronz::IP::IPv6Network network("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+
+    char buffer[64];
+    buffer[Cronz::IP::IPv6Network::MaxLength] = '#';
+
+    std::to_chars_result result = network.toChars(buffer, buffer + Cronz::IP::IPv6Network::MaxLength);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+    EXPECT_EQ(buffer[Cronz::IP::IPv6Network::MaxLength], '#');
+
+    result = network.toChars(buffer, buffer + Cronz::IP::IPv6Network::MaxLength - 1);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + Cronz::IP::IPv6Network::MaxLength - 1);
+}
+
+TEST(IPv6Network, Bounds) {
+    const Cronz::IP::IPv6Network network("2001:db8:abcd:1200::/56");
+    EXPECT_EQ(network.mask(), Cronz::IP::IPv6Address("ffff:ffff:ffff:ff00::"));
+    EXPECT_EQ(network.first(), Cronz::IP::IPv6Address("2001:db8:abcd:1200::"));
+    EXPECT_EQ(network.last(), Cronz::IP::IPv6Address("2001:db8:abcd:12ff:ffff:ffff:ffff:ffff"));
+
+    const Cronz::IP::IPv6Network wide("2001:db8::/96");
+    EXPECT_EQ(wide.mask(), Cronz::IP::IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff::"));
+    EXPECT_EQ(wide.last(), Cronz::IP::IPv6Address("2001:db8::ffff:ffff"));
+
+    EXPECT_EQ(Cronz::IP::IPv6Network().mask(), Cronz::IP::IPv6Address("::"));
+    EXPECT_EQ(Cronz::IP::IPv6Network().last(), Cronz::IP::IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(Cronz::IP::IPv6Network("::1").mask(), Cronz::IP::IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(Cronz::IP::IPv6Network("::1").last(), Cronz::IP::IPv6Address("::1"));
+}
+
+TEST(IPv6Network, Contains) {
+    const Cronz::IP::IPv6Network network("2001:db8::/32");
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv6Address("2001:db8::")));
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv6Address("2001:db8:ffff:ffff:ffff:ffff:ffff:ffff")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv6Address("2001:db9::")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv6Address("2001:db7:ffff::")));
+
+    EXPECT_TRUE(network.contains(network));
+    EXPECT_TRUE(network.contains(Cronz::IP::IPv6Network("2001:db8:1::/48")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv6Network("2001:db8::/31")));
+    EXPECT_FALSE(network.contains(Cronz::IP::IPv6Network("2001:db9::/48")));
+
+    // Prefixes reaching into the last 64 bits.
+    const Cronz::IP::IPv6Network deep("2001:db8::ab00:0/104");
+    EXPECT_TRUE(deep.contains(Cronz::IP::IPv6Address("2001:db8::abff:ffff")));
+    EXPECT_FALSE(deep.contains(Cronz::IP::IPv6Address("2001:db8::ac00:0")));
+    EXPECT_FALSE(deep.contains(Cronz::IP::IPv6Address("2001:db9::ab00:0")));
+
+    EXPECT_TRUE(Cronz::IP::IPv6Network().contains(Cronz::IP::IPv6Address("fe80::1")));
+    EXPECT_TRUE(Cronz::IP::IPv6Network("::1").contains(Cronz::IP::IPv6Address("::1")));
+    EXPECT_FALSE(Cronz::IP::IPv6Network("::1").contains(Cronz::IP::IPv6Address("::")));
+}
+
+TEST(IPv6Network, Subnets) {
+    const Cronz::IP::IPv6Network network("2001:db8::/32");
+
+    Cronz::IP::IPv6Network subnet;
+    ASSERT_TRUE(network.subnet(48, 0, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8::/48");
+    ASSERT_TRUE(network.subnet(48, 0xFFFF, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8:ffff::/48");
+    ASSERT_TRUE(network.subnet(64, 0xABCD1234ull, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8:abcd:1234::/64");
+    ASSERT_TRUE(network.subnet(96, 0xABCD12345678ull, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8:0:abcd:1234:5678::/96");
+    ASSERT_TRUE(network.subnet(128, 5, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8::5/128");
+
+    EXPECT_FALSE(network.subnet(48, 0x10000, subnet));
+    EXPECT_FALSE(network.subnet(31, 0, subnet));
+    EXPECT_FALSE(network.subnet(129, 0, subnet));
+    EXPECT_EQ(subnet.stringify(), "2001:db8::5/128");
+
+    ASSERT_TRUE(Cronz::IP::IPv6Network().subnet(64, 0xFFFFFFFFFFFFFFFFull, subnet));
+    EXPECT_EQ(subnet.stringify(), "ffff:ffff:ffff:ffff::/64");
+    ASSERT_TRUE(Cronz::IP::IPv6Network().subnet(128, 0xFFFFFFFFFFFFFFFFull, subnet));
+    EXPECT_EQ(subnet.stringify(), "::ffff:ffff:ffff:ffff/128");
+
+    Cronz::IP::IPv6Network lower;
+    Cronz::IP::IPv6Network upper;
+    ASSERT_TRUE(network.split(lower, upper));
+    EXPECT_EQ(lower.stringify(), "2001:db8::/33");
+    EXPECT_EQ(upper.stringify(), "2001:db8:8000::/33");
+    ASSERT_TRUE(Cronz::IP::IPv6Network("2001:db8::/64").split(lower, upper));
+    EXPECT_EQ(upper.stringify(), "2001:db8:0:0:8000::/65");
+    EXPECT_FALSE(Cronz::IP::IPv6Network("::1").split(lower, upper));
+}
+
+TEST(IPv6Network, Supernets) {
+    const Cronz::IP::IPv6Network network("2001:db8:1::/48");
+    EXPECT_EQ(network.supernet().stringify(), "2001:db8::/47");
+    EXPECT_EQ(network.supernet(32).stringify(), "2001:db8::/32");
+    EXPECT_EQ(network.supernet(64), network);
+    EXPECT_EQ(Cronz::IP::IPv6Network().supernet(), Cronz::IP::IPv6Network());
+
+    EXPECT_EQ(Cronz::IP::IPv6Network::Supernet(Cronz::IP::IPv6Network("2001:db8:1::/48"),
+                                               Cronz::IP::IPv6Network("2001:db8:2::/48")).stringify(),
+              "2001:db8::/46");
+    EXPECT_EQ(Cronz::IP::IPv6Network::Supernet(Cronz::IP::IPv6Network("2001:db8::1"),
+                                               Cronz::IP::IPv6Network("2001:db8::2")).stringify(),
+              "2001:db8::/126");
+    EXPECT_EQ(Cronz::IP::IPv6Network::Supernet(Cronz::IP::IPv6Network("::1"),
+                                               Cronz::IP::IPv6Network("::1")).stringify(), "::1/128");
+    EXPECT_EQ(Cronz::IP::IPv6Network::Supernet(Cronz::IP::IPv6Network("::1"),
+                                               Cronz::IP::IPv6Network("8000::1")).stringify(), "::/0");
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
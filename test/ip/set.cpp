@@ -0,0 +1,235 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/set.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+    // Sets are compared against bitmaps of a 4096-address universe, `10.0.0.0/20`.
+    constexpr std::uint32_t Universe = 4096;
+
+    Cronz::IP::IPv4Address Address(const std::uint32_t &offset) {
+        return Cronz::IP::IPv4Address(Cronz::Internal::NetworkToHost32(0x0A000000u + offset));
+    }
+
+    void Fill(std::mt19937 &random, Cronz::IP::IPSet &set, std::bitset<Universe> &bits) {
+        std::vector<Cronz::IP::IPv4Range> ranges;
+        for (int i = 0; i < 40; ++i) {
+            const std::uint32_t first = random() % Universe;
+            const std::uint32_t last = std::min(Universe - 1, first + static_cast<std::uint32_t>(random() % 64));
+            ranges.push_back({Address(first), Address(last)});
+
+            for (std::uint32_t j = first; j <= last; ++j)
+                bits.set(j);
+        }
+
+        ASSERT_TRUE(set.insert(ranges));
+    }
+
+    void Compare(const Cronz::IP::IPSet &set, const std::bitset<Universe> &bits) {
+        for (std::uint32_t i = 0; i < Universe; ++i)
+            ASSERT_EQ(set.contains(Address(i)), bits.test(i)) << i;
+
+        // Ranges are sorted, disjoint and non-adjacent.
+        std::vector<Cronz::IP::IPv4Range> ranges;
+        ASSERT_TRUE(set.ranges(ranges));
+        for (std::size_t i = 1; i < ranges.size(); ++i) {
+            ASSERT_LT(Cronz::Internal::NetworkToHost32(ranges[i - 1].last.uint32) + 1,
+                      Cronz::Internal::NetworkToHost32(ranges[i].first.uint32));
+        }
+    }
+}
+
+TEST(IPSet, Canonical_Form) {
+    Cronz::IP::IPSet set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("0.0.0.0")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("255.255.255.255")));
+
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.0.10"),
+                                                 Cronz::IP::IPv4Address("10.0.0.20")}));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.0.30"),
+                                                 Cronz::IP::IPv4Address("10.0.0.40")}));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Address("10.0.0.21")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Address("10.0.0.29")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Network("192.168.0.0/16")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Network("192.168.1.0/24")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv6Network("2001:db8::/32")));
+    EXPECT_FALSE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.0.2"),
+                                                  Cronz::IP::IPv4Address("10.0.0.1")}));
+
+    std::vector<Cronz::IP::IPv4Range> ranges;
+    ASSERT_TRUE(set.ranges(ranges));
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(ranges[0].first, Cronz::IP::IPv4Address("10.0.0.10"));
+    EXPECT_EQ(ranges[0].last, Cronz::IP::IPv4Address("10.0.0.21"));
+    EXPECT_EQ(ranges[1].first, Cronz::IP::IPv4Address("10.0.0.29"));
+    EXPECT_EQ(ranges[1].last, Cronz::IP::IPv4Address("10.0.0.40"));
+    EXPECT_EQ(ranges[2].first, Cronz::IP::IPv4Address("192.168.0.0"));
+    EXPECT_EQ(ranges[2].last, Cronz::IP::IPv4Address("192.168.255.255"));
+    EXPECT_EQ(set.size(), 4u);
+
+    // Filling the gap merges the neighbours.
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.0.22"),
+                                                 Cronz::IP::IPv4Address("10.0.0.28")}));
+    ASSERT_TRUE(set.ranges(ranges));
+    ASSERT_EQ(ranges.size(), 2u);
+    EXPECT_EQ(ranges[0].first, Cronz::IP::IPv4Address("10.0.0.10"));
+    EXPECT_EQ(ranges[0].last, Cronz::IP::IPv4Address("10.0.0.40"));
+
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv4Address("10.0.0.10")));
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv4Address("10.0.0.40")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("10.0.0.9")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("10.0.0.41")));
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv4Network("192.168.3.0/24")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Network("192.168.0.0/15")));
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv6Address("2001:db8::1")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv6Address("2001:db9::")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv6Network("2001:db8::/31")));
+}
+
+TEST(IPSet, Extremes) {
+    Cronz::IP::IPSet set;
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Address("255.255.255.255")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Address("0.0.0.0")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff")));
+
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv4Address("255.255.255.255")));
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv4Address("0.0.0.0")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("255.255.255.254")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv4Address("0.0.0.1")));
+    EXPECT_TRUE(set.contains(Cronz::IP::IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff")));
+    EXPECT_FALSE(set.contains(Cronz::IP::IPv6Address("::")));
+
+    Cronz::IP::IPSet other;
+    ASSERT_TRUE(other.insert(Cronz::IP::IPv4Address("1.2.3.4")));
+    EXPECT_FALSE(other.contains(Cronz::IP::IPv4Address("255.255.255.255")));
+
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Network("0.0.0.0/0")));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv6Network("::/0")));
+
+    std::vector<Cronz::IP::IPv4Network> networks;
+    ASSERT_TRUE(set.summarize(networks));
+    ASSERT_EQ(networks.size(), 1u);
+    EXPECT_EQ(networks[0].stringify(), "0.0.0.0/0");
+
+    std::vector<Cronz::IP::IPv6Network> networks6;
+    ASSERT_TRUE(set.summarize(networks6));
+    ASSERT_EQ(networks6.size(), 1u);
+    EXPECT_EQ(networks6[0].stringify(), "::/0");
+}
+
+TEST(IPSet, Summarization) {
+    Cronz::IP::IPSet set;
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.0.1"),
+                                                 Cronz::IP::IPv4Address("10.0.0.10")}));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv4Range{Cronz::IP::IPv4Address("10.0.1.0"),
+                                                 Cronz::IP::IPv4Address("10.0.2.255")}));
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv6Range{Cronz::IP::IPv6Address("2001:db8::ffff:ffff:ffff:ffff"),
+                                                 Cronz::IP::IPv6Address("2001:db8:0:1::2")}));
+
+    std::vector<Cronz::IP::IPv4Network> networks;
+    ASSERT_TRUE(set.summarize(networks));
+
+    std::vector<std::string> strings;
+    for (const auto &network : networks)
+        strings.push_back(network.stringify());
+
+    EXPECT_EQ(strings, (std::vector<std::string>{"10.0.0.1/32", "10.0.0.2/31", "10.0.0.4/30", "10.0.0.8/31",
+                                                  "10.0.0.10/32", "10.0.1.0/24", "10.0.2.0/24"}));
+
+    std::vector<Cronz::IP::IPv6Network> networks6;
+    ASSERT_TRUE(set.summarize(networks6));
+
+    strings.clear();
+    for (const auto &network : networks6)
+        strings.push_back(network.stringify());
+
+    EXPECT_EQ(strings, (std::vector<std::string>{"2001:db8::ffff:ffff:ffff:ffff/128", "2001:db8:0:1::/127",
+                                                  "2001:db8:0:1::2/128"}));
+
+    // Summarized networks rebuild the same set.
+    Cronz::IP::IPSet rebuilt;
+    ASSERT_TRUE(rebuilt.insert(networks));
+    ASSERT_TRUE(rebuilt.insert(networks6));
+    EXPECT_EQ(rebuilt, set);
+}
+
+TEST(IPSet, Operations) {
+    std::mt19937 random(13);
+
+    for (int round = 0; round < 20; ++round) {
+        Cronz::IP::IPSet a;
+        Cronz::IP::IPSet b;
+        std::bitset<Universe> aBits;
+        std::bitset<Universe> bBits;
+        Fill(random, a, aBits);
+        Fill(random, b, bBits);
+        Compare(a, aBits);
+        Compare(b, bBits);
+
+        Cronz::IP::IPSet result;
+        ASSERT_TRUE(result.assign(a));
+        ASSERT_TRUE(result.unite(b));
+        Compare(result, aBits | bBits);
+
+        ASSERT_TRUE(result.assign(a));
+        ASSERT_TRUE(result.intersect(b));
+        Compare(result, aBits & bBits);
+
+        ASSERT_TRUE(result.assign(a));
+        ASSERT_TRUE(result.subtract(b));
+        Compare(result, aBits & ~bBits);
+
+        ASSERT_TRUE(result.subtract(a));
+        EXPECT_TRUE(result.empty());
+    }
+}
+
+TEST(IPSet, Batch_Contains) {
+    std::mt19937 random(17);
+
+    Cronz::IP::IPSet set;
+    std::bitset<Universe> bits;
+    Fill(random, set, bits);
+
+    std::vector<Cronz::IP::IPv4Address> addresses(1001);
+    for (auto &address : addresses)
+        address = Address(random() % (Universe + 64));
+
+    std::unique_ptr<bool[]> results(new bool[addresses.size()]);
+    const std::size_t found = set.contains(addresses, std::span<bool>(results.get(), addresses.size()));
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        EXPECT_EQ(results[i], set.contains(addresses[i])) << i;
+        expected += results[i];
+    }
+
+    EXPECT_EQ(found, expected);
+
+    std::vector<Cronz::IP::IPv6Address> addresses6 = {Cronz::IP::IPv6Address("2001:db8::1")};
+    ASSERT_TRUE(set.insert(Cronz::IP::IPv6Network("2001:db8::/32")));
+    EXPECT_EQ(set.contains(addresses6, std::span<bool>(results.get(), 1)), 1u);
+    EXPECT_TRUE(results[0]);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/table.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::optional<std::uint32_t> Reference(const std::vector<Cronz::IP::IPv4Route> &routes,
+                                           const Cronz::IP::IPv4Address &address) {
+        std::optional<std::uint32_t> value;
+        int prefix = -1;
+        for (const auto &route : routes) {
+            if (route.network.contains(address) && static_cast<int>(route.network.prefix) >= prefix) {
+                prefix = route.network.prefix;
+                value = route.value;
+            }
+        }
+
+        return value;
+    }
+}
+
+TEST(IPv4RouteTable, Lookup) {
+    const std::vector<Cronz::IP::IPv4Route> routes = {
+        {Cronz::IP::IPv4Network("0.0.0.0/0"), 0},
+        {Cronz::IP::IPv4Network("10.0.0.0/8"), 1},
+        {Cronz::IP::IPv4Network("10.1.0.0/16"), 2},
+        {Cronz::IP::IPv4Network("10.1.2.0/24"), 3},
+        {Cronz::IP::IPv4Network("10.1.2.128/25"), 4},
+        {Cronz::IP::IPv4Network("10.1.2.200/32"), 5},
+        {Cronz::IP::IPv4Network("10.1.2.0/24"), 6},
+    };
+
+    Cronz::IP::IPv4RouteTable table;
+    EXPECT_TRUE(table.empty());
+
+    std::uint32_t value = 99;
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv4Address("10.0.0.1"), value));
+    EXPECT_EQ(value, 99u);
+
+    ASSERT_TRUE(table.build(routes));
+    EXPECT_TRUE(table);
+    EXPECT_EQ(table.size(), routes.size());
+
+    const std::vector<std::pair<const char*, std::uint32_t>> list = {
+        {"192.0.2.1", 0},
+        {"10.200.0.1", 1},
+        {"10.1.200.1", 2},
+        {"10.1.2.1", 6},
+        {"10.1.2.127", 6},
+        {"10.1.2.128", 4},
+        {"10.1.2.199", 4},
+        {"10.1.2.200", 5},
+        {"10.1.2.201", 4},
+        {"10.1.3.0", 2},
+    };
+
+    for (const auto &[address, expected] : list) {
+        ASSERT_TRUE(table.lookup(Cronz::IP::IPv4Address(address), value)) << address;
+        EXPECT_EQ(value, expected) << address;
+    }
+
+    ASSERT_TRUE(table.build(std::vector<Cronz::IP::IPv4Route>{{Cronz::IP::IPv4Network("10.1.2.200/32"), 7}}));
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv4Address("10.1.2.201"), value));
+    ASSERT_TRUE(table.lookup(Cronz::IP::IPv4Address("10.1.2.200"), value));
+    EXPECT_EQ(value, 7u);
+
+    EXPECT_FALSE(table.build(std::vector<Cronz::IP::IPv4Route>{
+        {Cronz::IP::IPv4Network("10.0.0.0/8"), Cronz::IP::IPv4RouteTable::MaxValue + 1}}));
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv4Address("10.1.2.200"), value));
+}
+
+TEST(IPv4RouteTable, Random) {
+    std::mt19937 random(3);
+
+    // Prefixes are drawn around a few /8s so that they nest.
+    std::vector<Cronz::IP::IPv4Route> routes(2000);
+    for (auto i = static_cast<std::size_t>(0); i < routes.size(); ++i) {
+        const auto base = static_cast<std::uint32_t>(random() % 4 + 10) << 24;
+        const Cronz::IP::IPv4Address address(Cronz::Internal::NetworkToHost32(base | (random() & 0x00FFFFFFu)));
+        routes[i] = {Cronz::IP::IPv4Network(address, static_cast<std::uint8_t>(8 + random() % 25)),
+                     static_cast<std::uint32_t>(i)};
+    }
+
+    const Cronz::IP::IPv4RouteTable table(routes);
+    ASSERT_FALSE(table.empty());
+
+    std::vector<Cronz::IP::IPv4Address> addresses(5000);
+    for (auto &address : addresses) {
+        // Half of the addresses are taken from within the routes.
+        if (0 == random() % 2) {
+            const auto &route = routes[random() % routes.size()];
+            address = Cronz::IP::IPv4Address(route.network.address.uint32 | (~route.network.mask().uint32 &
+                                                                              static_cast<std::uint32_t>(random())));
+        }
+        else
+            address = Cronz::IP::IPv4Address(Cronz::Internal::NetworkToHost32(
+                (static_cast<std::uint32_t>(random() % 6 + 9) << 24) | (random() & 0x00FFFFFFu)));
+    }
+
+    std::vector<std::uint32_t> values(addresses.size());
+    const std::size_t found = table.lookup(addresses, values, UINT32_MAX);
+
+    std::size_t expectedFound = 0;
+    for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+        const std::optional<std::uint32_t> expected = Reference(routes, addresses[i]);
+        expectedFound += expected.has_value();
+        EXPECT_EQ(values[i], expected.value_or(UINT32_MAX)) << addresses[i].stringify();
+    }
+
+    EXPECT_EQ(found, expectedFound);
+}
+
+TEST(IPv4RouteTable, Shared) {
+    Cronz::IP::SharedRouteTable<Cronz::IP::IPv4RouteTable> shared;
+    EXPECT_EQ(shared.load(), nullptr);
+
+    const Cronz::IP::IPv4Address address("192.0.2.1");
+    shared.store(std::make_shared<const Cronz::IP::IPv4RouteTable>(
+        std::vector<Cronz::IP::IPv4Route>{{Cronz::IP::IPv4Network("192.0.2.0/24"), 0}}));
+
+    std::atomic<bool> done = false;
+    std::atomic<bool> failed = false;
+    std::thread reader([&] {
+        std::uint32_t previous = 0;
+        while (!done.load()) {
+            const std::shared_ptr<const Cronz::IP::IPv4RouteTable> table = shared.load();
+
+            // Tables are published in increasing value order.
+            std::uint32_t value = 0;
+            if (!table->lookup(address, value) || value < previous)
+                failed = true;
+
+            previous = value;
+        }
+    });
+
+    for (auto i = static_cast<std::uint32_t>(1); i <= static_cast<std::uint32_t>(3); ++i) {
+        const std::shared_ptr<const Cronz::IP::IPv4RouteTable> previous = shared.exchange(
+            std::make_shared<const Cronz::IP::IPv4RouteTable>(
+                std::vector<Cronz::IP::IPv4Route>{{Cronz::IP::IPv4Network("192.0.2.0/24"), i}}));
+        EXPECT_NE(previous, nullptr);
+    }
+
+    done = true;
+    reader.join();
+    EXPECT_FALSE(failed);
+
+    std::uint32_t value;
+    ASSERT_TRUE(shared.load()->lookup(address, value));
+    EXPECT_EQ(value, 3u);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
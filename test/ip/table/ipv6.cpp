@@ -0,0 +1,130 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/ip/table.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+    std::optional<std::uint32_t> Reference(const std::vector<Cronz::IP::IPv6Route> &routes,
+                                           const Cronz::IP::IPv6Address &address) {
+        std::optional<std::uint32_t> value;
+        int prefix = -1;
+        for (const auto &route : routes) {
+            if (route.network.contains(address) && static_cast<int>(route.network.prefix) >= prefix) {
+                prefix = route.network.prefix;
+                value = route.value;
+            }
+        }
+
+        return value;
+    }
+}
+
+TEST(IPv6RouteTable, Lookup) {
+    const std::vector<Cronz::IP::IPv6Route> routes = {
+        {Cronz::IP::IPv6Network("2000::/3"), 0},
+        {Cronz::IP::IPv6Network("2001:db8::/32"), 1},
+        {Cronz::IP::IPv6Network("2001:db8:1::/48"), 2},
+        {Cronz::IP::IPv6Network("2001:db8:1:2::/64"), 3},
+        {Cronz::IP::IPv6Network("2001:db8:1:2:8000::/65"), 4},
+        {Cronz::IP::IPv6Network("2001:db8:1:2::1/128"), 5},
+        {Cronz::IP::IPv6Network("2001:db8:1::/48"), 6},
+    };
+
+    Cronz::IP::IPv6RouteTable table;
+    EXPECT_TRUE(table.empty());
+
+    std::uint32_t value = 99;
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv6Address("2001:db8::1"), value));
+    EXPECT_EQ(value, 99u);
+
+    ASSERT_TRUE(table.build(routes));
+    EXPECT_TRUE(table);
+    EXPECT_EQ(table.size(), routes.size());
+
+    const std::vector<std::pair<const char*, std::uint32_t>> list = {
+        {"2400:cb00::1", 0},
+        {"3fff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 0},
+        {"2001:db8:ffff::1", 1},
+        {"2001:db8:1:ffff::1", 6},
+        {"2001:db8:1:2::2", 3},
+        {"2001:db8:1:2:7fff:ffff:ffff:ffff", 3},
+        {"2001:db8:1:2:8000::", 4},
+        {"2001:db8:1:2::1", 5},
+    };
+
+    for (const auto &[address, expected] : list) {
+        ASSERT_TRUE(table.lookup(Cronz::IP::IPv6Address(address), value)) << address;
+        EXPECT_EQ(value, expected) << address;
+    }
+
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv6Address("4000::"), value));
+    EXPECT_FALSE(table.lookup(Cronz::IP::IPv6Address("::1"), value));
+
+    ASSERT_TRUE(table.build(std::vector<Cronz::IP::IPv6Route>{{Cronz::IP::IPv6Network("::/0"), 7}}));
+    ASSERT_TRUE(table.lookup(Cronz::IP::IPv6Address("::1"), value));
+    EXPECT_EQ(value, 7u);
+}
+
+TEST(IPv6RouteTable, Random) {
+    std::mt19937_64 random(5);
+
+    // Prefixes are drawn under a few /32s so that they nest, at every length down to /128.
+    const std::uint64_t bases[] = {0x20010DB800000000ull, 0x20010DB900000000ull, 0x2A00000000000000ull};
+
+    std::vector<Cronz::IP::IPv6Route> routes(2000);
+    for (auto i = static_cast<std::size_t>(0); i < routes.size(); ++i) {
+        Cronz::IP::IPv6Address address;
+        address.low64 = Cronz::Internal::NetworkToHost64(bases[random() % 3] | (random() & 0xFFFFull) << 16);
+        address.high64 = random();
+        routes[i] = {Cronz::IP::IPv6Network(address, static_cast<std::uint8_t>(16 + random() % 113)),
+                     static_cast<std::uint32_t>(i)};
+    }
+
+    const Cronz::IP::IPv6RouteTable table(routes);
+    ASSERT_FALSE(table.empty());
+
+    std::vector<Cronz::IP::IPv6Address> addresses(5000);
+    for (auto &address : addresses) {
+        // Half of the addresses are taken from within the routes.
+        if (0 == random() % 2) {
+            const auto &route = routes[random() % routes.size()];
+            const Cronz::IP::IPv6Address mask = route.network.mask();
+            address.low64 = route.network.address.low64 | (~mask.low64 & random());
+            address.high64 = route.network.address.high64 | (~mask.high64 & random());
+        }
+        else {
+            address.low64 = Cronz::Internal::NetworkToHost64(bases[random() % 3] | (random() & 0xFFFFFFFFull));
+            address.high64 = random();
+        }
+    }
+
+    std::vector<std::uint32_t> values(addresses.size());
+    const std::size_t found = table.lookup(addresses, values, UINT32_MAX);
+
+    std::size_t expectedFound = 0;
+    for (auto i = static_cast<std::size_t>(0); i < addresses.size(); ++i) {
+        const std::optional<std::uint32_t> expected = Reference(routes, addresses[i]);
+        expectedFound += expected.has_value();
+        EXPECT_EQ(values[i], expected.value_or(UINT32_MAX)) << addresses[i].stringify();
+    }
+
+    EXPECT_EQ(found, expectedFound);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/url.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+TEST(URL, Dataset) {
+    const std::vector<std::string> urls = {
+            "https://example.com/a/b?x=1#top",
+            "http://Example.com:8080/",
+            "https://cronz.dev/docs%20v1?q=url&list[]=1&list[]=2",
+            "ftp://127.0.0.1/file",
+    };
+
+    Cronz::URL::DatasetWriter writer;
+    for (const std::string &url : urls)
+        ASSERT_TRUE(writer.add(Cronz::URL::URL(url)));
+
+    EXPECT_EQ(writer.size(), urls.size());
+
+    std::vector<std::uint64_t> buffer(writer.serializedLength() / sizeof(std::uint64_t));
+    ASSERT_EQ(buffer.size() * sizeof(std::uint64_t), writer.serializedLength());
+    ASSERT_TRUE(writer.serialize(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+
+    Cronz::URL::DatasetReader reader;
+    ASSERT_TRUE(reader.attach(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+    ASSERT_EQ(reader.size(), urls.size());
+
+    EXPECT_EQ(reader.schemeCount(), 3);
+    EXPECT_EQ(reader.hostCount(), 3);
+    EXPECT_EQ(reader.hostIds()[0], reader.hostIds()[1]);
+    EXPECT_EQ(reader.hostTypeAt(reader.hostIds()[3]), '4');
+
+    EXPECT_EQ(reader.scheme(1), "http");
+    EXPECT_EQ(reader.host(1), "example.com");
+    EXPECT_EQ(reader.port(1), 8080);
+    EXPECT_EQ(reader.ports()[0], 0);
+
+    EXPECT_EQ(reader.path(0), "/a/b");
+    EXPECT_EQ(reader.query(0), "x=1");
+    EXPECT_EQ(reader.fragment(0), "top");
+
+    EXPECT_EQ(reader.path(1), "/");
+    EXPECT_TRUE(reader.query(1).empty());
+    EXPECT_TRUE(reader.fragment(1).empty());
+
+    EXPECT_EQ(reader.path(2), "/docs%20v1");
+    EXPECT_EQ(reader.query(2), "q=url&list[]=1&list[]=2");
+
+    EXPECT_TRUE(reader.host(urls.size()).empty());
+
+    // Memory-mapped file
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "cronz-test-url-dataset.bin";
+    ASSERT_TRUE(writer.save(path.string().c_str()));
+
+    Cronz::URL::DatasetReader mapped;
+    ASSERT_TRUE(mapped.open(path.string().c_str()));
+    ASSERT_EQ(mapped.size(), urls.size());
+
+    for (std::size_t i = 0; i < urls.size(); ++i) {
+        EXPECT_EQ(mapped.host(i), reader.host(i));
+        EXPECT_EQ(mapped.path(i), reader.path(i));
+    }
+
+    Cronz::URL::DatasetReader moved(std::move(mapped));
+    EXPECT_FALSE(mapped);
+    EXPECT_EQ(moved.scheme(3), "ftp");
+
+    moved.close();
+    std::filesystem::remove(path);
+
+    // Malformed input
+    buffer[2] = static_cast<std::uint64_t>(-1);
+    EXPECT_FALSE(reader.attach(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+    EXPECT_FALSE(reader);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,83 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/url.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(URL, Hash) {
+    // Equivalent URLs, different URL
+    const std::vector<std::tuple<std::vector<std::string>, std::string>> urls = {
+            {{"http://example.com/a/b?x=1", "HTTP://Example.COM/a/b?x=1", "http://example.com:80/a/b?x=1"},
+             "http://example.com:8080/a/b?x=1"},
+            {{"https://example.com/a%20b", "https://example.com/a%20b#fragment"}, "https://example.com/a/b"},
+    };
+
+    for (const auto &[equivalents, different] : urls) {
+        const Cronz::URL::URL url(equivalents[0]);
+        for (const std::string &equivalent : equivalents)
+            EXPECT_EQ(url.hash(), Cronz::URL::URL(equivalent).hash());
+
+        EXPECT_NE(url.hash(), Cronz::URL::URL(different).hash());
+        EXPECT_NE(url.hash(), url.hash(static_cast<std::uint64_t>(1)));
+    }
+
+    EXPECT_EQ(Cronz::URL::Host("Example.com").hash(), Cronz::URL::Host("example.COM").hash());
+}
+
+TEST(URL, BloomFilter) {
+    constexpr auto count = static_cast<std::size_t>(10000);
+
+    Cronz::URL::BloomFilter filter(count, 0.01);
+    ASSERT_TRUE(filter);
+
+    // Insertions report false positives too
+    auto present = static_cast<std::size_t>(0);
+    for (auto i = static_cast<std::size_t>(0); i < count; ++i)
+        present += filter.insert(Cronz::URL::URL("http://example.com/seen/" + std::to_string(i)));
+
+    EXPECT_LT(present, count / static_cast<std::size_t>(50));
+
+    for (auto i = static_cast<std::size_t>(0); i < count; ++i)
+        EXPECT_TRUE(filter.contains(Cronz::URL::URL("http://example.com:80/seen/" + std::to_string(i))));
+
+    auto falsePositives = static_cast<std::size_t>(0);
+    for (auto i = static_cast<std::size_t>(0); i < count; ++i)
+        falsePositives += filter.contains(Cronz::URL::URL("http://example.com/unseen/" + std::to_string(i)));
+
+    EXPECT_LT(falsePositives, count / static_cast<std::size_t>(50));
+
+    // Serialize and use the serialized form in place
+    std::vector<std::uint64_t> buffer(filter.serializedLength() / sizeof(std::uint64_t));
+    ASSERT_TRUE(filter.serialize(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+
+    Cronz::URL::BloomFilter attached;
+    ASSERT_TRUE(attached.attach(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+    EXPECT_EQ(filter.blockCount(), attached.blockCount());
+    EXPECT_EQ(filter.hashCount(), attached.hashCount());
+
+    for (auto i = static_cast<std::size_t>(0); i < count; ++i)
+        EXPECT_TRUE(attached.contains(Cronz::URL::URL("http://example.com/seen/" + std::to_string(i))));
+
+    EXPECT_FALSE(attached.insert(Cronz::URL::Host("new.example.com")));
+    EXPECT_TRUE(attached.contains(Cronz::URL::Host("NEW.example.com")));
+
+    buffer[0] = static_cast<std::uint64_t>(0);
+    EXPECT_FALSE(attached.attach(buffer.data(), buffer.size() * sizeof(std::uint64_t)));
+    EXPECT_FALSE(attached);
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,10 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
+#include <utility>
+
 TEST(URL, QueryField) {
     Cronz::URL::QueryField<true> field;
 
@@ -91,6 +95,35 @@ TEST(URL, QueryField) {
     EXPECT_FALSE(field.isArray());
 }
 
+TEST(URL, QueryManagerOverloads) {
+    using namespace std::string_view_literals;
+
+    Cronz::URL::QueryManager query;
+    ASSERT_NE(query.create("a"), nullptr);
+    ASSERT_NE(query.create("b"sv), nullptr);
+
+    std::string name = "a-long-field-name-that-is-not-stored-inline";
+    const char *storage = name.data();
+    const Cronz::URL::QueryField<false> *field = query.create(std::move(name));
+    ASSERT_NE(field, nullptr);
+    EXPECT_EQ(field->getName().data(), storage);
+
+    EXPECT_EQ(query.create("a"), query.get("a"sv));
+    EXPECT_TRUE(query.contains("b"sv));
+    EXPECT_TRUE(query.contains(std::string("a-long-field-name-that-is-not-stored-inline")));
+    EXPECT_EQ(std::as_const(query).get("c"), nullptr);
+
+    EXPECT_TRUE(query.remove("a"sv));
+    EXPECT_FALSE(query.contains("a"));
+    EXPECT_EQ(query.count(), static_cast<std::size_t>(2));
+
+    Cronz::URL::QueryField<true> renamable;
+    EXPECT_TRUE(renamable.setName("x"sv));
+    EXPECT_EQ(renamable.getName(), "x");
+    EXPECT_TRUE(renamable.setName(std::string("y")));
+    EXPECT_EQ(renamable.getName(), "y");
+}
+
 int main() {
     testing::InitGoogleTest();
     return RUN_ALL_TESTS();
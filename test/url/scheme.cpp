@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
 #include <vector>
 
 TEST(URL, Scheme) {
@@ -49,6 +51,21 @@ TEST(URL, Scheme) {
     }
 }
 
+TEST(URL, SchemeOverloads) {
+    Cronz::URL::Scheme scheme;
+    EXPECT_TRUE(scheme.setValue(std::string_view("wss://", 3)));
+    EXPECT_EQ(scheme.getValue(), "wss");
+
+    std::string value = "HTTPS";
+    EXPECT_TRUE(scheme.setValue(std::move(value)));
+    EXPECT_EQ(scheme.getValue(), "https");
+
+    std::string invalid = "+invalid";
+    EXPECT_FALSE(scheme.setValue(std::move(invalid)));
+    EXPECT_EQ(invalid, "+invalid");
+    EXPECT_EQ(scheme.getValue(), "https");
+}
+
 int main() {
     testing::InitGoogleTest();
     return RUN_ALL_TESTS();
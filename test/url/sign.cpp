@@ -0,0 +1,114 @@
+/*
+ * Cronz - https://lib.cronz.dev
+ *
+ * Copyright (c) 2024 - present. All rights reserved.
+ * Tuğrul Güngör - https://tugrulgungor.me
+ *
+ * Distributed under the MIT License.
+ * https://opensource.org/license/mit/
+ */
+
+#include <cronz/url.hpp>
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <string>
+
+namespace {
+    Cronz::URL::URLSigner MakeSigner(const std::string &key) {
+        Cronz::URL::URLSigner signer(std::as_bytes(std::span(key.data(), key.length())));
+        EXPECT_TRUE(signer.addField("expires"));
+        EXPECT_TRUE(signer.addField("user"));
+        return signer;
+    }
+}
+
+TEST(URL, Sign) {
+    const Cronz::URL::URLSigner signer = MakeSigner("secret");
+    Cronz::URL::URL url("https://cdn.example.com/videos/a%20b.mp4?expires=1700000000&user=42&x=1");
+
+    // The digest of the documented message, so that other implementations can produce the same signatures.
+    const Cronz::URL::URLSigner::Signature signature = signer.signature(url);
+    EXPECT_EQ(std::string(signature.data(), signature.size()), "Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy8");
+
+    EXPECT_FALSE(signer.verify(url));
+    ASSERT_TRUE(signer.sign(url));
+    EXPECT_TRUE(signer.verify(url));
+    EXPECT_EQ(url.query.get("signature")->value(), "Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy8");
+
+    // Signing again overwrites the signature, and the signature field is not signed.
+    ASSERT_TRUE(signer.sign(url));
+    EXPECT_TRUE(signer.verify(url));
+
+    // Parsed back from its string, and with the unsigned fields changed.
+    Cronz::URL::URL parsed(url.stringify());
+    EXPECT_TRUE(signer.verify(parsed));
+    ASSERT_TRUE(parsed.query.get("x")->setValue(2));
+    EXPECT_TRUE(signer.verify(parsed));
+
+    // Any change to the signed components, or another key.
+    const std::string signedURL = url.stringify();
+    for (const char *tampered : {"https://cdn.example.com/videos/a%20c.mp4", "https://cdn.example.com/videos/a",
+                                 "https://cdn.example.com/videos/a%20b.mp4/1080p", "https://cdn.example.com/"}) {
+        Cronz::URL::URL other(std::string(tampered) + signedURL.substr(signedURL.find('?')));
+        EXPECT_FALSE(signer.verify(other)) << tampered;
+    }
+
+    Cronz::URL::URL other(signedURL);
+    ASSERT_TRUE(other.query.get("expires")->setValue(1800000000));
+    EXPECT_FALSE(signer.verify(other));
+
+    other = Cronz::URL::URL(signedURL);
+    ASSERT_TRUE(other.query.remove("user"));
+    EXPECT_FALSE(signer.verify(other));
+
+    other = Cronz::URL::URL(signedURL);
+    ASSERT_TRUE(other.query.get("user")->addValue(std::string("43")));
+    EXPECT_FALSE(signer.verify(other));
+
+    EXPECT_FALSE(MakeSigner("secret2").verify(url));
+
+    // Truncated, altered or repeated signatures.
+    other = Cronz::URL::URL(signedURL);
+    ASSERT_TRUE(other.query.get("signature")->setValue(std::string("Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy")));
+    EXPECT_FALSE(signer.verify(other));
+    ASSERT_TRUE(other.query.get("signature")->setValue(std::string("Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy9")));
+    EXPECT_FALSE(signer.verify(other));
+    ASSERT_TRUE(other.query.get("signature")->setValue(std::string("Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy8")));
+    EXPECT_TRUE(signer.verify(other));
+    ASSERT_TRUE(other.query.get("signature")->addValue(std::string("Q400K5wGpVoZ3YpZGmMJVXRuSqEYkmbidY3rpUGqNy8")));
+    EXPECT_FALSE(signer.verify(other));
+}
+
+TEST(URL, Sign_Fields) {
+    const std::string key = "secret";
+    Cronz::URL::URLSigner signer(std::as_bytes(std::span(key.data(), key.length())), "sig");
+
+    EXPECT_EQ(signer.parameter(), "sig");
+    EXPECT_FALSE(signer.addField("sig"));
+    EXPECT_TRUE(signer.addField("a"));
+    EXPECT_TRUE(signer.addField("a"));
+    EXPECT_EQ(signer.fields().size(), static_cast<std::size_t>(1));
+
+    // A missing field differs from an empty one, and values are not joined ambiguously.
+    const Cronz::URL::URL missing("https://example.com/p");
+    const Cronz::URL::URL empty("https://example.com/p?a=");
+    const Cronz::URL::URL joined("https://example.com/p?a=1,2");
+    const Cronz::URL::URL array("https://example.com/p?a[]=1&a[]=2");
+    EXPECT_NE(signer.digest(missing), signer.digest(empty));
+    EXPECT_NE(signer.digest(joined), signer.digest(array));
+
+    // Path entries are length-prefixed, so an encoded slash is not a separator.
+    EXPECT_NE(signer.digest(Cronz::URL::URL("https://example.com/a%2Fb")),
+              signer.digest(Cronz::URL::URL("https://example.com/a/b")));
+
+    // Only the path and the selected fields are signed.
+    EXPECT_EQ(signer.digest(Cronz::URL::URL("https://example.com/p?a=1&b=2")),
+              signer.digest(Cronz::URL::URL("http://other.example.com:8080/p?b=3&a=1#fragment")));
+}
+
+int main() {
+    testing::InitGoogleTest();
+    return RUN_ALL_TESTS();
+}